@@ -10,6 +10,58 @@
 
 #include "HAL/ADC/ADC_Config.h"
 
+/*******************************************************************************
+ * API structures:
+ ******************************************************************************/
+/*
+ * Scan block callback.
+ *
+ * Notes:
+ * 		-	Called from ISR context, once per completed block. It must be short
+ * 			(i.e.: notify a consumer task).
+ *
+ * 		-	"pusBlock" is interleaved: sample of channel 'c' in scan 's' is
+ * 			"pusBlock[s * ucNumberOfChannels + c]". It is valid until the next
+ * 			block is completed.
+ */
+typedef void (*pfHOS_ADC_scanBlockCallback_t)(	void* pvParams,
+												const uint16_t* pusBlock,
+												uint32_t uiNumberOfScans	);
+
+/*
+ * Scan group. A list of channels that are converted in order, once per scan,
+ * at a timer triggered rate.
+ */
+typedef struct{
+	/*	Channels to be converted on every scan, in order	*/
+	const uint8_t* pucChannelArr;
+
+	/*
+	 * Sample time of each channel, in micro-second multiplied by ten (see
+	 * "vHOS_ADC_setSampleTime()").
+	 */
+	const uint32_t* puiSampleTimeArr;
+
+	uint8_t ucNumberOfChannels;
+
+	/*	Scans per second	*/
+	uint32_t uiScanFreq;
+
+	/*
+	 * Double buffer of (2 * uiScansPerBlock * ucNumberOfChannels) samples. It is
+	 * filled in circular manner, a block (half) at a time.
+	 */
+	uint16_t* pusBuffer;
+	uint32_t uiScansPerBlock;
+
+	/*	Optional, NULL if not used	*/
+	pfHOS_ADC_scanBlockCallback_t pfCallback;
+	void* pvCallbackParams;
+}xHOS_ADC_scanGroup_t;
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
 
 /*
  * Initializes SW driver.
@@ -120,4 +172,81 @@ void vHOS_ADC_initDmaSampling(	uint8_t ucUnitNumber,
 								uint8_t ucChannelSequenceLength
 								);
 
+/*
+ * Starts sampling a scan group.
+ *
+ * Notes:
+ * 		-	On targets with DMA, if the unit has a DMA request and its DMA
+ * 			channel is free, the group is programmed as the unit's regular
+ * 			sequence, and the timer unit configured in
+ * 			"pucPortADCTriggeringTimerUnitNumber[]" triggers it at "uiScanFreq".
+ * 			Channels of the same scan are then converted back to back, and a
+ * 			circular DMA transfer stores the samples in the scan group's buffer,
+ * 			with no interrupt but one per block (half transfer and transfer
+ * 			complete). At most "ucPORT_ADC_MAX_SEQUENCE_LENGTH" channels.
+ *
+ * 		-	Otherwise, conversions are triggered by the timer at a rate of
+ * 			(uiScanFreq * ucNumberOfChannels). Hence, channels of the same scan
+ * 			are sampled 1 / (uiScanFreq * ucNumberOfChannels) apart, and
+ * 			conversion time of every channel must be less than that. Sample of
+ * 			every conversion is stored in the buffer by the EOC ISR, which also
+ * 			selects the next channel.
+ *
+ * 		-	Either way, tasks are notified (and the callback is called) only
+ * 			once per block.
+ *
+ * 		-	ADC unit must be locked by the calling task, and remains dedicated to
+ * 			the scan group until "vHOS_ADC_stopScan()" is called (by the same
+ * 			task, as it releases the DMA channel).
+ *
+ * 		-	"pxGroup" and its arrays must remain valid until the scan is stopped.
+ *
+ * 		-	Returns 1 if started, 0 if the timer could not be set to the
+ * 			required rate.
+ */
+uint8_t ucHOS_ADC_startScan(uint8_t ucUnitNumber, const xHOS_ADC_scanGroup_t* pxGroup);
+
+/*
+ * Stops sampling of the current scan group, and restores SW triggering.
+ */
+void vHOS_ADC_stopScan(uint8_t ucUnitNumber);
+
+/*
+ * Blocks until a new block of the current scan group is completed, or timeout
+ * passes.
+ *
+ * Notes:
+ * 		-	Returns 1 if a block was completed, and writes its address to
+ * 			"ppusBlock". Returns 0 on timeout.
+ *
+ * 		-	Block must be consumed before the next one is completed (that is,
+ * 			within uiScansPerBlock / uiScanFreq seconds). Blocks that were
+ * 			completed while the previous one was not yet taken are counted by
+ * 			"uiHOS_ADC_getScanOverrunCount()".
+ */
+uint8_t ucHOS_ADC_blockUntilScanBlock(	uint8_t ucUnitNumber,
+										const uint16_t** ppusBlock,
+										TickType_t xTimeout	);
+
+/*
+ * Returns number of completed blocks that were not taken by
+ * "ucHOS_ADC_blockUntilScanBlock()" in time, since the scan was started.
+ */
+uint32_t uiHOS_ADC_getScanOverrunCount(uint8_t ucUnitNumber);
+
+/*
+ * Copies samples of a single channel out of an interleaved block.
+ *
+ * Notes:
+ * 		-	"ucChannelIndex" is the index of the channel in the scan group's
+ * 			"pucChannelArr" (not the channel number).
+ *
+ * 		-	"pusOut" must have a room of "uiNumberOfScans" samples.
+ */
+void vHOS_ADC_deinterleave(	const uint16_t* pusBlock,
+							uint8_t ucNumberOfChannels,
+							uint32_t uiNumberOfScans,
+							uint8_t ucChannelIndex,
+							uint16_t* pusOut	);
+
 #endif /* COTS_OS_INC_HAL_ADC_ADC_H_ */
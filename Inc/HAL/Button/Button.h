@@ -33,6 +33,9 @@
  * 					samples. (i.e.: "ucCurrentState" = "PRE_PRESSED")
  * 				3-	Button's level is "ucPressedLevel". for the "ucFilterN"th sample
  * 					in row. (i.e.: "ucCurrentState" = "PRESSED")
+ *
+ * 		-	Every button has its own task. For a large number of buttons, see
+ * 			"ButtonScanner.h", which scans all of them in a single task.
  */
 typedef struct{
 	/*		PRIVATE		*/
@@ -0,0 +1,156 @@
+/*
+ * ButtonScanner.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A single task that scans many buttons.
+ *
+ * Unlike "xHOS_Button_t", which has a task (and a stack) per button and reads
+ * its pin alone, a scanner handle has one task for all of its buttons. Every
+ * sample period, the task:
+ * 		-	Reads each of the used DIO ports at once, and debounces all of their
+ * 			pins in parallel (see "LIB/BinaryFilter/BinaryFilterVertical.h").
+ *
+ * 		-	Sends an event for every press and every release.
+ *
+ * 		-	Counts hold time of the pressed buttons only, and sends a long press
+ * 			event after "uiLongPressMs", followed by a repeat event every
+ * 			"uiRepeatPeriodMs" while the button remains pressed.
+ *
+ * Events of all buttons go to a single queue of the handle, in order of
+ * occurrence.
+ */
+
+#ifndef HAL_OS_INC_BUTTON_BUTTONSCANNER_H_
+#define HAL_OS_INC_BUTTON_BUTTONSCANNER_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+#include "HAL/Button/ButtonScanner_Config.h"
+
+/*	Event types	*/
+#define ucHOS_BUTTON_SCANNER_EVENT_PRESS			0
+#define ucHOS_BUTTON_SCANNER_EVENT_RELEASE			1
+#define ucHOS_BUTTON_SCANNER_EVENT_LONG_PRESS		2
+#define ucHOS_BUTTON_SCANNER_EVENT_REPEAT			3
+
+typedef struct{
+	/*	Index of the button in the handle's "pxButtonArr"	*/
+	uint8_t ucButton;
+
+	/*	One of "ucHOS_BUTTON_SCANNER_EVENT_xx"	*/
+	uint8_t ucEvent;
+}xHOS_ButtonScanner_event_t;
+
+/*
+ * Button connection.
+ *
+ * "ucPressedLevel": 0==> low level, 1==> high level.
+ */
+typedef struct{
+	uint8_t ucPortNumber;
+	uint8_t ucPinNumber;
+	uint8_t ucPressedLevel;
+}xHOS_ButtonScanner_button_t;
+
+typedef struct{
+	/*		PUBLIC		*/
+	const xHOS_ButtonScanner_button_t* pxButtonArr;
+	uint8_t ucNumberOfButtons;
+
+	uint32_t uiSamplePeriodMs;
+
+	/*
+	 * A level is accepted after (2 ^ "ucFilterCounterBits") samples in row.
+	 * (Range is: [1, 4])
+	 */
+	uint8_t ucFilterCounterBits;
+
+	/*	Zero disables long press (and repeat) events	*/
+	uint32_t uiLongPressMs;
+
+	/*	Zero disables repeat events	*/
+	uint32_t uiRepeatPeriodMs;
+
+	/*		PRIVATE		*/
+	/*	Used ports. Port 2k is at bits [0:15] of word k, port 2k+1 at [16:31]	*/
+	uint8_t pucPortNumberArr[uiCONF_BUTTON_SCANNER_MAX_PORTS];
+	uint8_t ucNumberOfPorts;
+
+	/*	Per word: mask of the used pins, and mask of the pressed-at-low ones	*/
+	uint32_t puiUsedMaskArr[(uiCONF_BUTTON_SCANNER_MAX_PORTS + 1) / 2];
+	uint32_t puiInvertMaskArr[(uiCONF_BUTTON_SCANNER_MAX_PORTS + 1) / 2];
+
+	/*	Filters, filtered level of a pin is 1 if its button is pressed	*/
+	xLIB_BinaryFilterVertical_t pxFilterArr[(uiCONF_BUTTON_SCANNER_MAX_PORTS + 1) / 2];
+
+	/*	Button index of each bit of the words	*/
+	uint8_t pucButtonIndexArr[((uiCONF_BUTTON_SCANNER_MAX_PORTS + 1) / 2) * 32];
+
+	/*	Bit 'i' is set if button 'i' is pressed	*/
+	volatile uint32_t uiPressedMask;
+
+	/*	Hold time (in samples) of the pressed buttons	*/
+	uint32_t puiHoldSamplesArr[uiCONF_BUTTON_SCANNER_MAX_BUTTONS];
+	uint32_t uiLongPressSamples;
+	uint32_t uiRepeatSamples;
+
+	uint32_t uiNumberOfLostEvents;
+
+	uint8_t pucEventQueueMemory[	uiCONF_BUTTON_SCANNER_EVENT_QUEUE_LEN *
+									sizeof(xHOS_ButtonScanner_event_t)	];
+	StaticQueue_t xEventQueueStatic;
+	QueueHandle_t xEventQueue;
+
+	StackType_t puxTaskStack[uiCONF_BUTTON_SCANNER_STACK_SIZE];
+	StaticTask_t xTaskStatic;
+	TaskHandle_t xTask;
+}xHOS_ButtonScanner_t;
+
+/*
+ * Initializes scanner handle.
+ *
+ * Notes:
+ * 		-	All public variables of the passed handle must be initialized to valid
+ * 			values first.
+ *
+ * 		-	Buttons must be connected to at most "uiCONF_BUTTON_SCANNER_MAX_PORTS"
+ * 			distinct ports, and no two buttons on the same pin.
+ *
+ * 		-	Returns 1 if initialized successfully, 0 otherwise.
+ *
+ * 		-	Must be called before scheduler start.
+ */
+uint8_t ucHOS_ButtonScanner_init(xHOS_ButtonScanner_t* pxHandle);
+
+/*
+ * Receives the oldest event of the handle's queue into "pxEvent".
+ *
+ * Returns 1 if an event was received, 0 if timeout passed first.
+ */
+uint8_t ucHOS_ButtonScanner_receiveEvent(	xHOS_ButtonScanner_t* pxHandle,
+											xHOS_ButtonScanner_event_t* pxEvent,
+											TickType_t xTimeout	);
+
+/*
+ * Reads button.
+ *
+ * Notes:
+ * 		-	Returns 1 if button is pressed (debounced), 0 otherwise.
+ *
+ * 		-	This function is inline.
+ */
+uint8_t ucHOS_ButtonScanner_isPressed(xHOS_ButtonScanner_t* pxHandle, uint8_t ucButton);
+
+/*
+ * Returns number of events that were lost, because the queue was full.
+ */
+uint32_t uiHOS_ButtonScanner_getNumberOfLostEvents(xHOS_ButtonScanner_t* pxHandle);
+
+
+
+#endif /* HAL_OS_INC_BUTTON_BUTTONSCANNER_H_ */
@@ -0,0 +1,33 @@
+/*
+ * ButtonScanner_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HAL_OS_INC_BUTTON_BUTTONSCANNER_CONFIG_H_
+#define HAL_OS_INC_BUTTON_BUTTONSCANNER_CONFIG_H_
+
+/*
+ * Maximum number of buttons scanned by one scanner handle (32 at most).
+ */
+#define uiCONF_BUTTON_SCANNER_MAX_BUTTONS			32
+
+/*
+ * Maximum number of distinct DIO ports the buttons of one scanner handle are
+ * connected to. Every two ports are debounced together as a 32-bit word.
+ */
+#define uiCONF_BUTTON_SCANNER_MAX_PORTS				4
+
+/*
+ * Length of the events queue of each scanner handle.
+ */
+#define uiCONF_BUTTON_SCANNER_EVENT_QUEUE_LEN		16
+
+/*
+ * Stack size of the scanner task.
+ */
+#define uiCONF_BUTTON_SCANNER_STACK_SIZE			128
+
+
+
+#endif /* HAL_OS_INC_BUTTON_BUTTONSCANNER_CONFIG_H_ */
@@ -9,12 +9,52 @@
 #ifndef CHARLCDI2C_H_
 #define CHARLCDI2C_H_
 
+/*
+ * Driver of character LCD (HD44780) connected through an I2C IO extender
+ * (PCF8574), in 4-bit mode.
+ *
+ * Frame API:
+ * 		-	Strings are written to a shadow frame in RAM, which costs no bus
+ * 			time. A refresh compares the frame with what is known to be on the
+ * 			LCD, and sends only the changed runs of characters.
+ *
+ * 		-	Each run (set address instruction followed by its characters) is
+ * 			encoded as the sequence of IO extender's bus values (nibbles and EN
+ * 			pulses), and sent in a single I2C transaction.
+ *
+ * 		-	No tick delays are needed between instructions. Every I2C byte takes
+ * 			a known time, hence the gap an instruction needs to execute is filled
+ * 			with enough idle bus values (see "CharLcdI2c_Config.h").
+ *
+ * 		-	If "uiRefreshPeriodMs" is non-zero, a task refreshes the LCD every
+ * 			"uiRefreshPeriodMs". Otherwise, user calls "vHOS_CharLcdI2c_refresh()".
+ *
+ * Print API (printChar, printStr) writes to the LCD directly, at cursor position.
+ * Printed characters are written to the frame as well, hence both APIs could be
+ * mixed.
+ */
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+
+#include "HAL/CharLcdI2c/CharLcdI2c_Config.h"
+
 
 #define ucHOS_CHAR_LCD_I2C_CURSOR_MODE_CURSOR_OFF_BLINK_OFF		0x0C
 #define ucHOS_CHAR_LCD_I2C_CURSOR_MODE_CURSOR_OFF_BLINK_ON		0x0D
 #define ucHOS_CHAR_LCD_I2C_CURSOR_MODE_CURSOR_ON_BLINK_OFF		0x0E
 #define ucHOS_CHAR_LCD_I2C_CURSOR_MODE_CURSOR_ON_BLINK_ON		0x0F
 
+/*
+ * Number of idle bus values after each instruction, such that (with the byte of
+ * the next EN pulse) the instruction has "uiCONF_CHAR_LCD_I2C_EXEC_TIME_US" to
+ * execute. An I2C byte takes 9 SCL periods.
+ */
+#define ucHOS_CHAR_LCD_I2C_PAD_BYTES												\
+	(	(	uiCONF_CHAR_LCD_I2C_EXEC_TIME_US * (uiCONF_CHAR_LCD_I2C_BUS_FREQ_HZ / 1000) +	\
+			8999	) / 9000 - 1	)
+
 typedef struct 
 {
 	/*			PUBLIC		*/
@@ -28,6 +68,9 @@ typedef struct
 	uint8_t ucPowerEnPort;
 	uint8_t ucPowerEnPin;
 
+	/*	Zero disables the refresh task	*/
+	uint32_t uiRefreshPeriodMs;
+
 	/*
 	 * Mutex of the LCD handle (Should be locked before using and unlocked after,
 	 * not using this mutex is user's responsibility).
@@ -41,9 +84,32 @@ typedef struct
 
 	/*	Current position of the cursor	*/
 	uint8_t ucCursorPos;
+
+	/*	Shadow frame, and what is currently on the LCD	*/
+	char pcFrameArr[ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS][ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS];
+	char pcGlassArr[ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS][ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS];
+
+	/*
+	 * Bus values of a run (set address instruction, and a full row), plus two
+	 * RS setup values (at the instruction, and at the first character).
+	 */
+	uint8_t pucTxArr[	(ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS + 1) * (4 + ucHOS_CHAR_LCD_I2C_PAD_BYTES) +
+						2	];
+
+	StackType_t puxTaskStack[uiCONF_CHAR_LCD_I2C_STACK_SIZE];
+	StaticTask_t xTaskStatic;
+	TaskHandle_t xTask;
 }xHOS_CharLcdI2c_t;
 
 
+/*
+ * Initializes handle and LCD.
+ *
+ * Notes:
+ * 		-	All public variables of handle must be initially set.
+ *
+ * 		-	Frame is initially blank (spaces).
+ */
 void vHOS_CharLcdI2c_init(xHOS_CharLcdI2c_t* pxHandle);
 
 void vHOS_CharLcdI2c_reInit(xHOS_CharLcdI2c_t* pxHandle);
@@ -52,9 +118,53 @@ void vHOS_CharLcdI2c_setCursorMode(xHOS_CharLcdI2c_t* pxHandle, uint8_t ucMode);
 
 void vHOS_CharLcdI2c_clearDisplay(xHOS_CharLcdI2c_t* pxHandle);
 
+/*
+ * Prints a character at cursor position, and advances the cursor.
+ *
+ * Notes:
+ * 		-	Character is written to the frame too. When cursor passes the last
+ * 			row, both the LCD and the frame are cleared.
+ *
+ * 		-	Prints use the bus, cursor and frame, which the refresh task uses as
+ * 			well. Hence if "uiRefreshPeriodMs" is non-zero, handle's mutex must be
+ * 			locked while printing.
+ */
 void vHOS_CharLcdI2c_printChar(xHOS_CharLcdI2c_t* pxHandle, char cCh);
 
+/*
+ * Prints a null terminated string using "vHOS_CharLcdI2c_printChar()". (Same
+ * notes apply)
+ */
 void vHOS_CharLcdI2c_printStr(xHOS_CharLcdI2c_t* pxHandle, char* pcStr);
 
+/*
+ * Writes string to the shadow frame, starting at ("ucRow", "ucCol").
+ *
+ * Notes:
+ * 		-	String is clipped at end of the row.
+ *
+ * 		-	LCD is not changed until next refresh.
+ */
+void vHOS_CharLcdI2c_writeStr(	xHOS_CharLcdI2c_t* pxHandle,
+								uint8_t ucRow,
+								uint8_t ucCol,
+								const char* pcStr	);
+
+/*
+ * Fills the shadow frame with spaces.
+ */
+void vHOS_CharLcdI2c_clearFrame(xHOS_CharLcdI2c_t* pxHandle);
+
+/*
+ * Sends the changed runs of the shadow frame to the LCD.
+ *
+ * Notes:
+ * 		-	A run that fails to be sent is retried on next refresh.
+ *
+ * 		-	Handle's mutex must be locked, like any other function of this driver.
+ * 			(The refresh task locks it on its own)
+ */
+void vHOS_CharLcdI2c_refresh(xHOS_CharLcdI2c_t* pxHandle);
+
 
 #endif /* CHARLCDI2C_H_ */
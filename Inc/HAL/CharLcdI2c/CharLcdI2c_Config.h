@@ -0,0 +1,43 @@
+/*
+ * CharLcdI2c_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef CHARLCDI2C_CONFIG_H_
+#define CHARLCDI2C_CONFIG_H_
+
+/*
+ * Display size.
+ */
+#define ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS			4
+#define ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS			20
+
+/*
+ * Fastest SCL frequency the LCD's I2C unit may be configured with (in Hz). Gaps
+ * between LCD instructions are counted in I2C bytes of this rate, so a slower
+ * bus only makes them longer.
+ */
+#define uiCONF_CHAR_LCD_I2C_BUS_FREQ_HZ				400000
+
+/*
+ * Execution time of an LCD instruction (in us), other than clear and return
+ * home. (37us at 270KHz LCD oscillator, with margin for slower oscillators)
+ */
+#define uiCONF_CHAR_LCD_I2C_EXEC_TIME_US			50
+
+/*
+ * Maximum number of unchanged characters between two changed ones, such that
+ * they are sent in a single run. (Skipping a gap costs a set address instruction,
+ * which takes as much as a character does)
+ */
+#define ucCONF_CHAR_LCD_I2C_MAX_RUN_GAP				1
+
+/*
+ * Stack size of the refresh task.
+ */
+#define uiCONF_CHAR_LCD_I2C_STACK_SIZE				128
+
+
+
+#endif /* CHARLCDI2C_CONFIG_H_ */
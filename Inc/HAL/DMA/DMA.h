@@ -98,23 +98,77 @@ uint8_t ucHOS_DMA_blockUntilHalfTransferComplete(	uint8_t ucUnitNumber,
 													uint8_t ucChannelNumber,
 													TickType_t xTimeout	);
 
-///*
-// * Clears transfer complete flag (SW Semaphore, not physical flag).
-// *
-// * Notes:
-// * 		-	TC flags must be cleared before starting a transfer.
-// */
-//void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
-//											uint8_t ucChannelNumber	);
-//
-///*
-// * Clears transfer half complete flag (SW Semaphore, not physical flag).
-// *
-// * Notes:
-// * 		-	THC flags must be cleared before starting a transfer.
-// */
-//void vHOS_DMA_clearTransferHalfCompleteFlag(	uint8_t ucUnitNumber,
-//											uint8_t ucChannelNumber	);
+/*
+ * Clears transfer complete flag (SW Semaphore, not physical flag).
+ *
+ * Notes:
+ * 		-	TC flags must be cleared before starting a transfer.
+ */
+void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber	);
+
+/*
+ * Clears transfer half complete flag (SW Semaphore, not physical flag).
+ *
+ * Notes:
+ * 		-	THC flags must be cleared before starting a transfer.
+ */
+void vHOS_DMA_clearTransferHalfCompleteFlag(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber	);
+
+/*
+ * Sets a function to be called (from ISR) on every transfer complete of a
+ * channel, after its TC flag (semaphore) is given.
+ *
+ * Notes:
+ * 		-	The channel must be previously locked by the calling task.
+ *
+ * 		-	Passing NULL removes the callback. It must be removed before the
+ * 			channel is released.
+ *
+ * 		-	Useful for drivers which chain transfers back to back, without a
+ * 			task waiting on each of them.
+ */
+void vHOS_DMA_setTransferCompleteCallback(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber,
+											void (*pfCallback)(void*),
+											void* pvParams	);
+
+/*
+ * Sets a function to be called (from ISR) on every transfer half complete of a
+ * channel, after its THC flag (semaphore) is given.
+ *
+ * Notes:
+ * 		-	Same as "vHOS_DMA_setTransferCompleteCallback()".
+ *
+ * 		-	With circular mode, half complete and complete callbacks tell which
+ * 			half of the memory array was just filled (or sent), while the other
+ * 			half is being transferred.
+ */
+void vHOS_DMA_setTransferHalfCompleteCallback(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber,
+												void (*pfCallback)(void*),
+												void* pvParams	);
+
+/*
+ * Returns number of data units remaining in the current transfer (or the
+ * current cycle, in circular mode) of a channel.
+ *
+ * Notes:
+ * 		-	Useful to find how far a circular peripheral to memory transfer has
+ * 			written, without waiting for a half or complete event.
+ */
+uint32_t uiHOS_DMA_getRemainingCount(uint8_t ucUnitNumber, uint8_t ucChannelNumber);
+
+/*
+ * Stops a transfer of a channel.
+ *
+ * Notes:
+ * 		-	A circular transfer runs until it is stopped by this function.
+ *
+ * 		-	The channel must be previously locked by the calling task.
+ */
+void vHOS_DMA_stopTransfer(uint8_t ucUnitNumber, uint8_t ucChannelNumber);
 
 /*
  * Releases a previously locked channel.
@@ -10,6 +10,11 @@
 #ifndef COTS_OS_INC_HAL_EEPROM_EEPROM_H_
 #define COTS_OS_INC_HAL_EEPROM_EEPROM_H_
 
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+#include "HAL/EEPROM/EEPROM_Config.h"
+
 typedef struct{
 	/*	PUBLIC	*/
 	uint8_t ucI2cUnitNumber;
@@ -17,6 +22,38 @@ typedef struct{
 	uint8_t ucWriteEnablePort;
 	uint8_t ucWriteEnablePin;
 	uint32_t uiSizeInBytes;
+
+	/*
+	 * Page size in bytes, as in EEPROM's datasheet (i.e.: 32 for 24C32, 64 for
+	 * 24C256). Must be a power of two, and not larger than
+	 * "uiCONF_EEPROM_MAX_PAGE_SIZE".
+	 */
+	uint16_t usPageSize;
+
+	/*
+	 * Optional write-back cache.
+	 *
+	 * If "uiCacheSizeInBytes" is non-zero, the EEPROM region
+	 * [0, uiCacheSizeInBytes) is mirrored in "pucCacheArr" (allocated by user).
+	 * Writes to this region only update the RAM copy and mark the changed pages
+	 * as dirty. Dirty pages are written to the EEPROM, one page write each, by
+	 * "ucHOS_EEPROM_flush()".
+	 *
+	 * "uiCacheSizeInBytes" must be a multiple of "usPageSize", and not more than
+	 * 64 pages.
+	 */
+	uint8_t* pucCacheArr;
+	uint32_t uiCacheSizeInBytes;
+
+	/*	PRIVATE	*/
+	StaticSemaphore_t xMutexStatic;
+	SemaphoreHandle_t xMutex;
+
+	/*	Address bytes followed by a page of data	*/
+	uint8_t pucFrame[2 + uiCONF_EEPROM_MAX_PAGE_SIZE];
+
+	uint64_t ulDirtyPagesBitmap;
+	uint8_t ucIsCacheLoaded;
 }xHOS_EEPROM_t;
 
 /*
@@ -24,17 +61,37 @@ typedef struct{
  *
  * Notes:
  * 		-	All public parameters must be initialized first.
+ *
+ * 		-	Cache (if used) is loaded from the EEPROM on the first read / write
+ * 			access.
  */
 void vHOS_EEPROM_init(xHOS_EEPROM_t* pxHandle);
 
+/*
+ * Locks handle's mutex.
+ */
+uint8_t ucHOS_EEPROM_lock(xHOS_EEPROM_t* pxHandle, TickType_t xTimeout);
+
+/*
+ * Unlocks handle's mutex.
+ */
+void vHOS_EEPROM_unlock(xHOS_EEPROM_t* pxHandle);
+
 /*
  * Write data buffer to selectable address at EEPROM.
  *
  * Notes:
  * 		-	Handle's mutex must be locked first by the calling task.
  *
+ * 		-	Data is written in page-aligned chunks (up to a page per I2C
+ * 			transaction). Completion of each page's write cycle is detected by
+ * 			ACK polling.
+ *
+ * 		-	Data in the cached region (if any) is written to the cache only. (See
+ * 			"ucHOS_EEPROM_flush()")
+ *
  * 		-	If function's parameters exceed maximum defined size of the handle,
- * 			or EEPROM stops responding, function returns 0.
+ * 			EEPROM stops responding, or "xTimeout" passes, function returns 0.
  *
  * 		-	Otherwise, function returns 1.
  */
@@ -50,8 +107,11 @@ uint8_t ucHOS_EEPROM_write(	xHOS_EEPROM_t* pxHandle,
  * Notes:
  * 		-	Handle's mutex must be locked first by the calling task.
  *
+ * 		-	Data is read in a single sequential read transaction. Data in the
+ * 			cached region (if any) is copied from the cache.
+ *
  * 		-	If function's parameters exceed maximum defined size of the handle,
- * 			or EEPROM stops responding, function returns 0.
+ * 			EEPROM stops responding, or "xTimeout" passes, function returns 0.
  *
  * 		-	Otherwise, function returns 1.
  */
@@ -61,4 +121,16 @@ uint8_t ucHOS_EEPROM_read(	xHOS_EEPROM_t* pxHandle,
 							uint32_t uiStartingAddress,
 							TickType_t xTimeout	);
 
+/*
+ * Writes dirty pages of the cache to the EEPROM.
+ *
+ * Notes:
+ * 		-	Handle's mutex must be locked first by the calling task.
+ *
+ * 		-	Returns 1 if all dirty pages were written (or cache is not used).
+ * 			Otherwise, if EEPROM stops responding or "xTimeout" passes, returns 0,
+ * 			and pages that were not written remain dirty.
+ */
+uint8_t ucHOS_EEPROM_flush(xHOS_EEPROM_t* pxHandle, TickType_t xTimeout);
+
 #endif /* COTS_OS_INC_HAL_EEPROM_EEPROM_H_ */
@@ -0,0 +1,24 @@
+/*
+ * EEPROM_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COTS_OS_INC_HAL_EEPROM_EEPROM_CONFIG_H_
+#define COTS_OS_INC_HAL_EEPROM_EEPROM_CONFIG_H_
+
+/*
+ * Largest page size (in bytes) of the used EEPROMs. Each handle reserves a
+ * frame buffer of this size (plus 2 address bytes).
+ */
+#define uiCONF_EEPROM_MAX_PAGE_SIZE			64
+
+/*
+ * Period (in ms) between two successive ACK polls while waiting for the
+ * internal write cycle of a page to be completed.
+ */
+#define uiCONF_EEPROM_ACK_POLLING_PERIOD_MS	1
+
+
+
+#endif /* COTS_OS_INC_HAL_EEPROM_EEPROM_CONFIG_H_ */
@@ -11,6 +11,7 @@
 #include "FreeRTOS.h"
 #include "RTOS_PRI_Config.h"
 #include "HAL/Button/Button.h"
+#include "HAL/Button/ButtonScanner.h"
 #include "HAL/SevenSegmentMux/SevenSegmentMux.h"
 #include "HAL/DMA/DMA.h"
 #include "HAL/SPI/SPI.h"
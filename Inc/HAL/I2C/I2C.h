@@ -8,6 +8,8 @@
 #ifndef COTS_OS_INC_HAL_I2C_I2C_H_
 #define COTS_OS_INC_HAL_I2C_I2C_H_
 
+#include "FreeRTOS.h"
+
 typedef struct{
 	uint8_t ucUnitNumber;
 	uint16_t usAddress;
@@ -18,14 +20,45 @@ typedef struct{
 	uint32_t uiRxSize;
 }xHOS_I2C_transreceiveParams_t;
 
+/*
+ * Initializes I2C units' driver objects and interrupts.
+ *
+ * Notes:
+ * 		-	Must be called once before scheduler start, and before using any of
+ * 			the following functions.
+ */
+void vHOS_I2C_init(void);
+
 void vHOS_I2C_enable(uint8_t ucUnitNumber);
 
 void vHOS_I2C_disable(uint8_t ucUnitNumber);
 
 /*
- * To avoid resulting in bus error (case multi-masters are on the bus), this function
- * must be a critical section.
- * ("taskENTER_CRITICAL()" and "taskEXIT_CRITICAL()" are called inside)
+ * Performs a master transaction: writes "uiTxSize" bytes, then (if "uiRxSize"
+ * is non-zero) reads "uiRxSize" bytes after a repeated start.
+ *
+ * Notes:
+ * 		-	Transaction is interrupt driven. The calling task is blocked (not
+ * 			polling) until the transaction is completed, failed, or timed out.
+ *
+ * 		-	Multiple tasks may call this function on the same unit. Transactions
+ * 			are queued on the unit's mutex, in the order of their tasks'
+ * 			priorities, and executed one at a time.
+ *
+ * 		-	"xTimeout" covers both waiting in the queue and the transaction
+ * 			itself. On timeout, the transaction is aborted and a stop condition
+ * 			is generated.
+ *
+ * 		-	Returns 1 if transaction is completed successfully. Returns 0 if
+ * 			timed out, address or data was not acknowledged, or a bus error /
+ * 			arbitration loss occurred.
+ */
+uint8_t ucHOS_I2C_masterTransReceiveTimeout(	xHOS_I2C_transreceiveParams_t* pxParams,
+												TickType_t xTimeout	);
+
+/*
+ * Same as "ucHOS_I2C_masterTransReceiveTimeout()", with a timeout of
+ * "uiCONF_I2C_DEFAULT_TIMEOUT_MS".
  */
 uint8_t ucHOS_I2C_masterTransReceive(xHOS_I2C_transreceiveParams_t* pxParams);
 
@@ -0,0 +1,19 @@
+/*
+ * I2C_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COTS_OS_INC_HAL_I2C_I2C_CONFIG_H_
+#define COTS_OS_INC_HAL_I2C_I2C_CONFIG_H_
+
+/*
+ * Timeout (in ms) of a transaction started by "ucHOS_I2C_masterTransReceive()".
+ * Includes time of waiting for the unit to be free (other tasks' transactions)
+ * and time of the transaction itself.
+ */
+#define uiCONF_I2C_DEFAULT_TIMEOUT_MS			100
+
+
+
+#endif /* COTS_OS_INC_HAL_I2C_I2C_CONFIG_H_ */
@@ -13,10 +13,42 @@
  *
  * This driver is to be "extern" in "port_DIO", to achieve seamless output
  * port interface.
+ *
+ * Chain:
+ * 		-	Output registers (i.e.: 74HC595) and input registers (i.e.: 74HC165)
+ * 			are daisy-chained, and share the same clock. Whole chain is
+ * 			transferred at once (one SPI burst), output bits go out on MOSI (or
+ * 			data pin) while input bits come in on MISO (or input data pin).
+ *
+ * 		-	Register 0 is the one connected to the MCU. Pin (8 * i + b) is bit
+ * 			'b' of register 'i' (For 74HC165: A is bit 0, H is bit 7).
+ *
+ * Writing:
+ * 		-	Pin writes edit a shadow copy of the output chain. In immediate flush
+ * 			mode, each write is followed by a transfer of the chain (as if it was
+ * 			a normal DIO port). In deferred flush mode, writes only mark the
+ * 			shadow copy dirty, and all of them are transferred by the next flush
+ * 			(or by the auto-refresh task).
+ *
+ * Reading:
+ * 		-	Inputs are sampled (parallel loaded) at the beginning of every
+ * 			transfer. Read functions return levels of the last sample.
+ *
+ * Auto-refresh:
+ * 		-	If "uiRefreshPeriodMs" is non-zero, a task transfers the whole chain
+ * 			every "uiRefreshPeriodMs", whether dirty or not. Hence, outputs
+ * 			corrupted by noise are restored, and inputs are periodically sampled.
  */
 
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
+
+#include "HAL/IOExtend/OExtendShiftRegister_Config.h"
+
+/*	Flush modes	*/
+#define ucHOS_OEXTEND_SHIFT_REGISTER_FLUSH_MODE_IMMEDIATE		0
+#define ucHOS_OEXTEND_SHIFT_REGISTER_FLUSH_MODE_DEFERRED		1
 
 typedef struct{
 	/*	PUBLIC	*/
@@ -27,44 +59,126 @@ typedef struct{
 	 */
 	uint8_t ucSpiUnitNumber;
 
-	/*	Used only when no HW SPI unit is used	*/
+	/*
+	 * Used only when no HW SPI unit is used. Bits are banged by the CPU, with no
+	 * delays. Pins must be of the MCU's own DIO ports.
+	 */
 	uint8_t ucSckPort;
 	uint8_t ucSckPin;
 	uint8_t ucDataPort;
 	uint8_t ucDataPin;
+	uint8_t ucInDataPort;
+	uint8_t ucInDataPin;
 
-	uint8_t ucRegisterSizeInBytes; // maximum: 4-bytes
+	/*
+	 * Number of output registers in the chain. (Maximum is:
+	 * "uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN")
+	 */
+	uint8_t ucRegisterSizeInBytes;
 
 	uint8_t ucLatchPort;
 	uint8_t ucLatchPin;
 
+	/*
+	 * Number of input registers in the chain, zero if there's none. (Maximum
+	 * is: "uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN")
+	 */
+	uint8_t ucInputRegisterSizeInBytes;
+
+	/*	Parallel load pin of the input registers (active low)	*/
+	uint8_t ucLoadPort;
+	uint8_t ucLoadPin;
+
+	/*	One of "ucHOS_OEXTEND_SHIFT_REGISTER_FLUSH_MODE_xx"	*/
+	uint8_t ucFlushMode;
+
+	/*	Zero disables the auto-refresh task	*/
+	uint32_t uiRefreshPeriodMs;
+
 	/*	Private (May only be used by this driver and lower layer DIO driver	*/
-	uint32_t uiCurrentOutputWord;
+	uint8_t pucOutputArr[uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN];
+	uint8_t pucInputArr[uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN];
+	uint8_t pucRxArr[uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN];
+	uint8_t ucIsDirty;
 
 	SemaphoreHandle_t xMutex;
 	StaticSemaphore_t xMutexStatic;
+
+	StackType_t puxTaskStack[uiCONF_OEXTEND_SHIFT_REGISTER_STACK_SIZE];
+	StaticTask_t xTaskStatic;
+	TaskHandle_t xTask;
 }xHOS_OExtendShiftRegister_t;
 
 /*
  * Initializes handle.
  *
  * Notes:
- * 		-	All public variables of handle must be initially set.
+ * 		-	All public variables of handle must be initially set. (Zero
+ * 			"ucFlushMode" and "uiRefreshPeriodMs" keep the driver working as a
+ * 			normal DIO port)
  *
  * 		-	SPI unit must be initialized first.
+ *
+ * 		-	Outputs are initially low.
  */
 void vHOS_OExtendShiftRegister_init(xHOS_OExtendShiftRegister_t* pxHandle);
 
+/*
+ * Writes output pin.
+ *
+ * Notes:
+ * 		-	"ucPinNumber" is in the range: [0, 8 * ucRegisterSizeInBytes - 1].
+ *
+ * 		-	Transfers the chain in immediate flush mode only.
+ */
 void vHOS_OExtendShiftRegister_writePin(
 		xHOS_OExtendShiftRegister_t* pxHandle,
 		uint8_t ucPinNumber,
 		uint8_t ucVal	);
 
+/*
+ * Writes output pins [0, 31] at once.
+ *
+ * Notes:
+ * 		-	Pins of the set bits of "uiMask" are written with their bits in "uiVal".
+ *
+ * 		-	Transfers the chain in immediate flush mode only.
+ */
 void vHOS_OExtendShiftRegister_writePort(
 		xHOS_OExtendShiftRegister_t* pxHandle,
 		uint32_t uiMask,
 		uint32_t uiVal	);
 
+/*
+ * Transfers the chain if any output was written since last transfer.
+ *
+ * (Used in deferred flush mode, to apply all pending writes in one burst)
+ */
+void vHOS_OExtendShiftRegister_flush(xHOS_OExtendShiftRegister_t* pxHandle);
+
+/*
+ * Transfers the chain, whether dirty or not. Outputs are rewritten and inputs
+ * are sampled.
+ */
+void vHOS_OExtendShiftRegister_refresh(xHOS_OExtendShiftRegister_t* pxHandle);
+
+/*
+ * Returns level of input pin, as of the last transfer.
+ *
+ * "ucPinNumber" is in the range: [0, 8 * ucInputRegisterSizeInBytes - 1].
+ */
+uint8_t ucHOS_OExtendShiftRegister_readInputPin(
+		xHOS_OExtendShiftRegister_t* pxHandle,
+		uint8_t ucPinNumber	);
+
+/*
+ * Returns levels of input pins [0, 31], as of the last transfer.
+ *
+ * (Level of pin 'i' is in bit 'i')
+ */
+uint32_t uiHOS_OExtendShiftRegister_readInputPort(
+		xHOS_OExtendShiftRegister_t* pxHandle	);
+
 
 
 
@@ -0,0 +1,23 @@
+/*
+ * OExtendShiftRegister_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COTS_OS_INC_HAL_IOEXTEND_OEXTENDSHIFTREGISTER_CONFIG_H_
+#define COTS_OS_INC_HAL_IOEXTEND_OEXTENDSHIFTREGISTER_CONFIG_H_
+
+/*
+ * Maximum number of daisy-chained registers (bytes) of one handle. Applies to
+ * output and input chains each.
+ */
+#define uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN			8
+
+/*
+ * Stack size of the auto-refresh task.
+ */
+#define uiCONF_OEXTEND_SHIFT_REGISTER_STACK_SIZE			128
+
+
+
+#endif /* COTS_OS_INC_HAL_IOEXTEND_OEXTENDSHIFTREGISTER_CONFIG_H_ */
@@ -3,12 +3,44 @@
  *
  *  Created on: Feb 4, 2024
  *      Author: Ali Emad
+ *
+ * Keypad matrix scanner.
+ *
+ * Scanning is driven by a HW timer. On every timer overflow, the ISR samples
+ * all rows of the currently driven column (which has settled since the
+ * previous overflow), and drives the next column. No delays are made, and no
+ * task is used.
+ *
+ * Every complete scan is debounced as a bitmap of all keys, and press / release
+ * events of the keys whose debounced states have changed are sent to the
+ * handle's events queue. See "KeypadScan.h" for n-key rollover and ghosting.
  */
 
 #ifndef COTS_OS_INC_HAL_KEYPAD_KEYPAD_H_
 #define COTS_OS_INC_HAL_KEYPAD_KEYPAD_H_
 
+#include "FreeRTOS.h"
+#include "queue.h"
+
 #include "HAL/Keypad/Keypad_Conf.h"
+#include "HAL/Keypad/KeypadScan.h"
+
+/*	Event types	*/
+#define ucHOS_KEYPAD_EVENT_PRESS		0
+#define ucHOS_KEYPAD_EVENT_RELEASE		1
+
+/*
+ * Keys pressed form an ambiguous pattern, debounced states are held until it
+ * is resolved. ("cKey" is '\0')
+ */
+#define ucHOS_KEYPAD_EVENT_GHOSTING		2
+
+typedef struct{
+	char cKey;
+
+	/*	One of "ucHOS_KEYPAD_EVENT_xx"	*/
+	uint8_t ucEvent;
+}xHOS_Keypad_event_t;
 
 typedef struct{
 	/*		PUBLIC		*/
@@ -37,24 +69,33 @@ typedef struct{
 
 	/*
 	 * Debouncing delay in ms.
+	 * (A key state is accepted after being the same for this time)
 	 */
 	uint32_t uiMsDebouncingDelay;
 
 	/*
-	 * Settling delay.
-	 * (Minimum time required until signal on one the pins settles)
+	 * Settling delay in us, which is the time each column is driven for.
+	 * (Minimum time required until signal on one the pins settles). Range is:
+	 * [1, 65536].
+	 *
+	 * Rows are pulled up by the internal pull-ups only, hence release of a
+	 * column (rising edge of its rows) is the slowest to settle.
 	 */
-	uint32_t uiMsSettlingDelay;
+	uint32_t uiUsSettlingDelay;
+
+	/*	Timer unit used for scanning (dedicated to this handle)	*/
+	uint8_t ucTimerUnitNumber;
 
 	/*		PRIVATE		*/
-	char cLastPressedKey;
+	xHOS_KeypadScan_t xScan;
 
-	SemaphoreHandle_t xNewPressedKeySemphr;
-	StaticSemaphore_t xNewPressedKeySemphrStatic;
+	uint8_t ucIsGhosting;
 
-	TaskHandle_t xTask;
-	StaticTask_t xTaskStatic;
-	StackType_t puxTaskStack[configMINIMAL_STACK_SIZE];
+	uint32_t uiNumberOfLostEvents;
+
+	uint8_t pucEventQueueMemory[ucCONF_KEYPAD_EVENT_QUEUE_LEN * sizeof(xHOS_Keypad_event_t)];
+	StaticQueue_t xEventQueueStatic;
+	QueueHandle_t xEventQueue;
 }xHOS_Keypad_t;
 
 /*
@@ -62,6 +103,15 @@ typedef struct{
  *
  * Notes:
  * 		-	All public variables of keypad handle must be initialized first.
+ *
+ * 		-	("ucNRows" * "ucNCols") must not exceed
+ * 			"ucCONF_KEYPAD_MAX_NUMBER_OF_KEYS".
+ *
+ * 		-	Rows are pulled-up inputs. Columns are open-drain outputs, driven
+ * 			low one at a time, while the others are released (high-impedance).
+ * 			Hence row and column pins must be of native (not extended) ports.
+ *
+ * 		-	Timer interrupts must be enabled in "Port_Interrupt.h".
  */
 void vHOS_Keypad_init(xHOS_Keypad_t* pxHandle);
 
@@ -74,25 +124,33 @@ void vHOS_Keypad_init(xHOS_Keypad_t* pxHandle);
  *
  * 		-	Otherwise, if timeout passes while no buttons were pressed, function
  * 			returns 0.
+ *
+ * 		-	Events other than presses that are received while waiting are
+ * 			discarded.
  */
 uint8_t ucHOS_Keypad_waitKey(	xHOS_Keypad_t* pxHandle,
 								char* pcButtonVal,
 								TickType_t xTimeout	);
 
+/*
+ * Receives the oldest event of the handle's queue into "pxEvent".
+ *
+ * Returns 1 if an event was received, 0 if timeout passed first.
+ */
+uint8_t ucHOS_Keypad_receiveEvent(	xHOS_Keypad_t* pxHandle,
+									xHOS_Keypad_event_t* pxEvent,
+									TickType_t xTimeout	);
 
+/*
+ * Returns map of debounced pressed keys. Bit (row * "ucNCols" + col) is set if
+ * key of that row and column is pressed.
+ */
+uint32_t uiHOS_Keypad_getPressedMap(xHOS_Keypad_t* pxHandle);
 
-
-
-
-
-
-
-
-
-
-
-
-
+/*
+ * Returns number of events that were lost, because the queue was full.
+ */
+uint32_t uiHOS_Keypad_getNumberOfLostEvents(xHOS_Keypad_t* pxHandle);
 
 
 
@@ -0,0 +1,105 @@
+/*
+ * KeypadScan.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Scan engine of "Keypad".
+ *
+ * A scan drives the columns one at a time, and samples all rows of each column
+ * at once. After the last column, the raw map of the scan (bit "row * NCols +
+ * col" is set if the key is pressed) is debounced with all other keys in
+ * parallel (see "LIB/BinaryFilter/BinaryFilterVertical.h").
+ *
+ * Ghosting:
+ * 		-	In a keypad of no diodes, pressing three keys at the corners of a
+ * 			rectangle connects the fourth corner too, which then reads pressed.
+ *
+ * 		-	A raw map is ambiguous if two of its rows have two or more common
+ * 			columns. Such scans are not passed to the filter, debounced keys
+ * 			keep their states until an unambiguous scan comes.
+ *
+ * 		-	Otherwise, any number of simultaneously pressed keys are detected
+ * 			(n-key rollover).
+ *
+ * This module depends on nothing but "stdint.h" (and "BinaryFilterVertical"),
+ * so it could be built on a host machine to simulate scans.
+ */
+
+#ifndef COTS_OS_INC_HAL_KEYPAD_KEYPADSCAN_H_
+#define COTS_OS_INC_HAL_KEYPAD_KEYPADSCAN_H_
+
+#include "stdint.h"
+
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+/*	Maximum number of keys (rows * columns)	*/
+#define ucHOS_KEYPAD_SCAN_MAX_KEYS		32
+
+/*	Return values of "ucHOS_KeypadScan_sample()"	*/
+#define ucHOS_KEYPAD_SCAN_IN_PROGRESS		0
+#define ucHOS_KEYPAD_SCAN_COMPLETE			1
+#define ucHOS_KEYPAD_SCAN_GHOSTING			2
+
+typedef struct{
+	/*		PRIVATE		*/
+	uint8_t ucNRows;
+	uint8_t ucNCols;
+	uint32_t uiColMask;
+
+	/*	Column sampled next	*/
+	uint8_t ucCol;
+
+	/*	Raw map of the current scan	*/
+	uint32_t uiRawMap;
+
+	xLIB_BinaryFilterVertical_t xFilter;
+}xHOS_KeypadScan_t;
+
+/*
+ * Initializes scan engine.
+ *
+ * Notes:
+ * 		-	("ucNRows" * "ucNCols") must not exceed "ucHOS_KEYPAD_SCAN_MAX_KEYS".
+ * 		-	A key state is accepted after (2 ^ "ucFilterCounterBits") scans in
+ * 			row. (Range is: [1, 4])
+ * 		-	First column to be sampled is column 0.
+ */
+void vHOS_KeypadScan_init(	xHOS_KeypadScan_t* pxHandle,
+							uint8_t ucNRows,
+							uint8_t ucNCols,
+							uint8_t ucFilterCounterBits	);
+
+/*
+ * Adds samples of the rows of the current column (bit 'i' is set if row 'i' is
+ * active), and moves to the next column.
+ *
+ * Notes:
+ * 		-	Returns one of "ucHOS_KEYPAD_SCAN_xx".
+ *
+ * 		-	If scan is complete, "puiChanged" is set to mask of the keys whose
+ * 			debounced states have changed. Otherwise, it is not changed.
+ *
+ * 		-	Column to be driven for the next sample is "pxHandle->ucCol".
+ */
+uint8_t ucHOS_KeypadScan_sample(	xHOS_KeypadScan_t* pxHandle,
+									uint32_t uiRows,
+									uint32_t* puiChanged	);
+
+/*
+ * Returns map of debounced pressed keys.
+ */
+static inline uint32_t uiHOS_KeypadScan_getPressedMap(xHOS_KeypadScan_t* pxHandle)
+{
+	return pxHandle->xFilter.uiLevelsFiltered;
+}
+
+/*
+ * Checks whether a raw map is ambiguous (see ghosting notes above).
+ */
+uint8_t ucHOS_KeypadScan_isGhosting(	uint32_t uiRawMap,
+										uint8_t ucNRows,
+										uint8_t ucNCols	);
+
+
+
+#endif /* COTS_OS_INC_HAL_KEYPAD_KEYPADSCAN_H_ */
@@ -8,7 +8,24 @@
 #ifndef COTS_OS_INC_HAL_KEYPAD_KEYPAD_CONF_H_
 #define COTS_OS_INC_HAL_KEYPAD_KEYPAD_CONF_H_
 
-#define ucCONF_KEYPAD_MAX_NUMBER_OF_SIMULTANEOUSLY_PRESSED_KEYS		3
+/*
+ * Maximum number of keys ("ucNRows" * "ucNCols") of a keypad handle. Must not
+ * exceed "ucHOS_KEYPAD_SCAN_MAX_KEYS".
+ */
+#define ucCONF_KEYPAD_MAX_NUMBER_OF_KEYS		16
+
+/*
+ * Maximum length of the events queue of a keypad handle. A handle of N keys
+ * uses a queue of (2 * N + 1) events, which holds a press and a release event
+ * of every key (n-key rollover), and a ghosting event.
+ */
+#define ucCONF_KEYPAD_EVENT_QUEUE_LEN	\
+	(2 * ucCONF_KEYPAD_MAX_NUMBER_OF_KEYS + 1)
+
+/*
+ * Priority of the scanning timer interrupt.
+ */
+#define ucCONF_KEYPAD_TIMER_PRI		(configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1)
 
 
 
@@ -8,19 +8,21 @@
 #ifndef COTS_OS_INC_HAL_MPU6050_MPU6050_H_
 #define COTS_OS_INC_HAL_MPU6050_MPU6050_H_
 
-/*	Manufacturing error drift. Used units are milli-g or milli-dps	*/
-typedef struct{
-	int32_t iX;
-	int32_t iY;
-	int32_t iZ;
-}xHOS_MPU6050_drift_t;
+#include "FreeRTOS.h"
+#include "semphr.h"
 
-/*	Measurement in milli	*/
-typedef struct{
-	int32_t iX;
-	int32_t iY;
-	int32_t iZ;
-}xHOS_MPU6050_measurement_t;
+#include "HAL/MPU6050/MPU6050_Config.h"
+#include "HAL/MPU6050/MPU6050_Decoder.h"
+
+#include "LIB/AttitudeEstimator/AttitudeEstimator.h"
+
+/*
+ * FIFO consumer callback. Executed in the handle's task context with a batch of
+ * decoded frames, oldest first.
+ */
+typedef void (*pfHOS_MPU6050_fifoCallback_t)(	void* pvParams,
+												const xHOS_MPU6050_frame_t* pxFrameArr,
+												uint32_t uiNumberOfFrames	);
 
 /*
  * Module structure.
@@ -38,8 +40,8 @@ typedef struct{
 	uint8_t ucIsIntConnected : 1;
 
 	/*
-	 * DIO pin connected to MPU6050's INT pin.
-	 * (Used only when tilt calculation is enabled, otherwise it is ignored).
+	 * DIO pin connected to MPU6050's INT pin. Must be an EXTI capable pin.
+	 * (Used only when INT pin is connected, otherwise it is ignored).
 	 */
 	uint8_t ucIntPort : 4;
 	uint8_t ucIntPin  : 4;
@@ -57,7 +59,7 @@ typedef struct{
 	xHOS_MPU6050_drift_t xAccelDrift;
 
 	/*
-	 * Tilt angles in micro-degrees.
+	 * Tilt angles in micro-degrees. (iX: roll, iY: pitch, iZ: yaw)
 	 * ("micro" to not miss small changes and also not use floating point)
 	 * (Read only, and valid only when tilt calculation is enabled)
 	 */
@@ -67,9 +69,32 @@ typedef struct{
 	int16_t sGyroFSR;
 	int16_t sAccelFSR;
 
-	xHOS_MPU6050_measurement_t xPrevGyroMeasurement;
+	xLIB_AttitudeEstimator_t xEstimator;
+
+	uint8_t ucIsTiltEnabled;
+	uint8_t ucIsFifoEnabled;
+
+	/*
+	 * INT pulses are counted by the EXTI callback, the task is woken once every
+	 * "usIntsPerWakeup" pulses.
+	 */
+	uint16_t usIntsPerWakeup;
+	uint16_t usIntCount;
 
-	StackType_t puxTaskStack[configMINIMAL_STACK_SIZE];
+	pfHOS_MPU6050_fifoCallback_t pfFifoCallback;
+	void* pvFifoCallbackParams;
+
+	/*	Number of times FIFO was reset due to overflow	*/
+	uint32_t uiFifoOverflowCount;
+
+	uint8_t pucFifoRawArr[	uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST *
+							uiHOS_MPU6050_FRAME_SIZE	];
+	xHOS_MPU6050_frame_t pxFifoFrameArr[uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST];
+
+	SemaphoreHandle_t xIntSemaphore;
+	StaticSemaphore_t xIntSemaphoreStatic;
+
+	StackType_t puxTaskStack[uiCONF_MPU6050_TASK_STACK_SIZE];
 	StaticTask_t xTaskStatic;
 	TaskHandle_t xTask;
 }xHOS_MPU6050_t;
@@ -138,6 +163,8 @@ uint8_t ucHOS_MPU6050_setClockSource(xHOS_MPU6050_t* pxHandle, uint8_t ucSource)
  * 			function. otherwise, calibration won't be done properly.
  *
  * 		-	INT pin must be connected and initialized.
+ *
+ * 		-	Tilt calculation and FIFO mode must be disabled.
  */
 uint8_t ucHOS_MPU6050_calibrate(xHOS_MPU6050_t* pxHandle);
 
@@ -148,6 +175,8 @@ uint8_t ucHOS_MPU6050_calibrate(xHOS_MPU6050_t* pxHandle);
  * 		-	Sample rate must be first set to 1kHz.
  * 		-	INT pin must be connected and "ucIntPort", "ucIntPin" must be initialized.
  * 		-	Tilt calculation is initially disabled.
+ * 		-	Tilt calculation and FIFO mode are mutually exclusive. Returns 0 if
+ * 			FIFO mode is enabled.
  */
 uint8_t ucHOS_MPU6050_enableTiltCalculation(xHOS_MPU6050_t* pxHandle);
 
@@ -159,6 +188,47 @@ uint8_t ucHOS_MPU6050_enableTiltCalculation(xHOS_MPU6050_t* pxHandle);
  */
 void vHOS_MPU6050_disableTiltCalculation(xHOS_MPU6050_t* pxHandle);
 
+/*
+ * Enables FIFO mode.
+ *
+ * The MPU6050 buffers accel, temperature and gyro samples in its FIFO, at the
+ * sample rate set by "ucHOS_MPU6050_confLpdfAndSampleRate()" (up to 1kHz).
+ * The handle's task is woken by the INT pin once every "uiFramesPerBurst"
+ * samples, reads all available frames in one I2C transaction (up to
+ * "uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST" at a time), decodes them, and
+ * passes them to "pfCallback".
+ *
+ * Notes:
+ * 		-	This function must be called after scheduler start.
+ * 		-	INT pin must be connected and "ucIntPort", "ucIntPin" must be initialized.
+ * 		-	"uiFramesPerBurst" is in the range from 1 to
+ * 			"uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST".
+ * 		-	"pfCallback" runs in the handle's task context, it must not block for
+ * 			long, otherwise FIFO may overflow. On overflow, FIFO is reset (its
+ * 			content is lost) and "uiFifoOverflowCount" is incremented.
+ * 		-	Accel and gyro full scale ranges and drifts are sampled when frames
+ * 			are decoded. They better not be changed while FIFO mode is enabled.
+ * 		-	Returns 0 if tilt calculation is enabled, or on I2C failure.
+ */
+uint8_t ucHOS_MPU6050_enableFifo(	xHOS_MPU6050_t* pxHandle,
+									uint32_t uiFramesPerBurst,
+									pfHOS_MPU6050_fifoCallback_t pfCallback,
+									void* pvParams	);
+
+/*
+ * Disables FIFO mode.
+ *
+ * Notes:
+ * 		-	This function must be called after scheduler start.
+ * 		-	FIFO mode is initially disabled.
+ */
+uint8_t ucHOS_MPU6050_disableFifo(xHOS_MPU6050_t* pxHandle);
+
+/*
+ * Returns number of times FIFO was reset due to overflow.
+ */
+uint32_t uiHOS_MPU6050_getFifoOverflowCount(xHOS_MPU6050_t* pxHandle);
+
 /*
  * Enters debugger mode, which gives user chance to easily read / write registers
  * of the MPU6050 using OCD.
@@ -236,7 +306,11 @@ uint8_t ucHOS_MPU6050_confLpdfAndSampleRate(	xHOS_MPU6050_t* pxHandle,
 												uint8_t ucDiv);
 
 /*
- * Busy waits until INT pin is high (data is ready).
+ * Blocks until INT pin signals that new data is ready.
+ *
+ * Notes:
+ * 		-	INT pin must be connected, and MPU6050 object must be enabled.
+ * 		-	Tilt calculation and FIFO mode must be disabled.
  */
 void vHOS_MPU6050_waitDataReadyInt(xHOS_MPU6050_t* pxHandle);
 
@@ -269,6 +343,14 @@ uint8_t ucHOS_MPU6050_readAccelMeasurement(	xHOS_MPU6050_t* pxHandle,
 uint8_t ucHOS_MPU6050_readTemperatureMeasurement(	xHOS_MPU6050_t* pxHandle,
 													int32_t* piTemp	);
 
+/*
+ * Reads accel, temperature and gyro measurements in one I2C transaction.
+ *
+ * (Units are the same as the three functions above)
+ */
+uint8_t ucHOS_MPU6050_readFrame(	xHOS_MPU6050_t* pxHandle,
+									xHOS_MPU6050_frame_t* pxFrame	);
+
 
 
 
@@ -0,0 +1,41 @@
+/*
+ * MPU6050_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COTS_OS_INC_HAL_MPU6050_MPU6050_CONFIG_H_
+#define COTS_OS_INC_HAL_MPU6050_MPU6050_CONFIG_H_
+
+/*
+ * Maximum number of frames read from the FIFO in one I2C transaction. Each
+ * handle reserves a raw buffer of 14 bytes per frame, and a decoded frames
+ * array of the same length.
+ *
+ * (FIFO of the MPU6050 is 1024 bytes, i.e.: 73 full frames)
+ */
+#define uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST		16
+
+/*
+ * Stack size of the handle's task. FIFO consumer callback is executed in
+ * this task's context.
+ */
+#define uiCONF_MPU6050_TASK_STACK_SIZE					(configMINIMAL_STACK_SIZE)
+
+/*
+ * Maximum time (in ms) the handle's task waits for an INT pulse before reading
+ * the FIFO anyway. (Recovers from a missed pulse)
+ */
+#define uiCONF_MPU6050_INT_TIMEOUT_MS					100
+
+/*
+ * Tilt calculation period (in ms), and gains of its attitude estimator.
+ * (See "LIB/AttitudeEstimator/AttitudeEstimator.h")
+ */
+#define uiCONF_MPU6050_TILT_PERIOD_MS					4
+#define fCONF_MPU6050_TILT_KP							(1.0f)
+#define fCONF_MPU6050_TILT_KI							(0.01f)
+
+
+
+#endif /* COTS_OS_INC_HAL_MPU6050_MPU6050_CONFIG_H_ */
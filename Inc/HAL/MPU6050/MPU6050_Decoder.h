@@ -0,0 +1,82 @@
+/*
+ * MPU6050_Decoder.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Decoder of raw MPU6050 sample frames.
+ *
+ * A frame is the 14 bytes block: ACCEL_XOUT_H ... GYRO_ZOUT_L (accel, temperature,
+ * gyro. Big-endian), which is the layout of both the data registers and the
+ * FIFO when accel, temperature and gyro are all enabled in "FIFO_EN".
+ *
+ * This module depends on nothing but "stdint.h", so it could be built on a host
+ * machine and fed with recorded FIFO dumps.
+ */
+
+#ifndef COTS_OS_INC_HAL_MPU6050_MPU6050_DECODER_H_
+#define COTS_OS_INC_HAL_MPU6050_MPU6050_DECODER_H_
+
+#include "stdint.h"
+
+/*	Size of a raw frame in bytes	*/
+#define uiHOS_MPU6050_FRAME_SIZE		14
+
+/*	Manufacturing error drift. Used units are milli-g or milli-dps	*/
+typedef struct{
+	int32_t iX;
+	int32_t iY;
+	int32_t iZ;
+}xHOS_MPU6050_drift_t;
+
+/*	Measurement in milli	*/
+typedef struct{
+	int32_t iX;
+	int32_t iY;
+	int32_t iZ;
+}xHOS_MPU6050_measurement_t;
+
+/*	Decoded frame	*/
+typedef struct{
+	/*	milli-g	*/
+	xHOS_MPU6050_measurement_t xAccel;
+
+	/*	milli-dps	*/
+	xHOS_MPU6050_measurement_t xGyro;
+
+	/*	milli-degree C	*/
+	int32_t iTemp;
+}xHOS_MPU6050_frame_t;
+
+/*
+ * Scaling of the decoded frames. (Snapshot of the handle's configuration)
+ */
+typedef struct{
+	/*	Full scale ranges in g and dps respectively	*/
+	int16_t sAccelFSR;
+	int16_t sGyroFSR;
+
+	xHOS_MPU6050_drift_t xAccelDrift;
+	xHOS_MPU6050_drift_t xGyroDrift;
+}xHOS_MPU6050_scale_t;
+
+/*
+ * Decodes "uiNumberOfFrames" consecutive raw frames from "pucRawArr" into
+ * "pxFrameArr".
+ *
+ * Notes:
+ * 		-	Conversion and drift subtraction are the same as those of
+ * 			"ucHOS_MPU6050_readAccelMeasurement()",
+ * 			"ucHOS_MPU6050_readGyroMeasurement()" and
+ * 			"ucHOS_MPU6050_readTemperatureMeasurement()".
+ *
+ * 		-	"pucRawArr" must be at least "uiNumberOfFrames" *
+ * 			"uiHOS_MPU6050_FRAME_SIZE" bytes long.
+ */
+void vHOS_MPU6050_decodeFrames(	const xHOS_MPU6050_scale_t* pxScale,
+								const uint8_t* pucRawArr,
+								uint32_t uiNumberOfFrames,
+								xHOS_MPU6050_frame_t* pxFrameArr	);
+
+
+
+#endif /* COTS_OS_INC_HAL_MPU6050_MPU6050_DECODER_H_ */
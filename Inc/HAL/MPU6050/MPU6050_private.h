@@ -104,6 +104,31 @@
 #define MPU6050_REG_FIFO_R_W                             (0x74)
 #define MPU6050_REG_WHO_AM_I                             (0x75)
 
+/*******************************************************************************
+ * Registers bits:
+ ******************************************************************************/
+/*	FIFO_EN	*/
+#define MPU6050_FIFO_EN_TEMP							(1u << 7)
+#define MPU6050_FIFO_EN_XG								(1u << 6)
+#define MPU6050_FIFO_EN_YG								(1u << 5)
+#define MPU6050_FIFO_EN_ZG								(1u << 4)
+#define MPU6050_FIFO_EN_ACCEL							(1u << 3)
+
+/*	INT_PIN_CFG	*/
+#define MPU6050_INT_PIN_CFG_LATCH_INT_EN				(1u << 5)
+#define MPU6050_INT_PIN_CFG_INT_RD_CLEAR				(1u << 4)
+
+/*	INT_ENABLE	*/
+#define MPU6050_INT_ENABLE_FIFO_OFLOW					(1u << 4)
+#define MPU6050_INT_ENABLE_DATA_RDY						(1u << 0)
+
+/*	USER_CTRL	*/
+#define MPU6050_USER_CTRL_FIFO_EN						(1u << 6)
+#define MPU6050_USER_CTRL_FIFO_RESET					(1u << 2)
+
+/*	Size of the FIFO in bytes	*/
+#define MPU6050_FIFO_SIZE								(1024)
+
 /*******************************************************************************
  * Helping structures:
  ******************************************************************************/
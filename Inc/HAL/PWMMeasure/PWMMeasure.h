@@ -15,6 +15,21 @@
  *
  * Test on STM32F103C8T6: maximum measurable frequency is about 15kHZ. (The number
  * may be less, based on CPU load of the application program).
+ *
+ * Capture backend:
+ * 		-	Uses a timer unit in PWM input mode. Timer captures period and active
+ * 			time of every cycle in HW, hence no edge timestamping jitter.
+ *
+ * 		-	A single short ISR per period accumulates "uiNumberOfAveragedPeriods"
+ * 			periods, and publishes their sum. No task is woken, and no 64-bit
+ * 			operations are made in the ISR. Duty and frequency are averaged over
+ * 			these periods when read.
+ *
+ * 		-	Signal is considered idle (0Hz, 0% or 100% duty) when the timer
+ * 			counter overflows without a rising edge.
+ *
+ * 		-	The EXTI backend remains available for signals on pins that are not
+ * 			connected to a free timer channel.
  */
 
 #ifndef COTS_OS_INC_HAL_PWMMEASURE_PWMMEASURE_H_
@@ -22,11 +37,22 @@
 
 #include "HAL/PWMMeasure/PWMMeasure_Config.h"
 
+#define ucHOS_PWM_MEASURE_BACKEND_EXTI			0
+#define ucHOS_PWM_MEASURE_BACKEND_CAPTURE		1
+
 typedef struct{
 	/*	PUBLIC	*/
+	/*	For capture backend, this must be the pin of channel 1 of the timer	*/
 	uint8_t ucPort;
 	uint8_t ucPin;
 
+	/*	One of "ucHOS_PWM_MEASURE_BACKEND_xx"	*/
+	uint8_t ucBackend;
+
+	/*	Capture backend only	*/
+	uint8_t ucTimerUnitNumber;
+	uint16_t usNumberOfAveragedPeriods;
+
 	/*	PRIVATE	*/
 	TaskHandle_t xTask;
 	StackType_t pxTaskStack[configMINIMAL_STACK_SIZE];
@@ -40,6 +66,18 @@ typedef struct{
 	uint32_t uiActiveTime;
 	uint32_t uiNumberOfIdlePeriods;
 	uint8_t ucPrevEdge;
+
+	/*	Capture backend accumulators (of the current averaging window)	*/
+	uint32_t uiCapPeriodSum;
+	uint32_t uiCapActiveSum;
+	uint16_t usCapCount;
+	uint8_t ucCapIsIdle;
+
+	/*	Capture backend published window (count is 0 if signal is idle)	*/
+	volatile uint32_t uiCapPeriodSumPublished;
+	volatile uint32_t uiCapActiveSumPublished;
+	volatile uint16_t usCapCountPublished;
+	volatile uint8_t ucCapIdleLevel;
 }xHOS_PWMDutyMeasure_t;
 
 
@@ -47,14 +85,21 @@ typedef struct{
  * Initializes handle.
  *
  * Notes:
- * 		-	"HWTime" driver must be initialized first.
- *
  * 		-	Configurations in "PWMMeasure_Config.h" must be set to valid values.
  *
- * 		-	"ucPort" & "ucPin" of the passed handle must be set to valid values.
+ * 		-	"ucPort", "ucPin" and "ucBackend" of the passed handle must be set to
+ * 			valid values.
  *
- * 		-	EXTI interrupts must be enabled in "Port_Interrupt.h".
- * 			(i.e.: define the "ucPORT_INTERRUPT_IRQ_DEF_EXTI" macro)
+ * 		-	EXTI backend:
+ * 			-	"HWTime" driver must be initialized first.
+ * 			-	EXTI interrupts must be enabled in "Port_Interrupt.h".
+ * 				(i.e.: define the "ucPORT_INTERRUPT_IRQ_DEF_EXTI" macro)
+ *
+ * 		-	Capture backend:
+ * 			-	"ucTimerUnitNumber" and "usNumberOfAveragedPeriods" (1 or more)
+ * 				must be set. Timer unit is dedicated to the handle.
+ * 			-	Timer interrupts must be enabled in "Port_Interrupt.h".
+ * 				(i.e.: define the "ucPORT_INTERRUPT_IRQ_DEF_TIM" macro)
  */
 void vHOS_PWMMeasure_init(xHOS_PWMDutyMeasure_t* pxHandle);
 
@@ -66,6 +111,9 @@ void vHOS_PWMMeasure_init(xHOS_PWMDutyMeasure_t* pxHandle);
  *
  * 		-	If the input signal is too fast to be handled, this function returns
  * 			maximum duty.
+ *
+ * 		-	Capture backend: averaged over the latest completed window of
+ * 			"usNumberOfAveragedPeriods" periods.
  */
 uint32_t uiHOS_PWMMeasure_getDuty(xHOS_PWMDutyMeasure_t* pxHandle);
 
@@ -75,6 +123,9 @@ uint32_t uiHOS_PWMMeasure_getDuty(xHOS_PWMDutyMeasure_t* pxHandle);
  * Notes:
  * 		-	If the input signal is too fast to be handled, this function returns
  * 			maximum frequency.
+ *
+ * 		-	Capture backend: averaged over the latest completed window of
+ * 			"usNumberOfAveragedPeriods" periods.
  */
 uint32_t uiHOS_PWMMeasure_getFreq(xHOS_PWMDutyMeasure_t* pxHandle);
 
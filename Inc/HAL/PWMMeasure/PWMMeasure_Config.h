@@ -18,5 +18,17 @@
  */
 #define uiCONF_PWM_MEASURE_NUMBR_OF_IDLE_PEERIODS_TILL_ZERO_HZ		(10)
 
+/*
+ * Capture backend timer clock. Prescaler is one of "uiPORT_TIM_PRESCALER_FOR_xx",
+ * and frequency is the corresponding "uiPORT_TIM_FREQ_ACTUAL_FOR_xx".
+ *
+ * Measurable frequency range is: [FREQ / 2^16, FREQ / 100] (for a 16-bit timer
+ * and a duty resolution of 1%).
+ */
+#define uiCONF_PWM_MEASURE_CAPTURE_PRESCALER		(uiPORT_TIM_PRESCALER_FOR_1_MHZ)
+#define uiCONF_PWM_MEASURE_CAPTURE_FREQ				(uiPORT_TIM_FREQ_ACTUAL_FOR_1_MHZ)
+
+#define uiCONF_PWM_MEASURE_CAPTURE_PRI		(configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1)
+
 
 #endif /* COTS_OS_INC_HAL_PWMMEASURE_PWMMEASURE_CONFIG_H_ */
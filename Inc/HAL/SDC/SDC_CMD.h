@@ -84,6 +84,17 @@ uint8_t ucHOS_SDC_setBlockLen(xHOS_SDC_t* pxSdc, uint32_t uiLen);
  ******************************************************************************/
 uint8_t ucHOS_SDC_writeCrcEnable(xHOS_SDC_t* pxSdc, uint8_t ucCrcEnable);
 
+/*******************************************************************************
+ * Sets number of blocks to be pre-erased before the next multiple block write
+ * (ACMD23).
+ *
+ * Notes:
+ * 		-	Unlike "ucHOS_SDC_sendAcmd()", this function is used after the SDC
+ * 			has left idle state.
+ ******************************************************************************/
+uint8_t ucHOS_SDC_setWriteBlockEraseCount(	xHOS_SDC_t* pxSdc,
+											uint32_t uiNumberOfBlocks	);
+
 
 
 
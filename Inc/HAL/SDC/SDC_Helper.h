@@ -54,6 +54,20 @@ typedef struct{
 	uint8_t ucIsModified;
 }xHOS_SDC_Block_Buffer_t;
 
+/*******************************************************************************
+ * Cluster chain extent (run of clusters which are contiguous on the SDC)
+ ******************************************************************************/
+typedef struct{
+	/*	Index (in the file's cluster chain) of the first cluster in the extent	*/
+	uint32_t uiFirstClusterIndex;
+
+	/*	Cluster number of the first cluster in the extent	*/
+	uint32_t uiFirstClusterNumber;
+
+	/*	Number of clusters in the extent	*/
+	uint32_t uiNumberOfClusters;
+}xHOS_SDC_Extent_t;
+
 
 
 
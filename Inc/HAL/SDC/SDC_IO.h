@@ -49,6 +49,39 @@ uint8_t ucHOS_SDC_keepTryingReadBlock(	xHOS_SDC_t* pxSdc,
 										uint32_t uiBlockNumber,
 										TickType_t xTimeout	);
 
+/*
+ * Reads "uiNumberOfBlocks" consecutive data blocks (512 bytes each) from the
+ * SD-card into "pucArr", using a single multiple block read command (CMD18),
+ * terminated by "STOP_TRANSMISSION" (CMD12).
+ *
+ * Returns 1 if read successfully, 0 otherwise.
+ *
+ * Notes:
+ * 		-	"pucArr" must be at least "512 * uiNumberOfBlocks" bytes long.
+ */
+uint8_t ucHOS_SDC_readMultipleBlocks(	xHOS_SDC_t* pxSdc,
+										uint8_t* pucArr,
+										uint32_t uiFirstBlockNumber,
+										uint32_t uiNumberOfBlocks,
+										TickType_t xTimeout	);
+
+/*
+ * Writes "uiNumberOfBlocks" consecutive data blocks (512 bytes each) from
+ * "pucArr" into the SD-card, using a single multiple block write command (CMD25),
+ * terminated by the "Stop Tran" token.
+ *
+ * Returns 1 if written successfully, 0 otherwise.
+ *
+ * Notes:
+ * 		-	If "configHOS_SDC_PRE_ERASE_EN" is 1, number of blocks is hinted to
+ * 			the SD-card (ACMD23) first, so that it could pre-erase them.
+ */
+uint8_t ucHOS_SDC_writeMultipleBlocks(	xHOS_SDC_t* pxSdc,
+										uint8_t* pucArr,
+										uint32_t uiFirstBlockNumber,
+										uint32_t uiNumberOfBlocks,
+										TickType_t xTimeout	);
+
 
 
 
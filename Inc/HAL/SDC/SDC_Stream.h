@@ -25,6 +25,18 @@ typedef struct{
 	/*	Stream's buffer	*/
 	xHOS_SDC_Block_Buffer_t xBuffer;
 
+	/*
+	 * Cluster chain cache. Extents are sorted by cluster index, and cover the
+	 * first "uiNumberOfCachedClusters" clusters of the file.
+	 */
+	xHOS_SDC_Extent_t pxExtentArr[configHOS_SDC_STREAM_EXTENT_CACHE_SIZE];
+	uint32_t uiNumberOfExtents;
+	uint32_t uiNumberOfCachedClusters;
+
+	/*	Last resolved (cluster index, cluster number) pair	*/
+	uint32_t uiLastClusterIndex;
+	uint32_t uiLastClusterNumber;
+
 	/*		PUBLIC		*/
 	/*	pointer to the SDC handle on which this stream is located. (set only once)	*/
 	xHOS_SDC_t* pxSdc;
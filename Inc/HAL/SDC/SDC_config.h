@@ -16,6 +16,28 @@
 
 #define configHOS_SDC_INIT_LOOP_TIMEOUT_MS			((uint32_t)10000)
 
+/*
+ * Stream reads/writes which span at least this number of whole contiguous
+ * sectors are done using multiple block commands (CMD18 / CMD25), directly
+ * between the SD-card and user's array.
+ */
+#define configHOS_SDC_MULTI_BLOCK_MIN_SECTORS		((uint32_t)2)
+
+/*
+ * Enables hinting the SD-card with number of blocks before multiple block
+ * writes (ACMD23), so that it could pre-erase them.
+ */
+#define configHOS_SDC_PRE_ERASE_EN					1
+
+/*
+ * Maximum number of extents (runs of contiguous clusters) cached in each stream
+ * handle. Must be at least 1.
+ *
+ * Cached part of the cluster chain is resolved in O(log(extents)), and the rest
+ * is resolved by following the FAT starting by the last resolved cluster.
+ */
+#define configHOS_SDC_STREAM_EXTENT_CACHE_SIZE		((uint32_t)8)
+
 
 
 
@@ -3,6 +3,24 @@
  *
  *  Created on: Jun 9, 2023
  *      Author: Ali Emad
+ *
+ * Drive modes:
+ * 		-	Task: a task refreshes one digit every "uiUpdatePeriodMs", writing its
+ * 			pins one by one.
+ *
+ * 		-	Timer: set/reset port words of every digit are calculated once, when
+ * 			the display changes. Then, on every overflow of a HW timer, the ISR
+ * 			writes these words (a single write per port) to move to the next
+ * 			digit. No task is used, and refresh rate does not depend on the RTOS
+ * 			tick, nor on the CPU load.
+ *
+ * 			Brightness is controlled by turning digits off at a compare match
+ * 			within each digit's time slot.
+ *
+ * Display buffer holds glyph indices, which are:
+ * 		-	[0, 9]: digits.
+ * 		-	[10, 35]: letters 'A' to 'Z' (of which [10, 15] are hex digits).
+ * 		-	"ucHOS_SEVENSEGMENTMUX_GLYPH_xx" symbols.
  */
 
 #ifndef HAL_OS_INC_SEVENSEGMENTMUX_SEVENSEGMENTMUX_H_
@@ -13,6 +31,19 @@
 
 #define uiHOS_SEVENSEGMENTMUX_STACK_SZ	(200)
 
+/*	Drive modes	*/
+#define ucHOS_SEVENSEGMENTMUX_DRIVE_TASK		0
+#define ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER		1
+
+/*	Glyph indices of symbols	*/
+#define ucHOS_SEVENSEGMENTMUX_GLYPH_BLANK			36
+#define ucHOS_SEVENSEGMENTMUX_GLYPH_MINUS			37
+#define ucHOS_SEVENSEGMENTMUX_GLYPH_UNDERSCORE		38
+#define ucHOS_SEVENSEGMENTMUX_GLYPH_DEGREE			39
+
+/*	Maximum brightness	*/
+#define ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS		255
+
 /*
  * "xHOS_SevenSegmentMux_t" structure.
  */
@@ -24,6 +55,24 @@ typedef struct{
 
 	uint8_t ucCurrentActiveDigit;
 
+	/*	Timer drive mode	*/
+	uint8_t pucPortNumberArr[configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS];
+	uint8_t ucNumberOfPorts;
+
+	/*	Set/reset words that turn all digits off	*/
+	uint32_t puiBlankWordArr[configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS];
+
+	/*
+	 * Set/reset words of each digit, double buffered. ISR uses the one indexed
+	 * by "ucActiveFrame", while the other one is being calculated.
+	 */
+	uint32_t puiFrameArr[2][configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_DIGITS]
+	                       [configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS];
+	volatile uint8_t ucActiveFrame;
+
+	uint32_t uiCounterUpperLimit;
+	volatile uint8_t ucBrightness;
+
 	/*		PUBLIC		*/
 	/*	Configuration parameters	*/
 	uint8_t* pxSegmentPortNumberArr;
@@ -40,12 +89,23 @@ typedef struct{
 
 	uint8_t ucNumberOfDigits;
 
+	/*	One of "ucHOS_SEVENSEGMENTMUX_DRIVE_xx"	*/
+	uint8_t ucDriveMode;
+
+	/*	Timer drive mode: timer unit (dedicated to this object)	*/
+	uint8_t ucTimerUnitNumber;
+
+	/*	Timer drive mode: full display refreshes per second (i.e.: 100)	*/
+	uint32_t uiRefreshRateHz;
+
 	/*	Runtime changing parameters	*/
+	/*	Glyph indices, element 0 is the rightmost digit	*/
 	uint8_t* pucDisplayBuffer;
 
+	/*	Bit 'i' is set if point of digit 'i' is on	*/
 	int8_t ucPointIndex;
 
-	uint32_t uiUpdatePeriodMs; // recommended: 10ms
+	uint32_t uiUpdatePeriodMs; // Task drive mode. recommended: 10ms
 }xHOS_SevenSegmentMux_t;
 
 /*
@@ -54,8 +114,12 @@ typedef struct{
  * Notes:
  * 		-	Must be called before scheduler start.
  *
- * 		-	All configuration parameters, and "uiUpdatePeriodMs" must be
- * 			initialized first.
+ * 		-	All configuration parameters, and "uiUpdatePeriodMs" (task drive
+ * 			mode) or "uiRefreshRateHz" (timer drive mode) must be initialized
+ * 			first.
+ *
+ * 		-	Timer drive mode: timer interrupts must be enabled in
+ * 			"Port_Interrupt.h". Brightness is initially maximum.
  *
  * 		-	Runtime parameters are initialized by this function as follows:
  * 				-	"pucDisplayBuffer" elements are all set to zero.
@@ -65,11 +129,52 @@ void vHOS_SevenSegmentMux_init(xHOS_SevenSegmentMux_t* pxHandle);
 
 /*
  * Changes current display value.
+ *
+ * "ucPointIndex": bit 'i' is set if point of digit 'i' is on.
  */
 void vHOS_SevenSegmentMux_write(	xHOS_SevenSegmentMux_t* pxHandle,
 									uint32_t uiNum,
 									uint8_t ucPointIndex	);
 
+/*
+ * Changes current display value to a hexadecimal number.
+ */
+void vHOS_SevenSegmentMux_writeHex(	xHOS_SevenSegmentMux_t* pxHandle,
+									uint32_t uiNum,
+									uint8_t ucPointIndex	);
+
+/*
+ * Changes current display value to a string.
+ *
+ * Notes:
+ * 		-	First character is displayed on the leftmost digit.
+ * 		-	Digits, letters (of any case), ' ', '-', '_' and '*' (degree) are
+ * 			displayed. Other characters are displayed as blanks.
+ * 		-	A '.' turns on point of the preceding character's digit.
+ * 		-	Characters that don't fit on the display are ignored, and digits that
+ * 			are not covered by the string are blanked.
+ */
+void vHOS_SevenSegmentMux_writeString(	xHOS_SevenSegmentMux_t* pxHandle,
+										const char* pcStr	);
+
+/*
+ * Applies changes made directly to "pucDisplayBuffer" or "ucPointIndex".
+ *
+ * Notes:
+ * 		-	Only needed in timer drive mode. Write functions call it internally.
+ */
+void vHOS_SevenSegmentMux_update(xHOS_SevenSegmentMux_t* pxHandle);
+
+/*
+ * Sets brightness.
+ *
+ * Notes:
+ * 		-	Timer drive mode only.
+ * 		-	"ucBrightness": 0 (off) to "ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS".
+ */
+void vHOS_SevenSegmentMux_setBrightness(	xHOS_SevenSegmentMux_t* pxHandle,
+											uint8_t ucBrightness	);
+
 /*
  * Enables "xHOS_SevenSegmentMux_t" object.
  *
@@ -13,4 +13,15 @@
 #define configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_OBJECTS	1
 #define configHOS_SEVEN_SEGMENT_MUX_UPDATE_TIME_MS			10
 
+/*
+ * Timer drive mode only: maximum number of distinct DIO ports that segment and
+ * digit enable pins of one object are connected to.
+ */
+#define configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS		3
+
+/*
+ * Timer drive mode only: priority of the timer interrupts.
+ */
+#define configHOS_SEVEN_SEGMENT_MUX_TIMER_PRI				(configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1)
+
 #endif /* HAL_OS_INC_SEVENSEGMENTMUX_SEVENSEGMENTMUXCONFIG_H_ */
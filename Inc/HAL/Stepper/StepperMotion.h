@@ -0,0 +1,134 @@
+/*
+ * StepperMotion.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Coordinated, accelerated motion of a group of steppers.
+ *
+ * Moves (segments) are added to a queue, and executed in the background by a
+ * hardware timer ISR, while the calling task continues (i.e.: to enqueue more
+ * segments).
+ *
+ * Every time a segment is added, the queued segments are re-planned (see
+ * "StepperPlanner.h"), such that motion does not stop between segments unless
+ * it has to. The segment currently being executed is never re-planned.
+ *
+ * The timer ISR runs once per step of the major stepper of the executed
+ * segment. It pulses the step pins of the steppers that step, and updates the
+ * timer period. No 64-bit operations are made in the ISR.
+ *
+ * Notes:
+ * 		-	Timer runs at 1MHz. Periods longer than the timer's counter range are
+ * 			clamped to it (for a 16-bit timer: major stepper's speed is never
+ * 			lower than ~16 steps/s).
+ *
+ * 		-	Steppers must be initialized and enabled by the user.
+ *
+ * 		-	"vHOS_StepperSynchronizer_move()" and "vHOS_Stepper_stepN()" must not
+ * 			be used on steppers of a motion handle.
+ */
+
+#ifndef HAL_OS_INC_STEPPER_STEPPERMOTION_H_
+#define HAL_OS_INC_STEPPER_STEPPERMOTION_H_
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+#include "HAL/Stepper/Stepper.h"
+#include "HAL/Stepper/StepperPlanner.h"
+#include "HAL/Stepper/StepperMotion_Config.h"
+
+/*******************************************************************************
+ * API structures:
+ ******************************************************************************/
+typedef struct{
+	/*			PUBLIC			*/
+	/*	Array of "ucNumberOfSteppers" steppers	*/
+	xHOS_Stepper_t* pxStepperArr;
+	uint8_t ucNumberOfSteppers;
+
+	uint8_t ucTimerUnitNumber;
+
+	/*	Acceleration along the path, in steps/s^2	*/
+	uint32_t uiAccel;
+
+	/*	Maximum instant speed change of any stepper at junctions, in steps/s	*/
+	uint32_t uiMaxJunctionJerk;
+
+	/*			PRIVATE			*/
+	xHOS_StepperPlanner_segment_t pxSegArr[uiCONF_STEPPER_MOTION_QUEUE_LENGTH];
+
+	/*	Free running indices. Segments in [uiTail, uiHead) are queued	*/
+	volatile uint32_t uiHead;
+	volatile uint32_t uiTail;
+
+	volatile uint8_t ucIsRunning;
+
+	xHOS_StepperPlanner_stepGen_t xStepGen;
+
+	uint32_t uiMaxCounterValue;
+
+	/*	Profiles calculated while re-planning, before being committed	*/
+	xHOS_StepperPlanner_profile_t pxProfileArr[uiCONF_STEPPER_MOTION_QUEUE_LENGTH];
+
+	SemaphoreHandle_t xFreeSlotsSemaphore;
+	StaticSemaphore_t xFreeSlotsStaticSemaphore;
+
+	SemaphoreHandle_t xIdleSemaphore;
+	StaticSemaphore_t xIdleStaticSemaphore;
+
+	SemaphoreHandle_t xMutex;
+	StaticSemaphore_t xStaticMutex;
+}xHOS_StepperMotion_t;
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * Initializes handle and its timer.
+ *
+ * Notes:
+ * 		-	Public parameters of the handle must be set before calling this
+ * 			function.
+ *
+ * 		-	Must be called before the scheduler starts.
+ */
+void vHOS_StepperMotion_init(xHOS_StepperMotion_t* pxHandle);
+
+/*
+ * Adds a segment to the queue. Motion starts immediately if it was stopped.
+ *
+ * Notes:
+ * 		-	"piDeltaArr" is an array of number of steps to be made by each
+ * 			stepper, such that "pxHandle->pxStepperArr[i]" moves by
+ * 			"piDeltaArr[i]". It is copied, and could be reused by the caller.
+ *
+ * 		-	"uiSpeed" is the speed along the path, in steps/s. Such that:
+ * 			speed = sqrt( (stepper0 speed) ^ 2 + (stepper1 speed) ^ 2 + ... )
+ *
+ * 		-	Blocks while the queue is full, for at most "xTimeout".
+ *
+ * 		-	Returns 1 if added (or all deltas are zero), 0 on timeout.
+ *
+ * 		-	This function is not ISR safe.
+ */
+uint8_t ucHOS_StepperMotion_enqueue(	xHOS_StepperMotion_t* pxHandle,
+										const int32_t* piDeltaArr,
+										uint32_t uiSpeed,
+										TickType_t xTimeout	);
+
+/*
+ * Blocks until all queued segments are executed and motion stops, for at most
+ * "xTimeout". Returns 1 if motion stopped, 0 on timeout.
+ */
+uint8_t ucHOS_StepperMotion_blockUntilIdle(	xHOS_StepperMotion_t* pxHandle,
+											TickType_t xTimeout	);
+
+/*
+ * Returns 1 if motion is in progress, 0 otherwise.
+ */
+uint8_t ucHOS_StepperMotion_isRunning(xHOS_StepperMotion_t* pxHandle);
+
+
+
+#endif /* HAL_OS_INC_STEPPER_STEPPERMOTION_H_ */
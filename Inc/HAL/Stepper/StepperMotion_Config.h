@@ -0,0 +1,23 @@
+/*
+ * StepperMotion_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HAL_OS_INC_STEPPER_STEPPERMOTION_CONFIG_H_
+#define HAL_OS_INC_STEPPER_STEPPERMOTION_CONFIG_H_
+
+/*
+ * Maximum number of steppers moved by one motion handle (8 at most).
+ */
+#define uiCONF_STEPPER_MOTION_MAX_STEPPERS			4
+
+/*
+ * Number of segments in the queue of each motion handle. It is also the
+ * look-ahead depth of the planner.
+ */
+#define uiCONF_STEPPER_MOTION_QUEUE_LENGTH			16
+
+
+
+#endif /* HAL_OS_INC_STEPPER_STEPPERMOTION_CONFIG_H_ */
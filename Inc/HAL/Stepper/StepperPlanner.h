@@ -0,0 +1,165 @@
+/*
+ * StepperPlanner.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * References:
+ * 		-	"AVR446: Linear speed control of stepper motor. Atmel", (step
+ * 			period recurrence).
+ * 		-	"Generate stepper-motor speed profiles in real time. D. Austin".
+ *
+ * Motion planner and step generator of "StepperMotion".
+ *
+ * A segment is a straight move of all steppers by "piDeltaArr" steps. Speeds
+ * and acceleration of segments are along the path (Euclidean norm of the
+ * steppers' speeds), in steps/s and steps/s^2.
+ *
+ * Planner:
+ * 		-	Maximum entry speed of each segment (junction speed) is limited such
+ * 			that no stepper's speed changes by more than "uiMaxJunctionJerk"
+ * 			instantly.
+ *
+ * 		-	Over a queue of segments, a backward pass limits entry speeds such
+ * 			that every segment can decelerate to the entry speed of the next
+ * 			one (and the last one to stand still), and a forward pass limits
+ * 			exit speeds such that every segment can accelerate to them.
+ *
+ * 		-	Each segment then gets a trapezoidal profile (accelerate, cruise,
+ * 			decelerate), in steps of its major stepper (the one of most steps).
+ *
+ * Step generator:
+ * 		-	Called once per step of the major stepper. Other steppers are
+ * 			distributed over the major stepper's steps using Bresenham's
+ * 			algorithm (additions and comparisons only).
+ *
+ * 		-	Period to the next step is updated using the recurrence:
+ * 			c(n) = c(n-1) - 2 * c(n-1) / (4 * n + 1), a single division per step.
+ *
+ * This module depends on nothing but "stdint.h", so it could be built on a host
+ * machine to simulate step timelines.
+ */
+
+#ifndef HAL_OS_INC_STEPPER_STEPPERPLANNER_H_
+#define HAL_OS_INC_STEPPER_STEPPERPLANNER_H_
+
+#include "stdint.h"
+
+#include "HAL/Stepper/StepperMotion_Config.h"
+
+/*	Step timing of a planned segment, in steps of its major stepper	*/
+typedef struct{
+	/*	Steps [0, uiAccelUntil) accelerate, [uiDecelAfter, N) decelerate	*/
+	uint32_t uiAccelUntil;
+	uint32_t uiDecelAfter;
+
+	/*	Recurrence index at entry, and at start of deceleration (negative)	*/
+	int32_t iEntryN;
+	int32_t iDecelN;
+
+	/*	Periods between steps, in timer ticks, Q8	*/
+	uint32_t uiEntryPeriodQ8;
+	uint32_t uiNominalPeriodQ8;
+	uint32_t uiExitPeriodQ8;
+
+	/*	Exit speed squared (path units), which this profile ends at	*/
+	uint64_t ulExitSpeedSqr;
+}xHOS_StepperPlanner_profile_t;
+
+typedef struct{
+	/*	Set by "vHOS_StepperPlanner_initSegment()"	*/
+	int32_t piDeltaArr[uiCONF_STEPPER_MOTION_MAX_STEPPERS];
+	uint8_t ucNumberOfSteppers;
+	uint8_t ucDirMask;
+	uint32_t uiSteps;
+	uint32_t uiLength;
+	uint32_t uiAccel;
+	uint64_t ulNominalSpeedSqr;
+	uint64_t ulMaxEntrySpeedSqr;
+
+	/*	Set by "vHOS_StepperPlanner_plan()"	*/
+	uint64_t ulEntrySpeedSqr;
+	uint64_t ulExitSpeedSqr;
+
+	/*	Used by the step generator	*/
+	xHOS_StepperPlanner_profile_t xProfile;
+}xHOS_StepperPlanner_segment_t;
+
+/*	Step generator state	*/
+typedef struct{
+	uint32_t uiStepIndex;
+	int32_t iN;
+	uint32_t uiPeriodQ8;
+	uint8_t ucIsDecelerating;
+	uint32_t puiErrArr[uiCONF_STEPPER_MOTION_MAX_STEPPERS];
+}xHOS_StepperPlanner_stepGen_t;
+
+/*
+ * Initializes a segment.
+ *
+ * Notes:
+ * 		-	"uiSpeed": nominal speed along the path, in steps/s.
+ * 		-	"uiAccel": acceleration along the path, in steps/s^2.
+ * 		-	Bit 'i' of "ucDirMask" is set if stepper 'i' moves backward.
+ * 		-	Maximum entry speed is initially zero (start from stand still).
+ * 		-	Returns 0 if all deltas are zero (empty segment), otherwise 1.
+ */
+uint8_t ucHOS_StepperPlanner_initSegment(	xHOS_StepperPlanner_segment_t* pxSeg,
+											const int32_t* piDeltaArr,
+											uint8_t ucNumberOfSteppers,
+											uint32_t uiSpeed,
+											uint32_t uiAccel	);
+
+/*
+ * Sets maximum entry speed of "pxSeg", as a junction with the segment "pxPrev"
+ * that precedes it.
+ */
+void vHOS_StepperPlanner_setJunction(	xHOS_StepperPlanner_segment_t* pxSeg,
+										const xHOS_StepperPlanner_segment_t* pxPrev,
+										uint32_t uiMaxJunctionJerk	);
+
+/*
+ * Plans entry and exit speeds of "uiCount" segments, starting at index
+ * "uiFirst" of the ring "pxSegArr" of "uiQueueLength" segments (a power of two).
+ *
+ * Notes:
+ * 		-	"ulFirstEntrySpeedSqr" is the (fixed) entry speed squared of the
+ * 			first segment.
+ * 		-	Last segment exits at stand still.
+ */
+void vHOS_StepperPlanner_plan(	xHOS_StepperPlanner_segment_t* pxSegArr,
+								uint32_t uiQueueLength,
+								uint32_t uiFirst,
+								uint32_t uiCount,
+								uint64_t ulFirstEntrySpeedSqr	);
+
+/*
+ * Calculates step profile of a planned segment into "pxProfile".
+ *
+ * "uiTimerFreq" is the frequency of the timer used for stepping, in Hz.
+ */
+void vHOS_StepperPlanner_calculateProfile(	const xHOS_StepperPlanner_segment_t* pxSeg,
+											uint32_t uiTimerFreq,
+											xHOS_StepperPlanner_profile_t* pxProfile	);
+
+/*
+ * Starts generating steps of a segment. Returns period (in timer ticks) until
+ * its first step.
+ */
+uint32_t uiHOS_StepperPlanner_loadSegment(	xHOS_StepperPlanner_stepGen_t* pxGen,
+											const xHOS_StepperPlanner_segment_t* pxSeg	);
+
+/*
+ * Generates one step of the major stepper.
+ *
+ * Notes:
+ * 		-	Returns bit mask of the steppers that step now.
+ * 		-	"puiPeriod" is set to the period (in timer ticks) until the next step.
+ * 		-	Segment is completed when "pxGen->uiStepIndex" equals "pxSeg->uiSteps".
+ */
+uint32_t uiHOS_StepperPlanner_step(	xHOS_StepperPlanner_stepGen_t* pxGen,
+									const xHOS_StepperPlanner_segment_t* pxSeg,
+									uint32_t* puiPeriod	);
+
+
+
+#endif /* HAL_OS_INC_STEPPER_STEPPERPLANNER_H_ */
@@ -23,15 +23,28 @@
  * Notes:
  * 		-	If serial (SPI), define "ucHOS_TFT_DATA_CONNECTION" as "ucHOS_TFT_DATA_CONNECTION_SPI".
  * 		-	If parallel, define "ucHOS_TFT_DATA_CONNECTION" as "ucHOS_TFT_DATA_CONNECTION_PARALLEL".
+ * 		-	Could be overridden from the compiler's command line (i.e.: by the
+ * 			host test, "TFT_Test.c", which tests the SPI connection).
  */
 #define ucHOS_TFT_DATA_CONNECTION_SPI 			0
 #define ucHOS_TFT_DATA_CONNECTION_PARALLEL 		1
+#ifndef ucHOS_TFT_DATA_CONNECTION
 #define ucHOS_TFT_DATA_CONNECTION				ucHOS_TFT_DATA_CONNECTION_PARALLEL
+#endif
 
 
 /*	Usage of CS pin	*/
 #define ucHOS_TFT_USE_CS						0
 
+/*
+ * Size (in pixels) of TFT handle's line buffer.
+ *
+ * Single color fills expand the color into this buffer, and stream it using a
+ * transfer per buffer length, instead of a transfer per pixel. Larger buffer
+ * means less transfers at the cost of RAM (2 bytes per pixel per TFT handle).
+ */
+#define uiHOS_TFT_LINE_BUFFER_PIXELS			((uint32_t)64)
+
 
 /*******************************************************************************
  * Include dependencies:
@@ -49,6 +62,11 @@ typedef struct{
 	StaticSemaphore_t xInitDoneSemaphoreStatic;
 	SemaphoreHandle_t xInitDoneSemaphore;
 
+	/*	Line buffer, and the color it is currently filled with (if any)	*/
+	xLIB_Color16_t pxLineBuffer[uiHOS_TFT_LINE_BUFFER_PIXELS];
+	xLIB_Color16_t xLineBufferColor;
+	uint8_t ucIsLineBufferFilled;
+
 	/*		PUBLIC		*/
 #if ucHOS_TFT_DATA_CONNECTION == ucHOS_TFT_DATA_CONNECTION_SPI
 	/*	number of SPI unit used to communicate the TFT	*/
@@ -224,7 +242,16 @@ void vHOS_TFT_drawNextNPixFromSingleColor(	xHOS_TFT_t* pxTFT,
 											uint32_t uiN	);
 
 /*
+ * Draws text (using the 8x8 font) with transparent background.
+ *
+ * Notes:
+ * 		-	"ucSize" is an integer scale factor (1 ==> 8x8 pixels per glyph).
  *
+ * 		-	Characters are stacked along the y-axis.
+ *
+ * 		-	Each horizontal run of lit pixels in a glyph row is drawn as a single
+ * 			rectangle. If background is known, the following function is much
+ * 			faster.
  */
 void vHOS_TFT_drawText(	xHOS_TFT_t* pxTFT,
 						xLIB_Color16_t xColor,
@@ -233,6 +260,25 @@ void vHOS_TFT_drawText(	xHOS_TFT_t* pxTFT,
 						uint8_t ucSize,
 						char* pcTxt	);
 
+/*
+ * Draws text (using the 8x8 font) over a solid background color.
+ *
+ * Notes:
+ * 		-	Same placement and scaling as "vHOS_TFT_drawText()".
+ *
+ * 		-	A single address window is set for the whole text, glyphs are then
+ * 			rasterized into TFT handle's line buffer and streamed a buffer at a
+ * 			time. (One transfer per glyph with default buffer size and "ucSize"
+ * 			of 1).
+ */
+void vHOS_TFT_drawTextWithBackground(	xHOS_TFT_t* pxTFT,
+										xLIB_Color16_t xColor,
+										xLIB_Color16_t xBackgroundColor,
+										uint16_t usXStart,
+										uint16_t usYStart,
+										uint8_t ucSize,
+										char* pcTxt	);
+
 
 
 
@@ -16,6 +16,10 @@
  *
  *		-	HW settings like frame format and clock mode must be initially set
  * 			by user.
+ *
+ *		-	If target has DMA, must be called after "vHOS_DMA_init()", and
+ *			before scheduler start. Each HW unit locks its Tx DMA channel here,
+ *			and holds it.
  */
 void vHOS_UART_init(void);
 
@@ -23,24 +27,78 @@ void vHOS_UART_init(void);
  * Sends an array of bytes.
  *
  * Notes:
- * 		-	Before calling this function, there must not be any on-going transfer
- * 			operations on the same unit, otherwise previous transmission would
- * 			be omitted.
+ * 		-	Enqueues "pcArr" after any previously enqueued arrays, and blocks
+ * 			until its last byte is written to the unit. "pcArr" can be reused
+ * 			once this function returns.
  *
  *		-	As UART is asynchronous, it is recommended to not send too much bytes
  *			consecutively, so that transmitter and receiver don't get out of sync.
  *
  * 		-	After calling this function, tasks can synchronize end of send
  * 			operation using the function "xHOS_UART_blockUntilTransferComplete()".
+ * 			If "uiSize" is 0, end of send operation is signaled immediately.
  */
 void vHOS_UART_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize);
 
+/*
+ * Enqueues an array of bytes to be sent, without waiting for it (or previously
+ * enqueued arrays) to be sent.
+ *
+ * Notes:
+ * 		-	Unit's Tx queue holds up to "uiCONF_UART_TX_QUEUE_LENGTH" arrays. If
+ * 			it's full, function blocks until a slot is free or "xTimeout" passes.
+ *
+ * 		-	Returns 1 if enqueued, 0 if timeout passed.
+ *
+ * 		-	If enqueued, "puiToken" (if not NULL) is set to a token that
+ * 			identifies the array. "pcArr" must not be modified until it is sent.
+ * 			(See "ucHOS_UART_blockUntilBufferSent()")
+ *
+ * 		-	Arrays are sent back to back, with the unit woken once per array (not
+ * 			once per byte). If target has DMA, each array is sent in a single DMA
+ * 			transfer.
+ *
+ * 		-	Zero size arrays are not enqueued. Their token is sent once all
+ * 			previously enqueued arrays are sent.
+ *
+ * 		-	On SW units, array is sent before returning.
+ */
+uint8_t ucHOS_UART_enqueue(	uint8_t ucUnitNumber,
+							int8_t* pcArr,
+							uint32_t uiSize,
+							TickType_t xTimeout,
+							uint32_t* puiToken	);
+
+/*
+ * Blocks calling task until the enqueued array of "uiToken" is sent, or timeout
+ * passes.
+ *
+ * Notes:
+ * 		-	Returns 1 if the array is sent, 0 if timeout passed.
+ *
+ * 		-	An array is considered sent once its last byte is written to the
+ * 			unit (it may still be shifting out on the bus). Its memory can then be
+ * 			reused. Arrays are sent in order, so arrays enqueued before it are
+ * 			sent too.
+ *
+ * 		-	Returns immediately if the array was already sent. Any number of
+ * 			arrays may be sent without being waited for.
+ *
+ * 		-	Only one task (the unit's mutex holder) may be blocked on a unit.
+ */
+uint8_t ucHOS_UART_blockUntilBufferSent(	uint8_t ucUnitNumber,
+											uint32_t uiToken,
+											TickType_t xTimeout	);
+
 /*
  * Receives an array of bytes.
  *
  * Notes:
  * 		-	If the specified "uiSize" was not received within the "xTimeout",
  * 			function returns 0. Otherwise, it returns 1.
+ *
+ * 		-	If continuous reception is enabled, data is taken from unit's ring,
+ * 			including bytes received before calling this function.
  */
 uint8_t ucHOS_UART_receive(		uint8_t ucUnitNumber,
 								int8_t* pcInArr,
@@ -75,6 +133,9 @@ void vHOS_UART_releaseMutex(uint8_t ucUnitNumber);
  * Blocks calling task until transmission (send operation) is completed or timeout passes.
  *
  * Notes:
+ * 		-	Transmission is completed when all enqueued arrays are sent, and the
+ * 			last byte is shifted out on the bus.
+ *
  * 		-	Returns 1 if transmission completed while timeout hasn't passed, otherwise
  * 			returns 0.
  *
@@ -87,6 +148,82 @@ void vHOS_UART_releaseMutex(uint8_t ucUnitNumber);
  */
 uint8_t ucHOS_UART_blockUntilTransmissionComplete(uint8_t ucUnitNumber, TickType_t xTimeout);
 
+/*
+ * Enables continuous reception.
+ *
+ * Notes:
+ * 		-	Received bytes are stored in unit's ring (of size
+ * 			"uiCONF_UART_RX_RING_SIZE") by the RxNE ISR, or by a circular DMA
+ * 			transfer on targets with DMA, whether a read function is pending or
+ * 			not. Ring is emptied when this function is called.
+ *
+ * 		-	With DMA, received bytes become available on an idle line, or every
+ * 			half ring, not on every byte.
+ *
+ * 		-	An idle line (a frame gap of one character time) after received bytes
+ * 			marks the end of a frame.
+ *
+ * 		-	If the ring is full, new bytes are dropped and counted (with DMA, the
+ * 			oldest bytes are overwritten and counted instead). (See
+ * 			"uiHOS_UART_getOverrunCount()")
+ *
+ * 		-	Available on HW units only.
+ */
+void vHOS_UART_enableContinuousReception(uint8_t ucUnitNumber);
+
+/*
+ * Disables continuous reception.
+ */
+void vHOS_UART_disableContinuousReception(uint8_t ucUnitNumber);
+
+/*
+ * Sets the match character (frame delimiter, i.e.: '\n' for NMEA).
+ *
+ * Notes:
+ * 		-	If "ucEnable" is 1, receiving "ucChar" ends a frame, and wakes a task
+ * 			blocked in "uiHOS_UART_readFrame()". If 0, match character is disabled.
+ */
+void vHOS_UART_setMatchCharacter(uint8_t ucUnitNumber, uint8_t ucChar, uint8_t ucEnable);
+
+/*
+ * Returns number of bytes available in unit's ring.
+ */
+uint32_t uiHOS_UART_getAvailableSize(uint8_t ucUnitNumber);
+
+/*
+ * Copies whatever is available in unit's ring (up to "uiMaxSize" bytes) to
+ * "pcArr", without blocking.
+ *
+ * Notes:
+ * 		-	Returns number of bytes copied.
+ */
+uint32_t uiHOS_UART_readAvailable(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiMaxSize);
+
+/*
+ * Blocks until a frame is received, then copies it to "pcArr".
+ *
+ * Notes:
+ * 		-	A frame ends at the first match character (included in the copied
+ * 			data), or at an idle line, or when "uiMaxSize" bytes are available,
+ * 			whichever comes first.
+ *
+ * 		-	Returns number of bytes copied, or 0 if no frame ended within
+ * 			"xTimeout" (received bytes are kept in the ring).
+ *
+ * 		-	Frames separated by idle lines are returned as one frame if the task
+ * 			was late reading the first one.
+ */
+uint32_t uiHOS_UART_readFrame(	uint8_t ucUnitNumber,
+								int8_t* pcArr,
+								uint32_t uiMaxSize,
+								TickType_t xTimeout	);
+
+/*
+ * Returns number of bytes dropped (or overwritten, with DMA) as unit's ring was
+ * full, since continuous reception was enabled.
+ */
+uint32_t uiHOS_UART_getOverrunCount(uint8_t ucUnitNumber);
+
 
 
 #endif /* COTS_OS_INC_HAL_UART_H_ */
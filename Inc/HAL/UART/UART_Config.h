@@ -14,6 +14,18 @@
  */
 #define uiCONF_UART_NUMBER_OF_NEEDED_UNITS			1
 
+/*
+ * Size (in bytes) of the continuous reception ring of each HW unit. Must be a
+ * power of two.
+ */
+#define uiCONF_UART_RX_RING_SIZE					256
+
+/*
+ * Maximum number of buffers queued for transmission on each HW unit. Must be a
+ * power of two.
+ */
+#define uiCONF_UART_TX_QUEUE_LENGTH					8
+
 /*
  * SW units' pins.
  */
@@ -0,0 +1,238 @@
+/*
+ * UART_HW_Private.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Shared between the HW UART driver ("UART_HW.c") and its variants
+ * ("UART_HW_V1.c" for targets without DMA, "UART_HW_V2.c" for targets with
+ * DMA). Not to be included by user code.
+ */
+
+#ifndef COTS_OS_INC_HAL_UART_UART_HW_PRIVATE_H_
+#define COTS_OS_INC_HAL_UART_UART_HW_PRIVATE_H_
+
+#include "HAL/DMA/DMA.h"
+
+/*******************************************************************************
+ * Helping macros:
+ ******************************************************************************/
+/*
+ * Number of units to be created.
+ */
+#if uiCONF_UART_NUMBER_OF_NEEDED_UNITS > portUART_NUMBER_OF_UNITS
+#define uiUART_HW_NUMBER_OF_UNITS		portUART_NUMBER_OF_UNITS
+#else
+#define uiUART_HW_NUMBER_OF_UNITS		uiCONF_UART_NUMBER_OF_NEEDED_UNITS
+#endif
+
+/*
+ * Ring index mask.
+ */
+#if (uiCONF_UART_RX_RING_SIZE & (uiCONF_UART_RX_RING_SIZE - 1)) != 0
+#error "uiCONF_UART_RX_RING_SIZE must be a power of two"
+#endif
+#define uiUART_HW_RING_MASK				(uiCONF_UART_RX_RING_SIZE - 1)
+
+/*
+ * Tx queue index mask.
+ */
+#if (uiCONF_UART_TX_QUEUE_LENGTH & (uiCONF_UART_TX_QUEUE_LENGTH - 1)) != 0
+#error "uiCONF_UART_TX_QUEUE_LENGTH must be a power of two"
+#endif
+#define uiUART_HW_TX_QUEUE_MASK			(uiCONF_UART_TX_QUEUE_LENGTH - 1)
+
+/*******************************************************************************
+ * Structures:
+ ******************************************************************************/
+typedef struct{
+	/*	Buffer to be sent	*/
+	int8_t* pcArr;
+	uint32_t uiSize;
+}xHOS_UART_HW_TxBuffer_t;
+
+typedef struct{
+	/*	Queued buffers	*/
+	xHOS_UART_HW_TxBuffer_t pxBufferArr[uiCONF_UART_TX_QUEUE_LENGTH];
+
+	/*
+	 * Free running write (enqueue) and read (sender) counters. Position in
+	 * "pxBufferArr" is their value masked by queue length.
+	 */
+	volatile uint32_t uiHead;
+	volatile uint32_t uiTail;
+
+	/*	Is the queue being sent	*/
+	volatile uint8_t ucIsBusy;
+
+	/*
+	 * Counting semaphore of the free queue slots. Taken on enqueue, given when
+	 * a buffer is completely written to the unit.
+	 */
+	StaticSemaphore_t xFreeSlotsSemaphoreStatic;
+	SemaphoreHandle_t xFreeSlotsSemaphore;
+
+	/*
+	 * Token (value of "uiTail" once sent) of the buffer a task is blocked on,
+	 * and whether a task is blocked.
+	 */
+	volatile uint32_t uiWakeToken;
+	volatile uint8_t ucIsWaiting;
+
+	/*
+	 * Binary semaphore given when the buffer of "uiWakeToken" is sent.
+	 */
+	StaticSemaphore_t xBufferSentSemaphoreStatic;
+	SemaphoreHandle_t xBufferSentSemaphore;
+
+#if portDMA_IS_AVAILABLE == 1
+	/*	DMA transfer of the buffer at the tail (channel is locked on init)	*/
+	xHOS_DMA_TransInfo_t xDmaInfo;
+#else
+	/*	Number of bytes sent of the buffer at the tail	*/
+	uint32_t uiTxByteCounter;
+#endif
+}xHOS_UART_HW_TxQueue_t;
+
+typedef struct{
+	/*	Pointer to the Rx buffer	*/
+	int8_t* pcRxBuffer;
+
+	/*	Size of the data received since calling "receive" function	*/
+	uint32_t uiRxCurrentSize;
+
+	/*	Total size of the data to be received	*/
+	uint32_t uiRxTotalSize;
+}xHOS_UART_HW_RxInfo_t;
+
+typedef struct{
+	/*	Ring storage	*/
+	uint8_t pucArr[uiCONF_UART_RX_RING_SIZE];
+
+	/*
+	 * Free running write (ISR) and read (task) counters. Fill level is their
+	 * difference, and position in "pucArr" is their value masked by ring size.
+	 */
+	volatile uint32_t uiHead;
+	volatile uint32_t uiTail;
+
+	/*	Value of "uiHead" at the latest idle line or match character event	*/
+	volatile uint32_t uiEventHead;
+
+	/*	Fill level at which ISR wakes the reading task	*/
+	volatile uint32_t uiWakeLevel;
+
+	/*	Number of bytes dropped as ring was full	*/
+	volatile uint32_t uiOverrunCount;
+
+	/*	Match character (frame delimiter)	*/
+	uint8_t ucMatchChar;
+	volatile uint8_t ucIsMatchEnabled;
+
+	/*	Is continuous reception enabled	*/
+	volatile uint8_t ucIsEnabled;
+
+#if portDMA_IS_AVAILABLE == 1
+	/*
+	 * Circular DMA transfer into "pucArr" (channel is locked on init). As
+	 * "uiHead" only advances to DMA's position, "uiHead" masked by ring size
+	 * is where DMA wrote up to at the latest event.
+	 */
+	xHOS_DMA_TransInfo_t xDmaInfo;
+#endif
+}xHOS_UART_HW_RxRing_t;
+
+typedef struct{
+	/*
+	 * Unit's mutex.
+	 *
+	 * (Taken by the task which is going to use the unit)
+	 */
+	StaticSemaphore_t xUnitMutexStatic;
+	SemaphoreHandle_t xUnitMutex;
+
+	/*
+	 * Unit's Transfer complete binary semaphore (flag).
+	 *
+	 * (After task has took the "xUnitMutex", it can synchronize with end of
+	 * transfer using this semaphore).
+	 */
+	StaticSemaphore_t xTransferCompleteSemaphoreStatic;
+	SemaphoreHandle_t xTransferCompleteSemaphore;
+
+	/*
+	 * Unit's RxNE (Rx buffer not empty) binary semaphore (flag).
+	 *
+	 * (In continuous reception, it is given on ring events instead)
+	 */
+	StaticSemaphore_t xRxneSemaphoreStatic;
+	SemaphoreHandle_t xRxneSemaphore;
+
+	/*	Unit number	*/
+	uint8_t ucUnitNumber;
+
+	/*	Tx queue	*/
+	xHOS_UART_HW_TxQueue_t xTxQueue;
+
+	/*	Rx info	*/
+	xHOS_UART_HW_RxInfo_t xRxInfo;
+
+	/*	Continuous reception ring	*/
+	xHOS_UART_HW_RxRing_t xRxRing;
+}xHOS_UART_HW_Unit_t;
+
+/*******************************************************************************
+ * Functions implemented by the variant ("UART_HW_V1.c" or "UART_HW_V2.c"):
+ ******************************************************************************/
+/*
+ * Initializes Tx resources of a unit (interrupt or DMA channel). Called by
+ * "vHOS_UART_HW_init()" before the unit is enabled.
+ */
+void vHOS_UART_HW_initTx(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*
+ * Starts sending the buffer at the tail of an idle queue. Called in a critical
+ * section, with the queue already marked busy.
+ */
+void vHOS_UART_HW_startTx(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*
+ * Initializes continuous reception resources of a unit (DMA channel, if any).
+ * Called by "vHOS_UART_HW_init()" before the unit is enabled.
+ */
+void vHOS_UART_HW_initRxRing(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*
+ * Starts filling the (emptied) ring, by the RxNE ISR or by circular DMA.
+ */
+void vHOS_UART_HW_startRxRing(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*
+ * Stops filling the ring.
+ */
+void vHOS_UART_HW_stopRxRing(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*
+ * Called (from ISR) on an idle line, before end of the frame is marked.
+ * Advances ring's "uiHead" over all bytes received so far (nothing to do if
+ * RxNE ISR advances it on every byte).
+ */
+void vHOS_UART_HW_syncRxRingFromISR(xHOS_UART_HW_Unit_t* pxUnit);
+
+/*******************************************************************************
+ * Functions implemented by "UART_HW.c", used by the variant:
+ ******************************************************************************/
+/*
+ * Called (from ISR) by the Tx variant once the buffer at the tail is completely
+ * written to the unit.
+ *
+ * Frees its slot, and wakes the task blocked on it (if any). If it was the last
+ * buffer, marks the queue idle and enables TC interrupt (end of transmission).
+ *
+ * Returns 1 if queue is empty, 0 if the next buffer is to be sent.
+ */
+uint8_t ucHOS_UART_HW_advanceTxQueueFromISR(	xHOS_UART_HW_Unit_t* pxUnit,
+												BaseType_t* pxHighPriorityTaskWoken	);
+
+
+
+#endif /* COTS_OS_INC_HAL_UART_UART_HW_PRIVATE_H_ */
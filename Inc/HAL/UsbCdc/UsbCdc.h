@@ -64,22 +64,51 @@ void vHOS_UsbCdc_releaseReception(uint8_t ucUnitNumber);
  * Stars a send operation.
  *
  * Notes:
- * 		-	A delay of at least 1ms is recommended between two send operations
- * 			on the same unit (port). (This is to give chance to the USB_DEVICE RTOS
- * 			task to process the data copied to its FIFO buffer and send it to the
- * 			host.
+ * 		-	Data is copied to the unit's Tx FIFO, and flushed to the host once
+ * 			"uiCONF_USB_CDC_TX_FLUSH_THRESHOLD" bytes are pending, or after
+ * 			"uiCONF_USB_CDC_TX_FLUSH_TIMEOUT_MS". Hence, many small sends are
+ * 			coalesced into full USB packets.
+ *
+ * 		-	If Tx FIFO is full, function blocks until host reads enough data.
+ * 			(Function returns once all of "pucBuffer" is copied)
  *
  * 		-	For large data streams, SW synchronization is recommended between device
  * 			device and host.
  */
 void vHOS_UsbCdc_send(uint8_t ucUnitNumber, uint8_t* pucBuffer, uint16_t usLen);
 
+/*
+ * Flushes pending Tx data immediately, without waiting for threshold or
+ * timeout.
+ */
+void vHOS_UsbCdc_flush(uint8_t ucUnitNumber);
+
+/*
+ * Reads received data.
+ *
+ * Notes:
+ * 		-	Data received from host is kept in unit's Rx ring (of size
+ * 			"uiCONF_USB_CDC_RX_BUFFER_SIZE") by the USB device task, whether a read
+ * 			is pending or not.
+ *
+ * 		-	Copies up to "uiMaxLen" of the received data to "pucBuffer", and
+ * 			returns number of copied bytes.
+ *
+ * 		-	If no data is available, function blocks (without polling) until data
+ * 			is received or "xTimeout" passes, then it returns 0.
+ */
+uint32_t uiHOS_UsbCdc_read(	uint8_t ucUnitNumber,
+							uint8_t* pucBuffer,
+							uint32_t uiMaxLen,
+							TickType_t xTimeout	);
+
 /*
  * Reads the Rx buffer.
  *
  * Notes:
  * 		-	This function copies Rx buffer to "pucBuffer", and length of the
- * 			buffer to "*pusLen".
+ * 			buffer to "*pusLen". ("pucBuffer" must be at least
+ * 			"uiCONF_USB_CDC_RX_BUFFER_SIZE" bytes)
  *
  * 		-	If Rx buffer was empty, this function waits for "xTimeout". If timeout
  * 			ends and no data is received, function returns 0. Otherwise it
@@ -103,6 +132,31 @@ uint8_t ucHOS_UsbCdc_receive(	uint8_t ucUnitNumber,
 								uint32_t uiLen,
 								TickType_t xTimeout	);
 
+/*
+ * Zero-copy read: gets the oldest contiguous segment of received data in unit's
+ * Rx ring.
+ *
+ * Notes:
+ * 		-	Writes pointer to the segment in "*ppucSegment", and returns its
+ * 			length. Data available after the ring's wrap-around point is returned
+ * 			by the next call.
+ *
+ * 		-	If no data is available, function blocks until data is received or
+ * 			"xTimeout" passes, then it returns 0.
+ *
+ * 		-	Segment remains valid until it is consumed using
+ * 			"vHOS_UsbCdc_consumeRx()".
+ */
+uint32_t uiHOS_UsbCdc_getRxSegment(	uint8_t ucUnitNumber,
+									uint8_t** ppucSegment,
+									TickType_t xTimeout	);
+
+/*
+ * Frees "uiLen" bytes (not more than last returned segment's length) of the
+ * Rx ring.
+ */
+void vHOS_UsbCdc_consumeRx(uint8_t ucUnitNumber, uint32_t uiLen);
+
 /*
  * Checks if serial port is connected.
  */
@@ -14,6 +14,20 @@
  */
 #define ucCONF_USB_CDC_NUMBER_OF_UNITS		1
 
+/*
+ * Size (in bytes) of the Rx ring of each unit. Must be a power of two.
+ */
+#define uiCONF_USB_CDC_RX_BUFFER_SIZE		512
+
+/*
+ * Transmitted data is coalesced in the TinyUSB Tx FIFO, and flushed (sent to
+ * host) once at least "uiCONF_USB_CDC_TX_FLUSH_THRESHOLD" bytes are pending, or
+ * "uiCONF_USB_CDC_TX_FLUSH_TIMEOUT_MS" passed since the first pending byte was
+ * written.
+ */
+#define uiCONF_USB_CDC_TX_FLUSH_THRESHOLD	64
+#define uiCONF_USB_CDC_TX_FLUSH_TIMEOUT_MS	2
+
 
 
 #endif /* COTS_OS_INC_HAL_USB_CDC_USB_CDC_CONFIG_H_ */
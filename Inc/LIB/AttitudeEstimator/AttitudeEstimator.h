@@ -0,0 +1,148 @@
+/*
+ * AttitudeEstimator.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * References:
+ * 		-	"Nonlinear Complementary Filters on the Special Orthogonal Group.
+ * 			R. Mahony, T. Hamel, J. Pflimlin", (explicit complementary filter).
+ *
+ * Fixed point attitude (orientation) estimator, fusing gyro and accel samples.
+ *
+ * Orientation is kept as a unit quaternion in Q30. On every sample:
+ * 		-	Gravity direction is estimated from the quaternion, and crossed with
+ * 			the normalized accel sample. The result is the error between them.
+ *
+ * 		-	Error is fed back to the gyro sample (proportional and integral
+ * 			terms). The integral term converges to the gyro bias.
+ *
+ * 		-	Quaternion is rotated by the corrected gyro sample, and
+ * 			re-normalized.
+ *
+ * Only integer operations are used while updating (no FPU is needed). All
+ * multiplications are 32x32 -> 64, which are single instructions on Cortex-M3
+ * (SMULL / SMLAL).
+ *
+ * Cycles budget (Cortex-M3, -O2, approximated): ~350 cycles per sample, of
+ * which ~100 are accel normalization (integer square root and a division).
+ * Euler angles are not calculated while updating, only when requested.
+ *
+ * Notes:
+ * 		-	Yaw is not observable from accel, it drifts with the uncompensated
+ * 			part of the gyro's Z bias.
+ *
+ * 		-	Handles have no mutex. If a handle is shared between tasks, user
+ * 			should protect it.
+ */
+
+#ifndef COTS_OS_INC_LIB_ATTITUDEESTIMATOR_ATTITUDEESTIMATOR_H_
+#define COTS_OS_INC_LIB_ATTITUDEESTIMATOR_ATTITUDEESTIMATOR_H_
+
+#include "stdint.h"
+
+/*	1.0 in Q30	*/
+#define iLIB_ATTITUDE_ESTIMATOR_ONE		(1l << 30)
+
+/*
+ * Sample of gyro and accel.
+ *
+ * Any unit could be used (i.e.: raw register values, milli-dps, milli-g), as
+ * long as:
+ * 		-	Gyro unit is the one scaled by "fGyroScale" (see init function).
+ * 		-	Accel components are in the range: [-32768, 32768].
+ */
+typedef struct{
+	int32_t piGyro[3];
+	int32_t piAccel[3];
+}xLIB_AttitudeEstimator_sample_t;
+
+/*	Unit quaternion (w, x, y, z), in Q30	*/
+typedef struct{
+	int32_t iW;
+	int32_t iX;
+	int32_t iY;
+	int32_t iZ;
+}xLIB_AttitudeEstimator_quaternion_t;
+
+/*	Euler angles (Z-Y-X sequence), in micro-degrees, in the range: +-[0:180]	*/
+typedef struct{
+	int32_t iRoll;
+	int32_t iPitch;
+	int32_t iYaw;
+}xLIB_AttitudeEstimator_euler_t;
+
+typedef struct{
+	/*		PUBLIC		*/
+	/*	Gyro bias, in the units of the gyro samples. Subtracted from every sample	*/
+	int32_t piGyroBias[3];
+
+	/*		PRIVATE		*/
+	xLIB_AttitudeEstimator_quaternion_t xQ;
+
+	/*	(0.5 * dt * fGyroScale), in Q46	*/
+	int32_t iGyroGain;
+
+	/*	(0.5 * dt * Kp), in Q30	*/
+	int32_t iKpGain;
+
+	/*	(0.5 * dt * dt * Ki), in Q46	*/
+	int32_t iKiGain;
+
+	/*	Integral term, (half angle per sample) in Q46	*/
+	int64_t plIntegral[3];
+}xLIB_AttitudeEstimator_t;
+
+/*
+ * Initializes handle.
+ *
+ * Notes:
+ * 		-	"fSamplePeriod": time between two successive samples, in seconds.
+ * 		-	"fGyroScale": angular velocity (in rad/s) of one gyro sample unit.
+ * 			(i.e.: for raw MPU6050 samples at +-250dps: (250 * pi / 180) / 32768)
+ * 		-	"fKp": proportional gain (rad/s per unit error). A typical value is 1.
+ * 		-	"fKi": integral gain. A typical value is 0.01, or 0 to disable
+ * 			gyro bias estimation.
+ * 		-	Floating point is used here only, to calculate the fixed point gains.
+ * 		-	Gains must fit in their Q formats, i.e.: (0.5 * dt * fGyroScale) < 2^-15.
+ * 		-	Orientation is reset to identity, and "piGyroBias" to zeros.
+ */
+void vLIB_AttitudeEstimator_init(	xLIB_AttitudeEstimator_t* pxHandle,
+									float fSamplePeriod,
+									float fGyroScale,
+									float fKp,
+									float fKi	);
+
+/*
+ * Resets orientation to identity, and the integral term to zeros.
+ */
+void vLIB_AttitudeEstimator_reset(xLIB_AttitudeEstimator_t* pxHandle);
+
+/*
+ * Updates orientation with a batch of "uiNumberOfSamples" samples, oldest first.
+ *
+ * Notes:
+ * 		-	Samples must be "fSamplePeriod" apart.
+ * 		-	Accel correction is skipped for samples of zero accel.
+ */
+void vLIB_AttitudeEstimator_update(	xLIB_AttitudeEstimator_t* pxHandle,
+									const xLIB_AttitudeEstimator_sample_t* pxSampleArr,
+									uint32_t uiNumberOfSamples	);
+
+/*
+ * Copies current orientation quaternion to "pxQ".
+ */
+void vLIB_AttitudeEstimator_getQuaternion(	xLIB_AttitudeEstimator_t* pxHandle,
+											xLIB_AttitudeEstimator_quaternion_t* pxQ	);
+
+/*
+ * Calculates Euler angles of current orientation.
+ *
+ * Notes:
+ * 		-	Maximum error of the used arc tangent approximation is ~0.001 degree.
+ */
+void vLIB_AttitudeEstimator_getEuler(	xLIB_AttitudeEstimator_t* pxHandle,
+										xLIB_AttitudeEstimator_euler_t* pxEuler	);
+
+
+
+#endif /* COTS_OS_INC_LIB_ATTITUDEESTIMATOR_ATTITUDEESTIMATOR_H_ */
@@ -0,0 +1,61 @@
+/*
+ * BinaryFilterVertical.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is an N-samples based filter for up to 32 binary values at once (i.e.:
+ * levels of a whole input port).
+ *
+ * It works the same way as "xLIB_BinaryFilter_t", that is, a filtered level
+ * changes only after its new value is sampled N consecutive times. But instead
+ * of a count per input, counters are kept vertically: bit 'i' of counter word
+ * 'k' is bit 'k' of the count of input 'i'. Hence, all inputs are updated by
+ * a few bitwise operations per counter bit, regardless of their number.
+ *
+ * Notes:
+ * 		-	N is (2 ^ "ucCounterBits"). (i.e.: 4 samples for 2 counter bits, at a
+ * 			5ms sample period, debounce time is 20ms)
+ *
+ * 		-	This module depends on nothing but "stdint.h".
+ */
+
+#ifndef COTS_OS_INC_LIB_BINARYFILTER_BINARYFILTERVERTICAL_H_
+#define COTS_OS_INC_LIB_BINARYFILTER_BINARYFILTERVERTICAL_H_
+
+#include "stdint.h"
+
+/*	Maximum number of counter bits (N = 16 samples)	*/
+#define ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS		4
+
+typedef struct{
+	/*			PRIVATE			*/
+	uint32_t puiCountArr[ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS];
+	uint8_t ucCounterBits;
+
+	/*			PUBLIC			*/
+	uint32_t uiLevelsFiltered;			// read-only.
+	uint32_t uiPrevLevelsFiltered;		// read-only.
+}xLIB_BinaryFilterVertical_t;
+
+
+/*
+ * Initializes handle.
+ *
+ * Notes:
+ * 		-	"ucCounterBits" is in the range: [1, 4].
+ * 		-	Bit 'i' of "uiInitialLevels" is the initial level of input 'i'.
+ */
+void vLIB_BinaryFilterVertical_init(	xLIB_BinaryFilterVertical_t* pxHandle,
+										uint8_t ucCounterBits,
+										uint32_t uiInitialLevels	);
+
+/*
+ * Updates filter handle with new sample levels (bit 'i' is input 'i').
+ *
+ * Returns mask of the inputs whose filtered level has changed by this sample.
+ */
+uint32_t uiLIB_BinaryFilterVertical_updateFilter(	xLIB_BinaryFilterVertical_t* pxHandle,
+													uint32_t uiNewLevels	);
+
+
+#endif /* COTS_OS_INC_LIB_BINARYFILTER_BINARYFILTERVERTICAL_H_ */
@@ -18,5 +18,82 @@ uint8_t ucLIB_CRC_getCrc7(uint8_t* pucArr, uint32_t uiLen);
  */
 uint16_t usLIB_CRC_getCrc16(uint8_t* pucArr, uint32_t uiLen);
 
+/*
+ * Returns CRC-32 (IEEE 802.3) of a given array.
+ */
+uint32_t uiLIB_CRC_getCrc32(uint8_t* pucArr, uint32_t uiLen);
+
+/*******************************************************************************
+ * Incremental API:
+ *
+ * Used when data is not available in a single contiguous array (i.e.: received
+ * in chunks, or framed with headers stored elsewhere). Example:
+ *
+ * 		uint32_t uiCrc = uiLIB_CRC_initCrc32();
+ * 		uiCrc = uiLIB_CRC_updateCrc32(uiCrc, pucHeader, uiHeaderLen);
+ * 		uiCrc = uiLIB_CRC_updateCrc32(uiCrc, pucPayload, uiPayloadLen);
+ * 		uiCrc = uiLIB_CRC_finalCrc32(uiCrc);
+ *
+ * Result equals that of calling the single-call function on the concatenated
+ * chunks.
+ ******************************************************************************/
+/*
+ * Returns initial value of a CRC-7 computation.
+ */
+uint8_t ucLIB_CRC_initCrc7(void);
+
+/*
+ * Updates a running CRC-7 with a given chunk.
+ *
+ * Notes:
+ * 		-	Bytes of the chunk are processed from last to first (same as in
+ * 			"ucLIB_CRC_getCrc7()"). Therefore, chunks must be passed in reverse
+ * 			order as well.
+ */
+uint8_t ucLIB_CRC_updateCrc7(uint8_t ucCrc, const uint8_t* pucArr, uint32_t uiLen);
+
+/*
+ * Returns final CRC-7 of a running computation.
+ */
+uint8_t ucLIB_CRC_finalCrc7(uint8_t ucCrc);
+
+/*
+ * Returns initial value of a CRC-16 computation.
+ */
+uint16_t usLIB_CRC_initCrc16(void);
+
+/*
+ * Updates a running CRC-16 with a given chunk.
+ *
+ * Notes:
+ * 		-	Processes "uiCONF_CRC_SLICE_SIZE" bytes per iteration (See
+ * 			"CRC_Config.h").
+ */
+uint16_t usLIB_CRC_updateCrc16(uint16_t usCrc, const uint8_t* pucArr, uint32_t uiLen);
+
+/*
+ * Returns final CRC-16 of a running computation.
+ */
+uint16_t usLIB_CRC_finalCrc16(uint16_t usCrc);
+
+/*
+ * Returns initial value of a CRC-32 computation.
+ */
+uint32_t uiLIB_CRC_initCrc32(void);
+
+/*
+ * Updates a running CRC-32 with a given chunk.
+ *
+ * Notes:
+ * 		-	Processes "uiCONF_CRC_SLICE_SIZE" bytes per iteration (See
+ * 			"CRC_Config.h").
+ */
+uint32_t uiLIB_CRC_updateCrc32(uint32_t uiCrc, const uint8_t* pucArr, uint32_t uiLen);
+
+/*
+ * Returns final CRC-32 of a running computation.
+ */
+uint32_t uiLIB_CRC_finalCrc32(uint32_t uiCrc);
+
 
 #endif /* COTS_OS_INC_LIB_CRC_CRC_H_ */
@@ -0,0 +1,33 @@
+/*
+ * CRC_Config.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COTS_OS_INC_LIB_CRC_CRC_CONFIG_H_
+#define COTS_OS_INC_LIB_CRC_CRC_CONFIG_H_
+
+/*
+ * Number of bytes processed per iteration by CRC-16 and CRC-32 functions.
+ *
+ * Notes:
+ * 		-	Must be 1, 4 or 8.
+ *
+ * 		-	A slice size of N uses (N - 1) extra lookup tables per CRC type,
+ * 			all placed in flash:
+ * 				CRC-16: (N - 1) * 512 bytes.
+ * 				CRC-32: (N - 1) * 1024 bytes.
+ *
+ * 		-	Larger slice size means less table lookup dependency chains, and
+ * 			hence faster computation of long arrays (i.e.: SD-card blocks).
+ *
+ * 		-	Could be overridden from the compiler's command line (i.e.: by the
+ * 			host test, "CRC_Test.c", to test all slice sizes).
+ */
+#ifndef uiCONF_CRC_SLICE_SIZE
+#define uiCONF_CRC_SLICE_SIZE			4
+#endif
+
+
+
+#endif /* COTS_OS_INC_LIB_CRC_CRC_CONFIG_H_ */
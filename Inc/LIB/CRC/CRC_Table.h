@@ -8,8 +8,16 @@
 #ifndef COTS_OS_INC_LIB_CRC_CRC_TABLE_H_
 #define COTS_OS_INC_LIB_CRC_CRC_TABLE_H_
 
+#include "LIB/CRC/CRC_Config.h"
+
 extern const uint8_t pucCrc7Table[256];
 extern const uint16_t pusCrc16Table[256];
+extern const uint32_t puiCrc32Table[256];
+
+#if uiCONF_CRC_SLICE_SIZE > 1
+extern const uint16_t ppusCrc16SliceTable[uiCONF_CRC_SLICE_SIZE - 1][256];
+extern const uint32_t ppuiCrc32SliceTable[uiCONF_CRC_SLICE_SIZE - 1][256];
+#endif
 
 
 #endif /* COTS_OS_INC_LIB_CRC_CRC_TABLE_H_ */
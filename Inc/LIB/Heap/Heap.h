@@ -7,6 +7,10 @@
  * References:
  * 		-	"Data Structures and Algorithms in C++. Michael Goodrich": 8.3.1 The
  * 			Heap Data Structure.
+ *
+ * Notes:
+ * 		-	This heap is bound to "xCONF_VECTOR_ELEM_TYPE" and "ucCONF_HEAP_COMPARE".
+ * 			For heaps of other element types / comparators, see "TypedHeap.h".
  */
 
 #ifndef COTS_OS_INC_LIB_HEAP_H_
@@ -0,0 +1,228 @@
+/*
+ * TypedHeap.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * References:
+ * 		-	"Data Structures and Algorithms in C++. Michael Goodrich": 8.3.1 The
+ * 			Heap Data Structure, 8.3.6 Bottom-Up Heap Construction.
+ *
+ * Type-generic heap (priority queue).
+ *
+ * Unlike "xLIB_Heap_t", which is bound to "xCONF_VECTOR_ELEM_TYPE" and to a
+ * single global "ucCONF_HEAP_COMPARE", every instantiation of this heap has its
+ * own element type, comparator and storage. Hence, many heaps of different
+ * types can co-exist in the same firmware (i.e.: a timer queue and a task
+ * scheduling queue).
+ *
+ * Usage example:
+ *
+ * 		typedef struct{
+ * 			uint32_t uiDeadline;
+ * 			void* pvCallback;
+ * 		}xTimer_t;
+ *
+ * 		static inline uint8_t ucCompareTimers(const xTimer_t* px1, const xTimer_t* px2)
+ * 		{
+ * 			return px1->uiDeadline <= px2->uiDeadline;
+ * 		}
+ *
+ * 		vLIB_TYPED_HEAP_DEFINE(Timer, xTimer_t, ucCompareTimers, 4)
+ *
+ * 		static xTimer_t pxTimerArr[32];
+ * 		static xLIB_Heap_Timer_t xTimerHeap;
+ *
+ * 		vLIB_Heap_Timer_init(&xTimerHeap, pxTimerArr, 32);
+ * 		ucLIB_Heap_Timer_push(&xTimerHeap, &xNewTimer);
+ *
+ * Notes:
+ * 		-	Comparator evaluates to 1 if its first argument is considered of more
+ * 			priority to be closer to heap's top than its second argument.
+ * 			Otherwise, it evaluates to 0. (Same as "ucCONF_HEAP_COMPARE")
+ *
+ * 		-	Arity is the number of children per node, 2 (binary heap) or 4. A
+ * 			4-ary heap is half as deep, so push and pop access fewer, closer
+ * 			nodes, at the cost of more comparisons per level.
+ *
+ * 		-	Storage is "uiCapacity" elements, allocated by the user.
+ *
+ * 		-	Heap handles have no mutex. If a heap is shared between tasks, user
+ * 			should protect it.
+ *
+ * 		-	Elements are moved (not swapped) while sifting, a node is written
+ * 			once per level.
+ */
+
+#ifndef COTS_OS_INC_LIB_HEAP_TYPEDHEAP_H_
+#define COTS_OS_INC_LIB_HEAP_TYPEDHEAP_H_
+
+#include "stdint.h"
+
+/*
+ * Instantiates a heap of elements of type "xElemType", named "Name".
+ *
+ * Defines:
+ * 		-	Handle type:	xLIB_Heap_<Name>_t
+ *
+ * 		-	vLIB_Heap_<Name>_init(pxHeap, pxArr, uiCapacity):
+ * 			Initializes an empty heap, using "pxArr" as its storage.
+ *
+ * 		-	uiLIB_Heap_<Name>_getSize(pxHeap):
+ * 			Returns number of elements in the heap.
+ *
+ * 		-	pxLIB_Heap_<Name>_getTopPtr(pxHeap):
+ * 			Returns pointer to top of the heap (NULL if empty). O(1).
+ *
+ * 		-	ucLIB_Heap_<Name>_push(pxHeap, pxNewElem):
+ * 			Adds new element. Returns 1 if added, 0 if heap is full. O(log(n)).
+ *
+ * 		-	ucLIB_Heap_<Name>_pop(pxHeap, pxTop):
+ * 			Removes top of the heap, and copies it to "pxTop" (if not NULL).
+ * 			Returns 1 if removed, 0 if heap is empty. O(log(n)).
+ *
+ * 		-	vLIB_Heap_<Name>_replaceTop(pxHeap, pxNewElem):
+ * 			Replaces top of the heap with a new element. Equivalent to pop then
+ * 			push, in a single sift (i.e.: rescheduling a periodic timer).
+ * 			Heap must not be empty. O(log(n)).
+ *
+ * 		-	vLIB_Heap_<Name>_build(pxHeap, uiSize):
+ * 			Makes a heap of the first "uiSize" elements already written in the
+ * 			storage array (bottom-up heap construction). O(n).
+ */
+#define vLIB_TYPED_HEAP_DEFINE(Name, xElemType, ucCompare, ucArity)			\
+																				\
+typedef struct{																	\
+	/*		PRIVATE		*/														\
+	xElemType* pxArr;															\
+	uint32_t uiSize;															\
+	uint32_t uiCapacity;														\
+}xLIB_Heap_##Name##_t;															\
+																				\
+static inline void vLIB_Heap_##Name##_siftUp(								\
+	xLIB_Heap_##Name##_t* pxHeap, uint32_t uiIndex, const xElemType* pxElem)	\
+{																				\
+	uint32_t uiParent;															\
+																				\
+	/*	Move parents down until a proper place of "pxElem" is found	*/			\
+	while (uiIndex > 0)															\
+	{																			\
+		uiParent = (uiIndex - 1) / (ucArity);									\
+		if (ucCompare(&pxHeap->pxArr[uiParent], pxElem))						\
+			break;																\
+		pxHeap->pxArr[uiIndex] = pxHeap->pxArr[uiParent];						\
+		uiIndex = uiParent;														\
+	}																			\
+																				\
+	pxHeap->pxArr[uiIndex] = *pxElem;											\
+}																				\
+																				\
+static inline void vLIB_Heap_##Name##_siftDown(								\
+	xLIB_Heap_##Name##_t* pxHeap, uint32_t uiIndex, const xElemType* pxElem)	\
+{																				\
+	uint32_t uiSize = pxHeap->uiSize;											\
+	uint32_t uiChild, uiBest, uiLast;											\
+																				\
+	/*	Move higher priority children up until a proper place is found	*/		\
+	while (1)																	\
+	{																			\
+		uiChild = (ucArity) * uiIndex + 1;										\
+		if (uiChild >= uiSize)													\
+			break;																\
+																				\
+		/*	Find the highest priority child	*/									\
+		uiLast = uiChild + (ucArity);											\
+		if (uiLast > uiSize)													\
+			uiLast = uiSize;													\
+		uiBest = uiChild;														\
+		for (uiChild++; uiChild < uiLast; uiChild++)							\
+		{																		\
+			if (!ucCompare(&pxHeap->pxArr[uiBest], &pxHeap->pxArr[uiChild]))	\
+				uiBest = uiChild;												\
+		}																		\
+																				\
+		if (ucCompare(pxElem, &pxHeap->pxArr[uiBest]))							\
+			break;																\
+																				\
+		pxHeap->pxArr[uiIndex] = pxHeap->pxArr[uiBest];							\
+		uiIndex = uiBest;														\
+	}																			\
+																				\
+	pxHeap->pxArr[uiIndex] = *pxElem;											\
+}																				\
+																				\
+static inline void vLIB_Heap_##Name##_init(									\
+	xLIB_Heap_##Name##_t* pxHeap, xElemType* pxArr, uint32_t uiCapacity)		\
+{																				\
+	pxHeap->pxArr = pxArr;														\
+	pxHeap->uiSize = 0;															\
+	pxHeap->uiCapacity = uiCapacity;											\
+}																				\
+																				\
+static inline uint32_t uiLIB_Heap_##Name##_getSize(							\
+	const xLIB_Heap_##Name##_t* pxHeap)											\
+{																				\
+	return pxHeap->uiSize;														\
+}																				\
+																				\
+static inline xElemType* pxLIB_Heap_##Name##_getTopPtr(						\
+	xLIB_Heap_##Name##_t* pxHeap)												\
+{																				\
+	return (pxHeap->uiSize > 0) ? &pxHeap->pxArr[0] : (xElemType*)0;			\
+}																				\
+																				\
+static inline uint8_t ucLIB_Heap_##Name##_push(								\
+	xLIB_Heap_##Name##_t* pxHeap, const xElemType* pxNewElem)					\
+{																				\
+	if (pxHeap->uiSize >= pxHeap->uiCapacity)									\
+		return 0;																\
+																				\
+	vLIB_Heap_##Name##_siftUp(pxHeap, pxHeap->uiSize++, pxNewElem);			\
+	return 1;																	\
+}																				\
+																				\
+static inline uint8_t ucLIB_Heap_##Name##_pop(								\
+	xLIB_Heap_##Name##_t* pxHeap, xElemType* pxTop)								\
+{																				\
+	if (pxHeap->uiSize == 0)													\
+		return 0;																\
+																				\
+	if (pxTop != (xElemType*)0)													\
+		*pxTop = pxHeap->pxArr[0];												\
+																				\
+	/*	Last element floats down from the root	*/								\
+	pxHeap->uiSize--;															\
+	if (pxHeap->uiSize > 0)														\
+	{																			\
+		xElemType xLast = pxHeap->pxArr[pxHeap->uiSize];						\
+		vLIB_Heap_##Name##_siftDown(pxHeap, 0, &xLast);							\
+	}																			\
+	return 1;																	\
+}																				\
+																				\
+static inline void vLIB_Heap_##Name##_replaceTop(							\
+	xLIB_Heap_##Name##_t* pxHeap, const xElemType* pxNewElem)					\
+{																				\
+	xElemType xNew = *pxNewElem;												\
+	vLIB_Heap_##Name##_siftDown(pxHeap, 0, &xNew);								\
+}																				\
+																				\
+static inline void vLIB_Heap_##Name##_build(									\
+	xLIB_Heap_##Name##_t* pxHeap, uint32_t uiSize)								\
+{																				\
+	xElemType xElem;															\
+																				\
+	pxHeap->uiSize = uiSize;													\
+	if (uiSize < 2)																\
+		return;																	\
+																				\
+	/*	Sift down every internal node, starting from the last one	*/			\
+	for (uint32_t i = (uiSize - 2) / (ucArity) + 1; i > 0; i--)				\
+	{																			\
+		xElem = pxHeap->pxArr[i - 1];											\
+		vLIB_Heap_##Name##_siftDown(pxHeap, i - 1, &xElem);						\
+	}																			\
+}
+
+
+
+#endif /* COTS_OS_INC_LIB_HEAP_TYPEDHEAP_H_ */
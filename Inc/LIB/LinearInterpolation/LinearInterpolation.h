@@ -8,6 +8,29 @@
 #ifndef COTS_OS_INC_LIB_LINEARINTERPOLATION_LINEARINTERPOLATION_H_
 #define COTS_OS_INC_LIB_LINEARINTERPOLATION_LINEARINTERPOLATION_H_
 
+/*
+ * Prepared interpolation table.
+ *
+ * Slope of each segment is calculated once on initialization, so a lookup
+ * costs one segment search and one multiplication (no division).
+ */
+typedef struct{
+	/*		PRIVATE		*/
+	const int32_t* piXArr;
+	const int32_t* piYArr;
+	uint32_t uiLen;
+
+	/*	Slope of segment 'i' (between points 'i' and 'i+1'), in Q16	*/
+	int32_t* piSlopeArr;
+
+	/*
+	 * If 'x' values are uniformly spaced, segment index is calculated directly
+	 * as: ((x - x[0]) * uiInvStep) >> 32, instead of searching for it.
+	 */
+	uint8_t ucIsUniform;
+	uint32_t uiInvStep;
+}xLIB_LinearInterpolation_t;
+
 /*
  * Notes:
  * 		-	"piXArr": contains 'x' values sorted in an ascending order.
@@ -16,6 +39,10 @@
  * 		-	"iX": value of 'x' for which the interpolation is to be made.
  *
  * 		-	return: interpolated value of 'y'.
+ *
+ * 		-	Segment is found using binary search, but a division is still made
+ * 			on every call. For tables that are evaluated frequently, use the
+ * 			prepared table API below.
  */
 int32_t iLIB_LinearInterpolation_interpolate(
 		int32_t* piXArr,
@@ -24,6 +51,58 @@ int32_t iLIB_LinearInterpolation_interpolate(
 		int32_t iX
 	);
 
+/*
+ * Initializes a prepared table handle.
+ *
+ * Notes:
+ * 		-	"piXArr": contains 'x' values sorted in a strictly ascending order.
+ * 		-	"piYArr": contains 'y' values.
+ * 		-	"uiLen": number of samples stored in "piXArr" and "piYArr", must be at least 2.
+ * 		-	"piSlopeArr": array of ("uiLen" - 1) elements, allocated by user.
+ *
+ * 		-	"piXArr" and "piYArr" are not copied, and must remain valid (i.e.:
+ * 			const tables in flash).
+ *
+ * 		-	Uniform spacing of 'x' values is detected automatically.
+ *
+ * 		-	Returns 1 if initialized successfully. Otherwise, if "uiLen" is less
+ * 			than 2, 'x' values are not strictly ascending, or a segment's slope
+ * 			does not fit in Q16 (|dy / dx| >= 32768), returns 0.
+ */
+uint8_t ucLIB_LinearInterpolation_init(
+		xLIB_LinearInterpolation_t* pxHandle,
+		const int32_t* piXArr,
+		const int32_t* piYArr,
+		uint32_t uiLen,
+		int32_t* piSlopeArr
+	);
+
+/*
+ * Returns interpolated value of 'y' at "iX", rounded to the nearest integer.
+ *
+ * Notes:
+ * 		-	Values out of the range of "piXArr" are extrapolated using the first
+ * 			or last segment.
+ *
+ * 		-	Complexity: O(1) for uniformly spaced 'x' values, O(log(n)) otherwise.
+ */
+int32_t iLIB_LinearInterpolation_get(
+		xLIB_LinearInterpolation_t* pxHandle,
+		int32_t iX
+	);
+
+/*
+ * Same as "iLIB_LinearInterpolation_get()", but returns 'y' in Q16 (16
+ * fractional bits).
+ *
+ * Notes:
+ * 		-	Result must be in the range of Q16 (-32768 <= y < 32768).
+ */
+int32_t iLIB_LinearInterpolation_getQ16(
+		xLIB_LinearInterpolation_t* pxHandle,
+		int32_t iX
+	);
+
 
 
 #endif /* COTS_OS_INC_LIB_LINEARINTERPOLATION_LINEARINTERPOLATION_H_ */
@@ -9,16 +9,22 @@
 #define COTS_OS_INC_LIB_NAVGFILTER_NAVGFILTER_H_
 
 #include "FreeRTOS.h"
-#include "queue.h"
 #include "semphr.h"
 
 typedef struct{
 	/*		PRIVATE		*/
-	StaticQueue_t xQueueStatic;
-	QueueHandle_t xQueue;
+	int32_t* piDataArr;
+	uint32_t uiIndex;
 
 	int32_t iSum;
 
+	/*
+	 * If "uiN" is a power of two, average is calculated by shifting the sum
+	 * right "ucLog2N" times, instead of dividing by "uiN".
+	 */
+	uint8_t ucIsNPowerOfTwo;
+	uint8_t ucLog2N;
+
 	/*		PUBLIC		*/
 	/*
 	 * Number of samples of a single filtering window.
@@ -30,9 +36,11 @@ typedef struct{
 	 *
 	 * Notes:
 	 * 		-	Read only.
-	 * 		-	Mutex of the handle must be locked first before reading.
+	 * 		-	Mutex of the handle must be locked first before reading, unless
+	 * 			the filter is updated from ISR only (See
+	 * 			"vLIB_NAvgFilter_updateFromISR()").
 	 */
-	int32_t iAvg;
+	volatile int32_t iAvg;
 
 	StaticSemaphore_t xMutexStatic;
 	SemaphoreHandle_t xMutex;
@@ -42,12 +50,16 @@ typedef struct{
 /*
  * Initializes handle.
  *
- * 		-	"piDataArr": Array of data, used as queue's memory. Must be allocated
- * 			by user, casted, and assigned to this pointer.
+ * 		-	"piDataArr": Array of data, used as ring buffer's memory. Must be
+ * 			allocated by user.
  *
  *	 	-	"uiN": Number of samples in the averaging window. ("piDataArr" must
  *	 		be of a length that is greater than or equal to "uiN").
  *
+ *	 	-	If "uiN" is a power of two, average is calculated using a shift
+ *	 		instead of a division. In this case, average of a negative sum is
+ *	 		rounded towards negative infinity instead of towards zero.
+ *
  *	 	-	Must be called before scheduler start.
  */
 void vLIB_NAvgFilter_init(	xLIB_NAvgFilter_t* pxHandle,
@@ -68,10 +80,31 @@ void vLIB_NAvgFilter_update(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal);
  *
  * 		-	Could be used in an ISR.
  *
- * 		-	Mutex of the handle must be locked first before updating.
+ * 		-	Safe for a single ISR producer and task consumers, given that the
+ * 			ISR is the only one updating the filter. Consumers may then read
+ * 			"iAvg" directly without locking the mutex, as it is written once per
+ * 			update in a single word store.
  */
 void vLIB_NAvgFilter_updateFromISR(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal);
 
+/*
+ * Updates filter with a block of new values (i.e.: a DMA-filled buffer).
+ *
+ * 		-	Equivalent to calling "vLIB_NAvgFilter_update()" for each element
+ * 			of "piArr" in order, but "iAvg" is calculated only once at the end.
+ *
+ * 		-	If "uiCount" is greater than or equal to "uiN", only the last "uiN"
+ * 			values are used, as older ones would be pushed out of the window
+ * 			anyway.
+ *
+ * 		-	Could be used in an ISR, with the same restrictions of
+ * 			"vLIB_NAvgFilter_updateFromISR()". Otherwise, mutex of the handle
+ * 			must be locked first before updating.
+ */
+void vLIB_NAvgFilter_updateBatch(	xLIB_NAvgFilter_t* pxHandle,
+									const int32_t* piArr,
+									uint32_t uiCount	);
+
 
 
 
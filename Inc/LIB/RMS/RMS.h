@@ -9,38 +9,84 @@
 #define COTS_OS_INC_LIB_RMS_RMS_H_
 
 #include "FreeRTOS.h"
-#include "queue.h"
 #include "semphr.h"
 
+typedef enum{
+	/*
+	 * RMS is calculated over the last "uiN" samples, and is updated with every
+	 * new sample.
+	 */
+	xLIB_RMS_Window_Sliding,
+
+	/*
+	 * Samples are divided into consecutive non-overlapping windows of "uiN"
+	 * samples each (i.e.: one mains cycle). RMS is updated once every window
+	 * is completed.
+	 */
+	xLIB_RMS_Window_Tumbling
+}xLIB_RMS_Window_t;
+
 typedef struct{
 	/*		PRIVATE		*/
-	StaticQueue_t xQueueStatic;
-	QueueHandle_t xQueue;
-
 	StaticSemaphore_t xMutexStatic;
 	SemaphoreHandle_t xMutex;
 
-	float fSum;
+	xLIB_RMS_Window_t xWindow;
+
+	/*
+	 * Sliding window: ring of squares of the last "uiN" samples.
+	 * Tumbling window: not used.
+	 */
+	uint32_t* puiSquareArr;
+	uint32_t uiIndex;
+
+	/*
+	 * Sum of squares of the current window. Squares and their sum are exact
+	 * integers, so there's no accumulation drift.
+	 */
+	uint64_t ulSum;
 
-	float fX0;
-	float fXN_1;
+	/*	Sum of squares of the last completed window (tumbling window only)	*/
+	uint64_t ulLastSum;
+
+	int16_t sOffset;
 
 	uint32_t uiN;
+
+	/*		PUBLIC		*/
+	/*
+	 * Number of completed tumbling windows since initialization.
+	 *
+	 * Notes:
+	 * 		-	Read only.
+	 * 		-	Could be used by the user to detect completion of a new window.
+	 */
+	volatile uint32_t uiNumberOfWindows;
 }xLIB_RMS_t;
 
 
 /*
  * Initializes handle.
  *
- * 		-	"piDataArr": Array of data, used as queue's memory. Must be allocated
- * 			by user, casted, and assigned to this pointer.
+ * 		-	"xWindow": Sliding or tumbling window. (See "xLIB_RMS_Window_t")
+ *
+ *	 	-	"uiN": Number of samples in the window.
  *
- *	 	-	"uiN": Number of samples in the averaging window. ("piDataArr" must
- *	 		be of a length that is greater than or equal to: ("uiN" - 2)).
+ * 		-	"puiSquareArr": Array of "uiN" elements, must be allocated by user.
+ * 			Only used in the sliding window mode, could be NULL otherwise.
+ *
+ * 		-	"sOffset": Value subtracted from every sample before squaring it
+ * 			(i.e.: mid-scale of a biased ADC input, 2048 for a 12-bit ADC).
+ * 			Zero for signed (Q15) inputs.
+ *
+ * 		-	Samples are signed 16-bit values. Raw ADC values are interpreted
+ * 			as-is, and Q15 values give an RMS value in Q15.
  */
 void vLIB_RMS_init(	xLIB_RMS_t* pxHandle,
-					float* piDataArr,
-					uint32_t uiN	);
+					xLIB_RMS_Window_t xWindow,
+					uint32_t uiN,
+					uint32_t* puiSquareArr,
+					int16_t sOffset	);
 
 /*
  * Locks handle.
@@ -59,19 +105,60 @@ void vLIB_RMS_unlock(xLIB_RMS_t* pxHandle);
  *
  * 		-	Mutex of the handle must be locked first before updating.
  */
-void vLIB_RMS_update(xLIB_RMS_t* pxHandle, float fNewVal);
+void vLIB_RMS_update(xLIB_RMS_t* pxHandle, int16_t sNewVal);
 
 /*
  * Updates filter with new value.
  *
  * 		-	Could be used in an ISR.
  *
- * 		-	Mutex of the handle must be locked first before updating.
+ * 		-	ISR must be the only one updating the handle.
  */
-void vLIB_RMS_updateFromISR(xLIB_RMS_t* pxHandle, float fNewVal);
+void vLIB_RMS_updateFromISR(xLIB_RMS_t* pxHandle, int16_t sNewVal);
 
+/*
+ * Updates filter with a block of new values.
+ *
+ * 		-	Intended for half/full DMA buffers (i.e.: after
+ * 			"ucHOS_DMA_blockUntilHalfTransferComplete()" or
+ * 			"ucHOS_DMA_blockUntilTransferComplete()" return).
+ *
+ * 		-	"uiStride": Distance (in samples) between two consecutive samples of
+ * 			this channel in "psArr". (1 for a single channel buffer, number of
+ * 			channels for an interleaved multi-channel scan buffer)
+ *
+ * 		-	Equivalent to calling "vLIB_RMS_update()" for every sample in the
+ * 			block. Blocks may cross boundaries of tumbling windows.
+ *
+ * 		-	Mutex of the handle must be locked first before updating, unless
+ * 			called from an ISR with the same restriction of
+ * 			"vLIB_RMS_updateFromISR()".
+ */
+void vLIB_RMS_updateBlock(	xLIB_RMS_t* pxHandle,
+							const int16_t* psArr,
+							uint32_t uiCount,
+							uint32_t uiStride	);
+
+/*
+ * Returns RMS value, in the same units of the input samples.
+ *
+ * 		-	Sliding window: RMS of the last "uiN" samples.
+ * 		-	Tumbling window: RMS of the last completed window.
+ *
+ * 		-	Mutex of the handle must be locked first.
+ *
+ * 		-	If the handle is updated from an ISR, that ISR's priority must be one
+ * 			from which FreeRTOS API could be called (masked by critical
+ * 			sections), as the window sum is copied in a critical section.
+ */
 float fLIB_RMS_getValue(xLIB_RMS_t* pxHandle);
 
+/*
+ * Same as "fLIB_RMS_getValue()", but uses integer arithmetic only (no FPU /
+ * soft-float). Result is truncated.
+ */
+uint16_t usLIB_RMS_getValueInt(xLIB_RMS_t* pxHandle);
+
 
 
 
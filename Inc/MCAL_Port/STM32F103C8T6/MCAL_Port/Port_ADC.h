@@ -57,6 +57,16 @@ extern const uint32_t pxPortADCChannelsArr[];
  */
 extern const uint8_t pucPortADCTriggeringTimerUnitNumber[];
 
+/*
+ * Whether ADC unit has a DMA request, and the DMA unit and channel it is
+ * connected to ({unit, channel}, valid only if it has).
+ */
+extern const uint8_t pucPortADCDoesUnitSupportDMA[];
+extern const uint8_t ppucPortADCDmaMapping[][2];
+
+/*	Maximum number of channels in a (regular) scan sequence	*/
+#define ucPORT_ADC_MAX_SEQUENCE_LENGTH				(	16	)
+
 /*******************************************************************************
  * API functions / macros:
  ******************************************************************************/
@@ -131,6 +141,35 @@ void vPort_ADC_setTriggerSource(uint8_t ucUnitNumber, uint8_t ucSrc);
  */
 void vPort_ADC_setConversionMode(uint8_t ucUnitNumber, uint8_t ucMode);
 
+/*
+ * Programs the unit's regular sequence, and enables scan mode. A trigger then
+ * converts all channels of the sequence, in order, back to back.
+ *
+ * Notes:
+ * 		-	"ucLength" is 1 to "ucPORT_ADC_MAX_SEQUENCE_LENGTH".
+ */
+void vPort_ADC_setScanSequence(	uint8_t ucUnitNumber,
+								const uint8_t* pucChannelArr,
+								uint8_t ucLength	);
+
+/*
+ * Restores single channel conversions (sequence of rank 1 only, scan mode
+ * disabled).
+ */
+void vPort_ADC_clearScanSequence(uint8_t ucUnitNumber);
+
+/*	Enables DMA request on every regular conversion (unlimited, for circular DMA)	*/
+#define vPORT_ADC_ENABLE_DMA_REQUEST(ucUnitNumber)	\
+	(LL_ADC_REG_SetDMATransfer(pxPortADCArr[(ucUnitNumber)], LL_ADC_REG_DMA_TRANSFER_UNLIMITED))
+
+/*	Disables DMA request	*/
+#define vPORT_ADC_DISABLE_DMA_REQUEST(ucUnitNumber)	\
+	(LL_ADC_REG_SetDMATransfer(pxPortADCArr[(ucUnitNumber)], LL_ADC_REG_DMA_TRANSFER_NONE))
+
+/*	Gets address of DR (DMA source)	*/
+#define pvPORT_ADC_GET_DR_ADDRESS(ucUnitNumber)	\
+	((void*)&pxPortADCArr[(ucUnitNumber)]->DR)
+
 
 
 
@@ -133,6 +133,20 @@ void vPort_DIO_initPinOutputOpenDrainPU(uint8_t ucPortNumber, uint8_t ucPinNumbe
 #define uiPORT_DIO_READ_PORT(ucPortNumber)	\
 	(	pxPortDioPortArr[(ucPortNumber)]->IDR	)
 
+/*
+ * Sets and resets pins of a port in a single write.
+ *
+ * Notes:
+ * 		-	Bit 'i' of "uiSetResetWord" sets pin 'i' (high level), and bit
+ * 			(16 + i) resets it (low level). Pins of zero bits are not changed.
+ *
+ * 		-	Write is atomic, no read-modify-write of the port is made.
+ *
+ * 		-	Pins must be initially initialized as digital outputs.
+ */
+#define vPORT_DIO_WRITE_PORT_SET_RESET(ucPortNumber, uiSetResetWord)	\
+	(	pxPortDioPortArr[(ucPortNumber)]->BSRR = (uiSetResetWord)	)
+
 #endif /* HAL_OS_PORT_PORT_DIO_H_ */
 
 
@@ -63,6 +63,7 @@ extern void (*ppfPortSpiRxneCallbackArr[portSPI_NUMBER_OF_UNITS])(void*);
 extern void* ppvPortSpiRxneCallbackParamsArr[portSPI_NUMBER_OF_UNITS];
 
 extern const uint8_t ppucPortSpiTxeDmaMapping[portSPI_NUMBER_OF_UNITS][2];
+extern const uint8_t ppucPortSpiRxneDmaMapping[portSPI_NUMBER_OF_UNITS][2];
 
 /*******************************************************************************
  * Helping structures:
@@ -363,6 +364,33 @@ static inline void vPort_SPI_disconnectTxeFromDma(uint8_t ucSpiUnitNumber)
 	LL_SPI_DisableDMAReq_TX(pxPortSpiArr[ucSpiUnitNumber]);
 }
 
+/*
+ * Connects SPI unit's RxNE signal to the given DMA channel.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ *
+ * 		-	If the used target has static DMA mapping, the DMA connection passed
+ * 			to this function is ignored.
+ */
+static inline void vPort_SPI_connectRxneToDma(	uint8_t ucSpiUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	LL_SPI_EnableDMAReq_RX(pxPortSpiArr[ucSpiUnitNumber]);
+}
+
+/*
+ * Disconnects SPI unit's RxNE signal from DMA.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ */
+static inline void vPort_SPI_disconnectRxneFromDma(uint8_t ucSpiUnitNumber)
+{
+	LL_SPI_DisableDMAReq_RX(pxPortSpiArr[ucSpiUnitNumber]);
+}
+
 /*
  * Initializes HW of an SPI unit.
  *
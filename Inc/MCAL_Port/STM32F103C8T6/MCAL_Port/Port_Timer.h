@@ -201,7 +201,7 @@ void vPort_TIM_setCcCallback(	uint8_t ucUnitNumber,
  * Disables counter.
  */
 #define vPORT_TIM_DISABLE_COUNTER(ucUnitNumber)	\
-	 (	LL_TIM_EnableCounter(pxPortTimArr[(ucUnitNumber)])	)
+	 (	LL_TIM_DisableCounter(pxPortTimArr[(ucUnitNumber)])	)
 
 /*
  * Sets output compare register.
@@ -307,6 +307,33 @@ void vPort_TIM_generateOnePulse(	uint8_t ucUnitNumber,
  */
 void vPort_TIM_enableTriggerOutput(uint8_t ucUnitNumber);
 
+/*
+ * Initializes timer unit in PWM input mode. Channel 1 (number 0) is the input.
+ *
+ * Notes:
+ * 		-	Counter is reset on every rising edge. Capture / compare register of
+ * 			channel 1 captures period (rising to rising), and that of channel 2
+ * 			captures active time (rising to falling), in timer ticks.
+ *
+ * 		-	"uiPrescaler" is the timer clock division factor (i.e.: one of
+ * 			"uiPORT_TIM_PRESCALER_FOR_xx_KHZ" defined values).
+ *
+ * 		-	OVF (update) event is generated only when the counter overflows,
+ * 			that is, when no rising edge occurs for a full counter range.
+ *
+ * 		-	Capture / compare interrupt (of channel 1) occurs on every rising
+ * 			edge.
+ *
+ * 		-	Counter is left disabled.
+ */
+void vPort_TIM_initPwmInput(uint8_t ucUnitNumber, uint32_t uiPrescaler);
+
+/*
+ * Reads capture / compare register of a channel.
+ */
+#define uiPORT_TIM_READ_CC_REGISTER(ucUnitNumber, ucChannelNumber)	\
+	((&(pxPortTimArr[(ucUnitNumber)]->CCR1))[(ucChannelNumber)])
+
 
 
 
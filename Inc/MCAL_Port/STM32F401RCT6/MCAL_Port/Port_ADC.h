@@ -50,6 +50,23 @@ extern const uint32_t pxPortADCChannelsArr[];
 #define iPORT_ADC_TEMP_SENS_B						(	-1395000	)
 #define iPORT_ADC_TEMP_SENS_C						(	5			)
 
+/*
+ * Number of timer unit used as trigger source for the ADC unit. (Used by upper
+ * layer SW when there's a need o synchronize ADC sampling).
+ *
+ */
+extern const uint8_t pucPortADCTriggeringTimerUnitNumber[];
+
+/*
+ * Whether ADC unit has a DMA request, and the DMA unit and channel it is
+ * connected to ({unit, channel}, valid only if it has).
+ */
+extern const uint8_t pucPortADCDoesUnitSupportDMA[];
+extern const uint8_t ppucPortADCDmaMapping[][2];
+
+/*	Maximum number of channels in a (regular) scan sequence	*/
+#define ucPORT_ADC_MAX_SEQUENCE_LENGTH				(	16	)
+
 
 /*******************************************************************************
  * API functions / macros:
@@ -109,6 +126,15 @@ void vPort_ADC_setInterruptCallback(	uint8_t ucUnitNumber,
 #define usPORT_ADC_GET_DR(ucAdcNumber)	\
 	(	LL_ADC_REG_ReadConversionData12(pxPortADCArr[(ucAdcNumber)])	)
 
+/*
+ * Selects conversion triggering source (SW or timer)
+ *
+ * Notes:
+ * 		-	"ucSrc": 0==> SW trigger,	1==> Timer trigger.
+ * 		-	Timer unit is configured in "pucPortADCTriggeringTimerUnitNumber[]".
+ */
+void vPort_ADC_setTriggerSource(uint8_t ucUnitNumber, uint8_t ucSrc);
+
 /*
  * Selects conversion mode.
  *
@@ -117,6 +143,35 @@ void vPort_ADC_setInterruptCallback(	uint8_t ucUnitNumber,
  */
 void vPort_ADC_setConversionMode(uint8_t ucUnitNumber, uint8_t ucMode);
 
+/*
+ * Programs the unit's regular sequence, and enables scan mode. A trigger then
+ * converts all channels of the sequence, in order, back to back.
+ *
+ * Notes:
+ * 		-	"ucLength" is 1 to "ucPORT_ADC_MAX_SEQUENCE_LENGTH".
+ */
+void vPort_ADC_setScanSequence(	uint8_t ucUnitNumber,
+								const uint8_t* pucChannelArr,
+								uint8_t ucLength	);
+
+/*
+ * Restores single channel conversions (sequence of rank 1 only, scan mode
+ * disabled).
+ */
+void vPort_ADC_clearScanSequence(uint8_t ucUnitNumber);
+
+/*	Enables DMA request on every regular conversion (unlimited, for circular DMA)	*/
+#define vPORT_ADC_ENABLE_DMA_REQUEST(ucUnitNumber)	\
+	(LL_ADC_REG_SetDMATransfer(pxPortADCArr[(ucUnitNumber)], LL_ADC_REG_DMA_TRANSFER_UNLIMITED))
+
+/*	Disables DMA request	*/
+#define vPORT_ADC_DISABLE_DMA_REQUEST(ucUnitNumber)	\
+	(LL_ADC_REG_SetDMATransfer(pxPortADCArr[(ucUnitNumber)], LL_ADC_REG_DMA_TRANSFER_NONE))
+
+/*	Gets address of DR (DMA source)	*/
+#define pvPORT_ADC_GET_DR_ADDRESS(ucUnitNumber)	\
+	((void*)&pxPortADCArr[(ucUnitNumber)]->DR)
+
 
 /*******************************************************************************
  * u16Port_ADC_PollingRead.
@@ -72,7 +72,7 @@ typedef struct{
 	void* pvMemoryStartingAdderss;
 	void* pvPeripheralStartingAdderss;
 
-	/*	Number of data units (bytes) to be transferred	*/
+	/*	Number of data units (bytes or half-words) to be transferred	*/
 	uint32_t uiN;
 
 	/*	0 ==> HW trigger source, 1==>MEM2MEM (SW triggering)	*/
@@ -82,8 +82,17 @@ typedef struct{
 //	uint8_t xMemorySize : 2;
 //	uint8_t xPeripheralSize : 2;
 	/*
-	 * For portability, all transfer operations are fixed to a size of 1 byte.
+	 * For portability, memory and peripheral data unit sizes are the same.
+	 * 0 ==> 1 byte, 1 ==> 2 bytes (half-word).
 	 */
+	uint8_t ucDataSize : 1;
+
+	/*
+	 * 0 ==> Normal mode, 1 ==> Circular mode (channel reloads its starting
+	 * addresses and "uiN" at the end of each cycle, and keeps transferring
+	 * until it is stopped).
+	 */
+	uint8_t ucCircularMode : 1;
 
 	/*	Transfer priority level. 0, 1, 2 or 3. Such that 3 is the highest	*/
 	uint8_t ucPriLevel : 2;
@@ -156,14 +165,57 @@ void vPort_DMA_startTransfer(xPort_DMA_TransInfo_t*  pxInfo);
 
 /*
  * Sets callback of transfer complete interrupt of a certain channel.
- *
- * This function should not be changed even when target is changed, as it only
- * uses driver's defined arrays.
  */
 void vPort_DMA_setTransferCompleteCallback(	uint8_t ucUnitNumber,
-															uint8_t ucChannelNumber,
-															void(*pfCallback)(void*),
-															void* pvParams	);
+											uint8_t ucChannelNumber,
+											void(*pfCallback)(void*),
+											void* pvParams	);
+
+/*
+ * Reads transfer half complete flag of a channel.
+ */
+#define ucPort_DMA_GET_THC_FLAG(ucUnitNumber, ucChannelNumber)	\
+	(READ_BIT(pxPort_DmaArr[(ucUnitNumber)]->ISR, 1 << (4*(ucChannelNumber)+2)))
+
+/*
+ * Clears transfer half complete flag of a channel.
+ */
+#define vPort_DMA_CLEAR_THC_FLAG(ucUnitNumber, ucChannelNumber)	\
+		WRITE_REG(pxPort_DmaArr[(ucUnitNumber)]->IFCR, 1ul << (2 + 4 * (ucChannelNumber)));
+
+/*
+ * Enables transfer half complete interrupt of a channel.
+ */
+#define vPORT_DMA_ENABLE_TRANSFER_HALF_COMPLETE_INTERRUPT(ucUnitNumber, ucChannelNumber)	\
+	(	LL_DMA_EnableIT_HT(pxPort_DmaArr[(ucUnitNumber)], (ucChannelNumber) + 1)	)
+
+/*
+ * Disables transfer half complete interrupt of a channel.
+ */
+#define vPORT_DMA_DISABLE_TRANSFER_HALF_COMPLETE_INTERRUPT(ucUnitNumber, ucChannelNumber)	\
+	(	LL_DMA_DisableIT_HT(pxPort_DmaArr[(ucUnitNumber)], (ucChannelNumber) + 1)	)
+
+/*
+ * Sets callback of transfer half complete interrupt of a certain channel.
+ */
+void vPort_DMA_setTransferHalfCompleteCallback(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	);
+
+/*
+ * Reads number of data units remaining in the current transfer (or the current
+ * cycle, in circular mode) of a channel.
+ */
+#define uiPORT_DMA_GET_REMAINING_COUNT(ucUnitNumber, ucChannelNumber)	\
+	(	LL_DMA_GetDataLength(pxPort_DmaArr[(ucUnitNumber)], (ucChannelNumber) + 1)	)
+
+/*
+ * Stops (disables) a channel. A circular transfer only ends this way.
+ */
+#define vPORT_DMA_STOP_TRANSFER(ucUnitNumber, ucChannelNumber)	\
+	(	LL_DMA_DisableChannel(pxPort_DmaArr[(ucUnitNumber)], (ucChannelNumber) + 1)	)
+
 
 
 
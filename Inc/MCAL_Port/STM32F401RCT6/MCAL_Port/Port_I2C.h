@@ -24,6 +24,15 @@
 
 extern I2C_TypeDef* const pxPortI2cArr[];
 
+extern void (*ppfPortI2cEventCallbackArr[])(void*);
+extern void* ppvPortI2cEventCallbackParamsArr[];
+
+extern void (*ppfPortI2cErrorCallbackArr[])(void*);
+extern void* ppvPortI2cErrorCallbackParamsArr[];
+
+/*	Number of units available in the used target	*/
+#define portI2C_NUMBER_OF_UNITS		2
+
 /*******************************************************************************
  * Configurations:
  ******************************************************************************/
@@ -403,6 +412,72 @@ static inline void vPort_I2C_setMaxRisingTime(uint8_t ucUnitNumber, uint32_t uiT
 		((uiPORT_CLOCK_MAIN_HZ / 1 / 2) * (uint64_t)uiTRise) / 1000000000);
 }
 
+/*	Enable event interrupt (SB, ADDR, ADD10, STOPF, BTF)	*/
+static inline void vPort_I2C_enableEventInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_EnableIT_EVT(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*	Disable event interrupt	*/
+static inline void vPort_I2C_disableEventInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_DisableIT_EVT(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*
+ * Enable buffer interrupt (TxE, RxNE).
+ * (Only takes effect when event interrupt is enabled)
+ */
+static inline void vPort_I2C_enableBufferInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_EnableIT_BUF(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*	Disable buffer interrupt	*/
+static inline void vPort_I2C_disableBufferInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_DisableIT_BUF(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*	Enable error interrupt (BERR, ARLO, AF, OVR)	*/
+static inline void vPort_I2C_enableErrorInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_EnableIT_ERR(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*	Disable error interrupt	*/
+static inline void vPort_I2C_disableErrorInterrupt(uint8_t ucUnitNumber)
+{
+	LL_I2C_DisableIT_ERR(pxPortI2cArr[ucUnitNumber]);
+}
+
+/*
+ * Read whether a previously requested stop condition is still pending.
+ * (Start must not be requested before it is generated)
+ */
+static inline uint8_t ucPort_I2C_readStopPendingFlag(uint8_t ucUnitNumber)
+{
+	return READ_BIT(pxPortI2cArr[ucUnitNumber]->CR1, I2C_CR1_STOP) ? 1 : 0;
+}
+
+/*	Sets event interrupt callback	*/
+static inline void vPort_I2C_setEventCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	ppfPortI2cEventCallbackArr[ucUnitNumber] = pfCallback;
+	ppvPortI2cEventCallbackParamsArr[ucUnitNumber] = pvParams;
+}
+
+/*	Sets error interrupt callback	*/
+static inline void vPort_I2C_setErrorCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	ppfPortI2cErrorCallbackArr[ucUnitNumber] = pfCallback;
+	ppvPortI2cErrorCallbackParamsArr[ucUnitNumber] = pvParams;
+}
+
 /*******************************************************************************
  * Interrupt handlers
  ******************************************************************************/
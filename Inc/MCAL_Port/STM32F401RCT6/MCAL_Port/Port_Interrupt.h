@@ -81,6 +81,10 @@ extern const IRQn_Type xPortInterruptPwrPvdIrqNumber;
 
 extern const IRQn_Type pxPortInterruptAdcEocIrqNumberArr[];
 
+extern const IRQn_Type pxPortInterruptI2cEventIrqNumberArr[];
+
+extern const IRQn_Type pxPortInterruptI2cErrorIrqNumberArr[];
+
 /*******************************************************************************
  * IRQ handler code enable.
  * 	As IRQ handlers are forced to be compiled (no optimization could be done to exclude
@@ -97,6 +101,7 @@ extern const IRQn_Type pxPortInterruptAdcEocIrqNumberArr[];
 #define ucPORT_INTERRUPT_IRQ_DEF_UART
 #define ucPORT_INTERRUPT_IRQ_DEF_USB
 #define ucPORT_INTERRUPT_IRQ_DEF_ADC
+#define ucPORT_INTERRUPT_IRQ_DEF_I2C
 
 
 
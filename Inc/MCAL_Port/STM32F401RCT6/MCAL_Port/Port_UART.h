@@ -28,9 +28,24 @@ extern void* ppvPortUartRxneCallbackParamsArr[];
 extern void (*ppfPortUartTcCallbackArr[])(void*);
 extern void* ppvPortUartTcCallbackParamsArr[];
 
+extern void (*ppfPortUartIdleCallbackArr[])(void*);
+extern void* ppvPortUartIdleCallbackParamsArr[];
+
 /*	Number of units available in the used target	*/
 #define portUART_NUMBER_OF_UNITS		3
 
+/*
+ * Mapping state between UART units and DMA (if there's a DMA).
+ *
+ * 0==> Dynamic mapping.
+ * 1==> Static mapping. (Requires configuring the "ppucPortUartTxeDmaMapping[]"
+ * and "ppucPortUartRxneDmaMapping[]")
+ */
+#define portUART_IS_DMA_STATIC_CONNECTED		1
+
+extern const uint8_t ppucPortUartTxeDmaMapping[portUART_NUMBER_OF_UNITS][2];
+extern const uint8_t ppucPortUartRxneDmaMapping[portUART_NUMBER_OF_UNITS][2];
+
 /*	Initializes UART HW	*/
 static inline void vPort_UART_initHW(uint8_t ucUnitNumber)
 {
@@ -122,6 +137,69 @@ static inline uint8_t ucPort_UART_readByte(uint8_t ucUnitNumber)
 	return LL_USART_ReceiveData8(pxPortUartArr[ucUnitNumber]);
 }
 
+/*
+ * Returns pointer to unit's data register.
+ * (Used when DMA is enabled).
+ */
+static inline void* pvPort_UART_getDrAddress(uint8_t ucUnitNumber)
+{
+	return (void*)(&pxPortUartArr[ucUnitNumber]->DR);
+}
+
+/*
+ * Connects UART unit's TxE signal to the given DMA channel.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ *
+ * 		-	If the used target has static DMA mapping, the DMA connection passed
+ * 			to this function is ignored.
+ */
+static inline void vPort_UART_connectTxeToDma(	uint8_t ucUartUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	LL_USART_EnableDMAReq_TX(pxPortUartArr[ucUartUnitNumber]);
+}
+
+/*
+ * Disconnects UART unit's TxE signal from DMA.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ */
+static inline void vPort_UART_disconnectTxeFromDma(uint8_t ucUartUnitNumber)
+{
+	LL_USART_DisableDMAReq_TX(pxPortUartArr[ucUartUnitNumber]);
+}
+
+/*
+ * Connects UART unit's RxNE signal to the given DMA channel.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ *
+ * 		-	If the used target has static DMA mapping, the DMA connection passed
+ * 			to this function is ignored.
+ */
+static inline void vPort_UART_connectRxneToDma(	uint8_t ucUartUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	LL_USART_EnableDMAReq_RX(pxPortUartArr[ucUartUnitNumber]);
+}
+
+/*
+ * Disconnects UART unit's RxNE signal from DMA.
+ *
+ * Notes:
+ * 		-	If there's no DMA in the used target, this function is ignored.
+ */
+static inline void vPort_UART_disconnectRxneFromDma(uint8_t ucUartUnitNumber)
+{
+	LL_USART_DisableDMAReq_RX(pxPortUartArr[ucUartUnitNumber]);
+}
+
 /*	Enables TxE interrupt	*/
 static inline void vPort_UART_enableTxeInterrupt(uint8_t ucUnitNumber)
 {
@@ -170,6 +248,22 @@ static inline void vPort_UART_disableTcInterrupt(uint8_t ucUnitNumber)
 #define ucPORT_UART_IS_TC_INTERRUPT_ENABLED(ucUnitNumber)	\
 	(LL_USART_IsEnabledIT_TC(pxPortUartArr[(ucUnitNumber)]))
 
+/*	Enables IDLE (idle line detected) interrupt	*/
+static inline void vPort_UART_enableIdleInterrupt(uint8_t ucUnitNumber)
+{
+	LL_USART_EnableIT_IDLE(pxPortUartArr[ucUnitNumber]);
+}
+
+/*	Disables IDLE interrupt	*/
+static inline void vPort_UART_disableIdleInterrupt(uint8_t ucUnitNumber)
+{
+	LL_USART_DisableIT_IDLE(pxPortUartArr[ucUnitNumber]);
+}
+
+/*	Checks whether IDLE interrupt is enabled or not	*/
+#define ucPORT_UART_IS_IDLE_INTERRUPT_ENABLED(ucUnitNumber)	\
+	(LL_USART_IsEnabledIT_IDLE(pxPortUartArr[(ucUnitNumber)]))
+
 /*	Reads TxE flag	*/
 #define ucPORT_UART_GET_TXE_FLAG(ucUnitNumber)	\
 	(LL_USART_IsActiveFlag_TXE(pxPortUartArr[(ucUnitNumber)]))
@@ -186,6 +280,10 @@ static inline void vPort_UART_disableTcInterrupt(uint8_t ucUnitNumber)
 #define ucPORT_UART_GET_ORE_FLAG(ucUnitNumber)	\
 	(LL_USART_IsActiveFlag_ORE(pxPortUartArr[(ucUnitNumber)]))
 
+/*	Reads IDLE flag	*/
+#define ucPORT_UART_GET_IDLE_FLAG(ucUnitNumber)	\
+	(LL_USART_IsActiveFlag_IDLE(pxPortUartArr[(ucUnitNumber)]))
+
 /*	Clears RxNE flag	*/
 #define vPORT_UART_CLEAR_RXNE_FLAG(ucUnitNumber)	\
 	(LL_USART_ClearFlag_RXNE(pxPortUartArr[(ucUnitNumber)]))
@@ -198,6 +296,15 @@ static inline void vPort_UART_disableTcInterrupt(uint8_t ucUnitNumber)
 #define vPORT_UART_CLEAR_ORE_FLAG(ucUnitNumber)	\
 	(LL_USART_ClearFlag_ORE(pxPortUartArr[(ucUnitNumber)]))
 
+/*
+ * Clears IDLE flag.
+ *
+ * (Clearing sequence reads the data register, hence, it must not be used while
+ * RxNE flag is set)
+ */
+#define vPORT_UART_CLEAR_IDLE_FLAG(ucUnitNumber)	\
+	(LL_USART_ClearFlag_IDLE(pxPortUartArr[(ucUnitNumber)]))
+
 /*	Sets TxE callback	*/
 static inline void vPort_UART_setTxeCallback(	uint8_t ucUnitNumber,
 												void(*pfCallback)(void*),
@@ -225,6 +332,15 @@ static inline void vPort_UART_setTcCallback(	uint8_t ucUnitNumber,
 	ppvPortUartTcCallbackParamsArr[ucUnitNumber] = pvParams;
 }
 
+/*	Sets IDLE callback	*/
+static inline void vPort_UART_setIdleCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	ppfPortUartIdleCallbackArr[ucUnitNumber] = pfCallback;
+	ppvPortUartIdleCallbackParamsArr[ucUnitNumber] = pvParams;
+}
+
 
 
 
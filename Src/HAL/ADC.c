@@ -16,6 +16,11 @@
 /*	MCAL	*/
 #include "MCAL_Port/Port_ADC.h"
 #include "MCAL_Port/Port_Interrupt.h"
+#include "MCAL_Port/Port_Timer.h"
+#include "MCAL_Port/Port_DMA.h"
+
+/*	HAL (OS)	*/
+#include "HAL/DMA/DMA.h"
 
 /*	SELF	*/
 #include "HAL/ADC/ADC.h"
@@ -34,6 +39,35 @@ typedef struct{
 	 */
 	SemaphoreHandle_t xEocSemphr;
 	StaticSemaphore_t xEocSemphrStatic;
+
+	/*	Scan group being sampled (NULL if none)	*/
+	const xHOS_ADC_scanGroup_t* volatile pxScanGroup;
+
+	/*	Index of the next sample in scan group's buffer	*/
+	uint32_t uiScanIndex;
+
+	/*	Number of samples per block	*/
+	uint32_t uiScanBlockSize;
+
+	/*	Index (in "pucChannelArr") of the channel being converted	*/
+	uint8_t ucScanChannelIndex;
+
+	/*	Latest completed block	*/
+	const uint16_t* volatile pusScanReadyBlock;
+
+	uint32_t uiScanOverrunCount;
+
+	/*	Given by EOC (or DMA) ISR once per completed block	*/
+	SemaphoreHandle_t xScanBlockSemphr;
+	StaticSemaphore_t xScanBlockSemphrStatic;
+
+#if portDMA_IS_AVAILABLE == 1
+	/*	Is the scan group sampled by the hardware sequence and circular DMA	*/
+	uint8_t ucIsScanDma;
+
+	/*	DMA transfer of the scan group (channel is locked while scanning)	*/
+	xHOS_DMA_TransInfo_t xScanDmaInfo;
+#endif
 }xHOS_ADC_t;
 
 /*******************************************************************************
@@ -44,6 +78,78 @@ static xHOS_ADC_t pxAdcArr[uiCONF_ADC_NUMBER_OF_UNITS];
 /*******************************************************************************
  * Static helping functions:
  ******************************************************************************/
+/*
+ * Hands a completed block of the scan group to the consumer.
+ */
+static inline void vScanBlockComplete(	xHOS_ADC_t* pxHandle,
+										const uint16_t* pusBlock,
+										BaseType_t* pxIsHptWoken	)
+{
+	const xHOS_ADC_scanGroup_t* pxGroup = pxHandle->pxScanGroup;
+
+	pxHandle->pusScanReadyBlock = pusBlock;
+
+	/*	If the previous block was not taken yet, it is an overrun	*/
+	if (xSemaphoreGiveFromISR(pxHandle->xScanBlockSemphr, pxIsHptWoken) != pdTRUE)
+		pxHandle->uiScanOverrunCount++;
+
+	if (pxGroup->pfCallback != NULL)
+		pxGroup->pfCallback(pxGroup->pvCallbackParams, pusBlock, pxGroup->uiScansPerBlock);
+}
+
+/*
+ * Stores sample of a scan group conversion, and selects the next channel before
+ * the next timer trigger. Block is handed to the consumer once it is complete.
+ */
+static inline void vScanEoc(	xHOS_ADC_t* pxHandle,
+								uint8_t ucUnitNumber,
+								BaseType_t* pxIsHptWoken	)
+{
+	const xHOS_ADC_scanGroup_t* pxGroup = pxHandle->pxScanGroup;
+	const uint16_t* pusBlock;
+
+	pxGroup->pusBuffer[pxHandle->uiScanIndex++] = usPORT_ADC_GET_DR(ucUnitNumber);
+
+	if (++pxHandle->ucScanChannelIndex == pxGroup->ucNumberOfChannels)
+		pxHandle->ucScanChannelIndex = 0;
+
+	vPORT_ADC_SELECT_CHANNEL(
+		ucUnitNumber, pxGroup->pucChannelArr[pxHandle->ucScanChannelIndex]);
+
+	/*	Check if a block (half of the buffer) is completed	*/
+	if (pxHandle->uiScanIndex == pxHandle->uiScanBlockSize)
+	{
+		pusBlock = pxGroup->pusBuffer;
+	}
+
+	else if (pxHandle->uiScanIndex == 2 * pxHandle->uiScanBlockSize)
+	{
+		pusBlock = &pxGroup->pusBuffer[pxHandle->uiScanBlockSize];
+		pxHandle->uiScanIndex = 0;
+	}
+
+	else
+	{
+		return;
+	}
+
+	vScanBlockComplete(pxHandle, pusBlock, pxIsHptWoken);
+}
+
+#if portDMA_IS_AVAILABLE == 1
+/*
+ * Starts sampling a scan group by the hardware sequence and circular DMA.
+ * Returns 0 if unit's DMA channel is not available.
+ */
+static uint8_t ucStartScanDma(	xHOS_ADC_t* pxHandle,
+								uint8_t ucUnitNumber,
+								const xHOS_ADC_scanGroup_t* pxGroup	);
+
+/*
+ * Stops DMA sampling of the current scan group.
+ */
+static void vStopScanDma(xHOS_ADC_t* pxHandle, uint8_t ucUnitNumber);
+#endif
 
 /*******************************************************************************
  * ISR callback:
@@ -55,10 +161,143 @@ void vEocCallback(void* pvParams)
 	xHOS_ADC_t* pxHandle = &pxAdcArr[ucUnitNumber];
 
 	BaseType_t xIsHptWoken = pdFALSE;
-	xSemaphoreGiveFromISR(pxHandle->xEocSemphr, &xIsHptWoken);
+
+#if portDMA_IS_AVAILABLE == 1
+	/*	Samples are moved by DMA (flag may be seen by a shared IRQ handler)	*/
+	if (pxHandle->ucIsScanDma)
+		return;
+#endif
+
+	if (pxHandle->pxScanGroup != NULL)
+		vScanEoc(pxHandle, ucUnitNumber, &xIsHptWoken);
+	else
+		xSemaphoreGiveFromISR(pxHandle->xEocSemphr, &xIsHptWoken);
+
+	portYIELD_FROM_ISR(xIsHptWoken);
+}
+
+#if portDMA_IS_AVAILABLE == 1
+/*
+ * DMA half transfer callback. First block of the buffer is filled.
+ */
+static void vScanDmaHtCallback(void* pvParams)
+{
+	xHOS_ADC_t* pxHandle = &pxAdcArr[(uint8_t)(uint32_t)pvParams];
+
+	BaseType_t xIsHptWoken = pdFALSE;
+
+	vScanBlockComplete(pxHandle, pxHandle->pxScanGroup->pusBuffer, &xIsHptWoken);
+
 	portYIELD_FROM_ISR(xIsHptWoken);
 }
 
+/*
+ * DMA transfer complete callback. Second block of the buffer is filled, and
+ * DMA wraps to the first one.
+ */
+static void vScanDmaTcCallback(void* pvParams)
+{
+	xHOS_ADC_t* pxHandle = &pxAdcArr[(uint8_t)(uint32_t)pvParams];
+
+	BaseType_t xIsHptWoken = pdFALSE;
+
+	vScanBlockComplete(	pxHandle,
+						&pxHandle->pxScanGroup->pusBuffer[pxHandle->uiScanBlockSize],
+						&xIsHptWoken	);
+
+	portYIELD_FROM_ISR(xIsHptWoken);
+}
+
+/*
+ * See prototype for info.
+ */
+static uint8_t ucStartScanDma(	xHOS_ADC_t* pxHandle,
+								uint8_t ucUnitNumber,
+								const xHOS_ADC_scanGroup_t* pxGroup	)
+{
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxHandle->xScanDmaInfo;
+
+	if (	!pucPortADCDoesUnitSupportDMA[ucUnitNumber]						||
+			pxGroup->ucNumberOfChannels > ucPORT_ADC_MAX_SEQUENCE_LENGTH	)
+	{
+		return 0;
+	}
+
+	pxDmaInfo->ucUnitNumber = ppucPortADCDmaMapping[ucUnitNumber][0];
+	pxDmaInfo->ucChannelNumber = ppucPortADCDmaMapping[ucUnitNumber][1];
+
+	/*	Channel may be used by another driver, EOC ISR is used then	*/
+	if (!ucHOS_DMA_lockChannel(pxDmaInfo->ucUnitNumber, pxDmaInfo->ucChannelNumber, 0))
+		return 0;
+
+	pxDmaInfo->pvPeripheralStartingAdderss = pvPORT_ADC_GET_DR_ADDRESS(ucUnitNumber);
+	pxDmaInfo->pvMemoryStartingAdderss = (void*)pxGroup->pusBuffer;
+	pxDmaInfo->uiN = 2 * pxHandle->uiScanBlockSize;
+	pxDmaInfo->ucTriggerSource = 0;
+	pxDmaInfo->ucPriLevel = 0;
+	pxDmaInfo->ucDirection = 0;
+	pxDmaInfo->ucMemoryIncrement = 1;
+	pxDmaInfo->ucPeripheralIncrement = 0;
+	pxDmaInfo->ucDataSize = 1;
+	pxDmaInfo->ucCircularMode = 1;
+
+	vHOS_DMA_setTransferHalfCompleteCallback(	pxDmaInfo->ucUnitNumber,
+												pxDmaInfo->ucChannelNumber,
+												vScanDmaHtCallback,
+												(void*)(uint32_t)ucUnitNumber	);
+
+	vHOS_DMA_setTransferCompleteCallback(	pxDmaInfo->ucUnitNumber,
+											pxDmaInfo->ucChannelNumber,
+											vScanDmaTcCallback,
+											(void*)(uint32_t)ucUnitNumber	);
+
+	vPORT_DMA_ENABLE_TRANSFER_HALF_COMPLETE_INTERRUPT(	pxDmaInfo->ucUnitNumber,
+														pxDmaInfo->ucChannelNumber	);
+
+	vPORT_DMA_ENABLE_TRANSFER_COMPLETE_INTERRUPT(	pxDmaInfo->ucUnitNumber,
+													pxDmaInfo->ucChannelNumber	);
+
+	/*	Samples are moved by DMA, no EOC ISR	*/
+	vPORT_ADC_DISABLE_EOC_INTERRUPT(ucUnitNumber);
+
+	/*	Each trigger converts the whole group, in order	*/
+	vPort_ADC_setScanSequence(	ucUnitNumber,
+								pxGroup->pucChannelArr,
+								pxGroup->ucNumberOfChannels	);
+
+	vHOS_DMA_startTransfer(pxDmaInfo);
+
+	vPORT_ADC_ENABLE_DMA_REQUEST(ucUnitNumber);
+
+	pxHandle->ucIsScanDma = 1;
+
+	return 1;
+}
+
+/*
+ * See prototype for info.
+ */
+static void vStopScanDma(xHOS_ADC_t* pxHandle, uint8_t ucUnitNumber)
+{
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxHandle->xScanDmaInfo;
+
+	vPORT_ADC_DISABLE_DMA_REQUEST(ucUnitNumber);
+
+	vHOS_DMA_stopTransfer(pxDmaInfo->ucUnitNumber, pxDmaInfo->ucChannelNumber);
+
+	ucHOS_DMA_releaseChannel(	pxDmaInfo->ucUnitNumber,
+								pxDmaInfo->ucChannelNumber,
+								portMAX_DELAY	);
+
+	vPort_ADC_clearScanSequence(ucUnitNumber);
+
+	vPORT_ADC_CLR_EOC_FLAG(ucUnitNumber);
+	vPORT_ADC_ENABLE_EOC_INTERRUPT(ucUnitNumber);
+
+	pxHandle->ucIsScanDma = 0;
+}
+#endif	/*	portDMA_IS_AVAILABLE == 1	*/
+
 /*******************************************************************************
  * API functions:
  ******************************************************************************/
@@ -90,6 +329,17 @@ void vHOS_ADC_init(void)
 		pxHandle->xEocSemphr = xSemaphoreCreateBinaryStatic(&pxHandle->xEocSemphrStatic);
 		xSemaphoreTake(pxHandle->xEocSemphr, 0);
 
+		/*	Create unit's scan block semaphore	*/
+		pxHandle->xScanBlockSemphr =
+			xSemaphoreCreateBinaryStatic(&pxHandle->xScanBlockSemphrStatic);
+		xSemaphoreTake(pxHandle->xScanBlockSemphr, 0);
+
+		pxHandle->pxScanGroup = NULL;
+
+#if portDMA_IS_AVAILABLE == 1
+		pxHandle->ucIsScanDma = 0;
+#endif
+
 		/*	Initialize interrupt	*/
 		vPort_ADC_setInterruptCallback(i, vEocCallback, (void*)(uint32_t)i);
 
@@ -222,10 +472,128 @@ inline uint32_t uiHOS_ADC_getVoltageDirect(uint32_t uiRawRead)
 	return ((uint64_t)uiRawRead * (uiPORT_ADC_VREF_IN_MV * 1000)) / 4096;
 }
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_ADC_startScan(uint8_t ucUnitNumber, const xHOS_ADC_scanGroup_t* pxGroup)
+{
+	xHOS_ADC_t* pxHandle = &pxAdcArr[ucUnitNumber];
+	uint8_t ucTimerUnitNumber = pucPortADCTriggeringTimerUnitNumber[ucUnitNumber];
 
+	configASSERT(pxHandle->pxScanGroup == NULL);
+	configASSERT(pxGroup->ucNumberOfChannels > 0 && pxGroup->uiScansPerBlock > 0);
 
+	/*	Configure channels	*/
+	for (uint8_t i = 0; i < pxGroup->ucNumberOfChannels; i++)
+	{
+		vHOS_ADC_setSampleTime(	ucUnitNumber,
+								pxGroup->pucChannelArr[i],
+								pxGroup->puiSampleTimeArr[i]	);
+	}
 
+	vHOS_ADC_selectMode(ucUnitNumber, 1);
+	vHOS_ADC_selectChannel(ucUnitNumber, pxGroup->pucChannelArr[0]);
 
+	/*	Init scan state	*/
+	pxHandle->uiScanIndex = 0;
+	pxHandle->uiScanBlockSize = pxGroup->uiScansPerBlock * pxGroup->ucNumberOfChannels;
+	pxHandle->ucScanChannelIndex = 0;
+	pxHandle->pusScanReadyBlock = NULL;
+	pxHandle->uiScanOverrunCount = 0;
+	xSemaphoreTake(pxHandle->xScanBlockSemphr, 0);
 
+	pxHandle->pxScanGroup = pxGroup;
 
+	/*
+	 * Trigger conversions by the timer. Once per scan if the whole group is
+	 * converted by the hardware sequence (DMA), otherwise once per channel.
+	 */
+	uint32_t uiTriggerFreq = pxGroup->uiScanFreq * pxGroup->ucNumberOfChannels;
+
+#if portDMA_IS_AVAILABLE == 1
+	if (ucStartScanDma(pxHandle, ucUnitNumber, pxGroup))
+		uiTriggerFreq = pxGroup->uiScanFreq;
+#endif
+
+	vPORT_TIM_DISABLE_COUNTER(ucTimerUnitNumber);
+	vPort_TIM_enableTriggerOutput(ucTimerUnitNumber);
+	vHOS_ADC_setTriggerSource(ucUnitNumber, 1);
+
+	if (uiPort_TIM_setOvfFreq(ucTimerUnitNumber, uiTriggerFreq) == 0)
+	{
+		vHOS_ADC_stopScan(ucUnitNumber);
+		return 0;
+	}
+
+	return 1;
+}
 
+/*
+ * See header for info.
+ */
+void vHOS_ADC_stopScan(uint8_t ucUnitNumber)
+{
+	xHOS_ADC_t* pxHandle = &pxAdcArr[ucUnitNumber];
+
+	vPORT_TIM_DISABLE_COUNTER(pucPortADCTriggeringTimerUnitNumber[ucUnitNumber]);
+
+#if portDMA_IS_AVAILABLE == 1
+	if (pxHandle->ucIsScanDma)
+		vStopScanDma(pxHandle, ucUnitNumber);
+#endif
+
+	pxHandle->pxScanGroup = NULL;
+
+	vHOS_ADC_setTriggerSource(ucUnitNumber, 0);
+
+	/*
+	 * Switching to SW trigger starts a conversion, and a scan conversion may
+	 * have been in progress. Consume their EOC, so that it is not mistaken for
+	 * the next conversion.
+	 */
+	ucHOS_ADC_blockUntilEOC(ucUnitNumber, pdMS_TO_TICKS(1));
+	xSemaphoreTake(pxHandle->xEocSemphr, 0);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_ADC_blockUntilScanBlock(	uint8_t ucUnitNumber,
+										const uint16_t** ppusBlock,
+										TickType_t xTimeout	)
+{
+	xHOS_ADC_t* pxHandle = &pxAdcArr[ucUnitNumber];
+
+	if (!xSemaphoreTake(pxHandle->xScanBlockSemphr, xTimeout))
+		return 0;
+
+	*ppusBlock = pxHandle->pusScanReadyBlock;
+
+	return 1;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_ADC_getScanOverrunCount(uint8_t ucUnitNumber)
+{
+	return pxAdcArr[ucUnitNumber].uiScanOverrunCount;
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_ADC_deinterleave(	const uint16_t* pusBlock,
+							uint8_t ucNumberOfChannels,
+							uint32_t uiNumberOfScans,
+							uint8_t ucChannelIndex,
+							uint16_t* pusOut	)
+{
+	pusBlock += ucChannelIndex;
+
+	for (uint32_t i = 0; i < uiNumberOfScans; i++)
+	{
+		pusOut[i] = *pusBlock;
+		pusBlock += ucNumberOfChannels;
+	}
+}
@@ -0,0 +1,272 @@
+/*
+ * ButtonScanner.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_DIO.h"
+
+/*	HAL-OS	*/
+#include "RTOS_PRI_Config.h"
+
+/*	SELF	*/
+#include "HAL/Button/ButtonScanner.h"
+
+/*******************************************************************************
+ * Helping functions/macros.
+ ******************************************************************************/
+#define uiNUMBER_OF_WORDS(pxHandle)		(((pxHandle)->ucNumberOfPorts + 1) / 2)
+
+static inline void vSendEvent(	xHOS_ButtonScanner_t* pxHandle,
+								uint8_t ucButton,
+								uint8_t ucEvent	)
+{
+	xHOS_ButtonScanner_event_t xEvent = {.ucButton = ucButton, .ucEvent = ucEvent};
+
+	if (xQueueSend(pxHandle->xEventQueue, &xEvent, 0) != pdTRUE)
+		pxHandle->uiNumberOfLostEvents++;
+}
+
+/*	Reads the two ports of word "ucWord" as a single sample	*/
+static inline uint32_t uiReadWord(xHOS_ButtonScanner_t* pxHandle, uint8_t ucWord)
+{
+	uint8_t ucPortIndex = 2 * ucWord;
+
+	uint32_t uiLevels = uiPORT_DIO_READ_PORT(pxHandle->pucPortNumberArr[ucPortIndex]) & 0xFFFF;
+
+	if (ucPortIndex + 1 < pxHandle->ucNumberOfPorts)
+	{
+		uiLevels |=
+			(uiPORT_DIO_READ_PORT(pxHandle->pucPortNumberArr[ucPortIndex + 1]) & 0xFFFF) << 16;
+	}
+
+	/*	Pressed pins are ones, unused pins are zeros	*/
+	return (uiLevels ^ pxHandle->puiInvertMaskArr[ucWord]) & pxHandle->puiUsedMaskArr[ucWord];
+}
+
+/*
+ * Counts hold time of the pressed buttons, and sends their long press and
+ * repeat events.
+ */
+static inline void vUpdateHoldTime(xHOS_ButtonScanner_t* pxHandle)
+{
+	uint32_t uiPressed = pxHandle->uiPressedMask;
+	uint32_t* puiHold;
+	uint8_t ucButton;
+
+	while (uiPressed)
+	{
+		ucButton = __builtin_ctz(uiPressed);
+		uiPressed &= uiPressed - 1;
+
+		puiHold = &pxHandle->puiHoldSamplesArr[ucButton];
+
+		/*	Hold time stops counting after long press, if there's no repeat	*/
+		if (	*puiHold >= pxHandle->uiLongPressSamples &&
+				pxHandle->uiRepeatSamples == 0	)
+			continue;
+
+		(*puiHold)++;
+
+		if (*puiHold == pxHandle->uiLongPressSamples)
+			vSendEvent(pxHandle, ucButton, ucHOS_BUTTON_SCANNER_EVENT_LONG_PRESS);
+
+		else if (*puiHold == pxHandle->uiLongPressSamples + pxHandle->uiRepeatSamples)
+		{
+			vSendEvent(pxHandle, ucButton, ucHOS_BUTTON_SCANNER_EVENT_REPEAT);
+			*puiHold = pxHandle->uiLongPressSamples;
+		}
+	}
+}
+
+/*******************************************************************************
+ * RTOS Task code:
+ ******************************************************************************/
+static void vTask(void* pvParams)
+{
+	xHOS_ButtonScanner_t* pxHandle = (xHOS_ButtonScanner_t*)pvParams;
+
+	uint32_t uiChanged, uiBit;
+	uint8_t ucButton;
+	xLIB_BinaryFilterVertical_t* pxFilter;
+
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	while(1)
+	{
+		for (uint8_t ucWord = 0; ucWord < uiNUMBER_OF_WORDS(pxHandle); ucWord++)
+		{
+			pxFilter = &pxHandle->pxFilterArr[ucWord];
+
+			/*	Debounce all pins of the word at once	*/
+			uiChanged = uiLIB_BinaryFilterVertical_updateFilter(
+				pxFilter,
+				uiReadWord(pxHandle, ucWord)	);
+
+			/*	Send press / release events of the changed ones	*/
+			while (uiChanged)
+			{
+				uiBit = __builtin_ctz(uiChanged);
+				uiChanged &= uiChanged - 1;
+
+				ucButton = pxHandle->pucButtonIndexArr[32 * ucWord + uiBit];
+
+				if ((pxFilter->uiLevelsFiltered >> uiBit) & 1)
+				{
+					pxHandle->uiPressedMask |= 1ul << ucButton;
+					pxHandle->puiHoldSamplesArr[ucButton] = 0;
+					vSendEvent(pxHandle, ucButton, ucHOS_BUTTON_SCANNER_EVENT_PRESS);
+				}
+				else
+				{
+					pxHandle->uiPressedMask &= ~(1ul << ucButton);
+					vSendEvent(pxHandle, ucButton, ucHOS_BUTTON_SCANNER_EVENT_RELEASE);
+				}
+			}
+		}
+
+		if (pxHandle->uiLongPressSamples != 0)
+			vUpdateHoldTime(pxHandle);
+
+		/*	Task is blocked until next sample time	*/
+		vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(pxHandle->uiSamplePeriodMs));
+	}
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_ButtonScanner_init(xHOS_ButtonScanner_t* pxHandle)
+{
+	const xHOS_ButtonScanner_button_t* pxButton;
+	uint8_t ucPortIndex, ucWord, ucBit;
+
+	if (pxHandle->ucNumberOfButtons > uiCONF_BUTTON_SCANNER_MAX_BUTTONS)
+		return 0;
+
+	/*	Initialize private parameters	*/
+	pxHandle->ucNumberOfPorts = 0;
+	for (uint8_t i = 0; i < (uiCONF_BUTTON_SCANNER_MAX_PORTS + 1) / 2; i++)
+	{
+		pxHandle->puiUsedMaskArr[i] = 0;
+		pxHandle->puiInvertMaskArr[i] = 0;
+	}
+	pxHandle->uiPressedMask = 0;
+	pxHandle->uiNumberOfLostEvents = 0;
+
+	/*	Map buttons to bits of the words	*/
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfButtons; i++)
+	{
+		pxButton = &pxHandle->pxButtonArr[i];
+
+		/*	Find button's port among the used ports, or add it	*/
+		for (ucPortIndex = 0; ucPortIndex < pxHandle->ucNumberOfPorts; ucPortIndex++)
+		{
+			if (pxHandle->pucPortNumberArr[ucPortIndex] == pxButton->ucPortNumber)
+				break;
+		}
+
+		if (ucPortIndex == pxHandle->ucNumberOfPorts)
+		{
+			if (ucPortIndex == uiCONF_BUTTON_SCANNER_MAX_PORTS)
+				return 0;
+
+			pxHandle->pucPortNumberArr[ucPortIndex] = pxButton->ucPortNumber;
+			pxHandle->ucNumberOfPorts++;
+		}
+
+		ucWord = ucPortIndex / 2;
+		ucBit = 16 * (ucPortIndex % 2) + pxButton->ucPinNumber;
+
+		if ((pxHandle->puiUsedMaskArr[ucWord] >> ucBit) & 1)
+			return 0;
+
+		pxHandle->puiUsedMaskArr[ucWord] |= 1ul << ucBit;
+		if (pxButton->ucPressedLevel == 0)
+			pxHandle->puiInvertMaskArr[ucWord] |= 1ul << ucBit;
+		pxHandle->pucButtonIndexArr[32 * ucWord + ucBit] = i;
+
+		/*	initialize DIO pin as an input, pulled with invert of "ucPressedLevel"	*/
+		uint8_t ucPull = pxButton->ucPressedLevel ? 2 : 1;
+		vPort_DIO_initPinInput(pxButton->ucPortNumber, pxButton->ucPinNumber, ucPull);
+	}
+
+	/*	All buttons are initially released	*/
+	for (uint8_t i = 0; i < uiNUMBER_OF_WORDS(pxHandle); i++)
+	{
+		vLIB_BinaryFilterVertical_init(	&pxHandle->pxFilterArr[i],
+										pxHandle->ucFilterCounterBits,
+										0	);
+	}
+
+	/*	Convert times to number of samples	*/
+	pxHandle->uiLongPressSamples = pxHandle->uiLongPressMs / pxHandle->uiSamplePeriodMs;
+	if (pxHandle->uiLongPressMs != 0 && pxHandle->uiLongPressSamples == 0)
+		pxHandle->uiLongPressSamples = 1;
+
+	pxHandle->uiRepeatSamples = pxHandle->uiRepeatPeriodMs / pxHandle->uiSamplePeriodMs;
+	if (pxHandle->uiRepeatPeriodMs != 0 && pxHandle->uiRepeatSamples == 0)
+		pxHandle->uiRepeatSamples = 1;
+
+	/*	Create events queue	*/
+	pxHandle->xEventQueue = xQueueCreateStatic(
+		uiCONF_BUTTON_SCANNER_EVENT_QUEUE_LEN,
+		sizeof(xHOS_ButtonScanner_event_t),
+		pxHandle->pucEventQueueMemory,
+		&pxHandle->xEventQueueStatic	);
+
+	/*	create task	*/
+	static uint8_t ucCreatedObjectsCount = 0;
+	char pcTaskName[configMAX_TASK_NAME_LEN];
+	sprintf(pcTaskName, "BtnScan%d", ucCreatedObjectsCount++);
+
+	pxHandle->xTask = xTaskCreateStatic(	vTask,
+											pcTaskName,
+											uiCONF_BUTTON_SCANNER_STACK_SIZE,
+											(void*)pxHandle,
+											configHOS_SOFT_REAL_TIME_TASK_PRI,
+											pxHandle->puxTaskStack,
+											&pxHandle->xTaskStatic	);
+
+	return 1;
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_ButtonScanner_receiveEvent(	xHOS_ButtonScanner_t* pxHandle,
+											xHOS_ButtonScanner_event_t* pxEvent,
+											TickType_t xTimeout	)
+{
+	return (xQueueReceive(pxHandle->xEventQueue, pxEvent, xTimeout) == pdTRUE);
+}
+
+/*
+ * See header file for info.
+ */
+__attribute__((always_inline)) inline
+uint8_t ucHOS_ButtonScanner_isPressed(xHOS_ButtonScanner_t* pxHandle, uint8_t ucButton)
+{
+	return (pxHandle->uiPressedMask >> ucButton) & 1;
+}
+
+/*
+ * See header file for info.
+ */
+uint32_t uiHOS_ButtonScanner_getNumberOfLostEvents(xHOS_ButtonScanner_t* pxHandle)
+{
+	return pxHandle->uiNumberOfLostEvents;
+}
@@ -7,6 +7,7 @@
 
 /*	LIB	*/
 #include "stdint.h"
+#include <stdio.h>
 
 /*	MCAL (Ported)	*/
 #include "MCAL_Port/Port_DIO.h"
@@ -16,6 +17,8 @@
 #include "task.h"
 #include "semphr.h"
 
+#include "RTOS_PRI_Config.h"
+
 /*	COTS-OS	*/
 #include "HAL/I2C/I2C.h"
 
@@ -23,15 +26,16 @@
 #include "HAL/CharLcdI2c/CharLcdI2c.h"
 
 /*******************************************************************************
- * Helping structures:
+ * Helping macros:
  ******************************************************************************/
-typedef struct{
-	uint8_t ucRs : 1;
-	uint8_t ucRw : 1;
-	uint8_t ucEn : 1;
-	uint8_t ucLedEn : 1;
-	uint8_t ucHByte : 4;
-}xBusVal_t;
+/*	Bits of the bus connecting I2C-IO extender and the LCD module	*/
+#define ucBUS_RS		(1 << 0)
+#define ucBUS_RW		(1 << 1)
+#define ucBUS_EN		(1 << 2)
+#define ucBUS_LED_EN	(1 << 3)
+
+/*	Instructions of long execution time	*/
+#define ucIS_LONG_CMD(ucCmd)	((ucCmd) == 0x01 || (ucCmd) == 0x02 || (ucCmd) == 0x03)
 
 /*******************************************************************************
  * Static (Private) functions:
@@ -54,56 +58,127 @@ static void vWriteBus(xHOS_CharLcdI2c_t* pxHandle)
 	ucHOS_I2C_masterTransReceive(&xParams);
 }
 
-static void vLatch(xHOS_CharLcdI2c_t* pxHandle)
+/*
+ * Sends bus values written in "pxHandle->pucTxArr" in a single transaction.
+ *
+ * Returns 1 if sent successfully, 0 otherwise.
+ */
+static uint8_t ucWriteBusSequence(xHOS_CharLcdI2c_t* pxHandle, uint32_t uiSize)
 {
-	xBusVal_t* pcBusVal = (xBusVal_t*)(&pxHandle->ucBusVal);
+	xHOS_I2C_transreceiveParams_t xParams = {
+		.ucUnitNumber = pxHandle->ucI2cUnitNumber,
+		.usAddress = pxHandle->ucAddress,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = pxHandle->pucTxArr,
+		.uiTxSize = uiSize,
+		.uiRxSize = 0
+	};
 
-	/*	LCD module latches by a falling edge on the EN pin	*/
+	/*	Bus keeps the last value	*/
+	pxHandle->ucBusVal = pxHandle->pucTxArr[uiSize - 1];
 
-	/*	En high	*/
-	pcBusVal->ucEn = 1;
-	vWriteBus(pxHandle);
+	return ucHOS_I2C_masterTransReceive(&xParams);
+}
+
+/*
+ * Encodes a byte (command if "ucRs" is 0, data if 1) as bus values, appended to
+ * the "uiSize" values already in "pxHandle->pucTxArr". Returns the new size.
+ *
+ * LCD module latches each nibble by a falling edge on the EN pin. Data is set
+ * with the rising edge, and held for a whole I2C byte before the falling edge.
+ * RS must be set up (tAS) before the rising edge, hence the first nibble of a
+ * sequence, and any nibble of a new RS, is preceded by a value of the new RS
+ * and EN low. Last nibble is followed by "ucHOS_CHAR_LCD_I2C_PAD_BYTES" idle
+ * values, while the byte executes.
+ */
+static uint32_t uiEncodeByte(	xHOS_CharLcdI2c_t* pxHandle,
+								uint32_t uiSize,
+								uint8_t ucByte,
+								uint8_t ucRs	)
+{
+	uint8_t* pucArr = pxHandle->pucTxArr;
 
-	/*	Settle delay	*/
-	vTaskDelay(pdMS_TO_TICKS(1));
+	/*	Write mode (RW low), LED enable is kept as is	*/
+	uint8_t ucCtrl = (pxHandle->ucBusVal & ucBUS_LED_EN) | (ucRs ? ucBUS_RS : 0);
+	uint8_t ucHigh = (ucByte & 0xF0) | ucCtrl;
+	uint8_t ucLow = (ucByte << 4) | ucCtrl;
+	uint32_t i = uiSize;
 
-	/*	En low	*/
-	pcBusVal->ucEn = 0;
-	vWriteBus(pxHandle);
+	/*	RS setup	*/
+	if (i == 0 || (pucArr[i - 1] & ucBUS_RS) != (ucCtrl & ucBUS_RS))
+		pucArr[i++] = ucHigh;
+
+	pucArr[i++] = ucHigh | ucBUS_EN;
+	pucArr[i++] = ucHigh;
+	pucArr[i++] = ucLow | ucBUS_EN;
+	pucArr[i++] = ucLow;
+
+	for (uint8_t j = 0; j < ucHOS_CHAR_LCD_I2C_PAD_BYTES; j++)
+		pucArr[i++] = ucLow;
+
+	return i;
 }
 
-static void vSendByteAndLatch(xHOS_CharLcdI2c_t* pxHandle, uint8_t ucByte)
+static void vSendCmd(xHOS_CharLcdI2c_t* pxHandle, uint8_t ucCmd)
 {
-	xBusVal_t* pcBusVal = (xBusVal_t*)(&pxHandle->ucBusVal);
+	/*	Write and latch CMD */
+	uint32_t uiSize = uiEncodeByte(pxHandle, 0, ucCmd, 0);
+	ucWriteBusSequence(pxHandle, uiSize);
+
+	/*
+	 * Clear and return home take ~1.52ms to execute, which is too long to be
+	 * filled with idle bus values.
+	 */
+	if (ucIS_LONG_CMD(ucCmd))
+		vTaskDelay(pdMS_TO_TICKS(2));
+}
 
-	/*	Select write mode (RW low)	*/
-	pcBusVal->ucRw = 0;
-	vWriteBus(pxHandle);
+/*	Returns DDRAM address of the beginning of a row	*/
+static inline uint8_t ucGetRowAddress(uint8_t ucRow)
+{
+	uint8_t ucAddress = (ucRow & 1) ? 0x40 : 0x00;
 
-	/*	Write higher 4-bits	*/
-	pcBusVal->ucHByte = ucByte >> 4;
-	vWriteBus(pxHandle);
-	vLatch(pxHandle);
+	if (ucRow >= 2)
+		ucAddress += ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
 
-	/*	Write lower 4-bits	*/
-	pcBusVal->ucHByte = ucByte & 0x0F;
-	vWriteBus(pxHandle);
-	vLatch(pxHandle);
+	return ucAddress;
 }
 
-static void vSendCmd(xHOS_CharLcdI2c_t* pxHandle, uint8_t ucCmd)
+/*
+ * Sends characters [ucFirst, ucLast] of a row of the frame in a single
+ * transaction.
+ */
+static void vSendRun(	xHOS_CharLcdI2c_t* pxHandle,
+						uint8_t ucRow,
+						uint8_t ucFirst,
+						uint8_t ucLast	)
 {
-	xBusVal_t* pcBusVal = (xBusVal_t*)(&pxHandle->ucBusVal);
+	uint32_t uiSize;
 
-	/*	Select the command register of the LCD-module (RS low)	*/
-	pcBusVal->ucRs = 0;
-	vWriteBus(pxHandle);
+	/*	Set DDRAM address	*/
+	uiSize = uiEncodeByte(	pxHandle,
+							0,
+							0x80 | (ucGetRowAddress(ucRow) + ucFirst),
+							0	);
 
-	/*	Write and latch CMD */
-	vSendByteAndLatch(pxHandle, ucCmd);
+	/*	Characters	*/
+	for (uint8_t ucCol = ucFirst; ucCol <= ucLast; ucCol++)
+	{
+		uiSize = uiEncodeByte(	pxHandle,
+								uiSize,
+								(uint8_t)pxHandle->pcFrameArr[ucRow][ucCol],
+								1	);
+	}
 
-	/*	Wait for execution to complete	*/
-	vTaskDelay(pdMS_TO_TICKS(3));
+	/*	If not sent, glass is not updated, and the run is retried on next refresh	*/
+	if (!ucWriteBusSequence(pxHandle, uiSize))
+		return;
+
+	for (uint8_t ucCol = ucFirst; ucCol <= ucLast; ucCol++)
+		pxHandle->pcGlassArr[ucRow][ucCol] = pxHandle->pcFrameArr[ucRow][ucCol];
+
+	/*	Cursor is now right after the run	*/
+	pxHandle->ucCursorPos = ucRow * ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS + ucLast + 1;
 }
 
 static void vInitSequence(xHOS_CharLcdI2c_t* pxHandle)
@@ -126,7 +201,25 @@ static void vInitSequence(xHOS_CharLcdI2c_t* pxHandle)
 	vSendCmd(pxHandle, 0x28);
 
 	/*	Clear display	*/
-	vHOS_CharLcdI2c_clearDisplay(pxHandle);	
+	vHOS_CharLcdI2c_clearDisplay(pxHandle);
+}
+
+/*******************************************************************************
+ * RTOS Task code:
+ ******************************************************************************/
+static void vTask(void* pvParams)
+{
+	xHOS_CharLcdI2c_t* pxHandle = (xHOS_CharLcdI2c_t*)pvParams;
+
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	while(1)
+	{
+		xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
+		vHOS_CharLcdI2c_refresh(pxHandle);
+		xSemaphoreGive(pxHandle->xMutex);
+
+		vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(pxHandle->uiRefreshPeriodMs));
+	}
 }
 
 /*******************************************************************************
@@ -144,8 +237,27 @@ void vHOS_CharLcdI2c_init(xHOS_CharLcdI2c_t* pxHandle)
 	/*	Initialize power enable pin	*/
 	vPort_DIO_initPinOutput(pxHandle->ucPowerEnPort, pxHandle->ucPowerEnPin);
 
+	/*	Frame is initially blank	*/
+	vHOS_CharLcdI2c_clearFrame(pxHandle);
+
 	/*	Run initialization sequence	*/
 	vInitSequence(pxHandle);
+
+	/*	Create refresh task	*/
+	if (pxHandle->uiRefreshPeriodMs != 0)
+	{
+		static uint8_t ucCreatedObjectsCount = 0;
+		char pcTaskName[configMAX_TASK_NAME_LEN];
+		sprintf(pcTaskName, "Lcd%d", ucCreatedObjectsCount++);
+
+		pxHandle->xTask = xTaskCreateStatic(	vTask,
+												pcTaskName,
+												uiCONF_CHAR_LCD_I2C_STACK_SIZE,
+												(void*)pxHandle,
+												configHOS_SOFT_REAL_TIME_TASK_PRI,
+												pxHandle->puxTaskStack,
+												&pxHandle->xTaskStatic	);
+	}
 }
 
 /*
@@ -177,8 +289,12 @@ void vHOS_CharLcdI2c_clearDisplay(xHOS_CharLcdI2c_t* pxHandle)
 	vSendCmd(pxHandle, 0x80);
 	pxHandle->ucCursorPos = 0;
 
-	/*	Here, execution time is more that other instructions	*/
-	vTaskDelay(pdMS_TO_TICKS(1));
+	/*	LCD is now blank	*/
+	for (uint8_t ucRow = 0; ucRow < ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS; ucRow++)
+	{
+		for (uint8_t ucCol = 0; ucCol < ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS; ucCol++)
+			pxHandle->pcGlassArr[ucRow][ucCol] = ' ';
+	}
 }
 
 /*
@@ -187,49 +303,48 @@ void vHOS_CharLcdI2c_clearDisplay(xHOS_CharLcdI2c_t* pxHandle)
 void vHOS_CharLcdI2c_printChar(xHOS_CharLcdI2c_t* pxHandle, char cCh)
 {
 	/*	Check if cursor needs to be shifted in row (LCD module won't do it on its own)	*/
-	if (pxHandle->ucCursorPos == 4*20)
+	if (pxHandle->ucCursorPos ==
+		ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS * ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS)
 	{
+		vHOS_CharLcdI2c_clearFrame(pxHandle);
 		vHOS_CharLcdI2c_clearDisplay(pxHandle);
 	}
 
-	else if (pxHandle->ucCursorPos%20 == 0)
+	else if (pxHandle->ucCursorPos % ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS == 0)
 	{
 		/*	Force the cursor to the beginning of the next line	*/
-		uint8_t ucAddress;
-		uint8_t ucLine = pxHandle->ucCursorPos / 20;
-
-		if (ucLine == 0)
-			ucAddress = 0x80 + pxHandle->ucCursorPos;
-		else if (ucLine == 1)
-			ucAddress = 0x80 + pxHandle->ucCursorPos%20 + 64;
-		else if (ucLine == 2)
-			ucAddress = 0x80 + pxHandle->ucCursorPos%20 + 20;
-		else if (ucLine == 3)
-			ucAddress = 0x80 + pxHandle->ucCursorPos%20 + 84;
-
-		vSendCmd(pxHandle, ucAddress);
+		uint8_t ucLine = pxHandle->ucCursorPos / ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
+
+		vSendCmd(pxHandle, 0x80 + ucGetRowAddress(ucLine));
 	}
-	
+
 	/*	If the byte is end-line byte	*/
 	if (cCh == '\n')
 	{
-		pxHandle->ucCursorPos += 20;
-		pxHandle->ucCursorPos = (pxHandle->ucCursorPos / 20) * 20;
+		pxHandle->ucCursorPos += ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
+		pxHandle->ucCursorPos =
+			(pxHandle->ucCursorPos / ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS) *
+			ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
 	}
 
 	/*	Otherwise	*/
 	else
 	{
-		xBusVal_t* pcBusVal = (xBusVal_t*)(&pxHandle->ucBusVal);
+		uint8_t ucRow = pxHandle->ucCursorPos / ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
+		uint8_t ucCol = pxHandle->ucCursorPos % ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS;
+
+		/*
+		 * Keep track of what is on the LCD, and write it to the frame too, such
+		 * that next refresh does not overwrite it.
+		 */
+		pxHandle->pcGlassArr[ucRow][ucCol] = cCh;
+		pxHandle->pcFrameArr[ucRow][ucCol] = cCh;
 
 		pxHandle->ucCursorPos++;
-	
-		/*	Select the data register of the LCD-module (RS high)	*/
-		pcBusVal->ucRs = 1;
-		vWriteBus(pxHandle);
-	
+
 		/*	Write data	*/
-		vSendByteAndLatch(pxHandle, (uint8_t)cCh);
+		uint32_t uiSize = uiEncodeByte(pxHandle, 0, (uint8_t)cCh, 1);
+		ucWriteBusSequence(pxHandle, uiSize);
 	}
 }
 
@@ -243,3 +358,66 @@ void vHOS_CharLcdI2c_printStr(xHOS_CharLcdI2c_t* pxHandle, char* pcStr)
 		vHOS_CharLcdI2c_printChar(pxHandle, pcStr[i]) ;
 	}
 }
+
+/*
+ * See header for info.
+ */
+void vHOS_CharLcdI2c_writeStr(	xHOS_CharLcdI2c_t* pxHandle,
+								uint8_t ucRow,
+								uint8_t ucCol,
+								const char* pcStr	)
+{
+	char* pcFrameRow = pxHandle->pcFrameArr[ucRow];
+
+	for (; *pcStr != '\0' && ucCol < ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS; ucCol++)
+		pcFrameRow[ucCol] = *pcStr++;
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_CharLcdI2c_clearFrame(xHOS_CharLcdI2c_t* pxHandle)
+{
+	for (uint8_t ucRow = 0; ucRow < ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS; ucRow++)
+	{
+		for (uint8_t ucCol = 0; ucCol < ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS; ucCol++)
+			pxHandle->pcFrameArr[ucRow][ucCol] = ' ';
+	}
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_CharLcdI2c_refresh(xHOS_CharLcdI2c_t* pxHandle)
+{
+	uint8_t ucCol, ucFirst, ucLast;
+
+	for (uint8_t ucRow = 0; ucRow < ucCONF_CHAR_LCD_I2C_NUMBER_OF_ROWS; ucRow++)
+	{
+		char* pcFrameRow = pxHandle->pcFrameArr[ucRow];
+		char* pcGlassRow = pxHandle->pcGlassArr[ucRow];
+
+		ucCol = 0;
+		while (ucCol < ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS)
+		{
+			/*	Skip unchanged characters	*/
+			if (pcFrameRow[ucCol] == pcGlassRow[ucCol])
+			{
+				ucCol++;
+				continue;
+			}
+
+			/*	Extend run until a gap longer than "ucCONF_CHAR_LCD_I2C_MAX_RUN_GAP"	*/
+			ucFirst = ucLast = ucCol;
+			for (ucCol++; ucCol < ucCONF_CHAR_LCD_I2C_NUMBER_OF_COLS; ucCol++)
+			{
+				if (pcFrameRow[ucCol] != pcGlassRow[ucCol])
+					ucLast = ucCol;
+				else if (ucCol - ucLast > ucCONF_CHAR_LCD_I2C_MAX_RUN_GAP)
+					break;
+			}
+
+			vSendRun(pxHandle, ucRow, ucFirst, ucLast);
+		}
+	}
+}
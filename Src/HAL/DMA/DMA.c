@@ -40,6 +40,14 @@ typedef struct{
 
 	SemaphoreHandle_t xTransferCompleteSemaphore;
 	StaticSemaphore_t xTransferCompleteSemaphoreStatic;
+
+	/*	Optional user callback of transfer complete (called from ISR)	*/
+	void (*pfTransferCompleteCallback)(void*);
+	void* pvTransferCompleteCallbackParams;
+
+	/*	Optional user callback of transfer half complete (called from ISR)	*/
+	void (*pfTransferHalfCompleteCallback)(void*);
+	void* pvTransferHalfCompleteCallbackParams;
 }xHOS_DMA_Channel_t;
 
 /*******************************************************************************
@@ -75,6 +83,9 @@ static void vTCCallback(void* pvParams)
 	xSemaphoreGiveFromISR(	pxChannel->xTransferCompleteSemaphore,
 							&xHighPriorityTaskWoken	);
 
+	if (pxChannel->pfTransferCompleteCallback != NULL)
+		pxChannel->pfTransferCompleteCallback(pxChannel->pvTransferCompleteCallbackParams);
+
 	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
 }
 
@@ -86,6 +97,9 @@ static void vTHCCallback(void* pvParams)
 	xSemaphoreGiveFromISR(	pxChannel->xTransferHalfCompleteSemaphore,
 							&xHighPriorityTaskWoken	);
 
+	if (pxChannel->pfTransferHalfCompleteCallback != NULL)
+		pxChannel->pfTransferHalfCompleteCallback(pxChannel->pvTransferHalfCompleteCallbackParams);
+
 	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
 }
 
@@ -132,6 +146,9 @@ void vHOS_DMA_init(void)
 					&pxChannelArr[i].xTransferHalfCompleteSemaphoreStatic	);
 			xSemaphoreGive(pxChannelArr[i].xTransferHalfCompleteSemaphore);
 
+			pxChannelArr[i].pfTransferCompleteCallback = NULL;
+			pxChannelArr[i].pfTransferHalfCompleteCallback = NULL;
+
 			/*	Enqueue pointer to the channel to channels' queue	*/
 			pxChannel = &pxChannelArr[i];
 			xQueueSend(xChannelQueue, (void*)&pxChannel, portMAX_DELAY); // shall never wait.
@@ -265,16 +282,81 @@ uint8_t ucHOS_DMA_blockUntilTransferHalfComplete(	uint8_t ucUnitNumber,
 							xTimeout	);
 }
 
-///*
-// * See header for info.
-// */
-//void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
-//											uint8_t ucChannelNumber	)
-//{
-//	uint32_t uiIndex = ucUnitNumber * portDMA_NUMBER_OF_CHANNELS_PER_UNIT + ucChannelNumber;
-//
-//	xSemaphoreTake(pxChannelArr[uiIndex].xTransferCompleteSemaphore, 0);
-//}
+/*
+ * See header for info.
+ */
+void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber	)
+{
+	uint32_t uiIndex = ucUnitNumber * portDMA_NUMBER_OF_CHANNELS_PER_UNIT + ucChannelNumber;
+
+	xSemaphoreTake(pxChannelArr[uiIndex].xTransferCompleteSemaphore, 0);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_DMA_clearTransferHalfCompleteFlag(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber	)
+{
+	uint32_t uiIndex = ucUnitNumber * portDMA_NUMBER_OF_CHANNELS_PER_UNIT + ucChannelNumber;
+
+	xSemaphoreTake(pxChannelArr[uiIndex].xTransferHalfCompleteSemaphore, 0);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_DMA_setTransferCompleteCallback(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber,
+											void (*pfCallback)(void*),
+											void* pvParams	)
+{
+	uint32_t uiIndex = ucUnitNumber * portDMA_NUMBER_OF_CHANNELS_PER_UNIT + ucChannelNumber;
+	xHOS_DMA_Channel_t* pxChannel = &pxChannelArr[uiIndex];
+
+	taskENTER_CRITICAL();
+	{
+		pxChannel->pfTransferCompleteCallback = pfCallback;
+		pxChannel->pvTransferCompleteCallbackParams = pvParams;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_DMA_setTransferHalfCompleteCallback(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber,
+												void (*pfCallback)(void*),
+												void* pvParams	)
+{
+	uint32_t uiIndex = ucUnitNumber * portDMA_NUMBER_OF_CHANNELS_PER_UNIT + ucChannelNumber;
+	xHOS_DMA_Channel_t* pxChannel = &pxChannelArr[uiIndex];
+
+	taskENTER_CRITICAL();
+	{
+		pxChannel->pfTransferHalfCompleteCallback = pfCallback;
+		pxChannel->pvTransferHalfCompleteCallbackParams = pvParams;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_DMA_getRemainingCount(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+{
+	return uiPORT_DMA_GET_REMAINING_COUNT(ucUnitNumber, ucChannelNumber);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_DMA_stopTransfer(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+{
+	vPORT_DMA_STOP_TRANSFER(ucUnitNumber, ucChannelNumber);
+}
 
 /*
  * See header for info.
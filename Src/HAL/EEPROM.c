@@ -8,9 +8,12 @@
 
 /*	LIB	*/
 #include "stdint.h"
+#include "string.h"
 
 /*	RTOS	*/
 #include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
 
 /*	MCAL	*/
 #include "MCAL_Port/Port_DIO.h"
@@ -23,107 +26,364 @@
 
 
 /*******************************************************************************
- * API functions:
+ * Helping functions/macros:
  ******************************************************************************/
 /*
- * See header for info.
+ * Returns ticks remaining of "xTimeout", that started at "xStartTime".
  */
-void vHOS_EEPROM_init(xHOS_EEPROM_t* pxHandle)
+static TickType_t xGetRemainingTime(TickType_t xStartTime, TickType_t xTimeout)
 {
-	/*	Initialize write enable pin as output. And enable output	*/
-	vPort_DIO_initPinOutput(pxHandle->ucWriteEnablePort, pxHandle->ucWriteEnablePin);
-	vPORT_DIO_WRITE_PIN(pxHandle->ucWriteEnablePort, pxHandle->ucWriteEnablePin, 0);
+	TickType_t xElapsed;
+
+	if (xTimeout == portMAX_DELAY)
+		return portMAX_DELAY;
+
+	xElapsed = xTaskGetTickCount() - xStartTime;
+
+	return (xElapsed < xTimeout) ? (xTimeout - xElapsed) : 0;
 }
 
+/*
+ * Waits for the EEPROM's internal write cycle to end.
+ *
+ * While write cycle is in progress, EEPROM does not acknowledge its address.
+ * Hence, an address only transaction is repeated until it gets acknowledged.
+ */
+static uint8_t ucAckPoll(	xHOS_EEPROM_t* pxHandle,
+							TickType_t xStartTime,
+							TickType_t xTimeout	)
+{
+	TickType_t xRemaining;
+
+	xHOS_I2C_transreceiveParams_t xParams = {
+			.ucUnitNumber = pxHandle->ucI2cUnitNumber,
+			.usAddress = pxHandle->ucI2cAddress,
+			.ucIs7BitAddress = 1,
+			.pucTxArr = NULL,
+			.uiTxSize = 0,
+			.pucRxArr = NULL,
+			.uiRxSize = 0
+	};
+
+	while(1)
+	{
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			return 0;
+
+		if (ucHOS_I2C_masterTransReceiveTimeout(&xParams, xRemaining))
+			return 1;
+
+		vTaskDelay(pdMS_TO_TICKS(uiCONF_EEPROM_ACK_POLLING_PERIOD_MS));
+	}
+}
 
 /*
- * See header for info.
+ * Writes "uiSize" bytes to the EEPROM, bypassing the cache.
+ *
+ * Data is split into page-aligned chunks, each is written in a single
+ * transaction (2 address bytes followed by up to a page of data), then ACK
+ * polled.
  */
-uint8_t ucHOS_EEPROM_write(	xHOS_EEPROM_t* pxHandle,
+static uint8_t ucWriteRaw(	xHOS_EEPROM_t* pxHandle,
 							const uint8_t* pucBuffer,
-							uint32_t uiBufferSz,
-							uint32_t uiStartingAddress,
+							uint32_t uiSize,
+							uint32_t uiAddress,
+							TickType_t xStartTime,
 							TickType_t xTimeout	)
 {
-	/*	Write byte by byte (TODO: page write)	*/
-	/*	TODO: Timeout	*/
-	uint8_t pucFrame[3];
-	uint16_t usAddress;
+	uint32_t uiChunkSize;
+	TickType_t xRemaining;
 
 	xHOS_I2C_transreceiveParams_t xParams = {
 			.ucUnitNumber = pxHandle->ucI2cUnitNumber,
 			.usAddress = pxHandle->ucI2cAddress,
 			.ucIs7BitAddress = 1,
-			.pucTxArr = pucFrame,
-			.uiTxSize = 3,
+			.pucTxArr = pxHandle->pucFrame,
 			.pucRxArr = NULL,
 			.uiRxSize = 0
 	};
 
-	for (uint32_t i = 0; i < uiBufferSz; i++)
+	while(uiSize > 0)
 	{
-		usAddress = uiStartingAddress + i;
-		pucFrame[0] = usAddress >> 8;
-		pucFrame[1] = usAddress & 0xFF;
-		pucFrame[2] = pucBuffer[i];
-		while(!ucHOS_I2C_masterTransReceive(&xParams));
-		vTaskDelay(10);	/*	TODO	*/
+		/*	Chunk must not cross a page boundary	*/
+		uiChunkSize = pxHandle->usPageSize - (uiAddress & (pxHandle->usPageSize - 1));
+		if (uiChunkSize > uiSize)
+			uiChunkSize = uiSize;
+
+		pxHandle->pucFrame[0] = (uint8_t)(uiAddress >> 8);
+		pxHandle->pucFrame[1] = (uint8_t)(uiAddress & 0xFF);
+		memcpy(&pxHandle->pucFrame[2], pucBuffer, uiChunkSize);
+		xParams.uiTxSize = 2 + uiChunkSize;
+
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			return 0;
+
+		if (!ucHOS_I2C_masterTransReceiveTimeout(&xParams, xRemaining))
+			return 0;
+
+		/*	Wait for write cycle to end	*/
+		if (!ucAckPoll(pxHandle, xStartTime, xTimeout))
+			return 0;
+
+		pucBuffer += uiChunkSize;
+		uiAddress += uiChunkSize;
+		uiSize -= uiChunkSize;
 	}
 
 	return 1;
 }
 
-
 /*
- * See header for info.
+ * Reads "uiSize" bytes from the EEPROM, bypassing the cache.
+ *
+ * A single sequential read transaction is used: dummy write of the address,
+ * then repeated start and reading of the whole buffer.
  */
-uint16_t usAddress;
-uint8_t ucHOS_EEPROM_read(	xHOS_EEPROM_t* pxHandle,
+static uint8_t ucReadRaw(	xHOS_EEPROM_t* pxHandle,
 							uint8_t* pucBuffer,
-							uint32_t uiBufferSz,
-							uint32_t uiStartingAddress,
+							uint32_t uiSize,
+							uint32_t uiAddress,
+							TickType_t xStartTime,
 							TickType_t xTimeout	)
 {
-	/*	Read byte by byte (TODO: page write)	*/
-	/*	TODO: Timeout	*/
-	uint8_t pucFrame[2];
-
+	TickType_t xRemaining;
 
 	xHOS_I2C_transreceiveParams_t xParams = {
 			.ucUnitNumber = pxHandle->ucI2cUnitNumber,
 			.usAddress = pxHandle->ucI2cAddress,
 			.ucIs7BitAddress = 1,
-			.pucTxArr = pucFrame,
+			.pucTxArr = pxHandle->pucFrame,
 			.uiTxSize = 2,
-			.uiRxSize = 1
+			.pucRxArr = pucBuffer,
+			.uiRxSize = uiSize
 	};
 
-	for (uint32_t i = 0; i < uiBufferSz; i++)
-	{
-		/*	Dummy write (For address selecting)	*/
-		usAddress = uiStartingAddress + i;
-		pucFrame[0] = usAddress >> 8;
-		pucFrame[1] = usAddress & 0xFF;
+	if (uiSize == 0)
+		return 1;
 
-		/*	Read	*/
-		xParams.pucRxArr = &pucBuffer[i];
+	pxHandle->pucFrame[0] = (uint8_t)(uiAddress >> 8);
+	pxHandle->pucFrame[1] = (uint8_t)(uiAddress & 0xFF);
 
-		while(!ucHOS_I2C_masterTransReceive(&xParams));
+	xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+	if (xRemaining == 0)
+		return 0;
 
-//		vTaskDelay(1);	/*	TODO	*/
-	}
+	return ucHOS_I2C_masterTransReceiveTimeout(&xParams, xRemaining);
+}
+
+/*
+ * Loads cache from the EEPROM, if it was not loaded yet.
+ */
+static uint8_t ucLoadCache(	xHOS_EEPROM_t* pxHandle,
+							TickType_t xStartTime,
+							TickType_t xTimeout	)
+{
+	if (pxHandle->uiCacheSizeInBytes == 0 || pxHandle->ucIsCacheLoaded)
+		return 1;
+
+	if (!ucReadRaw(	pxHandle,
+					pxHandle->pucCacheArr,
+					pxHandle->uiCacheSizeInBytes,
+					0,
+					xStartTime,
+					xTimeout	))
+		return 0;
+
+	pxHandle->ucIsCacheLoaded = 1;
+	pxHandle->ulDirtyPagesBitmap = 0;
 
 	return 1;
 }
 
+/*
+ * Copies data to the cache, and marks pages whose content has changed as dirty.
+ */
+static void vWriteCache(	xHOS_EEPROM_t* pxHandle,
+							const uint8_t* pucBuffer,
+							uint32_t uiSize,
+							uint32_t uiAddress	)
+{
+	uint32_t uiChunkSize;
+	uint32_t uiPage;
+
+	while(uiSize > 0)
+	{
+		uiChunkSize = pxHandle->usPageSize - (uiAddress & (pxHandle->usPageSize - 1));
+		if (uiChunkSize > uiSize)
+			uiChunkSize = uiSize;
+
+		/*	Unchanged data does not dirty the page	*/
+		if (memcmp(&pxHandle->pucCacheArr[uiAddress], pucBuffer, uiChunkSize) != 0)
+		{
+			memcpy(&pxHandle->pucCacheArr[uiAddress], pucBuffer, uiChunkSize);
+			uiPage = uiAddress / pxHandle->usPageSize;
+			pxHandle->ulDirtyPagesBitmap |= (uint64_t)1 << uiPage;
+		}
+
+		pucBuffer += uiChunkSize;
+		uiAddress += uiChunkSize;
+		uiSize -= uiChunkSize;
+	}
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+void vHOS_EEPROM_init(xHOS_EEPROM_t* pxHandle)
+{
+	configASSERT(pxHandle->usPageSize > 0);
+	configASSERT(pxHandle->usPageSize <= uiCONF_EEPROM_MAX_PAGE_SIZE);
+	configASSERT((pxHandle->usPageSize & (pxHandle->usPageSize - 1)) == 0);
+	configASSERT(pxHandle->uiCacheSizeInBytes <= pxHandle->uiSizeInBytes);
+	configASSERT(pxHandle->uiCacheSizeInBytes % pxHandle->usPageSize == 0);
+	configASSERT(pxHandle->uiCacheSizeInBytes / pxHandle->usPageSize <= 64);
+
+	/*	Initialize write enable pin as output. And enable output	*/
+	vPort_DIO_initPinOutput(pxHandle->ucWriteEnablePort, pxHandle->ucWriteEnablePin);
+	vPORT_DIO_WRITE_PIN(pxHandle->ucWriteEnablePort, pxHandle->ucWriteEnablePin, 0);
+
+	/*	Initialize mutex	*/
+	pxHandle->xMutex = xSemaphoreCreateMutexStatic(&pxHandle->xMutexStatic);
+	xSemaphoreGive(pxHandle->xMutex);
+
+	/*	Cache is loaded on first access	*/
+	pxHandle->ulDirtyPagesBitmap = 0;
+	pxHandle->ucIsCacheLoaded = 0;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_EEPROM_lock(xHOS_EEPROM_t* pxHandle, TickType_t xTimeout)
+{
+	return xSemaphoreTake(pxHandle->xMutex, xTimeout);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_EEPROM_unlock(xHOS_EEPROM_t* pxHandle)
+{
+	xSemaphoreGive(pxHandle->xMutex);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_EEPROM_write(	xHOS_EEPROM_t* pxHandle,
+							const uint8_t* pucBuffer,
+							uint32_t uiBufferSz,
+							uint32_t uiStartingAddress,
+							TickType_t xTimeout	)
+{
+	TickType_t xStartTime = xTaskGetTickCount();
+	uint32_t uiCachedSize;
+
+	/*	Check boundaries	*/
+	if (	uiStartingAddress > pxHandle->uiSizeInBytes ||
+			uiBufferSz > pxHandle->uiSizeInBytes - uiStartingAddress	)
+		return 0;
 
+	/*	Part that falls in the cached region is written to the cache only	*/
+	if (uiStartingAddress < pxHandle->uiCacheSizeInBytes)
+	{
+		if (!ucLoadCache(pxHandle, xStartTime, xTimeout))
+			return 0;
 
+		uiCachedSize = pxHandle->uiCacheSizeInBytes - uiStartingAddress;
+		if (uiCachedSize > uiBufferSz)
+			uiCachedSize = uiBufferSz;
 
+		vWriteCache(pxHandle, pucBuffer, uiCachedSize, uiStartingAddress);
 
+		pucBuffer += uiCachedSize;
+		uiStartingAddress += uiCachedSize;
+		uiBufferSz -= uiCachedSize;
+	}
 
+	return ucWriteRaw(	pxHandle,
+						pucBuffer,
+						uiBufferSz,
+						uiStartingAddress,
+						xStartTime,
+						xTimeout	);
+}
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_EEPROM_read(	xHOS_EEPROM_t* pxHandle,
+							uint8_t* pucBuffer,
+							uint32_t uiBufferSz,
+							uint32_t uiStartingAddress,
+							TickType_t xTimeout	)
+{
+	TickType_t xStartTime = xTaskGetTickCount();
+	uint32_t uiCachedSize;
 
+	/*	Check boundaries	*/
+	if (	uiStartingAddress > pxHandle->uiSizeInBytes ||
+			uiBufferSz > pxHandle->uiSizeInBytes - uiStartingAddress	)
+		return 0;
 
+	/*	Part that falls in the cached region is copied from the cache	*/
+	if (uiStartingAddress < pxHandle->uiCacheSizeInBytes)
+	{
+		if (!ucLoadCache(pxHandle, xStartTime, xTimeout))
+			return 0;
+
+		uiCachedSize = pxHandle->uiCacheSizeInBytes - uiStartingAddress;
+		if (uiCachedSize > uiBufferSz)
+			uiCachedSize = uiBufferSz;
 
+		memcpy(pucBuffer, &pxHandle->pucCacheArr[uiStartingAddress], uiCachedSize);
+
+		pucBuffer += uiCachedSize;
+		uiStartingAddress += uiCachedSize;
+		uiBufferSz -= uiCachedSize;
+	}
 
+	return ucReadRaw(	pxHandle,
+						pucBuffer,
+						uiBufferSz,
+						uiStartingAddress,
+						xStartTime,
+						xTimeout	);
+}
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_EEPROM_flush(xHOS_EEPROM_t* pxHandle, TickType_t xTimeout)
+{
+	TickType_t xStartTime = xTaskGetTickCount();
+	uint32_t uiPage;
+	uint32_t uiAddress;
+
+	while(pxHandle->ulDirtyPagesBitmap != 0)
+	{
+		/*	Lowest dirty page	*/
+		uiPage = 0;
+		while (((pxHandle->ulDirtyPagesBitmap >> uiPage) & 1) == 0)
+			uiPage++;
+
+		uiAddress = uiPage * pxHandle->usPageSize;
+
+		if (!ucWriteRaw(	pxHandle,
+							&pxHandle->pucCacheArr[uiAddress],
+							pxHandle->usPageSize,
+							uiAddress,
+							xStartTime,
+							xTimeout	))
+			return 0;
+
+		pxHandle->ulDirtyPagesBitmap &= ~((uint64_t)1 << uiPage);
+	}
+
+	return 1;
+}
@@ -0,0 +1,74 @@
+/*
+ * Port_I2C.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the I2C port, used only by "I2C_Test.c".
+ *
+ * Unlike the other host ports, functions here are only declared. Reading and
+ * writing the data register, and clearing ADDR flag, have side effects on the
+ * bus (i.e.: reading DR releases a byte held in the shift register, and starts
+ * reception of the next one). They are defined in the test, along with the
+ * simulated unit and the slave on its bus.
+ */
+
+#ifndef COTS_OS_SRC_HAL_I2C_HOSTTESTPORT_PORT_I2C_H_
+#define COTS_OS_SRC_HAL_I2C_HOSTTESTPORT_PORT_I2C_H_
+
+#include <stdint.h>
+
+/*	Number of units available in the stand-in target	*/
+#define portI2C_NUMBER_OF_UNITS		1
+
+/*	Same as the real targets	*/
+#define ucPORT_I2C_ACK_POS			0
+
+void vPort_I2C_enable(uint8_t ucUnitNumber);
+void vPort_I2C_disable(uint8_t ucUnitNumber);
+
+void vPort_I2C_generateStart(uint8_t ucUnitNumber);
+void vPort_I2C_generateStop(uint8_t ucUnitNumber);
+
+void vPort_I2C_enableAck(uint8_t ucUnitNumber);
+void vPort_I2C_disableAck(uint8_t ucUnitNumber);
+void vPort_I2C_setAckPos(uint8_t ucUnitNumber, uint8_t ucPos);
+
+uint8_t ucPort_I2C_readDrImm(uint8_t ucUnitNumber);
+void vPort_I2C_writeDrImm(uint8_t ucUnitNumber, uint8_t ucDR);
+
+uint8_t ucPort_I2C_readOvrFlag(uint8_t ucUnitNumber);
+void vPort_I2C_clearOvrFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readAckErrFlag(uint8_t ucUnitNumber);
+void vPort_I2C_clearAckErrFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readArbitrationLostFlag(uint8_t ucUnitNumber);
+void vPort_I2C_clearArbitrationLostFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readBusErrorFlag(uint8_t ucUnitNumber);
+void vPort_I2C_clearBusErrorFlag(uint8_t ucUnitNumber);
+
+uint8_t ucPort_I2C_readTxEmptyFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readRxNotEmptyFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_read10BitHeaderTxComplete(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readByteTransferFinishedFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readAddressTxCompleteFlag(uint8_t ucUnitNumber);
+void vPort_I2C_clearAddressTxCompleteFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readStartConditionTxCompleteFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readBusBusyFlag(uint8_t ucUnitNumber);
+uint8_t ucPort_I2C_readStopPendingFlag(uint8_t ucUnitNumber);
+
+void vPort_I2C_enableEventInterrupt(uint8_t ucUnitNumber);
+void vPort_I2C_disableEventInterrupt(uint8_t ucUnitNumber);
+void vPort_I2C_enableBufferInterrupt(uint8_t ucUnitNumber);
+void vPort_I2C_disableBufferInterrupt(uint8_t ucUnitNumber);
+void vPort_I2C_enableErrorInterrupt(uint8_t ucUnitNumber);
+void vPort_I2C_disableErrorInterrupt(uint8_t ucUnitNumber);
+
+void vPort_I2C_setEventCallback(	uint8_t ucUnitNumber,
+									void(*pfCallback)(void*),
+									void* pvParams	);
+void vPort_I2C_setErrorCallback(	uint8_t ucUnitNumber,
+									void(*pfCallback)(void*),
+									void* pvParams	);
+
+
+
+#endif /* COTS_OS_SRC_HAL_I2C_HOSTTESTPORT_PORT_I2C_H_ */
@@ -0,0 +1,468 @@
+/*
+ * I2C.c
+ *
+ *  Created on: Jul 11, 2023
+ *      Author: Ali Emad
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_I2C.h"
+#include "MCAL_Port/Port_Interrupt.h"
+
+/*	SELF	*/
+#include "HAL/I2C/I2C_Config.h"
+#include "HAL/I2C/I2C.h"
+
+/*******************************************************************************
+ * Helping types:
+ ******************************************************************************/
+typedef struct{
+	/*
+	 * Unit's mutex.
+	 *
+	 * Taken for the whole transaction. Tasks waiting on it form the unit's
+	 * transaction queue.
+	 */
+	StaticSemaphore_t xMutexStatic;
+	SemaphoreHandle_t xMutex;
+
+	/*	Given by the ISR on transaction completion or failure	*/
+	StaticSemaphore_t xDoneSemaphoreStatic;
+	SemaphoreHandle_t xDoneSemaphore;
+
+	/*	Current transaction	*/
+	xHOS_I2C_transreceiveParams_t* pxParams;
+	uint32_t uiTxCount;
+	uint32_t uiRxCount;
+	uint8_t ucIsReadPhase;
+	volatile uint8_t ucIsSuccessful;
+
+	/*
+	 * Set once the read phase's address is ACKed. Until then, events are not
+	 * data events of the read phase (i.e.: BTF of the write phase's last byte
+	 * stays set until the repeated start is actually generated).
+	 */
+	uint8_t ucIsReadAddressAcked;
+
+	uint8_t ucUnitNumber;
+}xHOS_I2C_Unit_t;
+
+/*******************************************************************************
+ * Global variables:
+ ******************************************************************************/
+static xHOS_I2C_Unit_t pxUnitArr[portI2C_NUMBER_OF_UNITS];
+
+/*******************************************************************************
+ * Helping functions / macros:
+ ******************************************************************************/
+#define ADDRESS_HEADER_10_BIT		0b11110000
+
+/*
+ * Ends current transaction (called from ISR).
+ */
+static void vFinishFromISR(xHOS_I2C_Unit_t* pxUnit, uint8_t ucIsSuccessful)
+{
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	vPort_I2C_disableEventInterrupt(ucUnitNumber);
+	vPort_I2C_disableBufferInterrupt(ucUnitNumber);
+	vPort_I2C_disableErrorInterrupt(ucUnitNumber);
+
+	vPort_I2C_setAckPos(ucUnitNumber, ucPORT_I2C_ACK_POS);
+
+	pxUnit->ucIsSuccessful = ucIsSuccessful;
+
+	xSemaphoreGiveFromISR(pxUnit->xDoneSemaphore, &xHighPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+/*
+ * Called (from ISR) when all Tx bytes are sent. Either generates a stop
+ * condition and ends the transaction, or generates a repeated start to begin
+ * the read phase.
+ */
+static void vEndWritePhase(xHOS_I2C_Unit_t* pxUnit)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	if (pxUnit->pxParams->uiRxSize == 0)
+	{
+		vPort_I2C_generateStop(ucUnitNumber);
+		vFinishFromISR(pxUnit, 1);
+	}
+
+	else
+	{
+		/*
+		 * Buffer interrupt stays disabled until the read phase's address is
+		 * ACKed, otherwise the (still set) TxE flag keeps interrupting.
+		 */
+		pxUnit->ucIsReadPhase = 1;
+		pxUnit->ucIsReadAddressAcked = 0;
+		pxUnit->uiRxCount = 0;
+		vPort_I2C_disableBufferInterrupt(ucUnitNumber);
+		vPort_I2C_generateStart(ucUnitNumber);
+	}
+}
+
+/*
+ * Called (from ISR) on address ACK of the read phase. ACK / stop setting before
+ * clearing ADDR flag depends on number of bytes to be received, as the unit
+ * starts receiving the first byte right after ADDR is cleared.
+ */
+static void vStartReadPhase(xHOS_I2C_Unit_t* pxUnit)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+	uint32_t uiRxSize = pxUnit->pxParams->uiRxSize;
+
+	pxUnit->ucIsReadAddressAcked = 1;
+
+	if (uiRxSize == 1)
+	{
+		/*	NACK the only byte, and stop right after it	*/
+		vPort_I2C_disableAck(ucUnitNumber);
+		vPort_I2C_clearAddressTxCompleteFlag(ucUnitNumber);
+		vPort_I2C_generateStop(ucUnitNumber);
+		vPort_I2C_enableBufferInterrupt(ucUnitNumber);
+	}
+
+	else if (uiRxSize == 2)
+	{
+		/*	NACK the second byte, both bytes are read on BTF	*/
+		vPort_I2C_disableAck(ucUnitNumber);
+		vPort_I2C_setAckPos(ucUnitNumber, 1);
+		vPort_I2C_clearAddressTxCompleteFlag(ucUnitNumber);
+	}
+
+	else
+	{
+		/*	If more than three bytes, bytes before the last three are read on RxNE	*/
+		vPort_I2C_enableAck(ucUnitNumber);
+		vPort_I2C_clearAddressTxCompleteFlag(ucUnitNumber);
+		if (uiRxSize > 3)
+			vPort_I2C_enableBufferInterrupt(ucUnitNumber);
+	}
+}
+
+/*
+ * Handles data events of the read phase.
+ *
+ * Last three bytes are handled on BTF (byte transfer finished, one byte in DR
+ * and one in the shift register, SCL stretched), so that NACK and stop are
+ * generated on time, as recommended in the target's reference manual.
+ */
+static void vReadPhaseEvent(xHOS_I2C_Unit_t* pxUnit)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+	xHOS_I2C_transreceiveParams_t* pxParams = pxUnit->pxParams;
+	uint32_t uiRemaining = pxParams->uiRxSize - pxUnit->uiRxCount;
+
+	if (uiRemaining == 1)
+	{
+		if (ucPort_I2C_readRxNotEmptyFlag(ucUnitNumber))
+		{
+			pxParams->pucRxArr[pxUnit->uiRxCount++] = ucPort_I2C_readDrImm(ucUnitNumber);
+			vFinishFromISR(pxUnit, 1);
+		}
+	}
+
+	else if (uiRemaining == 2)
+	{
+		if (ucPort_I2C_readByteTransferFinishedFlag(ucUnitNumber))
+		{
+			vPort_I2C_generateStop(ucUnitNumber);
+			pxParams->pucRxArr[pxUnit->uiRxCount++] = ucPort_I2C_readDrImm(ucUnitNumber);
+			pxParams->pucRxArr[pxUnit->uiRxCount++] = ucPort_I2C_readDrImm(ucUnitNumber);
+			vFinishFromISR(pxUnit, 1);
+		}
+	}
+
+	else if (uiRemaining == 3)
+	{
+		if (ucPort_I2C_readByteTransferFinishedFlag(ucUnitNumber))
+		{
+			vPort_I2C_disableAck(ucUnitNumber);
+			pxParams->pucRxArr[pxUnit->uiRxCount++] = ucPort_I2C_readDrImm(ucUnitNumber);
+		}
+	}
+
+	else
+	{
+		if (ucPort_I2C_readRxNotEmptyFlag(ucUnitNumber))
+		{
+			pxParams->pucRxArr[pxUnit->uiRxCount++] = ucPort_I2C_readDrImm(ucUnitNumber);
+
+			/*	Last three bytes are handled on BTF	*/
+			if (pxParams->uiRxSize - pxUnit->uiRxCount == 3)
+				vPort_I2C_disableBufferInterrupt(ucUnitNumber);
+		}
+	}
+}
+
+/*******************************************************************************
+ * ISR callbacks:
+ ******************************************************************************/
+static void vEventCallback(void* pvParams)
+{
+	xHOS_I2C_Unit_t* pxUnit = (xHOS_I2C_Unit_t*)pvParams;
+	xHOS_I2C_transreceiveParams_t* pxParams = pxUnit->pxParams;
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	/*	Start condition sent, send address (or 10-bit header)	*/
+	if (ucPort_I2C_readStartConditionTxCompleteFlag(ucUnitNumber))
+	{
+		if (pxParams->ucIs7BitAddress)
+			vPort_I2C_writeDrImm(
+				ucUnitNumber,
+				(((uint8_t)pxParams->usAddress) << 1) | pxUnit->ucIsReadPhase	);
+
+		else
+			vPort_I2C_writeDrImm(
+				ucUnitNumber,
+				ADDRESS_HEADER_10_BIT | ((pxParams->usAddress >> 7) & 0b110) | pxUnit->ucIsReadPhase	);
+	}
+
+	/*	10-bit header sent, send 2nd address byte	*/
+	else if (ucPort_I2C_read10BitHeaderTxComplete(ucUnitNumber))
+	{
+		vPort_I2C_writeDrImm(ucUnitNumber, pxParams->usAddress & 0xFF);
+	}
+
+	/*	Address ACKed	*/
+	else if (ucPort_I2C_readAddressTxCompleteFlag(ucUnitNumber))
+	{
+		if (pxUnit->ucIsReadPhase)
+			vStartReadPhase(pxUnit);
+
+		else
+		{
+			vPort_I2C_clearAddressTxCompleteFlag(ucUnitNumber);
+
+			/*	If there's no data to be written, end write phase	*/
+			if (pxParams->uiTxSize == 0)
+				vEndWritePhase(pxUnit);
+		}
+	}
+
+	/*	Read phase (ignoring events before its address is ACKed)	*/
+	else if (pxUnit->ucIsReadPhase)
+	{
+		if (pxUnit->ucIsReadAddressAcked)
+			vReadPhaseEvent(pxUnit);
+	}
+
+	/*	Write phase	*/
+	else if (pxUnit->uiTxCount < pxParams->uiTxSize)
+	{
+		if (ucPort_I2C_readTxEmptyFlag(ucUnitNumber))
+		{
+			vPort_I2C_writeDrImm(ucUnitNumber, pxParams->pucTxArr[pxUnit->uiTxCount++]);
+
+			/*	After last byte, wait for BTF instead of TxE	*/
+			if (pxUnit->uiTxCount == pxParams->uiTxSize)
+				vPort_I2C_disableBufferInterrupt(ucUnitNumber);
+		}
+	}
+
+	else if (ucPort_I2C_readByteTransferFinishedFlag(ucUnitNumber))
+	{
+		vEndWritePhase(pxUnit);
+	}
+}
+
+static void vErrorCallback(void* pvParams)
+{
+	xHOS_I2C_Unit_t* pxUnit = (xHOS_I2C_Unit_t*)pvParams;
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	/*	NACK (address or data), release the bus	*/
+	if (ucPort_I2C_readAckErrFlag(ucUnitNumber))
+	{
+		vPort_I2C_clearAckErrFlag(ucUnitNumber);
+		vPort_I2C_generateStop(ucUnitNumber);
+	}
+
+	/*	Arbitration lost, unit has already switched to slave mode	*/
+	if (ucPort_I2C_readArbitrationLostFlag(ucUnitNumber))
+		vPort_I2C_clearArbitrationLostFlag(ucUnitNumber);
+
+	if (ucPort_I2C_readBusErrorFlag(ucUnitNumber))
+		vPort_I2C_clearBusErrorFlag(ucUnitNumber);
+
+	if (ucPort_I2C_readOvrFlag(ucUnitNumber))
+		vPort_I2C_clearOvrFlag(ucUnitNumber);
+
+	vFinishFromISR(pxUnit, 0);
+}
+
+/*
+ * Returns remaining time of a timeout that started at "xStartTime".
+ */
+static TickType_t xGetRemainingTime(TickType_t xStartTime, TickType_t xTimeout)
+{
+	TickType_t xElapsed;
+
+	if (xTimeout == portMAX_DELAY)
+		return portMAX_DELAY;
+
+	xElapsed = xTaskGetTickCount() - xStartTime;
+
+	return (xElapsed < xTimeout) ? (xTimeout - xElapsed) : 0;
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header file for info.
+ */
+void vHOS_I2C_init(void)
+{
+	xHOS_I2C_Unit_t* pxUnit;
+
+	for (uint8_t i = 0; i < portI2C_NUMBER_OF_UNITS; i++)
+	{
+		pxUnit = &pxUnitArr[i];
+
+		/*	Create unit's mutex	*/
+		pxUnit->xMutex = xSemaphoreCreateMutexStatic(&pxUnit->xMutexStatic);
+		xSemaphoreGive(pxUnit->xMutex);
+
+		/*	Create transaction done semaphore	*/
+		pxUnit->xDoneSemaphore =
+			xSemaphoreCreateBinaryStatic(&pxUnit->xDoneSemaphoreStatic);
+		xSemaphoreTake(pxUnit->xDoneSemaphore, 0);
+
+		pxUnit->ucUnitNumber = i;
+
+		/*	Initialize unit's interrupts (enabled per transaction)	*/
+		vPort_I2C_disableEventInterrupt(i);
+		vPort_I2C_disableBufferInterrupt(i);
+		vPort_I2C_disableErrorInterrupt(i);
+
+		vPort_I2C_setEventCallback(i, vEventCallback, (void*)pxUnit);
+		vPort_I2C_setErrorCallback(i, vErrorCallback, (void*)pxUnit);
+
+		VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptI2cEventIrqNumberArr[i],
+										configLIBRARY_LOWEST_INTERRUPT_PRIORITY	);
+		VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptI2cErrorIrqNumberArr[i],
+										configLIBRARY_LOWEST_INTERRUPT_PRIORITY	);
+
+		vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptI2cEventIrqNumberArr[i]);
+		vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptI2cErrorIrqNumberArr[i]);
+	}
+}
+
+/*
+ * See header file for info.
+ */
+__attribute__((always_inline)) inline
+void vHOS_I2C_enable(uint8_t ucUnitNumber)
+{
+	vPort_I2C_enable(ucUnitNumber);
+}
+
+/*
+ * See header file for info.
+ */
+__attribute__((always_inline)) inline
+void vHOS_I2C_disable(uint8_t ucUnitNumber)
+{
+	vPort_I2C_disable(ucUnitNumber);
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_I2C_masterTransReceiveTimeout(	xHOS_I2C_transreceiveParams_t* pxParams,
+												TickType_t xTimeout	)
+{
+	uint8_t ucUnitNumber = pxParams->ucUnitNumber;
+	xHOS_I2C_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	TickType_t xStartTime = xTaskGetTickCount();
+	uint8_t ucIsSuccessful;
+
+	/*	Wait for previous transactions on this unit	*/
+	if (!xSemaphoreTake(pxUnit->xMutex, xTimeout))
+		return 0;
+
+	/*
+	 * Wait for bus if it was busy (i.e.: stop of the previous transaction is
+	 * still being generated, or another master is using the bus). This is
+	 * normally a few microseconds, hence polled.
+	 */
+	while(	ucPort_I2C_readBusBusyFlag(ucUnitNumber) ||
+			ucPort_I2C_readStopPendingFlag(ucUnitNumber)	)
+	{
+		if (xGetRemainingTime(xStartTime, xTimeout) == 0)
+		{
+			xSemaphoreGive(pxUnit->xMutex);
+			return 0;
+		}
+		taskYIELD();
+	}
+
+	/*	Prepare transaction	*/
+	pxUnit->pxParams = pxParams;
+	pxUnit->uiTxCount = 0;
+	pxUnit->uiRxCount = 0;
+	pxUnit->ucIsReadPhase = 0;
+	pxUnit->ucIsReadAddressAcked = 0;
+	pxUnit->ucIsSuccessful = 0;
+	xSemaphoreTake(pxUnit->xDoneSemaphore, 0);
+
+	/*	Start. Rest of the transaction is handled in ISR	*/
+	vPort_I2C_enableErrorInterrupt(ucUnitNumber);
+	vPort_I2C_enableBufferInterrupt(ucUnitNumber);
+	vPort_I2C_enableEventInterrupt(ucUnitNumber);
+	vPort_I2C_generateStart(ucUnitNumber);
+
+	/*	Block until transaction is done or timeout passes	*/
+	if (xSemaphoreTake(pxUnit->xDoneSemaphore, xGetRemainingTime(xStartTime, xTimeout)))
+	{
+		ucIsSuccessful = pxUnit->ucIsSuccessful;
+	}
+
+	else
+	{
+		/*	Abort	*/
+		vPort_I2C_disableEventInterrupt(ucUnitNumber);
+		vPort_I2C_disableBufferInterrupt(ucUnitNumber);
+		vPort_I2C_disableErrorInterrupt(ucUnitNumber);
+		vPort_I2C_generateStop(ucUnitNumber);
+		vPort_I2C_setAckPos(ucUnitNumber, ucPORT_I2C_ACK_POS);
+		ucIsSuccessful = 0;
+	}
+
+	xSemaphoreGive(pxUnit->xMutex);
+
+	return ucIsSuccessful;
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_I2C_masterTransReceive(xHOS_I2C_transreceiveParams_t* pxParams)
+{
+	return ucHOS_I2C_masterTransReceiveTimeout(
+		pxParams,
+		pdMS_TO_TICKS(uiCONF_I2C_DEFAULT_TIMEOUT_MS)	);
+}
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,812 @@
+/*
+ * I2C_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the I2C master driver, on a stand-in
+ * port ("HostTestPort" directory).
+ *
+ * The test simulates an STM32F1-like I2C unit in master mode, and a slave on its
+ * bus, at the level of the flags the driver uses: SB, ADD10, ADDR, TxE, RxNE,
+ * BTF, AF, and the START, STOP, ACK and POS control bits. SCL is stretched
+ * while ADDR or BTF is set, so the simulated bus waits for the driver, as the
+ * real one does. The driver's event and error callbacks are called while their
+ * interrupts are enabled and pending. Simulation runs whenever the driver
+ * blocks (see "ucHOST_TEST_STUB_onBlock()" in "Src/LIB/HostTestStubs").
+ *
+ * It checks, for random transactions with 7-bit and 10-bit addresses, that:
+ * 		-	The slave receives the written bytes, and the master receives the
+ * 			slave's bytes.
+ *
+ * 		-	The slave sends exactly "uiRxSize" bytes. All are ACKed but the last,
+ * 			which is NACKed, and a stop condition ends the transaction.
+ *
+ * 		-	DR is never read empty nor written full, and no interrupt is kept
+ * 			pending without being served (interrupt storm).
+ *
+ * 		-	An address NACK, a data NACK, and a slave which stretches SCL forever
+ * 			fail the transaction (the latter by timeout), and the next
+ * 			transaction succeeds.
+ *
+ * Then it prints, for transactions of the drivers which use the I2C, the number
+ * of interrupts per transaction, the bus time at 400 kHz, and the percentage of
+ * that time the CPU is left idle. A CPU time of "uiISR_CPU_TIME_NS" per
+ * interrupt is assumed (entry, callback and exit). The calling task itself is
+ * blocked for the whole transaction. (The previous, polling driver kept the
+ * CPU 0% idle.)
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_I2C_HOST_TEST \
+ * 			-ISrc/HAL/I2C/HostTestPort -ISrc/LIB/HostTestStubs -IInc \
+ * 			Src/HAL/I2C/I2C.c Src/HAL/I2C/I2C_Test.c -o i2c_test
+ *
+ * 		./i2c_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_I2C_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*	FreeRTOS (stubs)	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (stand-in port)	*/
+#include "MCAL_Port/Port_I2C.h"
+#include "MCAL_Port/Port_Interrupt.h"
+
+/*	HAL	*/
+#include "HAL/I2C/I2C.h"
+
+#define uiNUMBER_OF_TRANSACTIONS	20000
+#define uiMAX_TX_SIZE				20
+#define uiMAX_RX_SIZE				40
+
+/*	Bus clock, and assumed CPU time of an interrupt (~150 cycles at 72 MHz)	*/
+#define uiBIT_TIME_NS				2500
+#define uiISR_CPU_TIME_NS			2000
+
+/*	Consecutive interrupts with no change on the bus, considered a storm	*/
+#define uiMAX_ISR_STREAK			1000
+
+/*	Slave addresses	*/
+#define usSLAVE_ADDRESS_7_BIT		0x68
+#define usSLAVE_ADDRESS_10_BIT		0x2A5
+
+/*******************************************************************************
+ * Simulated unit and slave:
+ ******************************************************************************/
+const uint8_t pxPortInterruptI2cEventIrqNumberArr[] = {0};
+const uint8_t pxPortInterruptI2cErrorIrqNumberArr[] = {0};
+
+typedef enum{
+	xPHASE_IDLE,
+	xPHASE_WAIT_ADDRESS,		/*	SB set, waiting for address write	*/
+	xPHASE_ADDRESS,				/*	Address (or 10-bit header) on the bus	*/
+	xPHASE_WAIT_ADDRESS_2,		/*	ADD10 set, waiting for 2nd address byte	*/
+	xPHASE_ADDRESS_2,			/*	2nd address byte on the bus	*/
+	xPHASE_WAIT_ADDR_CLEAR,		/*	ADDR set, SCL stretched	*/
+	xPHASE_TX,
+	xPHASE_RX,
+	xPHASE_NACKED				/*	Address or data NACKed, waiting for stop	*/
+}xPhase_t;
+
+typedef struct{
+	/*	Callbacks and their parameters	*/
+	void (*pfEventCallback)(void*);
+	void* pvEventCallbackParams;
+	void (*pfErrorCallback)(void*);
+	void* pvErrorCallbackParams;
+
+	/*	Control bits	*/
+	uint8_t ucIsEnabled;
+	uint8_t ucIsEventInterruptEnabled;
+	uint8_t ucIsBufferInterruptEnabled;
+	uint8_t ucIsErrorInterruptEnabled;
+	uint8_t ucAck;
+	uint8_t ucPos;
+	uint8_t ucStartRequest;
+	uint8_t ucStopRequest;
+
+	/*	Status flags	*/
+	uint8_t ucSB;
+	uint8_t ucADD10;
+	uint8_t ucADDR;
+	uint8_t ucTXE;
+	uint8_t ucRXNE;
+	uint8_t ucBTF;
+	uint8_t ucAF;
+	uint8_t ucBusy;
+	uint8_t ucIsTransmitter;
+
+	xPhase_t xPhase;
+
+	uint8_t ucDr;
+	uint8_t ucShiftRegister;
+
+	/*	Tx: a byte is being sent. Rx: a byte is being received / is held	*/
+	uint8_t ucIsShifting;
+	uint8_t ucIsShiftRegisterFull;
+
+	/*	Rx: ACK of the byte being received, and of the next one (POS = 1)	*/
+	uint8_t ucCurrentAckLatch;
+	uint8_t ucNextAckLatch;
+	uint8_t ucLastAck;
+}xHostI2c_t;
+
+typedef struct{
+	uint16_t usAddress;
+	uint8_t ucIs7Bit;
+
+	/*	Was addressed by a 10-bit write (a 10-bit read needs the header only)	*/
+	uint8_t ucIs10BitWriteAddressed;
+
+	/*	Bytes received from master	*/
+	uint8_t pucRxArr[uiMAX_TX_SIZE];
+	uint32_t uiRxCount;
+
+	/*	Bytes sent to master, and master's ACKs	*/
+	uint32_t uiTxCount;
+	uint32_t uiTxAckCount;
+	uint32_t uiTxNackCount;
+
+	uint32_t uiStopCount;
+
+	/*	NACK received byte of this index (or never if ~0)	*/
+	uint32_t uiNackIndex;
+
+	/*	Stretch SCL forever, now or after that number of bus actions	*/
+	uint8_t ucIsStalled;
+	uint32_t uiStallAfterActions;
+}xHostSlave_t;
+
+static xHostI2c_t xI2c;
+static xHostSlave_t xSlave;
+
+/*	Simulated bus time (ns), number of interrupts, and misuses of DR	*/
+static uint64_t ulBusTime;
+static uint32_t uiIsrCount;
+static uint32_t uiDrMisuseCount;
+static uint32_t uiIsrStreak;
+static uint32_t uiStormCount;
+
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiIndex)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, index: %u\n", pcName, uiIndex);
+		uiNumberOfFailures++;
+	}
+}
+
+/*	Slave's i-th byte of a read	*/
+static uint8_t ucSlaveByte(uint32_t i)
+{
+	return (uint8_t)(i * 29 + 11);
+}
+
+/*	Starts reception of next byte (in the shift register)	*/
+static void vStartRxByte(void)
+{
+	xI2c.ucIsShifting = 1;
+	xI2c.ucCurrentAckLatch = xI2c.ucNextAckLatch;
+	xI2c.ucNextAckLatch = xI2c.ucAck;
+}
+
+/*	Port functions	*/
+void vPort_I2C_enable(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsEnabled = 1; }
+void vPort_I2C_disable(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsEnabled = 0; }
+
+void vPort_I2C_generateStart(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucStartRequest = 1; }
+void vPort_I2C_generateStop(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucStopRequest = 1; }
+
+void vPort_I2C_enableAck(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucAck = 1; }
+void vPort_I2C_disableAck(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucAck = 0; }
+void vPort_I2C_setAckPos(uint8_t ucUnitNumber, uint8_t ucPos) { (void)ucUnitNumber; xI2c.ucPos = ucPos; }
+
+uint8_t ucPort_I2C_readDrImm(uint8_t ucUnitNumber)
+{
+	uint8_t ucByte = xI2c.ucDr;
+	(void)ucUnitNumber;
+
+	if (!xI2c.ucRXNE)
+		uiDrMisuseCount++;
+
+	xI2c.ucRXNE = 0;
+
+	/*	Release the held byte, and continue receiving if it was ACKed	*/
+	if (xI2c.ucIsShiftRegisterFull)
+	{
+		xI2c.ucDr = xI2c.ucShiftRegister;
+		xI2c.ucRXNE = 1;
+		xI2c.ucBTF = 0;
+		xI2c.ucIsShiftRegisterFull = 0;
+
+		if (xI2c.ucLastAck && !xI2c.ucStopRequest)
+			vStartRxByte();
+	}
+
+	return ucByte;
+}
+
+void vPort_I2C_writeDrImm(uint8_t ucUnitNumber, uint8_t ucDR)
+{
+	(void)ucUnitNumber;
+
+	xI2c.ucDr = ucDR;
+
+	if (xI2c.ucSB)
+	{
+		xI2c.ucSB = 0;
+		xI2c.xPhase = xPHASE_ADDRESS;
+	}
+
+	else if (xI2c.ucADD10)
+	{
+		xI2c.ucADD10 = 0;
+		xI2c.xPhase = xPHASE_ADDRESS_2;
+	}
+
+	else if (xI2c.xPhase == xPHASE_TX && xI2c.ucTXE)
+	{
+		xI2c.ucTXE = 0;
+		xI2c.ucBTF = 0;
+	}
+
+	else
+		uiDrMisuseCount++;
+}
+
+uint8_t ucPort_I2C_readOvrFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return 0; }
+void vPort_I2C_clearOvrFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; }
+uint8_t ucPort_I2C_readAckErrFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucAF; }
+void vPort_I2C_clearAckErrFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucAF = 0; }
+uint8_t ucPort_I2C_readArbitrationLostFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return 0; }
+void vPort_I2C_clearArbitrationLostFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; }
+uint8_t ucPort_I2C_readBusErrorFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return 0; }
+void vPort_I2C_clearBusErrorFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; }
+
+uint8_t ucPort_I2C_readTxEmptyFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucTXE; }
+uint8_t ucPort_I2C_readRxNotEmptyFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucRXNE; }
+uint8_t ucPort_I2C_read10BitHeaderTxComplete(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucADD10; }
+uint8_t ucPort_I2C_readByteTransferFinishedFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucBTF; }
+uint8_t ucPort_I2C_readAddressTxCompleteFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucADDR; }
+uint8_t ucPort_I2C_readStartConditionTxCompleteFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucSB; }
+uint8_t ucPort_I2C_readBusBusyFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucBusy; }
+uint8_t ucPort_I2C_readStopPendingFlag(uint8_t ucUnitNumber) { (void)ucUnitNumber; return xI2c.ucStopRequest; }
+
+void vPort_I2C_clearAddressTxCompleteFlag(uint8_t ucUnitNumber)
+{
+	(void)ucUnitNumber;
+
+	if (!xI2c.ucADDR)
+		return;
+
+	xI2c.ucADDR = 0;
+
+	if (xI2c.ucIsTransmitter)
+	{
+		xI2c.xPhase = xPHASE_TX;
+		xI2c.ucTXE = 1;
+	}
+
+	else
+	{
+		xI2c.xPhase = xPHASE_RX;
+		xI2c.ucNextAckLatch = 1;
+		vStartRxByte();
+	}
+}
+
+void vPort_I2C_enableEventInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsEventInterruptEnabled = 1; }
+void vPort_I2C_disableEventInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsEventInterruptEnabled = 0; }
+void vPort_I2C_enableBufferInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsBufferInterruptEnabled = 1; }
+void vPort_I2C_disableBufferInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsBufferInterruptEnabled = 0; }
+void vPort_I2C_enableErrorInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsErrorInterruptEnabled = 1; }
+void vPort_I2C_disableErrorInterrupt(uint8_t ucUnitNumber) { (void)ucUnitNumber; xI2c.ucIsErrorInterruptEnabled = 0; }
+
+void vPort_I2C_setEventCallback(	uint8_t ucUnitNumber,
+									void(*pfCallback)(void*),
+									void* pvParams	)
+{
+	(void)ucUnitNumber;
+	xI2c.pfEventCallback = pfCallback;
+	xI2c.pvEventCallbackParams = pvParams;
+}
+
+void vPort_I2C_setErrorCallback(	uint8_t ucUnitNumber,
+									void(*pfCallback)(void*),
+									void* pvParams	)
+{
+	(void)ucUnitNumber;
+	xI2c.pfErrorCallback = pfCallback;
+	xI2c.pvErrorCallbackParams = pvParams;
+}
+
+/*	Slave's response to an address byte. Returns 1 if ACKed	*/
+static uint8_t ucSlaveAddress(uint8_t ucByte, uint8_t ucIsSecondByte)
+{
+	uint8_t ucIsRead = ucByte & 1;
+
+	if (ucIsSecondByte)
+	{
+		xSlave.ucIs10BitWriteAddressed = !xSlave.ucIs7Bit && ucByte == (xSlave.usAddress & 0xFF);
+		return xSlave.ucIs10BitWriteAddressed;
+	}
+
+	/*	10-bit header	*/
+	if ((ucByte & 0xF8) == 0xF0)
+	{
+		if (xSlave.ucIs7Bit || ((ucByte >> 1) & 0b11) != (xSlave.usAddress >> 8))
+			return 0;
+
+		xI2c.ucIsTransmitter = !ucIsRead;
+
+		return ucIsRead ? xSlave.ucIs10BitWriteAddressed : 1;
+	}
+
+	xI2c.ucIsTransmitter = !ucIsRead;
+
+	return xSlave.ucIs7Bit && (ucByte >> 1) == xSlave.usAddress;
+}
+
+/*
+ * Runs one action of the bus (start, stop, a byte, or moving DR to the shift
+ * register). Returns 1 if anything happened.
+ */
+static uint8_t ucRunBus(void)
+{
+	if (!xI2c.ucIsEnabled || xSlave.ucIsStalled)
+		return 0;
+
+	/*	(Repeated) start, after current byte	*/
+	if (xI2c.ucStartRequest && !xI2c.ucIsShifting && !xI2c.ucStopRequest)
+	{
+		xI2c.ucStartRequest = 0;
+		xI2c.ucSB = 1;
+		xI2c.ucBusy = 1;
+		xI2c.ucBTF = 0;
+		xI2c.ucTXE = 0;
+		xI2c.xPhase = xPHASE_WAIT_ADDRESS;
+		ulBusTime += uiBIT_TIME_NS;
+		return 1;
+	}
+
+	/*	Stop, after current byte (and after a held byte is read)	*/
+	if (xI2c.ucStopRequest && !xI2c.ucIsShifting && !xI2c.ucIsShiftRegisterFull)
+	{
+		xI2c.ucStopRequest = 0;
+		xI2c.ucStartRequest = 0;
+		xI2c.ucBusy = 0;
+		xI2c.ucSB = 0;
+		xI2c.ucADDR = 0;
+		xI2c.ucADD10 = 0;
+		xI2c.ucBTF = 0;
+		xI2c.ucTXE = 0;
+		xI2c.xPhase = xPHASE_IDLE;
+		xSlave.uiStopCount++;
+		ulBusTime += uiBIT_TIME_NS;
+		return 1;
+	}
+
+	switch(xI2c.xPhase)
+	{
+	case xPHASE_ADDRESS:
+	case xPHASE_ADDRESS_2:
+		ulBusTime += 9 * uiBIT_TIME_NS;
+
+		if (!ucSlaveAddress(xI2c.ucDr, xI2c.xPhase == xPHASE_ADDRESS_2))
+		{
+			xI2c.ucAF = 1;
+			xI2c.xPhase = xPHASE_NACKED;
+		}
+
+		/*	10-bit write header	*/
+		else if (xI2c.xPhase == xPHASE_ADDRESS && (xI2c.ucDr & 0xF9) == 0xF0)
+		{
+			xI2c.ucADD10 = 1;
+			xI2c.xPhase = xPHASE_WAIT_ADDRESS_2;
+		}
+
+		else
+		{
+			xI2c.ucADDR = 1;
+			xI2c.xPhase = xPHASE_WAIT_ADDR_CLEAR;
+		}
+		return 1;
+
+	case xPHASE_TX:
+		/*	Byte sent	*/
+		if (xI2c.ucIsShifting)
+		{
+			ulBusTime += 9 * uiBIT_TIME_NS;
+			xI2c.ucIsShifting = 0;
+
+			if (xSlave.uiRxCount == xSlave.uiNackIndex)
+			{
+				xI2c.ucAF = 1;
+				xI2c.xPhase = xPHASE_NACKED;
+				return 1;
+			}
+
+			if (xSlave.uiRxCount < uiMAX_TX_SIZE)
+				xSlave.pucRxArr[xSlave.uiRxCount] = xI2c.ucShiftRegister;
+			xSlave.uiRxCount++;
+
+			if (xI2c.ucTXE)
+				xI2c.ucBTF = 1;
+			return 1;
+		}
+
+		/*	DR to shift register	*/
+		if (!xI2c.ucTXE)
+		{
+			xI2c.ucShiftRegister = xI2c.ucDr;
+			xI2c.ucIsShifting = 1;
+			xI2c.ucTXE = 1;
+			return 1;
+		}
+		return 0;
+
+	case xPHASE_RX:
+		/*	Byte received, and ACKed / NACKed	*/
+		if (xI2c.ucIsShifting)
+		{
+			uint8_t ucByte = ucSlaveByte(xSlave.uiTxCount++);
+
+			ulBusTime += 9 * uiBIT_TIME_NS;
+			xI2c.ucIsShifting = 0;
+			xI2c.ucLastAck = xI2c.ucPos ? xI2c.ucCurrentAckLatch : xI2c.ucAck;
+
+			if (xI2c.ucLastAck)
+				xSlave.uiTxAckCount++;
+			else
+				xSlave.uiTxNackCount++;
+
+			/*	Held in shift register (SCL stretched) if DR is not read yet	*/
+			if (xI2c.ucRXNE)
+			{
+				xI2c.ucShiftRegister = ucByte;
+				xI2c.ucIsShiftRegisterFull = 1;
+				xI2c.ucBTF = 1;
+			}
+
+			else
+			{
+				xI2c.ucDr = ucByte;
+				xI2c.ucRXNE = 1;
+
+				if (xI2c.ucLastAck && !xI2c.ucStopRequest)
+					vStartRxByte();
+			}
+			return 1;
+		}
+		return 0;
+
+	default:
+		return 0;
+	}
+}
+
+static uint8_t ucIsEventPending(void)
+{
+	return	xI2c.ucIsEventInterruptEnabled &&
+			(	xI2c.ucSB || xI2c.ucADDR || xI2c.ucADD10 || xI2c.ucBTF ||
+				(xI2c.ucIsBufferInterruptEnabled && (xI2c.ucTXE || xI2c.ucRXNE))	);
+}
+
+static uint8_t ucIsErrorPending(void)
+{
+	return xI2c.ucIsErrorInterruptEnabled && xI2c.ucAF;
+}
+
+/*
+ * Runs one step of the simulated hardware. Returns 1 if anything happened.
+ *
+ * Pending interrupts are served first (ISR is much faster than a byte on the
+ * bus). An interrupt kept pending by the driver (i.e.: BTF of the write phase,
+ * until the repeated start is generated) lets the bus run every other step.
+ */
+static uint8_t ucRunHardware(void)
+{
+	uint8_t ucIsPending = ucIsErrorPending() || ucIsEventPending();
+
+	if (ucIsPending && (uiIsrStreak & 1) == 0)
+	{
+		uiIsrStreak++;
+		uiIsrCount++;
+
+		if (ucIsErrorPending())
+			xI2c.pfErrorCallback(xI2c.pvErrorCallbackParams);
+		else
+			xI2c.pfEventCallback(xI2c.pvEventCallbackParams);
+		return 1;
+	}
+
+	if (ucRunBus())
+	{
+		uiIsrStreak = 0;
+
+		if (--xSlave.uiStallAfterActions == 0)
+			xSlave.ucIsStalled = 1;
+		return 1;
+	}
+
+	if (ucIsPending)
+	{
+		if (uiIsrStreak >= 2 * uiMAX_ISR_STREAK)
+		{
+			uiStormCount++;
+			return 0;
+		}
+
+		/*	Nothing on the bus, next step serves the interrupt again	*/
+		uiIsrStreak++;
+		return 1;
+	}
+
+	return 0;
+}
+
+uint8_t ucHOST_TEST_STUB_onBlock(void)
+{
+	return ucRunHardware();
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static void vSlaveReset(uint8_t ucIs7Bit)
+{
+	xSlave.ucIs7Bit = ucIs7Bit;
+	xSlave.usAddress = ucIs7Bit ? usSLAVE_ADDRESS_7_BIT : usSLAVE_ADDRESS_10_BIT;
+	xSlave.ucIs10BitWriteAddressed = 0;
+	xSlave.uiRxCount = 0;
+	xSlave.uiTxCount = 0;
+	xSlave.uiTxAckCount = 0;
+	xSlave.uiTxNackCount = 0;
+	xSlave.uiStopCount = 0;
+	xSlave.uiNackIndex = ~0u;
+	xSlave.ucIsStalled = 0;
+	xSlave.uiStallAfterActions = ~0u;
+}
+
+/*	Checks state of the unit after a transaction	*/
+static void vCheckUnitIdle(uint32_t uiIndex)
+{
+	vCheck(	!xI2c.ucIsEventInterruptEnabled &&
+			!xI2c.ucIsBufferInterruptEnabled &&
+			!xI2c.ucIsErrorInterruptEnabled,
+			"interrupts disabled after transaction", uiIndex	);
+
+	vCheck(xI2c.ucPos == ucPORT_I2C_ACK_POS, "ACK POS restored", uiIndex);
+	vCheck(uiDrMisuseCount == 0, "DR read empty / written full", uiIndex);
+	vCheck(uiStormCount == 0, "interrupt storm", uiIndex);
+}
+
+static void vTestRandomTransactions(void)
+{
+	static uint8_t pucTxArr[uiMAX_TX_SIZE];
+	static uint8_t pucRxArr[uiMAX_RX_SIZE];
+	xHOS_I2C_transreceiveParams_t xParams;
+	uint8_t ucIsSuccessful;
+
+	for (uint32_t t = 0; t < uiNUMBER_OF_TRANSACTIONS; t++)
+	{
+		uint8_t ucIs7Bit = rand() % 4 != 0;
+
+		vSlaveReset(ucIs7Bit);
+
+		xParams.ucUnitNumber = 0;
+		xParams.usAddress = xSlave.usAddress;
+		xParams.ucIs7BitAddress = ucIs7Bit;
+		xParams.pucTxArr = pucTxArr;
+		xParams.uiTxSize = rand() % (uiMAX_TX_SIZE + 1);
+		xParams.pucRxArr = pucRxArr;
+		xParams.uiRxSize = (rand() % 2) ? (rand() % (uiMAX_RX_SIZE + 1)) : 0;
+
+		/*	10-bit read needs the write phase's address	*/
+		if (!ucIs7Bit && xParams.uiRxSize && !xParams.uiTxSize)
+			xParams.uiTxSize = 1;
+
+		for (uint32_t i = 0; i < xParams.uiTxSize; i++)
+			pucTxArr[i] = rand();
+		memset(pucRxArr, 0, sizeof(pucRxArr));
+
+		ucIsSuccessful = ucHOS_I2C_masterTransReceive(&xParams);
+
+		/*	Let the stop condition be generated	*/
+		while(ucRunHardware());
+
+		vCheck(ucIsSuccessful, "transaction successful", t);
+
+		vCheck(	xSlave.uiRxCount == xParams.uiTxSize &&
+				memcmp(xSlave.pucRxArr, pucTxArr, xParams.uiTxSize) == 0,
+				"slave received written bytes", t	);
+
+		vCheck(xSlave.uiTxCount == xParams.uiRxSize, "slave sent exactly Rx size", t);
+
+		if (xParams.uiRxSize)
+		{
+			vCheck(	xSlave.uiTxAckCount == xParams.uiRxSize - 1 &&
+					xSlave.uiTxNackCount == 1,
+					"all but last received byte ACKed", t	);
+		}
+
+		for (uint32_t i = 0; i < xParams.uiRxSize; i++)
+			vCheck(pucRxArr[i] == ucSlaveByte(i), "master received slave's bytes", t);
+
+		vCheck(xSlave.uiStopCount == 1 && !xI2c.ucBusy, "stop generated", t);
+
+		vCheckUnitIdle(t);
+	}
+}
+
+static uint8_t ucRunSimple(uint32_t uiTxSize, uint32_t uiRxSize)
+{
+	static uint8_t pucTxArr[uiMAX_TX_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+	static uint8_t pucRxArr[uiMAX_RX_SIZE];
+
+	xHOS_I2C_transreceiveParams_t xParams = {
+		.ucUnitNumber = 0,
+		.usAddress = usSLAVE_ADDRESS_7_BIT,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = pucTxArr,
+		.uiTxSize = uiTxSize,
+		.pucRxArr = pucRxArr,
+		.uiRxSize = uiRxSize
+	};
+
+	return ucHOS_I2C_masterTransReceive(&xParams);
+}
+
+static void vTestFailures(void)
+{
+	xHOS_I2C_transreceiveParams_t xParams;
+	uint8_t ucByte = 0;
+
+	/*	Address NACK (no such slave)	*/
+	vSlaveReset(1);
+	xParams = (xHOS_I2C_transreceiveParams_t){
+		.ucUnitNumber = 0,
+		.usAddress = usSLAVE_ADDRESS_7_BIT + 1,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = &ucByte,
+		.uiTxSize = 1
+	};
+	vCheck(!ucHOS_I2C_masterTransReceive(&xParams), "address NACK fails", 0);
+	while(ucRunHardware());
+	vCheck(xSlave.uiStopCount == 1 && !xI2c.ucBusy, "stop after address NACK", 0);
+	vCheckUnitIdle(0);
+
+	vSlaveReset(1);
+	vCheck(ucRunSimple(1, 4), "transaction after address NACK", 0);
+	while(ucRunHardware());
+
+	/*	Data NACK	*/
+	vSlaveReset(1);
+	xSlave.uiNackIndex = 2;
+	vCheck(!ucRunSimple(6, 0), "data NACK fails", 1);
+	while(ucRunHardware());
+	vCheck(xSlave.uiRxCount == 2, "no bytes after data NACK", 1);
+	vCheck(xSlave.uiStopCount == 1 && !xI2c.ucBusy, "stop after data NACK", 1);
+	vCheckUnitIdle(1);
+
+	vSlaveReset(1);
+	vCheck(ucRunSimple(2, 2), "transaction after data NACK", 1);
+	while(ucRunHardware());
+
+	/*
+	 * Slave stretching SCL forever, in the write and in the read phase.
+	 * (Simulation stops, which times the transaction out)
+	 */
+	for (uint32_t uiPhase = 0; uiPhase < 2; uiPhase++)
+	{
+		vSlaveReset(1);
+		xParams = (xHOS_I2C_transreceiveParams_t){
+			.ucUnitNumber = 0,
+			.usAddress = usSLAVE_ADDRESS_7_BIT,
+			.ucIs7BitAddress = 1,
+			.pucTxArr = &ucByte,
+			.uiTxSize = 1,
+			.pucRxArr = &ucByte,
+			.uiRxSize = 1
+		};
+
+		/*
+		 * Stall once the written byte is on the bus (start, address, DR to shift
+		 * register), or once the repeated start is generated (byte sent, start).
+		 */
+		xSlave.uiStallAfterActions = (uiPhase == 0) ? 3 : 5;
+
+		vCheck(!ucHOS_I2C_masterTransReceiveTimeout(&xParams, 10), "stalled slave times out", 2 + uiPhase);
+		vCheckUnitIdle(2 + uiPhase);
+		vCheck(xI2c.ucStopRequest, "stop requested on timeout", 2 + uiPhase);
+
+		/*	Slave releases SCL (i.e.: its own timeout)	*/
+		vSlaveReset(1);
+		vCheck(ucRunSimple(1, 3), "transaction after timeout", 2 + uiPhase);
+		while(ucRunHardware());
+		vCheckUnitIdle(2 + uiPhase);
+	}
+}
+
+typedef struct{
+	const char* pcName;
+	uint32_t uiTxSize;
+	uint32_t uiRxSize;
+}xBenchmarkCase_t;
+
+static void vBenchmark(void)
+{
+	static const xBenchmarkCase_t pxCaseArr[] = {
+		{"MPU6050 read sample (1 + 14)",	1,	14},
+		{"MPU6050 write register (2)",		2,	0},
+		{"EEPROM write page (2 + 16)",		18,	0},
+		{"EEPROM read (2 + 32)",			2,	32},
+		{"CharLcdI2c write nibble (1)",		1,	0},
+		{"read 1 byte (1 + 1)",				1,	1},
+		{"read 2 bytes (1 + 2)",			1,	2},
+		{"read 3 bytes (1 + 3)",			1,	3}
+	};
+
+	printf("transaction                     ISRs   bus time (us)   CPU idle\n");
+
+	for (uint32_t c = 0; c < sizeof(pxCaseArr) / sizeof(pxCaseArr[0]); c++)
+	{
+		uint32_t uiIsrStart = uiIsrCount;
+		uint64_t ulBusStart = ulBusTime;
+		uint32_t uiIsrs;
+		double dBusNs;
+
+		vSlaveReset(1);
+		vCheck(ucRunSimple(pxCaseArr[c].uiTxSize, pxCaseArr[c].uiRxSize), "benchmark transaction", c);
+		while(ucRunHardware());
+
+		uiIsrs = uiIsrCount - uiIsrStart;
+		dBusNs = (double)(ulBusTime - ulBusStart);
+
+		printf(	"%-30s %5u %15.1f %9.1f%%\n",
+				pxCaseArr[c].pcName,
+				uiIsrs,
+				dBusNs / 1000.0,
+				100.0 * (1.0 - uiIsrs * (double)uiISR_CPU_TIME_NS / dBusNs)	);
+	}
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vHOS_I2C_init();
+	vHOS_I2C_enable(0);
+
+	vTestRandomTransactions();
+	vTestFailures();
+	vBenchmark();
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_I2C_HOST_TEST	*/
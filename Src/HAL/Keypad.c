@@ -11,162 +11,291 @@
 /*	RTOS	*/
 #include "FreeRTOS.h"
 #include "task.h"
-#include "semphr.h"
+#include "queue.h"
 
 #include "RTOS_PRI_Config.h"
 
 /*	MCAL	*/
 #include "MCAL_Port/Port_DIO.h"
+#include "MCAL_Port/Port_Timer.h"
+#include "MCAL_Port/Port_Interrupt.h"
 
 /*	SELF	*/
 #include "HAL/Keypad/Keypad.h"
+#include "HAL/Keypad/KeypadScan.h"
 
 
 /*******************************************************************************
- * RTOS task:
+ * Helping functions / macros:
  ******************************************************************************/
-volatile uint32_t uiNPresses = 0;
-static void vTask(void* pvParams)
+/*
+ * Reads all row pins. Bit 'i' of the returned value is set if row 'i' is low
+ * (active, a key of the driven column is pressed on it). Each port is read once,
+ * if its row pins are successive in the rows array.
+ */
+static inline uint32_t uiReadRows(xHOS_Keypad_t* pxHandle)
 {
-	xHOS_Keypad_t* pxHandle = (xHOS_Keypad_t*)pvParams;
+	uint32_t uiRows = 0;
+	uint32_t uiPortLevels = 0;
+	uint8_t ucPort, ucLastPort = 0xFF;
 
-	while(1)
+	for (uint8_t ucRow = 0; ucRow < pxHandle->ucNRows; ucRow++)
 	{
-		/*	Execute one scan	*/
-
-		/*	For every column pin	*/
-		for (uint8_t ucCol = 0; ucCol < pxHandle->ucNCols; ucCol++)
+		ucPort = pxHandle->pucRowPortArr[ucRow];
+		if (ucPort != ucLastPort)
 		{
-			/*	Set the i-th column pin	*/
-			vPORT_DIO_WRITE_PIN(	pxHandle->pucColPortArr[ucCol],
-									pxHandle->pucColPinArr[ucCol],
-									1	);
-
-			/*
-			 * Settling delay (Wait for resetting previous column pin, and setting
-			 * new one to settle)
-			 */
-			vTaskDelay(pdMS_TO_TICKS(pxHandle->uiMsSettlingDelay));
-
-			/*	For every row pin	*/
-			for (uint8_t ucRow = 0; ucRow < pxHandle->ucNRows; ucRow++)
-			{
-				/*	Read pin state	*/
-				uint8_t ucRowPinState = ucPORT_DIO_READ_PIN(
-						pxHandle->pucRowPortArr[ucRow],
-						pxHandle->pucRowPinArr[ucRow]	);
-
-				/*	If row pin is high, then pin[row][col] is now pressed.	*/
-				if (ucRowPinState == 1)
-				{
-					pxHandle->cLastPressedKey =
-							pxHandle->pcButtons[ucRow * pxHandle->ucNCols + ucCol];
-
-					/*	Give new press semaphore	*/
-					xSemaphoreGive(pxHandle->xNewPressedKeySemphr);
-
-					uiNPresses++;
-
-					/*	Debouncing delay	*/
-					vTaskDelay(pdMS_TO_TICKS(pxHandle->uiMsDebouncingDelay));
-				}
-			}
-
-			/*	Reset the i-th column pin	*/
-			vPORT_DIO_WRITE_PIN(	pxHandle->pucColPortArr[ucCol],
-									pxHandle->pucColPinArr[ucCol],
-									0	);
+			uiPortLevels = uiPORT_DIO_READ_PORT(ucPort);
+			ucLastPort = ucPort;
 		}
+
+		uiRows |= ((~uiPortLevels >> pxHandle->pucRowPinArr[ucRow]) & 1) << ucRow;
 	}
+
+	return uiRows;
+}
+
+static inline void vSendEventFromISR(	xHOS_Keypad_t* pxHandle,
+										char cKey,
+										uint8_t ucEvent,
+										BaseType_t* pxHighPriorityTaskWoken	)
+{
+	xHOS_Keypad_event_t xEvent = {.cKey = cKey, .ucEvent = ucEvent};
+
+	if (xQueueSendFromISR(pxHandle->xEventQueue, &xEvent, pxHighPriorityTaskWoken) != pdTRUE)
+		pxHandle->uiNumberOfLostEvents++;
+}
+
+/*
+ * Columns are open-drain outputs. Idle columns are released (high-impedance),
+ * only the scanned one is driven (low). (Two pressed keys of a row would
+ * otherwise short the driven column to an idle one)
+ *
+ * Columns are switched by writing the set/reset register, pin configuration is
+ * not changed while scanning.
+ */
+static inline void vReleaseCol(xHOS_Keypad_t* pxHandle, uint8_t ucCol)
+{
+	vPORT_DIO_WRITE_PORT_SET_RESET(	pxHandle->pucColPortArr[ucCol],
+									1ul << pxHandle->pucColPinArr[ucCol]	);
+}
+
+static inline void vDriveCol(xHOS_Keypad_t* pxHandle, uint8_t ucCol)
+{
+	vPORT_DIO_WRITE_PORT_SET_RESET(	pxHandle->pucColPortArr[ucCol],
+									1ul << (16 + pxHandle->pucColPinArr[ucCol])	);
+}
+
+/*
+ * Number of counter bits of the scan filter, such that a key state is accepted
+ * after at least "uiMsDebouncingDelay".
+ */
+static uint8_t ucGetFilterCounterBits(xHOS_Keypad_t* pxHandle)
+{
+	uint32_t uiScanTimeUs = pxHandle->uiUsSettlingDelay * pxHandle->ucNCols;
+	uint32_t uiNScans = (pxHandle->uiMsDebouncingDelay * 1000 + uiScanTimeUs - 1) / uiScanTimeUs;
+	uint8_t ucBits = 1;
+
+	while (	(1ul << ucBits) < uiNScans &&
+			ucBits < ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS	)
+	{
+		ucBits++;
+	}
+
+	return ucBits;
 }
 
 /*******************************************************************************
- * API functions:
+ * Callbacks:
  ******************************************************************************/
 /*
- * See header for info.
+ * Called every "uiUsSettlingDelay".
  */
-void vHOS_Keypad_init(xHOS_Keypad_t* pxHandle)
+static void vCallback(void* pvParams)
 {
-	/*	Initialize all row pins as pulled-down inputs	*/
-	for (uint8_t i = 0; i < pxHandle->ucNRows; i++)
+	xHOS_Keypad_t* pxHandle = (xHOS_Keypad_t*)pvParams;
+
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+	uint32_t uiChanged, uiKey;
+	uint8_t ucCol = pxHandle->xScan.ucCol;
+
+	/*	Sample rows of the driven column, it has settled since previous call	*/
+	uint32_t uiRows = uiReadRows(pxHandle);
+
+	uint8_t ucRet = ucHOS_KeypadScan_sample(&pxHandle->xScan, uiRows, &uiChanged);
+
+	/*	Drive next column, it settles until next call	*/
+	vReleaseCol(pxHandle, ucCol);
+	vDriveCol(pxHandle, pxHandle->xScan.ucCol);
+
+	if (ucRet == ucHOS_KEYPAD_SCAN_GHOSTING)
 	{
-		vPort_DIO_initPinInput(	pxHandle->pucRowPortArr[i],
-								pxHandle->pucRowPinArr[i],
-								2	);
+		/*	Report once per ambiguous period	*/
+		if (!pxHandle->ucIsGhosting)
+		{
+			pxHandle->ucIsGhosting = 1;
+			vSendEventFromISR(	pxHandle,
+								'\0',
+								ucHOS_KEYPAD_EVENT_GHOSTING,
+								&xHighPriorityTaskWoken	);
+		}
 	}
 
-	/*	Initialize all col pins as outputs (initially low)	*/
-	for (uint8_t i = 0; i < pxHandle->ucNCols; i++)
+	else if (ucRet == ucHOS_KEYPAD_SCAN_COMPLETE)
 	{
-		vPort_DIO_initPinOutput(	pxHandle->pucColPortArr[i],
-									pxHandle->pucColPinArr[i]	);
+		pxHandle->ucIsGhosting = 0;
 
-		vPORT_DIO_WRITE_PIN(	pxHandle->pucColPortArr[i],
-								pxHandle->pucColPinArr[i],
-								0	);
+		/*	Send events of the changed keys	*/
+		while (uiChanged)
+		{
+			uiKey = __builtin_ctz(uiChanged);
+			uiChanged &= uiChanged - 1;
+
+			vSendEventFromISR(
+				pxHandle,
+				pxHandle->pcButtons[uiKey],
+				((uiHOS_KeypadScan_getPressedMap(&pxHandle->xScan) >> uiKey) & 1) ?
+					ucHOS_KEYPAD_EVENT_PRESS : ucHOS_KEYPAD_EVENT_RELEASE,
+				&xHighPriorityTaskWoken	);
+		}
 	}
 
-	/*
-	 * "cLastPressedKey" is initially '\0'. Indicating that no keys have been
-	 * pressed.
-	 */
-	pxHandle->cLastPressedKey = '\0';
-
-	/*	Initialize new press semaphore	*/
-	pxHandle->xNewPressedKeySemphr =
-			xSemaphoreCreateBinaryStatic(&pxHandle->xNewPressedKeySemphrStatic);
-
-	xSemaphoreTake(pxHandle->xNewPressedKeySemphr, 0);
-
-	/*	Initialize handle's task	*/
-	pxHandle->xTask = xTaskCreateStatic(
-		vTask,
-		"keypad",
-		configMINIMAL_STACK_SIZE,
-		(void*)pxHandle,
-		configHOS_SOFT_REAL_TIME_TASK_PRI,
-		pxHandle->puxTaskStack,
-		&pxHandle->xTaskStatic);
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
 }
 
-uint8_t ucHOS_Keypad_waitKey(	xHOS_Keypad_t* pxHandle,
-								char* pcButtonVal,
-								TickType_t xTimeout	)
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+void vHOS_Keypad_init(xHOS_Keypad_t* pxHandle)
 {
-	uint8_t ucState =
-			xSemaphoreTake(pxHandle->xNewPressedKeySemphr, xTimeout);
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
 
-	if (!ucState)
-		return 0;
+	uint32_t uiNKeys = (uint32_t)pxHandle->ucNRows * pxHandle->ucNCols;
 
-	*pcButtonVal = pxHandle->cLastPressedKey;
+	configASSERT(uiNKeys <= ucHOS_KEYPAD_SCAN_MAX_KEYS);
+	configASSERT(uiNKeys <= ucCONF_KEYPAD_MAX_NUMBER_OF_KEYS);
 
-	return 1;
-}
+	/*	Timer's upper limit register is 16-bit	*/
+	configASSERT(	pxHandle->uiUsSettlingDelay != 0 &&
+					pxHandle->uiUsSettlingDelay - 1 <= 0xFFFF	);
 
+	/*	Initialize all row pins as pulled-up inputs	*/
+	for (uint8_t i = 0; i < pxHandle->ucNRows; i++)
+	{
+		vPort_DIO_initPinInput(	pxHandle->pucRowPortArr[i],
+								pxHandle->pucRowPinArr[i],
+								1	);
+	}
 
+	/*
+	 * Initialize all col pins as open-drain outputs, released before switching
+	 * them to output mode.
+	 */
+	for (uint8_t i = 0; i < pxHandle->ucNCols; i++)
+	{
+		vReleaseCol(pxHandle, i);
 
+		vPort_DIO_initPinOutputOpenDrain(	pxHandle->pucColPortArr[i],
+											pxHandle->pucColPinArr[i]	);
+	}
 
+	/*	Initialize scan engine, and drive its first column	*/
+	vHOS_KeypadScan_init(	&pxHandle->xScan,
+							pxHandle->ucNRows,
+							pxHandle->ucNCols,
+							ucGetFilterCounterBits(pxHandle)	);
 
+	vDriveCol(pxHandle, pxHandle->xScan.ucCol);
 
+	pxHandle->ucIsGhosting = 0;
+	pxHandle->uiNumberOfLostEvents = 0;
 
+	/*	Create events queue	*/
+	pxHandle->xEventQueue = xQueueCreateStatic(
+		2 * uiNKeys + 1,
+		sizeof(xHOS_Keypad_event_t),
+		pxHandle->pucEventQueueMemory,
+		&pxHandle->xEventQueueStatic	);
 
+	/*	Init HW timer (1MHz, OVF every "uiUsSettlingDelay")	*/
+	vPORT_TIM_DISABLE_COUNTER(ucUnit);
 
+	vPORT_TIM_USE_INTERNAL_CLOCK_SOURCE(ucUnit);
 
+	VPORT_TIM_SET_PRESCALER(ucUnit, uiPORT_TIM_PRESCALER_FOR_1_MHZ);
 
+	vPORT_TIM_SET_COUNTING_DIR_UP(ucUnit);
 
+	vPORT_TIM_SET_COUNTER_UPPER_LIMIT(ucUnit, pxHandle->uiUsSettlingDelay - 1);
 
+	vPORT_TIM_CLEAR_OVF_FLAG(ucUnit);
 
+	vPort_TIM_setOvfCallback(ucUnit, vCallback, (void*)pxHandle);
 
+	vPORT_TIM_ENABLE_OVF_INTERRUPT(ucUnit);
 
+	/*	Init interrupt controller	*/
+	VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptTimerOvfIrqNumberArr[ucUnit],
+									ucCONF_KEYPAD_TIMER_PRI	);
 
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerOvfIrqNumberArr[ucUnit]);
 
+	vPORT_TIM_ENABLE_COUNTER(ucUnit);
+}
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_Keypad_waitKey(	xHOS_Keypad_t* pxHandle,
+								char* pcButtonVal,
+								TickType_t xTimeout	)
+{
+	xHOS_Keypad_event_t xEvent;
+	TimeOut_t xTimeOut;
 
+	vTaskSetTimeOutState(&xTimeOut);
 
+	while(1)
+	{
+		if (xQueueReceive(pxHandle->xEventQueue, &xEvent, xTimeout) != pdTRUE)
+			return 0;
 
+		if (xEvent.ucEvent == ucHOS_KEYPAD_EVENT_PRESS)
+		{
+			*pcButtonVal = xEvent.cKey;
+			return 1;
+		}
 
+		/*	Update remaining timeout	*/
+		if (xTaskCheckForTimeOut(&xTimeOut, &xTimeout) == pdTRUE)
+			return 0;
+	}
+}
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_Keypad_receiveEvent(	xHOS_Keypad_t* pxHandle,
+									xHOS_Keypad_event_t* pxEvent,
+									TickType_t xTimeout	)
+{
+	return (xQueueReceive(pxHandle->xEventQueue, pxEvent, xTimeout) == pdTRUE);
+}
 
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_Keypad_getPressedMap(xHOS_Keypad_t* pxHandle)
+{
+	return uiHOS_KeypadScan_getPressedMap(&pxHandle->xScan);
+}
 
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_Keypad_getNumberOfLostEvents(xHOS_Keypad_t* pxHandle)
+{
+	return pxHandle->uiNumberOfLostEvents;
+}
@@ -0,0 +1,105 @@
+/*
+ * KeypadScan.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include "stdint.h"
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+/*	SELF	*/
+#include "HAL/Keypad/KeypadScan.h"
+
+/*
+ * See header for info.
+ */
+void vHOS_KeypadScan_init(	xHOS_KeypadScan_t* pxHandle,
+							uint8_t ucNRows,
+							uint8_t ucNCols,
+							uint8_t ucFilterCounterBits	)
+{
+	pxHandle->ucNRows = ucNRows;
+	pxHandle->ucNCols = ucNCols;
+	pxHandle->uiColMask = (1ul << ucNCols) - 1;
+	pxHandle->ucCol = 0;
+	pxHandle->uiRawMap = 0;
+
+	/*	All keys are initially released	*/
+	vLIB_BinaryFilterVertical_init(&pxHandle->xFilter, ucFilterCounterBits, 0);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_KeypadScan_sample(	xHOS_KeypadScan_t* pxHandle,
+									uint32_t uiRows,
+									uint32_t* puiChanged	)
+{
+	uint8_t ucCol = pxHandle->ucCol;
+	uint8_t ucNCols = pxHandle->ucNCols;
+
+	/*	Add active rows of this column to the raw map	*/
+	for (uint8_t ucRow = 0; uiRows != 0; ucRow++, uiRows >>= 1)
+	{
+		if (uiRows & 1)
+			pxHandle->uiRawMap |= 1ul << (ucRow * ucNCols + ucCol);
+	}
+
+	/*	Move to next column	*/
+	ucCol++;
+	if (ucCol < ucNCols)
+	{
+		pxHandle->ucCol = ucCol;
+		return ucHOS_KEYPAD_SCAN_IN_PROGRESS;
+	}
+
+	/*	Scan is complete	*/
+	uint32_t uiRawMap = pxHandle->uiRawMap;
+	pxHandle->ucCol = 0;
+	pxHandle->uiRawMap = 0;
+
+	if (ucHOS_KeypadScan_isGhosting(uiRawMap, pxHandle->ucNRows, ucNCols))
+	{
+		*puiChanged = 0;
+		return ucHOS_KEYPAD_SCAN_GHOSTING;
+	}
+
+	*puiChanged = uiLIB_BinaryFilterVertical_updateFilter(&pxHandle->xFilter, uiRawMap);
+	return ucHOS_KEYPAD_SCAN_COMPLETE;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_KeypadScan_isGhosting(	uint32_t uiRawMap,
+										uint8_t ucNRows,
+										uint8_t ucNCols	)
+{
+	uint32_t uiColMask = (1ul << ucNCols) - 1;
+	uint32_t uiRowI, uiCommon;
+
+	/*	A pattern of ghosting needs at least 3 pressed keys	*/
+	if ((uiRawMap & (uiRawMap - 1)) == 0)
+		return 0;
+
+	for (uint8_t i = 0; i < ucNRows; i++)
+	{
+		uiRowI = (uiRawMap >> (i * ucNCols)) & uiColMask;
+
+		/*	Row of less than two keys can't have two common columns	*/
+		if ((uiRowI & (uiRowI - 1)) == 0)
+			continue;
+
+		for (uint8_t j = i + 1; j < ucNRows; j++)
+		{
+			uiCommon = uiRowI & (uiRawMap >> (j * ucNCols));
+
+			/*	Two or more common columns	*/
+			if (uiCommon & (uiCommon - 1))
+				return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,311 @@
+/*
+ * KeypadScan_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) simulation of the keypad scan engine.
+ *
+ * A 4x4 keypad of no diodes is simulated electrically: only the scanned column
+ * is driven, others are high-impedance, and a row reads active if it is
+ * connected to the driven column through any path of pressed keys (so ghost
+ * keys appear as they do on HW). Keys are pressed and released randomly, with
+ * contact bounce, and the column is changed every "uiCOL_PERIOD_US".
+ *
+ * It checks that:
+ * 		-	Every press and release of an unambiguous key pattern produces exactly
+ * 			one event, and no other events are produced.
+ *
+ * 		-	Patterns of three keys at corners of a rectangle are reported as
+ * 			ghosting. Once all keys have settled, they produce no events.
+ *
+ * 		-	Up to all keys of a single row or column are detected together
+ * 			(n-key rollover).
+ *
+ * and measures scan latency (time from a key's change, to its event), which
+ * must not exceed the bounce time plus (N + 1) scans.
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_KEYPAD_SCAN_HOST_TEST -IInc Src/LIB/BinaryFilterVertical.c \
+ * 			Src/HAL/Keypad/KeypadScan.c Src/HAL/Keypad/KeypadScan_Test.c \
+ * 			-o keypad_test
+ *
+ * 		./keypad_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_KEYPAD_SCAN_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "HAL/Keypad/KeypadScan.h"
+
+#define uiNROWS				4
+#define uiNCOLS				4
+#define uiNKEYS				(uiNROWS * uiNCOLS)
+#define uiCOL_PERIOD_US		250
+#define ucFILTER_BITS		2
+#define uiMAX_BOUNCE_US		3000
+#define uiNUMBER_OF_STEPS	4000
+#define uiSTEP_US			40000	/*	Time between key pattern changes	*/
+
+/*	Bounce, then N scans of stable contact, plus a scan of sampling misalignment	*/
+#define uiMAX_LATENCY_US	\
+	(uiMAX_BOUNCE_US + ((1u << ucFILTER_BITS) + 1) * uiCOL_PERIOD_US * uiNCOLS)
+
+/*******************************************************************************
+ * Keypad electrical model:
+ ******************************************************************************/
+/*	Levels of keys at time "uiTime", including bounce	*/
+static uint32_t uiTrueMap;
+static uint32_t uiPrevTrueMap;
+static uint32_t uiChangeTime;
+static uint32_t uiBounceEnd[uiNKEYS];
+static uint32_t uiLastBounceEnd;
+
+static uint32_t uiGetContactMap(uint32_t uiTime)
+{
+	uint32_t uiMap = uiTrueMap;
+
+	for (uint32_t k = 0; k < uiNKEYS; k++)
+	{
+		if (uiTime < uiBounceEnd[k] && (rand() & 1))
+			uiMap ^= 1ul << k;
+	}
+
+	return uiMap;
+}
+
+/*
+ * Rows connected to column "ucCol", through any path of closed contacts.
+ *
+ * Idle columns are high-impedance inputs (as "Keypad.c" leaves them), so a path
+ * may pass through rows and idle columns alike: a row connected to an idle
+ * column, which is connected to an active row, is active too (ghost key). No
+ * column other than "ucCol" drives any level.
+ */
+static uint32_t uiGetActiveRows(uint32_t uiContactMap, uint8_t ucCol)
+{
+	uint32_t uiCols = 1ul << ucCol;
+	uint32_t uiRows = 0;
+	uint32_t uiPrevCols;
+
+	do
+	{
+		uiPrevCols = uiCols;
+
+		for (uint32_t r = 0; r < uiNROWS; r++)
+		{
+			if ((uiContactMap >> (r * uiNCOLS)) & uiCols)
+				uiRows |= 1ul << r;
+		}
+
+		for (uint32_t r = 0; r < uiNROWS; r++)
+		{
+			if ((uiRows >> r) & 1)
+				uiCols |= (uiContactMap >> (r * uiNCOLS)) & ((1ul << uiNCOLS) - 1);
+		}
+	}while (uiCols != uiPrevCols);
+
+	return uiRows;
+}
+
+/*	Random key pattern, of ghosting or not	*/
+static uint32_t uiRandomPattern(void)
+{
+	uint32_t uiMap = 0;
+	uint32_t uiType = rand() % 4;
+
+	if (uiType == 0)
+		return 0;
+
+	/*	Whole row, or whole column (n-key rollover)	*/
+	if (uiType == 1)
+	{
+		if (rand() & 1)
+			return (((1ul << uiNCOLS) - 1) << ((rand() % uiNROWS) * uiNCOLS));
+
+		uint32_t c = rand() % uiNCOLS;
+		for (uint32_t r = 0; r < uiNROWS; r++)
+			uiMap |= 1ul << (r * uiNCOLS + c);
+		return uiMap;
+	}
+
+	/*	Three corners of a rectangle (ghosting)	*/
+	if (uiType == 2)
+	{
+		uint32_t r1 = rand() % uiNROWS, r2 = (r1 + 1 + rand() % (uiNROWS - 1)) % uiNROWS;
+		uint32_t c1 = rand() % uiNCOLS, c2 = (c1 + 1 + rand() % (uiNCOLS - 1)) % uiNCOLS;
+		return	(1ul << (r1 * uiNCOLS + c1)) |
+				(1ul << (r1 * uiNCOLS + c2)) |
+				(1ul << (r2 * uiNCOLS + c1));
+	}
+
+	/*	Random unambiguous keys	*/
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		uint32_t uiNew = uiMap | (1ul << (rand() % uiNKEYS));
+		if (!ucHOS_KeypadScan_isGhosting(uiNew, uiNROWS, uiNCOLS))
+			uiMap = uiNew;
+	}
+	return uiMap;
+}
+
+/*******************************************************************************
+ * Test:
+ ******************************************************************************/
+int main(void)
+{
+	xHOS_KeypadScan_t xScan;
+	uint32_t uiTime = 0;
+	uint32_t uiErrors = 0;
+	uint32_t uiNumberOfEvents = 0;
+	uint32_t uiNumberOfGhostPatterns = 0, uiNumberOfGhostDetected = 0;
+	uint32_t uiNumberOfTransients = 0;
+	uint64_t ulLatencySum = 0;
+	uint32_t uiLatencyMax = 0, uiLatencyMin = (uint32_t)-1;
+	uint32_t uiChanged, uiExpected;
+	uint32_t uiPressed = 0;
+	uint8_t ucRet, ucGhostSeen;
+	uint8_t ucPrevIsGhost = 0;
+
+	srand(1);
+
+	vHOS_KeypadScan_init(&xScan, uiNROWS, uiNCOLS, ucFILTER_BITS);
+	uiTrueMap = 0;
+
+	for (uint32_t uiStep = 0; uiStep < uiNUMBER_OF_STEPS; uiStep++)
+	{
+		/*
+		 * New key pattern (on even steps), or release of all keys (on odd
+		 * steps). Keys that change bounce.
+		 */
+		uiPrevTrueMap = uiTrueMap;
+		uiTrueMap = (uiStep % 2 == 0) ? uiRandomPattern() : 0;
+		uiChangeTime = uiTime;
+		uiLastBounceEnd = uiTime;
+		for (uint32_t k = 0; k < uiNKEYS; k++)
+		{
+			if (((uiTrueMap ^ uiPrevTrueMap) >> k) & 1)
+				uiBounceEnd[k] = uiTime + rand() % uiMAX_BOUNCE_US;
+			else
+				uiBounceEnd[k] = 0;
+
+			if (uiBounceEnd[k] > uiLastBounceEnd)
+				uiLastBounceEnd = uiBounceEnd[k];
+		}
+
+		/*	Ghost pattern reads as the full rectangle	*/
+		uint32_t uiReadMap = 0;
+		for (uint32_t c = 0; c < uiNCOLS; c++)
+		{
+			uint32_t uiRows = uiGetActiveRows(uiTrueMap, c);
+			for (uint32_t r = 0; r < uiNROWS; r++)
+				if ((uiRows >> r) & 1)
+					uiReadMap |= 1ul << (r * uiNCOLS + c);
+		}
+		uint8_t ucIsGhost = ucHOS_KeypadScan_isGhosting(uiReadMap, uiNROWS, uiNCOLS);
+		uiNumberOfGhostPatterns += ucIsGhost;
+
+		/*	Keys expected to change state	*/
+		uiExpected = uiTrueMap ^ uiPressed;
+		ucGhostSeen = 0;
+
+		/*	Scan until next step	*/
+		for (uint32_t t = 0; t < uiSTEP_US; t += uiCOL_PERIOD_US, uiTime += uiCOL_PERIOD_US)
+		{
+			uint32_t uiRows = uiGetActiveRows(uiGetContactMap(uiTime), xScan.ucCol);
+
+			ucRet = ucHOS_KeypadScan_sample(&xScan, uiRows, &uiChanged);
+
+			if (ucRet == ucHOS_KEYPAD_SCAN_GHOSTING)
+				ucGhostSeen = 1;
+
+			if (ucRet != ucHOS_KEYPAD_SCAN_COMPLETE)
+				continue;
+
+			while (uiChanged)
+			{
+				uint32_t k = __builtin_ctz(uiChanged);
+				uiChanged &= uiChanged - 1;
+				uiNumberOfEvents++;
+
+				/*
+				 * While an ambiguous pattern is pressed or released, keys may
+				 * change out of the pattern's final state only while others
+				 * are still bouncing, or within (N + 1) scans after. (i.e.: a
+				 * real key that settled before the others, or a ghost key seen
+				 * by some columns but not by the others, as columns are sampled
+				 * at different times)
+				 */
+				if (!((uiExpected >> k) & 1))
+				{
+					if (	(ucIsGhost || ucPrevIsGhost) &&
+							uiTime < uiLastBounceEnd + uiMAX_LATENCY_US - uiMAX_BOUNCE_US	)
+					{
+						uiPressed ^= 1ul << k;
+						uiNumberOfTransients++;
+					}
+					else
+						uiErrors++;
+					continue;
+				}
+				uiExpected &= ~(1ul << k);
+				uiPressed ^= 1ul << k;
+
+				if (ucIsGhost)
+					continue;
+
+				uint32_t uiLatency = uiTime + uiCOL_PERIOD_US - uiChangeTime;
+				if (uiLatency > uiMAX_LATENCY_US)
+					uiErrors++;
+				ulLatencySum += uiLatency;
+				if (uiLatency > uiLatencyMax)	uiLatencyMax = uiLatency;
+				if (uiLatency < uiLatencyMin)	uiLatencyMin = uiLatency;
+			}
+		}
+
+		ucPrevIsGhost = ucIsGhost;
+
+		/*	Missed events	*/
+		if (uiExpected && !ucIsGhost)
+			uiErrors++;
+
+		/*	Debounced state must match the reported events	*/
+		if (uiHOS_KeypadScan_getPressedMap(&xScan) != uiPressed)
+			uiErrors++;
+
+		if (ucIsGhost && ucGhostSeen)
+			uiNumberOfGhostDetected++;
+		else if (ucIsGhost)
+			uiErrors++;
+
+		/*	Debounced state must match	*/
+		if (!ucIsGhost && uiHOS_KeypadScan_getPressedMap(&xScan) != uiTrueMap)
+			uiErrors++;
+	}
+
+	printf("Scan period: %u us, filter: %u scans\n",
+			uiCOL_PERIOD_US * uiNCOLS, 1u << ucFILTER_BITS);
+	printf("Events: %u, ghost patterns: %u (detected: %u, transient keys: %u)\n",
+			uiNumberOfEvents, uiNumberOfGhostPatterns, uiNumberOfGhostDetected,
+			uiNumberOfTransients);
+	printf("Latency (us): min %u, avg %u, max %u (limit: %u)\n",
+			uiLatencyMin, (uint32_t)(ulLatencySum / (uiNumberOfEvents ? uiNumberOfEvents : 1)),
+			uiLatencyMax, uiMAX_LATENCY_US);
+	printf("Errors: %u\n", uiErrors);
+
+	if (uiErrors || uiNumberOfEvents == 0 || uiNumberOfGhostDetected == 0)
+	{
+		printf("FAILED\n");
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_KEYPAD_SCAN_HOST_TEST	*/
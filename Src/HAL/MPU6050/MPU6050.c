@@ -10,14 +10,18 @@
 #include "stdlib.h"
 #include "stdio.h"
 #include "math.h"
+#include "LIB/AttitudeEstimator/AttitudeEstimator.h"
 
 /*	MCAL (ported)	*/
 #include "MCAL_Port/Port_Breakpoint.h"
 #include "MCAL_Port/Port_DIO.h"
+#include "MCAL_Port/Port_EXTI.h"
+#include "MCAL_Port/Port_Interrupt.h"
 
 /*	OS	*/
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 #include "RTOS_PRI_Config.h"
 
 /*	HAL	*/
@@ -25,6 +29,8 @@
 
 /*	SELF	*/
 #include "HAL/MPU6050/MPU6050_private.h"
+#include "HAL/MPU6050/MPU6050_Config.h"
+#include "HAL/MPU6050/MPU6050_Decoder.h"
 #include "HAL/MPU6050/MPU6050.h"
 
 
@@ -201,128 +207,275 @@ static uint8_t ucReadAccelRawMeasurement(	xHOS_MPU6050_t* pxHandle,
 	return 1;
 }
 
-/*******************************************************************************
- * Task function:
- ******************************************************************************/
+static inline void vGetScale(	xHOS_MPU6050_t* pxHandle,
+								xHOS_MPU6050_scale_t* pxScale	)
+{
+	pxScale->sAccelFSR = pxHandle->sAccelFSR;
+	pxScale->sGyroFSR = pxHandle->sGyroFSR;
+	pxScale->xAccelDrift = pxHandle->xAccelDrift;
+	pxScale->xGyroDrift = pxHandle->xGyroDrift;
+}
+
+static uint8_t ucReadFifoCount(xHOS_MPU6050_t* pxHandle, uint16_t* pusCount)
+{
+	uint8_t ucSuccessful;
+
+	/*	Prepare transreceive params	*/
+	uint8_t ucAddress = MPU6050_REG_FIFO_COUNTH;
+	uint8_t pucCountArr[2];
+
+	xHOS_I2C_transreceiveParams_t xTRParams = {
+		.ucUnitNumber = pxHandle->ucI2CUnitNumber,
+		.usAddress = MPU6050_ADDRESS0 | pxHandle->ucAdd0State,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = &ucAddress,
+		.uiTxSize = 1,
+		.pucRxArr = pucCountArr,
+		.uiRxSize = 2
+	};
+
+	/*	Brust read FIFO_COUNTH and FIFO_COUNTL	*/
+	ucSuccessful = ucHOS_I2C_masterTransReceive(&xTRParams);
+	if (!ucSuccessful)
+		return 0;
+
+	*pusCount = ((uint16_t)pucCountArr[0] << 8) | pucCountArr[1];
+
+	return 1;
+}
+
 /*
- * This task is used to calculate tilt of an MPU6050 object (if tilt is enabled).
+ * Reads "uiNumberOfFrames" frames from the FIFO into "pucFifoRawArr", in one
+ * I2C transaction.
  */
-static void vTask(void* pvParams)
+static uint8_t ucReadFifoFrames(	xHOS_MPU6050_t* pxHandle,
+									uint32_t uiNumberOfFrames	)
 {
 	uint8_t ucSuccessful;
-	xHOS_MPU6050_measurement_t xMeasurement;
-	xHOS_MPU6050_measurement_t xIntegration;
-	int32_t iThetaXAccel = 0;
-	int32_t iThetaYAccel = 0;
-	int32_t iAccel;
-	uint32_t uiStableCount = 0;
 
-	xHOS_MPU6050_t* pxHandle = (xHOS_MPU6050_t*)pvParams;
+	/*	Prepare transreceive params	*/
+	uint8_t ucAddress = MPU6050_REG_FIFO_R_W;
 
-	/*	Task is initially suspended	*/
-	vTaskSuspend(pxHandle->xTask);
+	xHOS_I2C_transreceiveParams_t xTRParams = {
+		.ucUnitNumber = pxHandle->ucI2CUnitNumber,
+		.usAddress = MPU6050_ADDRESS0 | pxHandle->ucAdd0State,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = &ucAddress,
+		.uiTxSize = 1,
+		.pucRxArr = pxHandle->pucFifoRawArr,
+		.uiRxSize = uiNumberOfFrames * uiHOS_MPU6050_FRAME_SIZE
+	};
 
-	/*	Reset tilt values	*/
-	pxHandle->xTilt.iX = 0;
-	pxHandle->xTilt.iY = 0;
-	pxHandle->xTilt.iZ = 0;
+	/*
+	 * Brust read. (FIFO_R_W address is not auto-incremented, successive reads
+	 * pop successive FIFO bytes)
+	 */
+	ucSuccessful = ucHOS_I2C_masterTransReceive(&xTRParams);
+	if (!ucSuccessful)
+		return 0;
 
-	/*	Rest previous gyro measurement	*/
-	pxHandle->xPrevGyroMeasurement.iX = 0;
-	pxHandle->xPrevGyroMeasurement.iY = 0;
-	pxHandle->xPrevGyroMeasurement.iZ = 0;
+	return 1;
+}
 
-	if (pxHandle->ucIsIntConnected)
+/*
+ * Discards FIFO content. FIFO is left enabled.
+ */
+static uint8_t ucResetFifo(xHOS_MPU6050_t* pxHandle)
+{
+	uint8_t ucSuccessful;
+
+	/*	Stop FIFO and reset it (reset bit is cleared by hardware)	*/
+	ucSuccessful = ucEditReg(	pxHandle,
+								MPU6050_REG_USER_CTRL,
+								MPU6050_USER_CTRL_FIFO_EN | MPU6050_USER_CTRL_FIFO_RESET,
+								MPU6050_USER_CTRL_FIFO_RESET	);
+	if (!ucSuccessful)
+		return 0;
+
+	/*	Start FIFO	*/
+	ucSuccessful = ucEditReg(	pxHandle,
+								MPU6050_REG_USER_CTRL,
+								MPU6050_USER_CTRL_FIFO_EN,
+								MPU6050_USER_CTRL_FIFO_EN	);
+	if (!ucSuccessful)
+		return 0;
+
+	return 1;
+}
+
+/*
+ * Sets number of INT pulses per task wakeup.
+ */
+static inline void vSetIntsPerWakeup(xHOS_MPU6050_t* pxHandle, uint16_t usCount)
+{
+	taskENTER_CRITICAL();
 	{
-		/*	Enable INT pin latch and INT flags clear on read	*/
-		ucEditReg(pxHandle, MPU6050_REG_INT_PIN_CFG, 0b110000, 0b110000);
+		pxHandle->usIntsPerWakeup = usCount;
+		pxHandle->usIntCount = 0;
+	}
+	taskEXIT_CRITICAL();
+}
 
-		/*	Enable INT on data ready	*/
-		ucEditReg(pxHandle, MPU6050_REG_INT_ENABLE, 1, 1);
+/*******************************************************************************
+ * ISR callback:
+ ******************************************************************************/
+/*
+ * INT pin is configured to generate a pulse on every new sample. Pulses are
+ * counted, and the semaphore is given once every "usIntsPerWakeup" of them.
+ */
+static void vIntCallback(void* pvParams)
+{
+	xHOS_MPU6050_t* pxHandle = (xHOS_MPU6050_t*)pvParams;
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+	pxHandle->usIntCount++;
+	if (pxHandle->usIntCount >= pxHandle->usIntsPerWakeup)
+	{
+		pxHandle->usIntCount = 0;
+		xSemaphoreGiveFromISR(pxHandle->xIntSemaphore, &xHighPriorityTaskWoken);
 	}
 
-	/*	Tilt calculation is initially disabled	*/
-	vTaskSuspend(pxHandle->xTask);
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
 
-	/*	Tilt calculation can't be done without having the INT pin connected	*/
-	while(!pxHandle->ucIsIntConnected)
-		vTaskSuspend(pxHandle->xTask);
+/*******************************************************************************
+ * Task function:
+ ******************************************************************************/
+/*
+ * Calculates tilt of an MPU6050 object. Returns when tilt calculation is disabled.
+ */
+static void vTiltLoop(xHOS_MPU6050_t* pxHandle)
+{
+	uint8_t ucSuccessful;
+	xHOS_MPU6050_frame_t xFrame;
+	xLIB_AttitudeEstimator_sample_t xSample;
+	xLIB_AttitudeEstimator_euler_t xEuler;
 
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	while(1)
+	while(pxHandle->ucIsTiltEnabled)
 	{
-		/*	Wait for INT pin. (To synchronize task with samples taken by the MPU6050)	*/
-		while(!ucPORT_DIO_READ_PIN(pxHandle->ucIntPort, pxHandle->ucIntPin));
+		/*	Wait for INT pulse. (To synchronize task with samples taken by the MPU6050)	*/
+		if (!xSemaphoreTake(	pxHandle->xIntSemaphore,
+								pdMS_TO_TICKS(uiCONF_MPU6050_INT_TIMEOUT_MS)	))
+			continue;
+
+		if (!pxHandle->ucIsTiltEnabled)
+			break;
 
-		/*	Read accel measurement	*/
-		ucSuccessful = ucHOS_MPU6050_readAccelMeasurement(pxHandle, &xMeasurement);
+		/*	Read accel and gyro measurements	*/
+		ucSuccessful = ucHOS_MPU6050_readFrame(pxHandle, &xFrame);
 		configASSERT(ucSuccessful);
 
-		iAccel = xMeasurement.iX*xMeasurement.iX + xMeasurement.iY*xMeasurement.iY + xMeasurement.iZ*xMeasurement.iZ;
+		/*	Update estimator (milli-dps and milli-g)	*/
+		xSample.piGyro[0] = xFrame.xGyro.iX;
+		xSample.piGyro[1] = xFrame.xGyro.iY;
+		xSample.piGyro[2] = xFrame.xGyro.iZ;
+		xSample.piAccel[0] = xFrame.xAccel.iX;
+		xSample.piAccel[1] = xFrame.xAccel.iY;
+		xSample.piAccel[2] = xFrame.xAccel.iZ;
 
-		/*	If MPU6050 is not accelerating, calculate accel angles	*/
-		if (950*950 < iAccel && iAccel < 1050*1050)
-		{
-			uiStableCount++;
-			if (uiStableCount == 10)
-			{
-				iThetaXAccel = 90000000 - (float)acos((float)xMeasurement.iY / 1000.0f) * 180000000.0f / (float)M_PI;
-				iThetaYAccel = -90000000 + (float)acos((float)xMeasurement.iX / 1000.0f) * 180000000.0f / (float)M_PI;
-			}
-		}
+		vLIB_AttitudeEstimator_update(&pxHandle->xEstimator, &xSample, 1);
 
-		else
+		/*	Update tilt angles	*/
+		vLIB_AttitudeEstimator_getEuler(&pxHandle->xEstimator, &xEuler);
+		pxHandle->xTilt.iX = xEuler.iRoll;
+		pxHandle->xTilt.iY = xEuler.iPitch;
+		pxHandle->xTilt.iZ = xEuler.iYaw;
+
+		/*	Task is blocked until next sample time	*/
+		vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(uiCONF_MPU6050_TILT_PERIOD_MS));
+	}
+}
+
+/*
+ * Reads, decodes and passes FIFO frames to the consumer callback. Returns when
+ * FIFO mode is disabled.
+ */
+static void vFifoLoop(xHOS_MPU6050_t* pxHandle)
+{
+	uint8_t ucSuccessful;
+	uint16_t usCount;
+	uint32_t uiAvailableFrames;
+	uint32_t uiNumberOfFrames;
+	xHOS_MPU6050_scale_t xScale;
+
+	while(pxHandle->ucIsFifoEnabled)
+	{
+		/*
+		 * Block until a burst of samples is written to the FIFO. (Or until
+		 * timeout, in case an INT pulse was missed)
+		 */
+		xSemaphoreTake(	pxHandle->xIntSemaphore,
+						pdMS_TO_TICKS(uiCONF_MPU6050_INT_TIMEOUT_MS)	);
+
+		/*	Drain FIFO until less than a burst is left	*/
+		while(pxHandle->ucIsFifoEnabled)
 		{
-			uiStableCount = 0;
-		}
+			ucSuccessful = ucReadFifoCount(pxHandle, &usCount);
+			if (!ucSuccessful)
+				break;
 
-		/*	Read gyro measurement	*/
-		ucSuccessful = ucHOS_MPU6050_readGyroMeasurement(pxHandle, &xMeasurement);
-		configASSERT(ucSuccessful);
+			/*
+			 * On overflow, oldest bytes are overwritten and frame alignment is
+			 * lost. FIFO is then reset.
+			 */
+			if (	usCount >
+					(MPU6050_FIFO_SIZE / uiHOS_MPU6050_FRAME_SIZE) * uiHOS_MPU6050_FRAME_SIZE	)
+			{
+				pxHandle->uiFifoOverflowCount++;
+				ucResetFifo(pxHandle);
+				break;
+			}
 
-		/*	Integrate	*/
-		xIntegration.iX = (pxHandle->xPrevGyroMeasurement.iX + xMeasurement.iX) * 2;// / 2;
-		xIntegration.iY = (pxHandle->xPrevGyroMeasurement.iY + xMeasurement.iY) * 2;// / 2;
-		xIntegration.iZ = (pxHandle->xPrevGyroMeasurement.iZ + xMeasurement.iZ) * 2;// / 2;
+			uiAvailableFrames = usCount / uiHOS_MPU6050_FRAME_SIZE;
+			if (uiAvailableFrames == 0)
+				break;
 
-		/*	Ignore changes smaller than 0.01 degree, to avoid truncating error	*/
-		if (xIntegration.iX > 100 || xIntegration.iX < -100)
-			pxHandle->xTilt.iX += xIntegration.iX;
+			uiNumberOfFrames = uiAvailableFrames;
+			if (uiNumberOfFrames > uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST)
+				uiNumberOfFrames = uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST;
 
-		if (xIntegration.iY > 100 || xIntegration.iY < -100)
-			pxHandle->xTilt.iY += xIntegration.iY;
+			/*	Read all frames in one transaction	*/
+			ucSuccessful = ucReadFifoFrames(pxHandle, uiNumberOfFrames);
+			if (!ucSuccessful)
+				break;
 
-		if (xIntegration.iZ > 100 || xIntegration.iZ < -100)
-			pxHandle->xTilt.iZ += xIntegration.iZ;
+			/*	Decode and pass to consumer	*/
+			vGetScale(pxHandle, &xScale);
+			vHOS_MPU6050_decodeFrames(	&xScale,
+										pxHandle->pucFifoRawArr,
+										uiNumberOfFrames,
+										pxHandle->pxFifoFrameArr	);
 
-		if (uiStableCount == 10)
-		{
-			/*
-			 * Increment / decrement tilt angles in the direction of accel angle to
-			 * compensate drift and mis-sampling.
-			 */
-			pxHandle->xTilt.iX += 0.8f * (float)(iThetaXAccel - pxHandle->xTilt.iX) / (float)abs(pxHandle->xTilt.iX) * (float)abs(iThetaXAccel);
-			pxHandle->xTilt.iY += 0.8f * (float)(iThetaYAccel - pxHandle->xTilt.iY) / (float)abs(pxHandle->xTilt.iY) * (float)abs(iThetaYAccel);
+			pxHandle->pfFifoCallback(	pxHandle->pvFifoCallbackParams,
+										pxHandle->pxFifoFrameArr,
+										uiNumberOfFrames	);
 
-			uiStableCount = 0;
+			if (uiAvailableFrames - uiNumberOfFrames < pxHandle->usIntsPerWakeup)
+				break;
 		}
+	}
+}
 
-		/*	Check that angle is in the range: +-[0:180]	*/
-		if(pxHandle->xTilt.iX > 180000000)		pxHandle->xTilt.iX -= 360000000;
-		if(pxHandle->xTilt.iY > 180000000)		pxHandle->xTilt.iY -= 360000000;
-		if(pxHandle->xTilt.iZ > 180000000)		pxHandle->xTilt.iZ -= 360000000;
+/*
+ * This task is used to calculate tilt of an MPU6050 object (if tilt is enabled),
+ * or to read its FIFO (if FIFO mode is enabled).
+ */
+static void vTask(void* pvParams)
+{
+	xHOS_MPU6050_t* pxHandle = (xHOS_MPU6050_t*)pvParams;
 
-		if(pxHandle->xTilt.iX < -180000000)		pxHandle->xTilt.iX += 360000000;
-		if(pxHandle->xTilt.iY < -180000000)		pxHandle->xTilt.iY += 360000000;
-		if(pxHandle->xTilt.iZ < -180000000)		pxHandle->xTilt.iZ += 360000000;
+	while(1)
+	{
+		if (pxHandle->ucIsFifoEnabled)
+			vFifoLoop(pxHandle);
 
-		/*	Update previous gyro measurement	*/
-		pxHandle->xPrevGyroMeasurement.iX = xMeasurement.iX;
-		pxHandle->xPrevGyroMeasurement.iY = xMeasurement.iY;
-		pxHandle->xPrevGyroMeasurement.iZ = xMeasurement.iZ;
+		else if (pxHandle->ucIsTiltEnabled)
+			vTiltLoop(pxHandle);
 
-		/*	Task is blocked until next sample time	*/
-		vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(4));
+		/*	Block until one of them is enabled	*/
+		else
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 	}
 }
 
@@ -384,10 +537,38 @@ uint8_t ucHOS_MPU6050_writeReg(xHOS_MPU6050_t* pxHandle, uint8_t ucAddress, uint
 /*	See header for info	*/
 void vHOS_MPU6050_init(xHOS_MPU6050_t* pxHandle)
 {
-	/*	Initialize INT pin if connected	*/
+	pxHandle->ucIsTiltEnabled = 0;
+	pxHandle->ucIsFifoEnabled = 0;
+	pxHandle->usIntsPerWakeup = 1;
+	pxHandle->usIntCount = 0;
+	pxHandle->uiFifoOverflowCount = 0;
+
+	/*	Initialize INT semaphore	*/
+	pxHandle->xIntSemaphore =
+		xSemaphoreCreateBinaryStatic(&pxHandle->xIntSemaphoreStatic);
+	xSemaphoreTake(pxHandle->xIntSemaphore, 0);
+
+	/*	Initialize INT pin and its EXTI if connected	*/
 	if (pxHandle->ucIsIntConnected)
+	{
 		vPort_DIO_initPinInput(pxHandle->ucIntPort, pxHandle->ucIntPin, 0);
 
+		vPort_EXTI_setEdge(pxHandle->ucIntPort, pxHandle->ucIntPin, 1);
+		vPORT_EXTI_DISABLE_LINE(pxHandle->ucIntPort, pxHandle->ucIntPin);
+		vPort_EXTI_setCallback(	pxHandle->ucIntPort,
+								pxHandle->ucIntPin,
+								vIntCallback,
+								(void*)pxHandle	);
+
+		uint32_t uiIrqNum = uiPort_EXTI_getIrqNum(pxHandle->ucIntPort, pxHandle->ucIntPin);
+
+		VPORT_INTERRUPT_SET_PRIORITY(
+			uiIrqNum,
+			configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1	);
+
+		vPORT_INTERRUPT_ENABLE_IRQ(uiIrqNum);
+	}
+
 	/*	Create task	*/
 	static uint8_t ucCreatedObjectsCount = 0;
 	char pcTaskName[configMAX_TASK_NAME_LEN];
@@ -395,7 +576,7 @@ void vHOS_MPU6050_init(xHOS_MPU6050_t* pxHandle)
 
 	pxHandle->xTask = xTaskCreateStatic(	vTask,
 											pcTaskName,
-											configMINIMAL_STACK_SIZE,
+											uiCONF_MPU6050_TASK_STACK_SIZE,
 											(void*)pxHandle,
 											configHOS_HARD_REAL_TIME_TASK_PRI,
 											pxHandle->puxTaskStack,
@@ -410,7 +591,30 @@ uint8_t ucHOS_MPU6050_enable(xHOS_MPU6050_t* pxHandle)
 	if (!ucSuccesssful)
 		return 0;
 
-	vTaskResume(pxHandle->xTask);
+	if (pxHandle->ucIsIntConnected)
+	{
+		/*
+		 * INT pin pulses (50us, active high) on every new sample. No latch, so
+		 * pulses are counted by EXTI without having to read INT_STATUS.
+		 */
+		ucSuccesssful = ucEditReg(	pxHandle,
+									MPU6050_REG_INT_PIN_CFG,
+									0b11110000,
+									0	);
+		if (!ucSuccesssful)
+			return 0;
+
+		/*	Enable INT on data ready	*/
+		ucSuccesssful = ucEditReg(	pxHandle,
+									MPU6050_REG_INT_ENABLE,
+									MPU6050_INT_ENABLE_DATA_RDY,
+									MPU6050_INT_ENABLE_DATA_RDY	);
+		if (!ucSuccesssful)
+			return 0;
+
+		vPORT_EXTI_CLEAR_PENDING_FLAG(pxHandle->ucIntPort, pxHandle->ucIntPin);
+		vPORT_EXTI_ENABLE_LINE(pxHandle->ucIntPort, pxHandle->ucIntPin);
+	}
 
 	return 1;
 }
@@ -424,7 +628,9 @@ uint8_t ucHOS_MPU6050_disable(xHOS_MPU6050_t* pxHandle)
 	if (!ucSuccesssful)
 		return 0;
 
-	vTaskSuspend(pxHandle->xTask);
+	/*	No more samples. (Task blocks until INT timeout, then re-checks)	*/
+	if (pxHandle->ucIsIntConnected)
+		vPORT_EXTI_DISABLE_LINE(pxHandle->ucIntPort, pxHandle->ucIntPin);
 
 	return 1;
 }
@@ -448,13 +654,17 @@ uint8_t ucHOS_MPU6050_setClockSource(xHOS_MPU6050_t* pxHandle, uint8_t ucSource)
 uint8_t ucHOS_MPU6050_calibrate(xHOS_MPU6050_t* pxHandle)
 {
 	uint8_t ucSuccessful;
-	xHOS_MPU6050_measurement_t xMeasurement;
+	xHOS_MPU6050_frame_t xFrame;
 	xHOS_MPU6050_measurement_t xAccelDriftSum = {0, 0, 0};
 	xHOS_MPU6050_measurement_t xGyroDriftSum = {0, 0, 0};
 
 	if (!pxHandle->ucIsIntConnected)
 		return 0;
 
+	/*	Task must not be consuming INT pulses	*/
+	if (pxHandle->ucIsTiltEnabled || pxHandle->ucIsFifoEnabled)
+		return 0;
+
 	/*	Rest drift values	*/
 	pxHandle->xGyroDrift.iX = 0;
 	pxHandle->xGyroDrift.iY = 0;
@@ -467,25 +677,20 @@ uint8_t ucHOS_MPU6050_calibrate(xHOS_MPU6050_t* pxHandle)
 	for(uint16_t i = 0; i < 1000; i++)
 	{
 		/*	wait for new  sample to be ready	*/
-		while(!ucPORT_DIO_READ_PIN(pxHandle->ucIntPort, pxHandle->ucIntPin));
+		vHOS_MPU6050_waitDataReadyInt(pxHandle);
 
-		/*	Read accel measurement, and add it to the drift value	*/
-		ucSuccessful = ucHOS_MPU6050_readAccelMeasurement(pxHandle, &xMeasurement);
+		/*	Read accel and gyro measurements, and add them to the drift values	*/
+		ucSuccessful = ucHOS_MPU6050_readFrame(pxHandle, &xFrame);
 		if (!ucSuccessful)
 			return 0;
 
-		xAccelDriftSum.iX += xMeasurement.iX;
-        xAccelDriftSum.iY += xMeasurement.iY;
-        xAccelDriftSum.iZ += xMeasurement.iZ;
-
-		/*	Read gyro measurement, and add it to the drift value	*/
-		ucSuccessful = ucHOS_MPU6050_readGyroMeasurement(pxHandle, &xMeasurement);
-		if (!ucSuccessful)
-			return 0;
+		xAccelDriftSum.iX += xFrame.xAccel.iX;
+        xAccelDriftSum.iY += xFrame.xAccel.iY;
+        xAccelDriftSum.iZ += xFrame.xAccel.iZ;
 
-		xGyroDriftSum.iX += xMeasurement.iX;
-        xGyroDriftSum.iY += xMeasurement.iY;
-        xGyroDriftSum.iZ += xMeasurement.iZ;
+		xGyroDriftSum.iX += xFrame.xGyro.iX;
+        xGyroDriftSum.iY += xFrame.xGyro.iY;
+        xGyroDriftSum.iZ += xFrame.xGyro.iZ;
 	}
 
 	/*	Take average	*/
@@ -503,10 +708,26 @@ uint8_t ucHOS_MPU6050_calibrate(xHOS_MPU6050_t* pxHandle)
 /*	See header for info	*/
 uint8_t ucHOS_MPU6050_enableTiltCalculation(xHOS_MPU6050_t* pxHandle)
 {
-	if (!pxHandle->ucIsIntConnected)
+	if (!pxHandle->ucIsIntConnected || pxHandle->ucIsFifoEnabled)
 		return 0;
 
-	vTaskResume(pxHandle->xTask);
+	if (pxHandle->ucIsTiltEnabled)
+		return 1;
+
+	/*	Reset tilt values	*/
+	pxHandle->xTilt.iX = 0;
+	pxHandle->xTilt.iY = 0;
+	pxHandle->xTilt.iZ = 0;
+
+	/*	Reset estimator. (Gyro samples are in milli-dps)	*/
+	vLIB_AttitudeEstimator_init(	&pxHandle->xEstimator,
+									(float)uiCONF_MPU6050_TILT_PERIOD_MS / 1000.0f,
+									(float)M_PI / 180000.0f,
+									fCONF_MPU6050_TILT_KP,
+									fCONF_MPU6050_TILT_KI	);
+
+	pxHandle->ucIsTiltEnabled = 1;
+	xTaskNotifyGive(pxHandle->xTask);
 
 	return 1;
 }
@@ -514,7 +735,89 @@ uint8_t ucHOS_MPU6050_enableTiltCalculation(xHOS_MPU6050_t* pxHandle)
 /*	See header for info	*/
 void vHOS_MPU6050_disableTiltCalculation(xHOS_MPU6050_t* pxHandle)
 {
-	vTaskSuspend(pxHandle->xTask);
+	pxHandle->ucIsTiltEnabled = 0;
+
+	/*	Unblock the task, if waiting for INT	*/
+	xSemaphoreGive(pxHandle->xIntSemaphore);
+}
+
+/*	See header for info	*/
+uint8_t ucHOS_MPU6050_enableFifo(	xHOS_MPU6050_t* pxHandle,
+									uint32_t uiFramesPerBurst,
+									pfHOS_MPU6050_fifoCallback_t pfCallback,
+									void* pvParams	)
+{
+	uint8_t ucSuccessful;
+
+	if (!pxHandle->ucIsIntConnected || pxHandle->ucIsTiltEnabled)
+		return 0;
+
+	if (	uiFramesPerBurst == 0 ||
+			uiFramesPerBurst > uiCONF_MPU6050_FIFO_MAX_FRAMES_PER_BURST	)
+		return 0;
+
+	if (pxHandle->ucIsFifoEnabled)
+		return 0;
+
+	pxHandle->pfFifoCallback = pfCallback;
+	pxHandle->pvFifoCallbackParams = pvParams;
+
+	/*	Write accel, temperature and gyro samples to the FIFO	*/
+	ucSuccessful = ucHOS_MPU6050_writeReg(	pxHandle,
+											MPU6050_REG_FIFO_EN,
+											MPU6050_FIFO_EN_TEMP	|
+											MPU6050_FIFO_EN_XG		|
+											MPU6050_FIFO_EN_YG		|
+											MPU6050_FIFO_EN_ZG		|
+											MPU6050_FIFO_EN_ACCEL	);
+	if (!ucSuccessful)
+		return 0;
+
+	/*	Start with an empty FIFO	*/
+	ucSuccessful = ucResetFifo(pxHandle);
+	if (!ucSuccessful)
+		return 0;
+
+	/*	Wake task once every burst	*/
+	vSetIntsPerWakeup(pxHandle, uiFramesPerBurst);
+	xSemaphoreTake(pxHandle->xIntSemaphore, 0);
+
+	pxHandle->ucIsFifoEnabled = 1;
+	xTaskNotifyGive(pxHandle->xTask);
+
+	return 1;
+}
+
+/*	See header for info	*/
+uint8_t ucHOS_MPU6050_disableFifo(xHOS_MPU6050_t* pxHandle)
+{
+	uint8_t ucSuccessful;
+
+	pxHandle->ucIsFifoEnabled = 0;
+
+	/*	Unblock the task, if waiting for INT	*/
+	vSetIntsPerWakeup(pxHandle, 1);
+	xSemaphoreGive(pxHandle->xIntSemaphore);
+
+	/*	Stop FIFO	*/
+	ucSuccessful = ucEditReg(	pxHandle,
+								MPU6050_REG_USER_CTRL,
+								MPU6050_USER_CTRL_FIFO_EN,
+								0	);
+	if (!ucSuccessful)
+		return 0;
+
+	ucSuccessful = ucHOS_MPU6050_writeReg(pxHandle, MPU6050_REG_FIFO_EN, 0);
+	if (!ucSuccessful)
+		return 0;
+
+	return 1;
+}
+
+/*	See header for info	*/
+uint32_t uiHOS_MPU6050_getFifoOverflowCount(xHOS_MPU6050_t* pxHandle)
+{
+	return pxHandle->uiFifoOverflowCount;
 }
 
 /*	See header for info	*/
@@ -788,7 +1091,9 @@ uint8_t ucHOS_MPU6050_confLpdfAndSampleRate(	xHOS_MPU6050_t* pxHandle,
 /*	See header for info	*/
 void vHOS_MPU6050_waitDataReadyInt(xHOS_MPU6050_t* pxHandle)
 {
-	while(!ucPORT_DIO_READ_PIN(pxHandle->ucIntPort, pxHandle->ucIntPin));
+	/*	Discard previous pulses, and block until the next one	*/
+	xSemaphoreTake(pxHandle->xIntSemaphore, 0);
+	xSemaphoreTake(pxHandle->xIntSemaphore, portMAX_DELAY);
 }
 
 /*	See header for info	*/
@@ -803,10 +1108,10 @@ uint8_t ucHOS_MPU6050_readGyroMeasurement(	xHOS_MPU6050_t* pxHandle,
 	if (!ucSuccessful)
 		return 0;
 
-	/*	Convert it to milli-dps value	*/
-	pxData->iX = ((int32_t)xRawMeasurement.sX * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
-	pxData->iY = ((int32_t)xRawMeasurement.sY * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
-	pxData->iZ = ((int32_t)xRawMeasurement.sZ * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
+	/*	Convert it to milli-dps value (64-bit product, see "MPU6050_Decoder.c")	*/
+	pxData->iX = ((int64_t)xRawMeasurement.sX * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
+	pxData->iY = ((int64_t)xRawMeasurement.sY * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
+	pxData->iZ = ((int64_t)xRawMeasurement.sZ * (int32_t)(pxHandle->sGyroFSR) * 1000) / 32768;
 
 	/*	Subtract drift error	*/
 	pxData->iX -= pxHandle->xGyroDrift.iX;
@@ -829,9 +1134,9 @@ uint8_t ucHOS_MPU6050_readAccelMeasurement(	xHOS_MPU6050_t* pxHandle,
 		return 0;
 
 	/*	Convert it to milli-g value	*/
-	pxData->iX = ((int32_t)xRawMeasurement.sX * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
-	pxData->iY = ((int32_t)xRawMeasurement.sY * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
-	pxData->iZ = ((int32_t)xRawMeasurement.sZ * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
+	pxData->iX = ((int64_t)xRawMeasurement.sX * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
+	pxData->iY = ((int64_t)xRawMeasurement.sY * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
+	pxData->iZ = ((int64_t)xRawMeasurement.sZ * (int32_t)(pxHandle->sAccelFSR) * 1000) / 32768;
 
 	/*	Subtract drift error	*/
 	pxData->iX -= pxHandle->xAccelDrift.iX;
@@ -874,6 +1179,39 @@ uint8_t ucHOS_MPU6050_readTemperatureMeasurement(	xHOS_MPU6050_t* pxHandle,
 	return 1;
 }
 
+/*	See header for info	*/
+uint8_t ucHOS_MPU6050_readFrame(	xHOS_MPU6050_t* pxHandle,
+									xHOS_MPU6050_frame_t* pxFrame	)
+{
+	uint8_t ucSuccessful;
+	xHOS_MPU6050_scale_t xScale;
+
+	/*	Prepare transreceive params	*/
+	uint8_t ucAddress = MPU6050_REG_ACCEL_XOUT_H;
+	uint8_t pucRawArr[uiHOS_MPU6050_FRAME_SIZE];
+
+	xHOS_I2C_transreceiveParams_t xTRParams = {
+		.ucUnitNumber = pxHandle->ucI2CUnitNumber,
+		.usAddress = MPU6050_ADDRESS0 | pxHandle->ucAdd0State,
+		.ucIs7BitAddress = 1,
+		.pucTxArr = &ucAddress,
+		.uiTxSize = 1,
+		.pucRxArr = pucRawArr,
+		.uiRxSize = uiHOS_MPU6050_FRAME_SIZE
+	};
+
+	/*	Brust read registers (accel, temperature and gyro)	*/
+	ucSuccessful = ucHOS_I2C_masterTransReceive(&xTRParams);
+	if (!ucSuccessful)
+		return 0;
+
+	/*	Decode	*/
+	vGetScale(pxHandle, &xScale);
+	vHOS_MPU6050_decodeFrames(&xScale, pucRawArr, 1, pxFrame);
+
+	return 1;
+}
+
 
 
 
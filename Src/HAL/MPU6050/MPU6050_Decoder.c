@@ -0,0 +1,68 @@
+/*
+ * MPU6050_Decoder.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include "stdint.h"
+
+/*	SELF	*/
+#include "HAL/MPU6050/MPU6050_Decoder.h"
+
+
+/*******************************************************************************
+ * Helping functions / macros:
+ ******************************************************************************/
+/*	Reads a big-endian signed 16-bit value	*/
+#define sREAD_BE16(pucArr)	\
+	((int16_t)(((uint16_t)(pucArr)[0] << 8) | (uint16_t)(pucArr)[1]))
+
+static inline void vDecodeAxes(	const uint8_t* pucRawArr,
+								int32_t iFSR,
+								const xHOS_MPU6050_drift_t* pxDrift,
+								xHOS_MPU6050_measurement_t* pxMeasurement	)
+{
+	/*
+	 * Product is done in 64-bit, as it exceeds 32-bit range for gyro FSRs above
+	 * 65 dps (32768 * 2000 * 1000 = 6.5e10).
+	 */
+	pxMeasurement->iX = ((int64_t)sREAD_BE16(&pucRawArr[0]) * iFSR * 1000) / 32768;
+	pxMeasurement->iY = ((int64_t)sREAD_BE16(&pucRawArr[2]) * iFSR * 1000) / 32768;
+	pxMeasurement->iZ = ((int64_t)sREAD_BE16(&pucRawArr[4]) * iFSR * 1000) / 32768;
+
+	pxMeasurement->iX -= pxDrift->iX;
+	pxMeasurement->iY -= pxDrift->iY;
+	pxMeasurement->iZ -= pxDrift->iZ;
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*	See header for info	*/
+void vHOS_MPU6050_decodeFrames(	const xHOS_MPU6050_scale_t* pxScale,
+								const uint8_t* pucRawArr,
+								uint32_t uiNumberOfFrames,
+								xHOS_MPU6050_frame_t* pxFrameArr	)
+{
+	for (uint32_t i = 0; i < uiNumberOfFrames; i++)
+	{
+		/*	Accel: bytes 0 to 5	*/
+		vDecodeAxes(	&pucRawArr[0],
+						pxScale->sAccelFSR,
+						&pxScale->xAccelDrift,
+						&pxFrameArr[i].xAccel	);
+
+		/*	Temperature: bytes 6 and 7	*/
+		pxFrameArr[i].iTemp =
+			(((int32_t)sREAD_BE16(&pucRawArr[6])) * 1000) / 340 + 36530;
+
+		/*	Gyro: bytes 8 to 13	*/
+		vDecodeAxes(	&pucRawArr[8],
+						pxScale->sGyroFSR,
+						&pxScale->xGyroDrift,
+						&pxFrameArr[i].xGyro	);
+
+		pucRawArr += uiHOS_MPU6050_FRAME_SIZE;
+	}
+}
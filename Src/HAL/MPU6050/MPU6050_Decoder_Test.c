@@ -0,0 +1,234 @@
+/*
+ * MPU6050_Decoder_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the MPU6050 frame decoder.
+ *
+ * It decodes FIFO dumps, for every accel and gyro full scale range, and checks
+ * every decoded value against a double precision reference (truncated toward
+ * zero, as the integer conversion is). Built-in dumps contain random frames and
+ * the extremes (-32768, -1, 0, 1, 32767) of every field, at which the 32-bit
+ * product used to overflow for gyro FSRs of 250 dps and above.
+ *
+ * Recorded FIFO dumps (raw bytes read from "FIFO_R_W", accel, temperature and
+ * gyro enabled) could be given on the command line, along with the FSRs they
+ * were recorded with. They are checked the same way, and their decoded frames
+ * are printed as CSV (milli-g, milli-dps, milli-degree C).
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_MPU6050_DECODER_HOST_TEST -IInc \
+ * 			Src/HAL/MPU6050/MPU6050_Decoder.c \
+ * 			Src/HAL/MPU6050/MPU6050_Decoder_Test.c -o mpu6050_decoder_test
+ *
+ * 		./mpu6050_decoder_test [<dump file> <accel FSR (g)> <gyro FSR (dps)>]...
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_MPU6050_DECODER_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "HAL/MPU6050/MPU6050_Decoder.h"
+
+#define uiNUMBER_OF_RANDOM_FRAMES		10000
+#define uiMAX_DUMP_FRAMES				100000
+#define uiBENCHMARK_FRAMES				20000000
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiFrame)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, frame: %u\n", pcName, uiFrame);
+		uiNumberOfFailures++;
+	}
+}
+
+static int16_t sReadBE16(const uint8_t* pucArr)
+{
+	return (int16_t)(((uint16_t)pucArr[0] << 8) | pucArr[1]);
+}
+
+static void vWriteBE16(uint8_t* pucArr, int16_t sVal)
+{
+	pucArr[0] = (uint16_t)sVal >> 8;
+	pucArr[1] = (uint16_t)sVal & 0xFF;
+}
+
+/*	Reference conversion of an axis, in milli units	*/
+static int32_t iRefAxis(int16_t sRaw, int16_t sFSR, int32_t iDrift)
+{
+	return (int32_t)trunc((double)sRaw * sFSR * 1000.0 / 32768.0) - iDrift;
+}
+
+/*	Checks "uiNumberOfFrames" frames of "pucRawArr" decoded with "pxScale"	*/
+static void vCheckDump(	const xHOS_MPU6050_scale_t* pxScale,
+						const uint8_t* pucRawArr,
+						uint32_t uiNumberOfFrames,
+						uint8_t ucPrint	)
+{
+	static xHOS_MPU6050_frame_t pxFrameArr[uiMAX_DUMP_FRAMES];
+
+	vHOS_MPU6050_decodeFrames(pxScale, pucRawArr, uiNumberOfFrames, pxFrameArr);
+
+	for (uint32_t i = 0; i < uiNumberOfFrames; i++)
+	{
+		const uint8_t* pucFrame = &pucRawArr[i * uiHOS_MPU6050_FRAME_SIZE];
+		xHOS_MPU6050_frame_t* pxFrame = &pxFrameArr[i];
+
+		vCheck(pxFrame->xAccel.iX == iRefAxis(sReadBE16(&pucFrame[0]), pxScale->sAccelFSR, pxScale->xAccelDrift.iX), "accel X", i);
+		vCheck(pxFrame->xAccel.iY == iRefAxis(sReadBE16(&pucFrame[2]), pxScale->sAccelFSR, pxScale->xAccelDrift.iY), "accel Y", i);
+		vCheck(pxFrame->xAccel.iZ == iRefAxis(sReadBE16(&pucFrame[4]), pxScale->sAccelFSR, pxScale->xAccelDrift.iZ), "accel Z", i);
+
+		vCheck(pxFrame->iTemp == (int32_t)trunc(sReadBE16(&pucFrame[6]) * 1000.0 / 340.0) + 36530, "temperature", i);
+
+		vCheck(pxFrame->xGyro.iX == iRefAxis(sReadBE16(&pucFrame[8]), pxScale->sGyroFSR, pxScale->xGyroDrift.iX), "gyro X", i);
+		vCheck(pxFrame->xGyro.iY == iRefAxis(sReadBE16(&pucFrame[10]), pxScale->sGyroFSR, pxScale->xGyroDrift.iY), "gyro Y", i);
+		vCheck(pxFrame->xGyro.iZ == iRefAxis(sReadBE16(&pucFrame[12]), pxScale->sGyroFSR, pxScale->xGyroDrift.iZ), "gyro Z", i);
+
+		if (ucPrint)
+		{
+			printf(	"%d,%d,%d,%d,%d,%d,%d\n",
+					pxFrame->xAccel.iX, pxFrame->xAccel.iY, pxFrame->xAccel.iZ,
+					pxFrame->xGyro.iX, pxFrame->xGyro.iY, pxFrame->xGyro.iZ,
+					pxFrame->iTemp	);
+		}
+	}
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static const int16_t psAccelFSRArr[] = {2, 4, 8, 16};
+static const int16_t psGyroFSRArr[] = {250, 500, 1000, 2000};
+
+static void vTestBuiltInDumps(void)
+{
+	static const int16_t psExtremeArr[] = {-32768, -32767, -1, 0, 1, 32766, 32767};
+	static uint8_t pucRawArr[uiNUMBER_OF_RANDOM_FRAMES * uiHOS_MPU6050_FRAME_SIZE];
+	uint32_t uiNumberOfFrames = 0;
+
+	/*	Every field at every extreme	*/
+	for (uint32_t i = 0; i < sizeof(psExtremeArr) / sizeof(psExtremeArr[0]); i++)
+	{
+		for (uint32_t j = 0; j < uiHOS_MPU6050_FRAME_SIZE; j += 2)
+			vWriteBE16(&pucRawArr[uiNumberOfFrames * uiHOS_MPU6050_FRAME_SIZE + j], psExtremeArr[i]);
+		uiNumberOfFrames++;
+	}
+
+	/*	Random frames	*/
+	while (uiNumberOfFrames < uiNUMBER_OF_RANDOM_FRAMES)
+	{
+		for (uint32_t j = 0; j < uiHOS_MPU6050_FRAME_SIZE; j++)
+			pucRawArr[uiNumberOfFrames * uiHOS_MPU6050_FRAME_SIZE + j] = rand();
+		uiNumberOfFrames++;
+	}
+
+	for (uint32_t a = 0; a < 4; a++)
+	{
+		for (uint32_t g = 0; g < 4; g++)
+		{
+			xHOS_MPU6050_scale_t xScale = {
+				.sAccelFSR = psAccelFSRArr[a],
+				.sGyroFSR = psGyroFSRArr[g],
+				.xAccelDrift = {rand() % 101 - 50, rand() % 101 - 50, rand() % 101 - 50},
+				.xGyroDrift = {rand() % 2001 - 1000, rand() % 2001 - 1000, rand() % 2001 - 1000}
+			};
+
+			vCheckDump(&xScale, pucRawArr, uiNumberOfFrames, 0);
+		}
+	}
+
+	/*	Full scale reads +/- FSR	*/
+	xHOS_MPU6050_scale_t xScale = {.sAccelFSR = 16, .sGyroFSR = 2000};
+	xHOS_MPU6050_frame_t pxFrameArr[2];
+	vHOS_MPU6050_decodeFrames(&xScale, pucRawArr, 1, &pxFrameArr[0]);
+	vCheck(pxFrameArr[0].xAccel.iX == -16000, "accel -FSR", 0);
+	vCheck(pxFrameArr[0].xGyro.iX == -2000000, "gyro -FSR", 0);
+	vHOS_MPU6050_decodeFrames(&xScale, &pucRawArr[6 * uiHOS_MPU6050_FRAME_SIZE], 1, &pxFrameArr[1]);
+	vCheck(pxFrameArr[1].xGyro.iZ == 1999938, "gyro +FSR", 0);
+}
+
+static void vTestRecordedDump(const char* pcPath, int16_t sAccelFSR, int16_t sGyroFSR)
+{
+	static uint8_t pucRawArr[uiMAX_DUMP_FRAMES * uiHOS_MPU6050_FRAME_SIZE];
+	xHOS_MPU6050_scale_t xScale = {.sAccelFSR = sAccelFSR, .sGyroFSR = sGyroFSR};
+	uint32_t uiSize;
+
+	FILE* pxFile = fopen(pcPath, "rb");
+	if (pxFile == NULL)
+	{
+		printf("FAILED: can not open %s\n", pcPath);
+		uiNumberOfFailures++;
+		return;
+	}
+	uiSize = fread(pucRawArr, 1, sizeof(pucRawArr), pxFile);
+	fclose(pxFile);
+
+	/*	FIFO is read in whole frames	*/
+	vCheck(uiSize % uiHOS_MPU6050_FRAME_SIZE == 0, "dump size is whole frames", uiSize);
+
+	printf("# %s: accel FSR: %d g, gyro FSR: %d dps\n", pcPath, sAccelFSR, sGyroFSR);
+	printf("# ax,ay,az,gx,gy,gz,temp\n");
+	vCheckDump(&xScale, pucRawArr, uiSize / uiHOS_MPU6050_FRAME_SIZE, 1);
+}
+
+static void vBenchmark(void)
+{
+	static uint8_t pucRawArr[1000 * uiHOS_MPU6050_FRAME_SIZE];
+	static xHOS_MPU6050_frame_t pxFrameArr[1000];
+	xHOS_MPU6050_scale_t xScale = {.sAccelFSR = 16, .sGyroFSR = 2000};
+	volatile uint32_t uiSink = 0;
+
+	for (uint32_t i = 0; i < sizeof(pucRawArr); i++)
+		pucRawArr[i] = rand();
+
+	clock_t xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_FRAMES / 1000; i++)
+	{
+		vHOS_MPU6050_decodeFrames(&xScale, pucRawArr, 1000, pxFrameArr);
+		uiSink += (uint32_t)pxFrameArr[i % 1000].xGyro.iX;
+	}
+	double dSec = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	printf("Decoding: %.1f Mframes/s\n", uiBENCHMARK_FRAMES / dSec / 1e6);
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+	srand(1);
+
+	vTestBuiltInDumps();
+
+	for (int i = 1; i + 2 < argc; i += 3)
+		vTestRecordedDump(argv[i], atoi(argv[i + 1]), atoi(argv[i + 2]));
+
+	vBenchmark();
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_MPU6050_DECODER_HOST_TEST	*/
@@ -7,12 +7,15 @@
 
 /*	LIB	*/
 #include "stdint.h"
+#include <stdio.h>
 
 /*	RTOS	*/
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "task.h"
 
+#include "RTOS_PRI_Config.h"
+
 /*	MCAL	*/
 #include "MCAL_Port/Port_SPI.h"
 #include "MCAL_Port/Port_DIO.h"
@@ -24,8 +27,69 @@
 #include "HAL/IOExtend/OExtendShiftRegister.h"
 
 
-static void  vSpiTransmit(xHOS_OExtendShiftRegister_t* pxHandle)
+/*******************************************************************************
+ * Helping functions/macros.
+ ******************************************************************************/
+/*
+ * Number of bytes of a transfer. Shorter of the two chains gets its bytes first,
+ * such that they pass through it and get out of (or come into) the longer one.
+ */
+#define ucCHAIN_LEN(pxHandle)											\
+	(	((pxHandle)->ucRegisterSizeInBytes > (pxHandle)->ucInputRegisterSizeInBytes) ?	\
+		(pxHandle)->ucRegisterSizeInBytes :											\
+		(pxHandle)->ucInputRegisterSizeInBytes	)
+
+/*
+ * Bit-bangs the chain, last byte first, MSB first.
+ *
+ * Input bit is read before the rising edge, as 74HC165 shifts on it, while
+ * 74HC595 samples on it.
+ */
+static void vBitBang(xHOS_OExtendShiftRegister_t* pxHandle, uint8_t ucLen)
+{
+	uint8_t ucOut, ucIn;
+
+	for (int8_t reg = ucLen - 1; reg >= 0; reg--)
+	{
+		ucOut = pxHandle->pucOutputArr[reg];
+		ucIn = 0;
+
+		for (int8_t i = 7; i >= 0; i--)
+		{
+			vPORT_DIO_WRITE_PIN(pxHandle->ucDataPort, pxHandle->ucDataPin, (ucOut >> i) & 1);
+
+			if (pxHandle->ucInputRegisterSizeInBytes != 0)
+				ucIn |= ucPORT_DIO_READ_PIN(pxHandle->ucInDataPort, pxHandle->ucInDataPin) << i;
+
+			vPORT_DIO_WRITE_PIN(pxHandle->ucSckPort, pxHandle->ucSckPin, 1);
+
+			vPORT_DIO_WRITE_PIN(pxHandle->ucSckPort, pxHandle->ucSckPin, 0);
+		}
+
+		pxHandle->pucRxArr[reg] = ucIn;
+	}
+}
+
+/*
+ * Transfers the whole chain in one burst.
+ *
+ * Handle's mutex must be taken first.
+ */
+static void vTransfer(xHOS_OExtendShiftRegister_t* pxHandle)
 {
+	uint8_t ucLen = ucCHAIN_LEN(pxHandle);
+
+	/*	Parallel load inputs	*/
+	if (pxHandle->ucInputRegisterSizeInBytes != 0)
+	{
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLoadPort, pxHandle->ucLoadPin, 0);
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLoadPort, pxHandle->ucLoadPin, 1);
+	}
+
+	/*	Write Latch pin low	*/
+	if (pxHandle->ucRegisterSizeInBytes != 0)
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 0);
+
 	if (pxHandle->ucSpiUnitNumber != 255)
 	{
 		ucHOS_SPI_takeMutex(pxHandle->ucSpiUnitNumber, portMAX_DELAY);
@@ -33,9 +97,19 @@ static void  vSpiTransmit(xHOS_OExtendShiftRegister_t* pxHandle)
 		vHOS_SPI_setByteDirection(	pxHandle->ucSpiUnitNumber,
 									ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST	);
 
-		vHOS_SPI_send(	pxHandle->ucSpiUnitNumber,
-						(int8_t*)&pxHandle->uiCurrentOutputWord,
-						pxHandle->ucRegisterSizeInBytes	);
+		if (pxHandle->ucInputRegisterSizeInBytes != 0)
+		{
+			vHOS_SPI_transceive(	pxHandle->ucSpiUnitNumber,
+									(int8_t*)pxHandle->pucOutputArr,
+									(int8_t*)pxHandle->pucRxArr,
+									ucLen	);
+		}
+		else
+		{
+			vHOS_SPI_send(	pxHandle->ucSpiUnitNumber,
+							(int8_t*)pxHandle->pucOutputArr,
+							ucLen	);
+		}
 
 		ucHOS_SPI_blockUntilTransferComplete(pxHandle->ucSpiUnitNumber, portMAX_DELAY);
 
@@ -44,38 +118,77 @@ static void  vSpiTransmit(xHOS_OExtendShiftRegister_t* pxHandle)
 
 	else
 	{
-		for (int8_t reg = pxHandle->ucRegisterSizeInBytes - 1; reg >= 0; reg--)
-		{
-			for (int8_t i = 7; i >= 0; i--)
-			{
-				uint8_t ucState = (pxHandle->uiCurrentOutputWord >> (i + reg * 8)) & 1;
-				vPORT_DIO_WRITE_PIN(pxHandle->ucDataPort, pxHandle->ucDataPin, ucState);
+		vBitBang(pxHandle, ucLen);
+	}
 
-				vTaskDelay(pdMS_TO_TICKS(10));
+	/*	Write Latch pin high	*/
+	if (pxHandle->ucRegisterSizeInBytes != 0)
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 1);
+
+	/*	First received byte (last index) is of register 0	*/
+	for (uint8_t i = 0; i < pxHandle->ucInputRegisterSizeInBytes; i++)
+		pxHandle->pucInputArr[i] = pxHandle->pucRxArr[ucLen - 1 - i];
 
-				vPORT_DIO_WRITE_PIN(pxHandle->ucSckPort, pxHandle->ucSckPin, 1);
+	pxHandle->ucIsDirty = 0;
+}
 
-				vTaskDelay(pdMS_TO_TICKS(10));
+/*
+ * Transfers the chain if in immediate flush mode, otherwise marks it dirty.
+ *
+ * Handle's mutex must be taken first.
+ */
+static inline void vApplyWrite(xHOS_OExtendShiftRegister_t* pxHandle)
+{
+	if (pxHandle->ucFlushMode == ucHOS_OEXTEND_SHIFT_REGISTER_FLUSH_MODE_IMMEDIATE)
+		vTransfer(pxHandle);
+	else
+		pxHandle->ucIsDirty = 1;
+}
 
-				vPORT_DIO_WRITE_PIN(pxHandle->ucSckPort, pxHandle->ucSckPin, 0);
+/*******************************************************************************
+ * RTOS Task code:
+ ******************************************************************************/
+static void vTask(void* pvParams)
+{
+	xHOS_OExtendShiftRegister_t* pxHandle = (xHOS_OExtendShiftRegister_t*)pvParams;
 
-				vTaskDelay(pdMS_TO_TICKS(10));
-			}
-		}
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	while(1)
+	{
+		vHOS_OExtendShiftRegister_refresh(pxHandle);
 
+		vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(pxHandle->uiRefreshPeriodMs));
 	}
 }
 
-
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
 void vHOS_OExtendShiftRegister_init(xHOS_OExtendShiftRegister_t* pxHandle)
 {
+	configASSERT(pxHandle->ucRegisterSizeInBytes <= uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN);
+	configASSERT(pxHandle->ucInputRegisterSizeInBytes <= uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN);
+
 	/*	Initialize mutex	*/
 	pxHandle->xMutex = xSemaphoreCreateMutexStatic(&pxHandle->xMutexStatic);
 	xSemaphoreGive(pxHandle->xMutex);
 
 	/*	Initialize latch pin	*/
-	vPort_DIO_initPinOutput(pxHandle->ucLatchPort, pxHandle->ucLatchPin);
-	vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 0);
+	if (pxHandle->ucRegisterSizeInBytes != 0)
+	{
+		vPort_DIO_initPinOutput(pxHandle->ucLatchPort, pxHandle->ucLatchPin);
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 0);
+	}
+
+	/*	Initialize load pin (initially in shift mode)	*/
+	if (pxHandle->ucInputRegisterSizeInBytes != 0)
+	{
+		vPort_DIO_initPinOutput(pxHandle->ucLoadPort, pxHandle->ucLoadPin);
+		vPORT_DIO_WRITE_PIN(pxHandle->ucLoadPort, pxHandle->ucLoadPin, 1);
+	}
 
 	/*	Initialize SCK and data pins (only if HW SPI is not used)	*/
 	if (pxHandle->ucSpiUnitNumber == 255)
@@ -85,12 +198,42 @@ void vHOS_OExtendShiftRegister_init(xHOS_OExtendShiftRegister_t* pxHandle)
 
 		vPort_DIO_initPinOutput(pxHandle->ucDataPort, pxHandle->ucDataPin);
 		vPORT_DIO_WRITE_PIN(pxHandle->ucDataPort, pxHandle->ucDataPin, 0);
+
+		if (pxHandle->ucInputRegisterSizeInBytes != 0)
+			vPort_DIO_initPinInput(pxHandle->ucInDataPort, pxHandle->ucInDataPin, 0);
+	}
+
+	/*	Output chain is initially zero	*/
+	for (uint8_t i = 0; i < uiCONF_OEXTEND_SHIFT_REGISTER_MAX_CHAIN_LEN; i++)
+	{
+		pxHandle->pucOutputArr[i] = 0;
+		pxHandle->pucInputArr[i] = 0;
 	}
 
-	/*	Output word is initially zero	*/
-	vHOS_OExtendShiftRegister_writePort(pxHandle, 0xFFFFFFFF, 0);
+	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
+	vTransfer(pxHandle);
+	xSemaphoreGive(pxHandle->xMutex);
+
+	/*	Create auto-refresh task	*/
+	if (pxHandle->uiRefreshPeriodMs != 0)
+	{
+		static uint8_t ucCreatedObjectsCount = 0;
+		char pcTaskName[configMAX_TASK_NAME_LEN];
+		sprintf(pcTaskName, "ShiftReg%d", ucCreatedObjectsCount++);
+
+		pxHandle->xTask = xTaskCreateStatic(	vTask,
+												pcTaskName,
+												uiCONF_OEXTEND_SHIFT_REGISTER_STACK_SIZE,
+												(void*)pxHandle,
+												configHOS_SOFT_REAL_TIME_TASK_PRI,
+												pxHandle->puxTaskStack,
+												&pxHandle->xTaskStatic	);
+	}
 }
 
+/*
+ * See header for info.
+ */
 void vHOS_OExtendShiftRegister_writePin(
 		xHOS_OExtendShiftRegister_t* pxHandle,
 		uint8_t ucPinNumber,
@@ -99,25 +242,21 @@ void vHOS_OExtendShiftRegister_writePin(
 	/*	Lock mutex	*/
 	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
 
-	/*	Write Latch pin low	*/
-	vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 0);
-
-	/*	Edit stored current value of the port	*/
+	/*	Edit stored current value of the pin	*/
 	if (ucVal)
-		pxHandle->uiCurrentOutputWord |= (1ul << ucPinNumber);
+		pxHandle->pucOutputArr[ucPinNumber / 8] |= (1 << (ucPinNumber % 8));
 	else
-		pxHandle->uiCurrentOutputWord &= (~(1ul << ucPinNumber));
-
-	/*	SPI transmit	*/
-	vSpiTransmit(pxHandle);
+		pxHandle->pucOutputArr[ucPinNumber / 8] &= ~(1 << (ucPinNumber % 8));
 
-	/*	Write Latch pin high	*/
-	vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 1);
+	vApplyWrite(pxHandle);
 
 	/*	Unlock mutex	*/
 	xSemaphoreGive(pxHandle->xMutex);
 }
 
+/*
+ * See header for info.
+ */
 void vHOS_OExtendShiftRegister_writePort(
 		xHOS_OExtendShiftRegister_t* pxHandle,
 		uint32_t uiMask,
@@ -126,19 +265,68 @@ void vHOS_OExtendShiftRegister_writePort(
 	/*	Lock mutex	*/
 	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
 
-	/*	Write Latch pin low	*/
-	vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 0);
+	/*	Edit stored current value of the port (its first 4 registers)	*/
+	for (uint8_t i = 0; i < 4 && i < pxHandle->ucRegisterSizeInBytes; i++)
+	{
+		pxHandle->pucOutputArr[i] &= ~(uint8_t)(uiMask >> (8 * i));
+		pxHandle->pucOutputArr[i] |= (uint8_t)(uiVal >> (8 * i));
+	}
 
-	/*	Edit stored current value of the port	*/
-	pxHandle->uiCurrentOutputWord &= ~(uiMask);                                        \
-	pxHandle->uiCurrentOutputWord |= (uiVal);
+	vApplyWrite(pxHandle);
 
-	/*	SPI transmit	*/
-	vSpiTransmit(pxHandle);
+	/*	Unlock mutex	*/
+	xSemaphoreGive(pxHandle->xMutex);
+}
 
-	/*	Write Latch pin high	*/
-	vPORT_DIO_WRITE_PIN(pxHandle->ucLatchPort, pxHandle->ucLatchPin, 1);
+/*
+ * See header for info.
+ */
+void vHOS_OExtendShiftRegister_flush(xHOS_OExtendShiftRegister_t* pxHandle)
+{
+	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
+
+	if (pxHandle->ucIsDirty)
+		vTransfer(pxHandle);
+
+	xSemaphoreGive(pxHandle->xMutex);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_OExtendShiftRegister_refresh(xHOS_OExtendShiftRegister_t* pxHandle)
+{
+	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
+
+	vTransfer(pxHandle);
+
+	xSemaphoreGive(pxHandle->xMutex);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_OExtendShiftRegister_readInputPin(
+		xHOS_OExtendShiftRegister_t* pxHandle,
+		uint8_t ucPinNumber	)
+{
+	return (pxHandle->pucInputArr[ucPinNumber / 8] >> (ucPinNumber % 8)) & 1;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_OExtendShiftRegister_readInputPort(
+		xHOS_OExtendShiftRegister_t* pxHandle	)
+{
+	uint32_t uiLevels = 0;
+
+	xSemaphoreTake(pxHandle->xMutex, portMAX_DELAY);
+
+	for (uint8_t i = 0; i < 4 && i < pxHandle->ucInputRegisterSizeInBytes; i++)
+		uiLevels |= (uint32_t)pxHandle->pucInputArr[i] << (8 * i);
 
-	/*	Unlock mutex	*/
 	xSemaphoreGive(pxHandle->xMutex);
+
+	return uiLevels;
 }
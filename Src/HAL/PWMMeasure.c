@@ -20,6 +20,7 @@
 #include "MCAL_Port/Port_DIO.h"
 #include "MCAL_Port/Port_EXTI.h"
 #include "MCAL_Port/Port_Interrupt.h"
+#include "MCAL_Port/Port_Timer.h"
 
 /*	HAL	*/
 #include "HAL/HWTime/HWTime.h"
@@ -36,10 +37,6 @@
 /*******************************************************************************
  * Callbacks:
  ******************************************************************************/
-extern volatile int32_t iVoltageDuty;
-extern volatile int32_t iTicks;
-extern volatile int32_t iDir;
-
 static void vCallback(void* pvParams)
 {
 	xHOS_PWMDutyMeasure_t* pxHandle = (xHOS_PWMDutyMeasure_t*)pvParams;
@@ -59,21 +56,11 @@ static void vCallback(void* pvParams)
 		 */
 		if (pxHandle->ucPrevEdge == 1)		return;
 
-		/*	Increment ticks	*/
-		if (ucPORT_DIO_READ_PIN(1, 0))
-			iTicks++;
-		else
-			iTicks--;
-
 		pxHandle->ucPrevEdge = 1;
 
 		/*	Calculate period (Time since  the previous rising edge	*/
-		if (iTicks % 2 == 0)
-		{
-			pxHandle->uiPeriodTime = ulCurrentTime - pxHandle->ulPrevRisingTime;
-			pxHandle->ulPrevRisingTime = ulCurrentTime;
-		}
-
+		pxHandle->uiPeriodTime = ulCurrentTime - pxHandle->ulPrevRisingTime;
+		pxHandle->ulPrevRisingTime = ulCurrentTime;
 	}
 
 	/*	Otherwise, if callback is due to a falling edge	*/
@@ -95,6 +82,62 @@ static void vCallback(void* pvParams)
 	(void)xSemaphoreGiveFromISR(pxHandle->xNewMeasurementSemaphore, NULL);
 }
 
+/*
+ * Capture backend, called on every rising edge. Timer has already captured
+ * period and active time of the cycle that has just ended.
+ */
+static void vCapCallback(void* pvParams)
+{
+	xHOS_PWMDutyMeasure_t* pxHandle = (xHOS_PWMDutyMeasure_t*)pvParams;
+
+	uint32_t uiPeriod = uiPORT_TIM_READ_CC_REGISTER(pxHandle->ucTimerUnitNumber, 0);
+	uint32_t uiActive = uiPORT_TIM_READ_CC_REGISTER(pxHandle->ucTimerUnitNumber, 1);
+
+	/*
+	 * First edge after init or idle only starts a new cycle, what has been
+	 * captured is not a full period.
+	 */
+	if (pxHandle->ucCapIsIdle)
+	{
+		pxHandle->ucCapIsIdle = 0;
+		return;
+	}
+
+	pxHandle->uiCapPeriodSum += uiPeriod;
+	pxHandle->uiCapActiveSum += uiActive;
+	pxHandle->usCapCount++;
+
+	/*	Publish the window when complete, and start a new one	*/
+	if (pxHandle->usCapCount == pxHandle->usNumberOfAveragedPeriods)
+	{
+		pxHandle->uiCapPeriodSumPublished = pxHandle->uiCapPeriodSum;
+		pxHandle->uiCapActiveSumPublished = pxHandle->uiCapActiveSum;
+		pxHandle->usCapCountPublished = pxHandle->usCapCount;
+
+		pxHandle->uiCapPeriodSum = 0;
+		pxHandle->uiCapActiveSum = 0;
+		pxHandle->usCapCount = 0;
+	}
+}
+
+/*
+ * Capture backend, called when a full counter range has passed without a rising
+ * edge. That is, signal is idle at its current level.
+ */
+static void vCapIdleCallback(void* pvParams)
+{
+	xHOS_PWMDutyMeasure_t* pxHandle = (xHOS_PWMDutyMeasure_t*)pvParams;
+
+	pxHandle->ucCapIsIdle = 1;
+	pxHandle->uiCapPeriodSum = 0;
+	pxHandle->uiCapActiveSum = 0;
+	pxHandle->usCapCount = 0;
+
+	pxHandle->ucCapIdleLevel =
+		ucPORT_DIO_READ_PIN(pxHandle->ucPort, pxHandle->ucPin);
+	pxHandle->usCapCountPublished = 0;
+}
+
 /*******************************************************************************
  * RTOS task:
  ******************************************************************************/
@@ -147,6 +190,107 @@ static void vTask(void* pvParams)
 	}
 }
 
+/*******************************************************************************
+ * Capture backend:
+ ******************************************************************************/
+static void vCapInit(xHOS_PWMDutyMeasure_t* pxHandle)
+{
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	/*	Initialize handle's variables	*/
+	pxHandle->uiCapPeriodSum = 0;
+	pxHandle->uiCapActiveSum = 0;
+	pxHandle->usCapCount = 0;
+	pxHandle->ucCapIsIdle = 1;
+	pxHandle->uiCapPeriodSumPublished = 0;
+	pxHandle->uiCapActiveSumPublished = 0;
+	pxHandle->usCapCountPublished = 0;
+
+	/*	Initialize pin	*/
+	vPort_DIO_initPinInput(pxHandle->ucPort, pxHandle->ucPin, 0);
+	pxHandle->ucCapIdleLevel =
+		ucPORT_DIO_READ_PIN(pxHandle->ucPort, pxHandle->ucPin);
+
+	/*	Initialize timer	*/
+	vPort_TIM_initPwmInput(ucUnit, uiCONF_PWM_MEASURE_CAPTURE_PRESCALER);
+
+	vPort_TIM_setCcCallback(ucUnit, vCapCallback, (void*)pxHandle);
+	vPort_TIM_setOvfCallback(ucUnit, vCapIdleCallback, (void*)pxHandle);
+
+	vPORT_TIM_ENABLE_CC_INTERRUPT(ucUnit);
+	vPORT_TIM_ENABLE_OVF_INTERRUPT(ucUnit);
+
+	/*	Initialize interrupt controller	*/
+	VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptTimerOvfIrqNumberArr[ucUnit],
+									uiCONF_PWM_MEASURE_CAPTURE_PRI	);
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerOvfIrqNumberArr[ucUnit]);
+
+	VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptTimerCcIrqNumberArr[ucUnit],
+									uiCONF_PWM_MEASURE_CAPTURE_PRI	);
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerCcIrqNumberArr[ucUnit]);
+
+	vPORT_TIM_ENABLE_COUNTER(ucUnit);
+}
+
+/*
+ * Copies the latest published window. Timer interrupts are disabled while
+ * copying, so that a window won't be published in the middle of reading it.
+ */
+static inline void vCapRead(	xHOS_PWMDutyMeasure_t* pxHandle,
+								uint32_t* puiPeriodSum,
+								uint32_t* puiActiveSum,
+								uint16_t* pusCount,
+								uint8_t* pucIdleLevel	)
+{
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	vPORT_TIM_DISABLE_CC_INTERRUPT(ucUnit);
+	vPORT_TIM_DISABLE_OVF_INTERRUPT(ucUnit);
+
+	*puiPeriodSum = pxHandle->uiCapPeriodSumPublished;
+	*puiActiveSum = pxHandle->uiCapActiveSumPublished;
+	*pusCount = pxHandle->usCapCountPublished;
+	*pucIdleLevel = pxHandle->ucCapIdleLevel;
+
+	vPORT_TIM_ENABLE_OVF_INTERRUPT(ucUnit);
+	vPORT_TIM_ENABLE_CC_INTERRUPT(ucUnit);
+}
+
+static uint32_t uiCapGetDuty(xHOS_PWMDutyMeasure_t* pxHandle)
+{
+	uint32_t uiPeriodSum, uiActiveSum;
+	uint16_t usCount;
+	uint8_t ucIdleLevel;
+
+	vCapRead(pxHandle, &uiPeriodSum, &uiActiveSum, &usCount, &ucIdleLevel);
+
+	/*	Idle signal (or no window completed yet)	*/
+	if (usCount == 0 || uiPeriodSum == 0)
+		return ucIdleLevel ? (uint32_t)-1 : 0;
+
+	if (uiActiveSum >= uiPeriodSum)
+		return (uint32_t)-1;
+
+	return ((uint64_t)((uint32_t)-1) * uiActiveSum) / uiPeriodSum;
+}
+
+static uint32_t uiCapGetFreq(xHOS_PWMDutyMeasure_t* pxHandle)
+{
+	uint32_t uiPeriodSum, uiActiveSum;
+	uint16_t usCount;
+	uint8_t ucIdleLevel;
+
+	vCapRead(pxHandle, &uiPeriodSum, &uiActiveSum, &usCount, &ucIdleLevel);
+
+	if (usCount == 0)
+		return 0;
+
+	if (uiPeriodSum == 0)
+		return (uint32_t)-1;
+
+	return ((uint64_t)uiCONF_PWM_MEASURE_CAPTURE_FREQ * usCount) / uiPeriodSum;
+}
+
 /*******************************************************************************
  * API functions:
  ******************************************************************************/
@@ -155,6 +299,12 @@ static void vTask(void* pvParams)
  */
 void vHOS_PWMMeasure_init(xHOS_PWMDutyMeasure_t* pxHandle)
 {
+	if (pxHandle->ucBackend == ucHOS_PWM_MEASURE_BACKEND_CAPTURE)
+	{
+		vCapInit(pxHandle);
+		return;
+	}
+
 	/*	Initialize task	*/
 	static uint8_t ucCreatedObjectsCount = 0;
 	char pcTaskName[configMAX_TASK_NAME_LEN];
@@ -212,6 +362,9 @@ uint32_t uiHOS_PWMMeasure_getDuty(xHOS_PWMDutyMeasure_t* pxHandle)
 
 	uint32_t uiDuty;
 
+	if (pxHandle->ucBackend == ucHOS_PWM_MEASURE_BACKEND_CAPTURE)
+		return uiCapGetDuty(pxHandle);
+
 	/*
 	 * Disable EXTI, to assure a new measurement won't take place in the middle
 	 * of reading handle's data.
@@ -242,6 +395,9 @@ uint32_t uiHOS_PWMMeasure_getDuty(xHOS_PWMDutyMeasure_t* pxHandle)
  */
 uint32_t uiHOS_PWMMeasure_getFreq(xHOS_PWMDutyMeasure_t* pxHandle)
 {
+	if (pxHandle->ucBackend == ucHOS_PWM_MEASURE_BACKEND_CAPTURE)
+		return uiCapGetFreq(pxHandle);
+
 	/*	Check for zero frequency	*/
 	uint64_t ulCurrentTime = ulHOS_HWTime_getTimestamp();
 	uint64_t ulTimeSinceLastEdge = ulCurrentTime - pxHandle->ulPrevRisingTime;
@@ -255,6 +255,39 @@ uint8_t ucHOS_SDC_writeCrcEnable(xHOS_SDC_t* pxSdc, uint8_t ucCrcEnable)
 	return 1;
 }
 
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_SDC_setWriteBlockEraseCount(	xHOS_SDC_t* pxSdc,
+											uint32_t uiNumberOfBlocks	)
+{
+	SDC_R1_t xR1;
+	uint8_t ucGotR1;
+
+	/*	send leading CMD55	*/
+	vHOS_SDC_sendCommand(pxSdc, 55, 0);
+
+	ucGotR1 = ucHOS_SDC_getR1(pxSdc, &xR1);
+	if (!ucGotR1)
+		return 0;
+
+	if (ucHOS_SDC_checkR1(&xR1) == 0)
+		return 0;
+
+	/*	Send ACMD23 (SET_WR_BLK_ERASE_COUNT). Argument is 23-bits wide	*/
+	vHOS_SDC_sendCommand(pxSdc, 23, uiNumberOfBlocks & 0x7FFFFF);
+
+	/*	get response (R1)	*/
+	ucGotR1 = ucHOS_SDC_getR1(pxSdc, &xR1);
+	if (!ucGotR1)
+		return 0;
+
+	if (ucHOS_SDC_checkR1(&xR1) == 0)
+		return 0;
+
+	return 1;
+}
+
 
 
 
@@ -24,61 +24,122 @@
 /*	SELF	*/
 #include "HAL/SDC/SDC_IO.h"
 
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+/*
+ * Returns address argument of a block command (Based on SDC's version).
+ *
+ * Only high capacity (v2, CCS = 1) cards are block addressed. v1, standard
+ * capacity v2 and MMC v3 cards are byte addressed (block length is 512).
+ */
+static inline uint32_t uiGetBlockAddress(xHOS_SDC_t* pxSdc, uint32_t uiBlockNumber)
+{
+	if (pxSdc->xVer == xHOS_SDC_Version_2_BlockAddress)
+		return uiBlockNumber;
+	else
+		return uiBlockNumber * 512;
+}
 
-uint8_t ucHOS_SDC_writeBlock(	xHOS_SDC_t* pxSdc,
-								xHOS_SDC_Block_Buffer_t* pxBlock,
-								TickType_t xTimeout	)
+/*
+ * Blocks until SDC releases its busy signal (MISO is held low as long as the
+ * card is busy programming).
+ *
+ * Returns 1 if SDC is no longer busy, 0 if "xEndTime" was reached.
+ */
+static uint8_t ucWaitWhileBusy(xHOS_SDC_t* pxSdc, TickType_t xEndTime)
 {
-	SDC_R1_t xR1;
-	SDC_Data_Response_t xRd;
+	uint8_t ucDummyByte;
 
-	uint8_t ucSuccessful;
-	uint8_t ucGotR1;
-	uint8_t ucGotRd;
-	uint8_t ucDummyByte = 0xFF;
-	uint32_t uiAddress;
+	while(1)
+	{
+		vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+		if (ucDummyByte == 0xFF)
+			return 1;
 
-	/*	Acquire SPI mutex	*/
-//	ucSuccessful = ucHOS_SPI_takeMutex(pxSdc->ucSpiUnitNumber, xTimeout);
-//	if (!ucSuccessful)
-//		return 0;
+		if (xTaskGetTickCount() > xEndTime)
+			return 0;
+	}
+}
 
-	/*	Get address (Based on SDC's version)	*/
-	if (pxSdc->xVer == xHOS_SDC_Version_2_BlockAddress)
-		uiAddress = pxBlock->uiLbaRead;
-	else if (pxSdc->xVer == xHOS_SDC_Version_2_ByteAddress)
-		uiAddress = pxBlock->uiLbaRead * 512;
-	else
-		uiAddress = 0;	/*	TODO: what does other versions (1, 3) do?	*/
+/*
+ * Blocks until SDC sends a data token.
+ *
+ * Returns 1 if token was received, 0 if "xEndTime" was reached.
+ */
+static uint8_t ucWaitDataToken(xHOS_SDC_t* pxSdc, TickType_t xEndTime)
+{
+	uint8_t ucDummyByte;
 
-	/*	Send CMD24	*/
-	vHOS_SDC_sendCommand(pxSdc, 24, uiAddress);
+	while(1)
+	{
+		vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+		if (ucDummyByte == 0b11111110)
+			return 1;
 
-	/*	Get R1 response	*/
-	ucGotR1 = ucHOS_SDC_getR1(pxSdc, &xR1);
-	if (ucGotR1 == 0 || ucHOS_SDC_checkR1(&xR1) == 0)
+		if (xTaskGetTickCount() > xEndTime)
+			return 0;
+	}
+}
+
+/*
+ * Receives data packet (512 bytes followed by CRC) into "pucArr", and checks
+ * its CRC (if enabled).
+ *
+ * Notes:
+ * 		-	Data token must be previously received.
+ */
+static uint8_t ucReceiveDataPacket(xHOS_SDC_t* pxSdc, uint8_t* pucArr)
+{
+	uint8_t pcCrcArr[2];
+
+	/*	Receive the data block	*/
+	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
+								ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST	);
+
+	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)pucArr, 512);
+
+	/*	Receive the CRC	*/
+	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
+								ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST	);
+
+	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)pcCrcArr, 2);
+
+	/*	Check CRC (if enabled)	*/
+	if (pxSdc->ucIsCrcEnabled)
 	{
-//		vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
-		return 0;
+		uint16_t usCrc = (pcCrcArr[1] << 8) | pcCrcArr[0];
+		if (usLIB_CRC_getCrc16(pucArr, 512) != usCrc)
+			return 0;
 	}
 
+	return 1;
+}
+
+/*
+ * Sends data packet (token, 512 bytes of "pucArr" and CRC), and receives its
+ * data response.
+ */
+static uint8_t ucSendDataPacket(xHOS_SDC_t* pxSdc, uint8_t ucToken, uint8_t* pucArr)
+{
+	SDC_Data_Response_t xRd;
+	uint8_t ucDummyByte = 0xFF;
+
 	/*	if CRC was enabled, calculate it for the block	*/
 	uint16_t usCrc = 0;
 	if (pxSdc->ucIsCrcEnabled == 1)
-		usCrc = usLIB_CRC_getCrc16(pxBlock->pucBufferr, 512);
+		usCrc = usLIB_CRC_getCrc16(pucArr, 512);
 
 	/*	wait for 1 SPI byte	*/
 	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
 
-	/**	send the data packet	**/
 	/*	send data token	*/
-	ucDummyByte = 0b11111110;
-	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)&ucToken, 1);
 
 	/*	send data block	*/
 	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
 								ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST	);
-	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)pxBlock->pucBufferr, 512);
+	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)pucArr, 512);
 
 	/*	send CRC	*/
 	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
@@ -86,8 +147,45 @@ uint8_t ucHOS_SDC_writeBlock(	xHOS_SDC_t* pxSdc,
 	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)&usCrc, 2);
 
 	/*	Get data response	*/
-	ucGotRd = ucHOS_SDC_getDataResponse(pxSdc, &xRd);
-	if (!ucGotRd || xRd.ucStatus != SDC_Data_Response_Status_Accepted)
+	if (!ucHOS_SDC_getDataResponse(pxSdc, &xRd))
+		return 0;
+
+	return (xRd.ucStatus == SDC_Data_Response_Status_Accepted);
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_SDC_writeBlock(	xHOS_SDC_t* pxSdc,
+								xHOS_SDC_Block_Buffer_t* pxBlock,
+								TickType_t xTimeout	)
+{
+	SDC_R1_t xR1;
+
+	uint8_t ucGotR1;
+
+	/*	Acquire SPI mutex	*/
+//	ucSuccessful = ucHOS_SPI_takeMutex(pxSdc->ucSpiUnitNumber, xTimeout);
+//	if (!ucSuccessful)
+//		return 0;
+
+	/*	Send CMD24	*/
+	vHOS_SDC_sendCommand(pxSdc, 24, uiGetBlockAddress(pxSdc, pxBlock->uiLbaRead));
+
+	/*	Get R1 response	*/
+	ucGotR1 = ucHOS_SDC_getR1(pxSdc, &xR1);
+	if (ucGotR1 == 0 || ucHOS_SDC_checkR1(&xR1) == 0)
+	{
+//		vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
+		return 0;
+	}
+
+	/**	send the data packet and get its data response	**/
+	if (!ucSendDataPacket(pxSdc, 0b11111110, pxBlock->pucBufferr))
 	{
 //		vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
 		return 0;
@@ -98,6 +196,9 @@ uint8_t ucHOS_SDC_writeBlock(	xHOS_SDC_t* pxSdc,
 	return 1;
 }
 
+/*
+ * See header for info.
+ */
 uint8_t ucHOS_SDC_keepTryingWriteBlock(	xHOS_SDC_t* pxSdc,
 										xHOS_SDC_Block_Buffer_t* pxBlock,
 										TickType_t xTimeout	)
@@ -132,6 +233,9 @@ uint8_t ucHOS_SDC_keepTryingWriteBlock(	xHOS_SDC_t* pxSdc,
 	return 0;
 }
 
+/*
+ * See header for info.
+ */
 uint8_t ucHOS_SDC_readBlock(	xHOS_SDC_t* pxSdc,
 								xHOS_SDC_Block_Buffer_t* pxBlock,
 								uint32_t uiBlockNumber,
@@ -139,9 +243,6 @@ uint8_t ucHOS_SDC_readBlock(	xHOS_SDC_t* pxSdc,
 {
 	SDC_R1_t xR1;
 	uint8_t ucGotR1;
-	uint8_t ucSuccessful;
-	uint8_t ucDummyByte;
-	uint32_t uiAddress;
 
 	/*	if the block requested is the one currently in buffer	*/
 	if (uiBlockNumber == pxBlock->uiLbaRead && uiBlockNumber != 0)
@@ -157,16 +258,8 @@ uint8_t ucHOS_SDC_readBlock(	xHOS_SDC_t* pxSdc,
 //	if (!ucSuccessful)
 //		return 0;
 
-	/*	Get address (Based on SDC's version)	*/
-	if (pxSdc->xVer == xHOS_SDC_Version_2_BlockAddress)
-		uiAddress = uiBlockNumber;
-	else if (pxSdc->xVer == xHOS_SDC_Version_2_ByteAddress)
-		uiAddress = uiBlockNumber * 512;
-	else
-		uiAddress = 0;	/*	TODO: what does other versions (1, 3) do?	*/
-
 	/*	Send CMD17	*/
-	vHOS_SDC_sendCommand(pxSdc, 17, uiAddress);
+	vHOS_SDC_sendCommand(pxSdc, 17, uiGetBlockAddress(pxSdc, uiBlockNumber));
 
 	/*	Get R1 response	*/
 	ucGotR1 = ucHOS_SDC_getR1(pxSdc, &xR1);
@@ -177,43 +270,17 @@ uint8_t ucHOS_SDC_readBlock(	xHOS_SDC_t* pxSdc,
 	}
 
 	/*	wait for the data token (0b11111110) to be received	*/
-	while(1)
+	if (!ucWaitDataToken(pxSdc, xEndTime))
 	{
-		vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
-		if (ucDummyByte == 0b11111110)
-			break;
-
-		if (xTaskGetTickCount() > xEndTime)
-		{
-			vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
-			return 0;
-		}
+//		vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
+		return 0;
 	}
 
-	/*	Receive the data block	*/
-	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
-								ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST	);
-
-	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)pxBlock->pucBufferr, 512);
-
-	/*	Receive the CRC	*/
-	uint8_t pcCrcArr[2];
-
-	vHOS_SPI_setByteDirection(	pxSdc->ucSpiUnitNumber,
-								ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST	);
-
-	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, pcCrcArr, 2);
-
-	uint16_t usCrc = (pcCrcArr[1] << 8) | pcCrcArr[0];
-	/*	Check CRC (if enabled)	*/
-	if (pxSdc->ucIsCrcEnabled)
+	/*	Receive the data block and check its CRC (if enabled)	*/
+	if (!ucReceiveDataPacket(pxSdc, pxBlock->pucBufferr))
 	{
-		uint16_t usCrcCalc = usLIB_CRC_getCrc16(pxBlock->pucBufferr, 512);
-		if (usCrcCalc != usCrc)
-		{
-//			vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
-			return 0;
-		}
+//		vHOS_SPI_releaseMutex(pxSdc->ucSpiUnitNumber);
+		return 0;
 	}
 
 	pxBlock->uiLbaRead = uiBlockNumber;
@@ -224,6 +291,9 @@ uint8_t ucHOS_SDC_readBlock(	xHOS_SDC_t* pxSdc,
 	return 1;
 }
 
+/*
+ * See header for info.
+ */
 uint8_t ucHOS_SDC_keepTryingReadBlock(	xHOS_SDC_t* pxSdc,
 										xHOS_SDC_Block_Buffer_t* pxBlock,
 										uint32_t uiBlockNumber,
@@ -259,3 +329,142 @@ uint8_t ucHOS_SDC_keepTryingReadBlock(	xHOS_SDC_t* pxSdc,
 
 	return 0;
 }
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_SDC_readMultipleBlocks(	xHOS_SDC_t* pxSdc,
+										uint8_t* pucArr,
+										uint32_t uiFirstBlockNumber,
+										uint32_t uiNumberOfBlocks,
+										TickType_t xTimeout	)
+{
+	SDC_R1_t xR1;
+	uint8_t ucDummyByte;
+	uint8_t ucSuccessful = 1;
+
+	TickType_t xCurrentTime = xTaskGetTickCount();
+	TickType_t xEndTime = xCurrentTime + xTimeout;
+	if (xTimeout == portMAX_DELAY || xEndTime < xCurrentTime)
+		xEndTime = portMAX_DELAY;
+
+	/*	Send CMD18 (READ_MULTIPLE_BLOCK)	*/
+	vHOS_SDC_sendCommand(	pxSdc,
+							18,
+							uiGetBlockAddress(pxSdc, uiFirstBlockNumber)	);
+
+	/*	Get R1 response	*/
+	if (!ucHOS_SDC_getR1(pxSdc, &xR1) || !ucHOS_SDC_checkR1(&xR1))
+		return 0;
+
+	/*	Receive data packets back to back	*/
+	for (uint32_t i = 0; i < uiNumberOfBlocks; i++)
+	{
+		ucSuccessful = ucWaitDataToken(pxSdc, xEndTime);
+		if (!ucSuccessful)
+			break;
+
+		ucSuccessful = ucReceiveDataPacket(pxSdc, &pucArr[512 * i]);
+		if (!ucSuccessful)
+			break;
+	}
+
+	/*
+	 * Send CMD12 (STOP_TRANSMISSION). Byte following it is a stuff byte, and
+	 * response is R1b.
+	 */
+	vHOS_SDC_sendCommand(pxSdc, 12, 0);
+
+	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+
+	if (!ucHOS_SDC_getR1(pxSdc, &xR1) || !ucHOS_SDC_checkR1(&xR1))
+		return 0;
+
+	if (!ucWaitWhileBusy(pxSdc, xEndTime))
+		return 0;
+
+	return ucSuccessful;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_SDC_writeMultipleBlocks(	xHOS_SDC_t* pxSdc,
+										uint8_t* pucArr,
+										uint32_t uiFirstBlockNumber,
+										uint32_t uiNumberOfBlocks,
+										TickType_t xTimeout	)
+{
+	SDC_R1_t xR1;
+	uint8_t ucDummyByte;
+	uint8_t ucSuccessful = 1;
+
+	TickType_t xCurrentTime = xTaskGetTickCount();
+	TickType_t xEndTime = xCurrentTime + xTimeout;
+	if (xTimeout == portMAX_DELAY || xEndTime < xCurrentTime)
+		xEndTime = portMAX_DELAY;
+
+#if configHOS_SDC_PRE_ERASE_EN
+	/*
+	 * Hint the SDC with number of blocks to be written (ACMD23). This is only a
+	 * performance hint, hence its failure is not an error.
+	 */
+	ucHOS_SDC_setWriteBlockEraseCount(pxSdc, uiNumberOfBlocks);
+#endif
+
+	/*	Send CMD25 (WRITE_MULTIPLE_BLOCK)	*/
+	vHOS_SDC_sendCommand(	pxSdc,
+							25,
+							uiGetBlockAddress(pxSdc, uiFirstBlockNumber)	);
+
+	/*	Get R1 response	*/
+	if (!ucHOS_SDC_getR1(pxSdc, &xR1) || !ucHOS_SDC_checkR1(&xR1))
+		return 0;
+
+	/*	Send data packets, each is followed by SDC's busy period	*/
+	uint8_t ucIsDataRejected = 0;
+	for (uint32_t i = 0; i < uiNumberOfBlocks; i++)
+	{
+		ucSuccessful = ucSendDataPacket(pxSdc, 0b11111100, &pucArr[512 * i]);
+		if (!ucSuccessful)
+		{
+			ucIsDataRejected = 1;
+			break;
+		}
+
+		ucSuccessful = ucWaitWhileBusy(pxSdc, xEndTime);
+		if (!ucSuccessful)
+			break;
+	}
+
+	/*
+	 * If a data packet was rejected (CRC or write error), terminate the
+	 * transaction by CMD12 (STOP_TRANSMISSION), as recommended by the spec.
+	 * Byte following it is a stuff byte, and response is R1b.
+	 */
+	if (ucIsDataRejected)
+	{
+		ucWaitWhileBusy(pxSdc, xEndTime);
+
+		vHOS_SDC_sendCommand(pxSdc, 12, 0);
+
+		vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+
+		ucHOS_SDC_getR1(pxSdc, &xR1);
+
+		ucWaitWhileBusy(pxSdc, xEndTime);
+
+		return 0;
+	}
+
+	/*	Send "Stop Tran" token, followed by a byte before busy signal starts	*/
+	ucDummyByte = 0b11111101;
+	vHOS_SPI_send(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+
+	vHOS_SPI_receive(pxSdc->ucSpiUnitNumber, (int8_t*)&ucDummyByte, 1);
+
+	if (!ucWaitWhileBusy(pxSdc, xEndTime))
+		return 0;
+
+	return ucSuccessful;
+}
@@ -26,6 +26,234 @@
 /*	SELF	*/
 #include "HAL/SDC/SDC_Stream.h"
 
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+/*
+ * Gets cluster number of a cluster given its index in the stream's cluster chain.
+ *
+ * Returns 0xFFFFFFFF if the index is outside the chain.
+ *
+ * Notes:
+ * 		-	Clusters inside the cached extents are resolved using binary search.
+ *
+ * 		-	Otherwise, FAT is followed starting by the closest known cluster,
+ * 			which is the last resolved one in case of sequential access. Followed
+ * 			clusters are added to the cache (while there's room for new extents).
+ */
+static uint32_t uiGetClusterNumber(	xHOS_SDC_Stream_t* pxStream,
+									uint32_t uiClusterIndex	)
+{
+	xHOS_SDC_Extent_t* pxExtentArr = pxStream->pxExtentArr;
+	xHOS_SDC_Extent_t* pxExtent;
+	uint32_t uiIndex, uiNumber, uiNextNumber;
+
+	/*	If it is the last resolved cluster	*/
+	if (uiClusterIndex == pxStream->uiLastClusterIndex)
+		return pxStream->uiLastClusterNumber;
+
+	/*	If it is in the cached extents, binary search for its extent	*/
+	if (uiClusterIndex < pxStream->uiNumberOfCachedClusters)
+	{
+		uint32_t uiLow = 0;
+		uint32_t uiHigh = pxStream->uiNumberOfExtents - 1;
+		uint32_t uiMid;
+		while(uiLow < uiHigh)
+		{
+			uiMid = (uiLow + uiHigh + 1) / 2;
+			if (pxExtentArr[uiMid].uiFirstClusterIndex <= uiClusterIndex)
+				uiLow = uiMid;
+			else
+				uiHigh = uiMid - 1;
+		}
+
+		pxExtent = &pxExtentArr[uiLow];
+		uiNumber =
+			pxExtent->uiFirstClusterNumber +
+			(uiClusterIndex - pxExtent->uiFirstClusterIndex);
+	}
+
+	/*	Otherwise, follow the FAT starting by the closest known cluster	*/
+	else
+	{
+		pxExtent = &pxExtentArr[pxStream->uiNumberOfExtents - 1];
+		uiIndex = pxStream->uiNumberOfCachedClusters - 1;
+		uiNumber = pxExtent->uiFirstClusterNumber + pxExtent->uiNumberOfClusters - 1;
+
+		if (	pxStream->uiLastClusterIndex > uiIndex &&
+				pxStream->uiLastClusterIndex < uiClusterIndex	)
+		{
+			uiIndex = pxStream->uiLastClusterIndex;
+			uiNumber = pxStream->uiLastClusterNumber;
+		}
+
+		while(uiIndex < uiClusterIndex)
+		{
+			uiNextNumber = uiHOS_SDC_getNextClusterNumber(pxStream->pxSdc, uiNumber);
+			if (uiNextNumber == 0xFFFFFFFF)
+				return 0xFFFFFFFF;
+
+			uiIndex++;
+
+			/*	Add it to the cache, if it is the first un-cached cluster	*/
+			if (uiIndex == pxStream->uiNumberOfCachedClusters)
+			{
+				pxExtent = &pxExtentArr[pxStream->uiNumberOfExtents - 1];
+
+				if (uiNextNumber == uiNumber + 1)
+				{
+					pxExtent->uiNumberOfClusters++;
+					pxStream->uiNumberOfCachedClusters++;
+				}
+
+				else if (pxStream->uiNumberOfExtents < configHOS_SDC_STREAM_EXTENT_CACHE_SIZE)
+				{
+					pxExtent++;
+					pxExtent->uiFirstClusterIndex = uiIndex;
+					pxExtent->uiFirstClusterNumber = uiNextNumber;
+					pxExtent->uiNumberOfClusters = 1;
+					pxStream->uiNumberOfExtents++;
+					pxStream->uiNumberOfCachedClusters++;
+				}
+			}
+
+			uiNumber = uiNextNumber;
+		}
+	}
+
+	pxStream->uiLastClusterIndex = uiClusterIndex;
+	pxStream->uiLastClusterNumber = uiNumber;
+
+	return uiNumber;
+}
+
+/*
+ * Gets LBA of the sector at "uiSectorsOffset" from start of the stream, and
+ * returns number of sectors (starting by it, and up to "uiMaxCount") which are
+ * physically contiguous on the SD-card.
+ *
+ * Returns 0 if the sector is outside the file's cluster chain.
+ */
+static uint32_t uiGetContiguousSectors(	xHOS_SDC_Stream_t* pxStream,
+										uint32_t uiSectorsOffset,
+										uint32_t uiMaxCount,
+										uint32_t* puiLba	)
+{
+	xHOS_SDC_t* pxSdc = pxStream->pxSdc;
+	uint32_t uiNextClusterNumber;
+
+	/*	Get cluster number of the first sector	*/
+	uint32_t uiClusterIndex = uiSectorsOffset / pxSdc->ucSectorsPerCluster;
+	uint32_t uiClusterNumber = uiGetClusterNumber(pxStream, uiClusterIndex);
+
+	if (uiClusterNumber == 0xFFFFFFFF)
+		return 0;
+
+	*puiLba =
+		uiHOS_SDC_getClusterLba(pxSdc, uiClusterNumber) +
+		uiSectorsOffset % pxSdc->ucSectorsPerCluster;
+
+	/*	Count sectors until end of the cluster run	*/
+	uint32_t uiCount =
+		pxSdc->ucSectorsPerCluster - uiSectorsOffset % pxSdc->ucSectorsPerCluster;
+
+	while(uiCount < uiMaxCount)
+	{
+		uiClusterIndex++;
+		uiNextClusterNumber = uiGetClusterNumber(pxStream, uiClusterIndex);
+
+		if (uiNextClusterNumber != uiClusterNumber + 1)
+			break;
+
+		uiClusterNumber = uiNextClusterNumber;
+		uiCount += pxSdc->ucSectorsPerCluster;
+	}
+
+	if (uiCount > uiMaxCount)
+		uiCount = uiMaxCount;
+
+	return uiCount;
+}
+
+/*
+ * If at least "configHOS_SDC_MULTI_BLOCK_MIN_SECTORS" contiguous whole sectors
+ * are requested, starting at "uiSectorsOffset", they are read (or written if
+ * "ucIsWrite" is 1) directly between the SD-card and "pucArr" using a single
+ * multiple block command.
+ *
+ * Returns number of sectors transferred (0 if request was not suitable for a
+ * multiple block transfer), or 0xFFFFFFFF if transfer failed.
+ *
+ * Notes:
+ * 		-	Stream's buffer is kept coherent. If it is modified and going to be
+ * 			read, it is saved first. If it is going to be overwritten, it is
+ * 			invalidated.
+ */
+static uint32_t uiTransferMultipleSectors(	xHOS_SDC_Stream_t* pxStream,
+											uint32_t uiSectorsOffset,
+											uint8_t* pucArr,
+											uint32_t uiMaxCount,
+											uint8_t ucIsWrite,
+											TickType_t xTimeout	)
+{
+	uint8_t ucSuccessfull;
+	uint32_t uiLba;
+	uint32_t uiCount;
+
+	if (uiMaxCount < configHOS_SDC_MULTI_BLOCK_MIN_SECTORS)
+		return 0;
+
+	uiCount = uiGetContiguousSectors(pxStream, uiSectorsOffset, uiMaxCount, &uiLba);
+
+	if (uiCount < configHOS_SDC_MULTI_BLOCK_MIN_SECTORS)
+		return 0;
+
+	/*	Keep stream's buffer coherent	*/
+	uint32_t uiBufferLba = pxStream->xBuffer.uiLbaRead;
+	if (uiLba <= uiBufferLba && uiBufferLba < uiLba + uiCount)
+	{
+		if (ucIsWrite)
+		{
+			/*	Buffered sector is going to be overwritten, invalidate it	*/
+			pxStream->xBuffer.uiLbaRead = 0;
+			pxStream->xBuffer.ucIsModified = 0;
+		}
+
+		else if (pxStream->xBuffer.ucIsModified)
+		{
+			ucSuccessfull = ucHOS_SDC_saveCurrentBuffer(pxStream, xTimeout);
+			if (!ucSuccessfull)
+				return 0xFFFFFFFF;
+		}
+	}
+
+	if (ucIsWrite)
+	{
+		ucSuccessfull = ucHOS_SDC_writeMultipleBlocks(	pxStream->pxSdc,
+														pucArr,
+														uiLba,
+														uiCount,
+														xTimeout	);
+	}
+
+	else
+	{
+		ucSuccessfull = ucHOS_SDC_readMultipleBlocks(	pxStream->pxSdc,
+														pucArr,
+														uiLba,
+														uiCount,
+														xTimeout	);
+	}
+
+	if (!ucSuccessfull)
+		return 0xFFFFFFFF;
+
+	return uiCount;
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
 /*
  * See header for info.
  */
@@ -63,6 +291,15 @@ uint8_t ucHOS_SDC_openStream(	xHOS_SDC_Stream_t* pxStream,
 		((uint32_t)pxDirData->usFirstClusterHigh << 16) |
 		(uint32_t)pxDirData->usFirstClusterLow;
 
+	/*	Initialize cluster chain cache by the first cluster	*/
+	pxStream->pxExtentArr[0].uiFirstClusterIndex = 0;
+	pxStream->pxExtentArr[0].uiFirstClusterNumber = pxStream->uiFirstClusterNumber;
+	pxStream->pxExtentArr[0].uiNumberOfClusters = 1;
+	pxStream->uiNumberOfExtents = 1;
+	pxStream->uiNumberOfCachedClusters = 1;
+	pxStream->uiLastClusterIndex = 0;
+	pxStream->uiLastClusterNumber = pxStream->uiFirstClusterNumber;
+
 	/*	Get LBA of this cluster	*/
 	pxStream->uiStartLba = uiHOS_SDC_getClusterLba(
 		pxStream->pxSdc,
@@ -127,6 +364,20 @@ uint8_t ucHOS_SDC_saveCurrentBuffer(	xHOS_SDC_Stream_t* pxStream,
 {
 	uint8_t ucSuccessfull;
 
+	/*
+	 * If buffer was not modified (or was invalidated by a multiple sector write),
+	 * there's nothing to save.
+	 */
+	if (!pxStream->xBuffer.ucIsModified)
+		return 1;
+
+	/*
+	 * Never write a buffer that is outside the data region (i.e.: an
+	 * invalidated buffer, which would otherwise overwrite LBA 0 - the MBR).
+	 */
+	if (pxStream->xBuffer.uiLbaRead < pxStream->pxSdc->uiClustersBeginLba)
+		return 1;
+
 	/*	Get cluster index of the sector to be buffered	*/
 	uint32_t uiBufferOffset = pxStream->xBuffer.uiLbaRead - pxStream->uiStartLba;
 
@@ -134,8 +385,7 @@ uint8_t ucHOS_SDC_saveCurrentBuffer(	xHOS_SDC_Stream_t* pxStream,
 		uiBufferOffset / pxStream->pxSdc->ucSectorsPerCluster;
 
 	/*	Get cluster number of this cluster index	*/
-	uint32_t uiClusterNumber = uiHOS_SDC_getClusterNumber(
-		pxStream->pxSdc, pxStream->uiFirstClusterNumber, uiClusterIndex	);
+	uint32_t uiClusterNumber = uiGetClusterNumber(pxStream, uiClusterIndex);
 
 	if (uiClusterNumber == 0xFFFFFFFF)
 		return 0;
@@ -151,6 +401,8 @@ uint8_t ucHOS_SDC_saveCurrentBuffer(	xHOS_SDC_Stream_t* pxStream,
 	if (!ucSuccessfull)
 		return 0;
 
+	pxStream->xBuffer.ucIsModified = 0;
+
 	return 1;
 }
 
@@ -168,10 +420,7 @@ uint8_t ucHOS_SDC_readSector(	xHOS_SDC_Stream_t* pxStream,
 		uiSectorsOffset / pxStream->pxSdc->ucSectorsPerCluster;
 
 	/*	Get cluster number of this cluster index	*/
-	uint32_t uiClusterNumber = uiHOS_SDC_getClusterNumber(
-		pxStream->pxSdc,
-		pxStream->uiFirstClusterNumber,
-		uiClusterIndex	);
+	uint32_t uiClusterNumber = uiGetClusterNumber(pxStream, uiClusterIndex);
 
 	if (uiClusterNumber == 0xFFFFFFFF)
 		return 0;
@@ -278,9 +527,16 @@ uint8_t ucHOS_SDC_readStream(	xHOS_SDC_Stream_t* pxStream,
 
 	TickType_t xEndTime = xTaskGetTickCount() + xTimeout;
 
-	ucSccessfull = ucHOS_SDC_updateBbuffer(pxStream, uiOffset, xTimeout);
-	if (!ucSccessfull)
-		return 0;
+	/*
+	 * If "uiOffset" is sector aligned, buffer update (or multiple sector
+	 * transfer) is done inside the following loop.
+	 */
+	if (uiOffset % 512 != 0)
+	{
+		ucSccessfull = ucHOS_SDC_updateBbuffer(pxStream, uiOffset, xTimeout);
+		if (!ucSccessfull)
+			return 0;
+	}
 
 	/*
 	 * Program will copy from "stream->buffer" and break when it reaches its end,
@@ -288,6 +544,7 @@ uint8_t ucHOS_SDC_readStream(	xHOS_SDC_Stream_t* pxStream,
 	 * will take place before continuing.
 	 */
 	uint32_t i = 0;
+	uint32_t uiCount;
 	while(1)
 	{
 		if (i == uiLen)
@@ -295,6 +552,23 @@ uint8_t ucHOS_SDC_readStream(	xHOS_SDC_Stream_t* pxStream,
 
 		if ((uiOffset+i) % 512 == 0)
 		{
+			/*	Read whole contiguous sectors (if any) directly into "pucArr"	*/
+			uiCount = uiTransferMultipleSectors(	pxStream,
+													(uiOffset + i) / 512,
+													&pucArr[i],
+													(uiLen - i) / 512,
+													0,
+													xEndTime - xTaskGetTickCount()	);
+
+			if (uiCount == 0xFFFFFFFF)
+				return 0;
+
+			if (uiCount != 0)
+			{
+				i += uiCount * 512;
+				continue;
+			}
+
 			ucSccessfull = ucHOS_SDC_updateBbuffer(
 				pxStream,
 				uiOffset + i,
@@ -369,9 +643,16 @@ uint8_t ucHOS_SDC_writeStream(	xHOS_SDC_Stream_t* pxStream,
 
 	TickType_t xEndTime = xTaskGetTickCount() + xTimeout;
 
-	ucSuccessfull = ucHOS_SDC_updateBbuffer(pxStream, uiOffset, xTimeout);
-	if (!ucSuccessfull)
-		return 0;
+	/*
+	 * If "uiOffset" is sector aligned, buffer update (or multiple sector
+	 * transfer) is done inside the following loop.
+	 */
+	if (uiOffset % 512 != 0)
+	{
+		ucSuccessfull = ucHOS_SDC_updateBbuffer(pxStream, uiOffset, xTimeout);
+		if (!ucSuccessfull)
+			return 0;
+	}
 
 	/*
 	 * Program will copy to "stream->buffer" and break when it reaches its end,
@@ -379,6 +660,7 @@ uint8_t ucHOS_SDC_writeStream(	xHOS_SDC_Stream_t* pxStream,
 	 * will take place before continuing.
 	 */
 	uint32_t i = 0;
+	uint32_t uiCount;
 	while(1)
 	{
 		if (i == uiLen)
@@ -386,7 +668,22 @@ uint8_t ucHOS_SDC_writeStream(	xHOS_SDC_Stream_t* pxStream,
 
 		if ((uiOffset+i) % 512 == 0)
 		{
-			pxStream->xBuffer.ucIsModified = 1;
+			/*	Write whole contiguous sectors (if any) directly from "pucArr"	*/
+			uiCount = uiTransferMultipleSectors(	pxStream,
+													(uiOffset + i) / 512,
+													&pucArr[i],
+													(uiLen - i) / 512,
+													1,
+													xEndTime - xTaskGetTickCount()	);
+
+			if (uiCount == 0xFFFFFFFF)
+				return 0;
+
+			if (uiCount != 0)
+			{
+				i += uiCount * 512;
+				continue;
+			}
 
 			ucSuccessfull = ucHOS_SDC_updateBbuffer(
 				pxStream,
@@ -398,10 +695,9 @@ uint8_t ucHOS_SDC_writeStream(	xHOS_SDC_Stream_t* pxStream,
 		}
 
 		pxStream->xBuffer.pucBufferr[(uiOffset+i) % 512] = pucArr[i];
+		pxStream->xBuffer.ucIsModified = 1;
 		i++;
 	}
-
-	pxStream->xBuffer.ucIsModified = 1;
 }
 
 /*
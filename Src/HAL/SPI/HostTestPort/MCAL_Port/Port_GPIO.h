@@ -0,0 +1,15 @@
+/*
+ * Port_GPIO.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the GPIO port, used only by "SPI_Test.c". "SPI_V1.c"
+ * includes the GPIO port, but does not use it.
+ */
+
+#ifndef COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_GPIO_H_
+#define COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_GPIO_H_
+
+
+
+#endif /* COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_GPIO_H_ */
@@ -0,0 +1,25 @@
+/*
+ * Port_Interrupt.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the interrupt port, used only by "SPI_Test.c".
+ * Interrupts are "raised" by the test calling the registered callbacks, so NVIC
+ * settings are ignored.
+ */
+
+#ifndef COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_INTERRUPT_H_
+#define COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_INTERRUPT_H_
+
+#include <stdint.h>
+
+extern const uint8_t pxPortInterruptSpiTxeIrqNumberArr[];
+extern const uint8_t pxPortInterruptSpiRxneIrqNumberArr[];
+
+#define vPORT_INTERRUPT_ENABLE_IRQ(ucIRQNumber)				((void)(ucIRQNumber))
+
+#define VPORT_INTERRUPT_SET_PRIORITY(ucIRQNumber, ucPri)	((void)(ucIRQNumber), (void)(ucPri))
+
+
+
+#endif /* COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_INTERRUPT_H_ */
@@ -0,0 +1,167 @@
+/*
+ * Port_SPI.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the SPI port, used only by "SPI_Test.c".
+ *
+ * A unit is a plain structure: interrupt enables, DMA request connections, the
+ * Tx buffer, the shift register, the Rx buffer, and the registered callbacks.
+ * The test simulates the hardware (and the slave on the bus) by moving bytes
+ * between them, and calling the callbacks while the matching interrupts are
+ * enabled. It defines "pxHostPortSpiArr[]".
+ */
+
+#ifndef COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_SPI_H_
+#define COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_SPI_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+typedef struct{
+	/*	Callbacks and their parameters	*/
+	void (*pfTxeCallback)(void*);
+	void* pvTxeCallbackParams;
+	void (*pfRxneCallback)(void*);
+	void* pvRxneCallbackParams;
+
+	/*	Interrupt enables	*/
+	uint8_t ucIsTxeInterruptEnabled;
+	uint8_t ucIsRxneInterruptEnabled;
+
+	/*	Are TxE and RxNE connected to DMA requests	*/
+	uint8_t ucIsTxeConnectedToDma;
+	uint8_t ucIsRxneConnectedToDma;
+
+	/*	Tx buffer, shift register and Rx buffer, and whether they hold a byte	*/
+	uint8_t ucTxBuffer;
+	uint8_t ucIsTxBufferFull;
+	uint8_t ucShiftRegister;
+	uint8_t ucIsShifting;
+	uint8_t ucRxBuffer;
+	uint8_t ucIsRxBufferFull;
+
+	/*	Data register address given to DMA (reads Rx, writes Tx)	*/
+	uint8_t ucDr;
+}xHostPort_SPI_t;
+
+/*	Number of units available in the stand-in target	*/
+#define portSPI_NUMBER_OF_UNITS				1
+
+#define portSPI_IS_DMA_STATIC_CONNECTED		1
+
+extern const uint8_t ppucPortSpiTxeDmaMapping[portSPI_NUMBER_OF_UNITS][2];
+extern const uint8_t ppucPortSpiRxneDmaMapping[portSPI_NUMBER_OF_UNITS][2];
+
+extern xHostPort_SPI_t pxHostPortSpiArr[portSPI_NUMBER_OF_UNITS];
+
+/*	Counts writes to a full Tx buffer (byte lost)	*/
+extern uint32_t uiHostPortSpiTxOverwriteCount;
+
+static inline void vPORT_SPI_enableTxeInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsTxeInterruptEnabled = 1;
+}
+
+static inline void vPORT_SPI_disableTxeInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsTxeInterruptEnabled = 0;
+}
+
+static inline void vPORT_SPI_enableRxneInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsRxneInterruptEnabled = 1;
+}
+
+static inline void vPORT_SPI_disableRxneInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsRxneInterruptEnabled = 0;
+}
+
+/*	Reading DR clears RxNE	*/
+static inline void vPORT_SPI_clearRxneFlag(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsRxBufferFull = 0;
+}
+
+static inline void vPort_SPI_setTxeCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortSpiArr[ucUnitNumber].pfTxeCallback = pfCallback;
+	pxHostPortSpiArr[ucUnitNumber].pvTxeCallbackParams = pvParams;
+}
+
+static inline void vPort_SPI_setRxneCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortSpiArr[ucUnitNumber].pfRxneCallback = pfCallback;
+	pxHostPortSpiArr[ucUnitNumber].pvRxneCallbackParams = pvParams;
+}
+
+/*
+ * Busy while a byte is in the Tx buffer or being shifted. Polling it takes
+ * time, so the simulated hardware runs a step on every poll.
+ */
+static inline uint8_t ucPort_SPI_isBusy(uint8_t ucUnitNumber)
+{
+	if (ucHOST_TEST_STUB_onBlock != NULL)
+		ucHOST_TEST_STUB_onBlock();
+
+	return	pxHostPortSpiArr[ucUnitNumber].ucIsTxBufferFull	||
+			pxHostPortSpiArr[ucUnitNumber].ucIsShifting;
+}
+
+static inline void vPort_SPI_writeDataNoWait(uint8_t ucUnitNumber, uint8_t ucByte)
+{
+	if (pxHostPortSpiArr[ucUnitNumber].ucIsTxBufferFull)
+		uiHostPortSpiTxOverwriteCount++;
+
+	pxHostPortSpiArr[ucUnitNumber].ucTxBuffer = ucByte;
+	pxHostPortSpiArr[ucUnitNumber].ucIsTxBufferFull = 1;
+}
+
+static inline uint8_t ucPort_SPI_readDataNoWait(uint8_t ucUnitNumber)
+{
+	pxHostPortSpiArr[ucUnitNumber].ucIsRxBufferFull = 0;
+	return pxHostPortSpiArr[ucUnitNumber].ucRxBuffer;
+}
+
+static inline void* pvPort_SPI_getDrAddress(uint8_t ucUnitNumber)
+{
+	return (void*)&pxHostPortSpiArr[ucUnitNumber].ucDr;
+}
+
+static inline void vPort_SPI_connectTxeToDma(	uint8_t ucSpiUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	(void)ucDmaUnitNumber;
+	(void)ucDmaChannelNumber;
+	pxHostPortSpiArr[ucSpiUnitNumber].ucIsTxeConnectedToDma = 1;
+}
+
+static inline void vPort_SPI_disconnectTxeFromDma(uint8_t ucSpiUnitNumber)
+{
+	pxHostPortSpiArr[ucSpiUnitNumber].ucIsTxeConnectedToDma = 0;
+}
+
+static inline void vPort_SPI_connectRxneToDma(	uint8_t ucSpiUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	(void)ucDmaUnitNumber;
+	(void)ucDmaChannelNumber;
+	pxHostPortSpiArr[ucSpiUnitNumber].ucIsRxneConnectedToDma = 1;
+}
+
+static inline void vPort_SPI_disconnectRxneFromDma(uint8_t ucSpiUnitNumber)
+{
+	pxHostPortSpiArr[ucSpiUnitNumber].ucIsRxneConnectedToDma = 0;
+}
+
+
+
+#endif /* COTS_OS_SRC_HAL_SPI_HOSTTESTPORT_PORT_SPI_H_ */
@@ -0,0 +1,483 @@
+/*
+ * SPI_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the SPI driver, on a stand-in port
+ * ("HostTestPort" directory).
+ *
+ * The test simulates the hardware: a byte written to the Tx buffer (by the
+ * driver or by the simulated DMA) moves to the shift register, is appended to
+ * a "wire" array, and the slave's reply to it lands in the Rx buffer. The
+ * driver's callbacks are called while their interrupts are enabled, and the
+ * simulated DMA channels move bytes while their unit's requests are connected.
+ * Simulation runs whenever the driver blocks or polls the busy flag (see
+ * "ucHOST_TEST_STUB_onBlock()" in "Src/LIB/HostTestStubs").
+ *
+ * It checks, for both byte directions, and for send, transceive, receive and
+ * send multiple operations, that:
+ * 		-	Bytes on the wire are the sent array (in the configured byte
+ * 			direction), or 0xFF for receive.
+ *
+ * 		-	Received array is the slave's reply, with no byte lost.
+ *
+ * 		-	The operation returns only after the last byte is shifted on the bus,
+ * 			and signals end of transfer.
+ *
+ * 		-	No byte is written to a full Tx buffer.
+ *
+ * 		-	(DMA variant) Channels are the mapped ones, and are released after
+ * 			every operation. A TC flag left by a previous user does not end a
+ * 			transfer early.
+ *
+ * Then it prints, for send, transceive and receive operations of different
+ * transfer sizes, the number of interrupts per transfer (which is what loads
+ * the CPU on target), and host throughput of the driver's code path in MB/s.
+ *
+ * It is built for both variants, and run from repository's root directory as
+ * follows (portDMA_IS_AVAILABLE: 0 for "SPI_V1.c", 1 for "SPI_V2.c"):
+ *
+ * 		gcc -O2 -DHAL_SPI_HOST_TEST -DportDMA_IS_AVAILABLE=1 \
+ * 			-ISrc/HAL/SPI/HostTestPort -ISrc/LIB/HostTestStubs -IInc \
+ * 			Src/HAL/SPI/SPI_V1.c Src/HAL/SPI/SPI_V2.c Src/HAL/SPI/SPI_Test.c \
+ * 			-o spi_test
+ *
+ * 		./spi_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_SPI_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*	FreeRTOS (stubs)	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (stand-in port)	*/
+#include "MCAL_Port/Port_SPI.h"
+#include "MCAL_Port/Port_DMA.h"
+
+/*	HAL	*/
+#include "HAL/DMA/DMA.h"
+#include "HAL/SPI/SPI.h"
+
+#define uiWIRE_SIZE					(4 * 1024)
+#define uiMAX_TRANSFER_SIZE			600
+#define uiNUMBER_OF_TRANSFERS		2000
+#define uiBENCHMARK_BYTES			(1024 * 1024)
+
+/*******************************************************************************
+ * Stand-in port and simulated hardware:
+ ******************************************************************************/
+xHostPort_SPI_t pxHostPortSpiArr[portSPI_NUMBER_OF_UNITS];
+
+uint32_t uiHostPortSpiTxOverwriteCount;
+
+const uint8_t ppucPortSpiTxeDmaMapping[portSPI_NUMBER_OF_UNITS][2] = {
+	{0, 2}
+};
+
+const uint8_t ppucPortSpiRxneDmaMapping[portSPI_NUMBER_OF_UNITS][2] = {
+	{0, 1}
+};
+
+const uint8_t pxPortInterruptSpiTxeIrqNumberArr[] = {0};
+const uint8_t pxPortInterruptSpiRxneIrqNumberArr[] = {0};
+
+static xHostPort_SPI_t* const pxSpi = &pxHostPortSpiArr[0];
+
+/*	Bytes shifted out by the unit (MOSI)	*/
+static uint8_t pucWireArr[uiWIRE_SIZE];
+static uint32_t uiWireLen;
+
+/*	Number of interrupts taken	*/
+static uint32_t uiIsrCount;
+
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiIndex)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, index: %u\n", pcName, uiIndex);
+		uiNumberOfFailures++;
+	}
+}
+
+/*	Slave's reply (MISO) to the i-th byte on the wire	*/
+static uint8_t ucSlaveReply(uint32_t i)
+{
+	return (uint8_t)(i * 13 + 7);
+}
+
+#if portDMA_IS_AVAILABLE
+
+/*	Simulated DMA channels	*/
+typedef struct{
+	uint8_t ucIsLocked;
+	uint8_t ucIsActive;
+	uint8_t ucTcFlag;
+	xHOS_DMA_TransInfo_t xInfo;
+
+	/*	Number of bytes transferred	*/
+	uint32_t uiCount;
+}xHostDmaChannel_t;
+
+static xHostDmaChannel_t pxDmaArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+
+static xHostDmaChannel_t* const pxTxDma = &pxDmaArr[2];
+static xHostDmaChannel_t* const pxRxDma = &pxDmaArr[1];
+
+uint8_t ucHOS_DMA_lockChannel(	uint8_t ucUnitNumber,
+								uint8_t ucChannelNumber,
+								TickType_t xTimeout	)
+{
+	(void)xTimeout;
+	vCheck(	ucUnitNumber == 0 &&
+			(	ucChannelNumber == ppucPortSpiTxeDmaMapping[0][1] ||
+				ucChannelNumber == ppucPortSpiRxneDmaMapping[0][1]	),
+			"locked channel is a mapped one", ucChannelNumber	);
+	vCheck(!pxDmaArr[ucChannelNumber].ucIsLocked, "channel locked once", ucChannelNumber);
+	pxDmaArr[ucChannelNumber].ucIsLocked = 1;
+	return 1;
+}
+
+uint8_t ucHOS_DMA_lockAnyChannel(	uint8_t* pucUnitNumber,
+									uint8_t* pucChannelNumber,
+									TickType_t xTimeout	)
+{
+	/*	Not used, as the stand-in port is static connected	*/
+	(void)pucUnitNumber;
+	(void)pucChannelNumber;
+	(void)xTimeout;
+	vCheck(0, "lock any channel", 0);
+	return 0;
+}
+
+uint8_t ucHOS_DMA_releaseChannel(	uint8_t ucUnitNumber,
+									uint8_t ucChannelNumber,
+									TickType_t xTimeout	)
+{
+	(void)ucUnitNumber;
+	(void)xTimeout;
+	vCheck(pxDmaArr[ucChannelNumber].ucIsLocked, "released channel is locked", ucChannelNumber);
+	vCheck(!pxDmaArr[ucChannelNumber].ucIsActive, "released channel is idle", ucChannelNumber);
+	pxDmaArr[ucChannelNumber].ucIsLocked = 0;
+	return 1;
+}
+
+void vHOS_DMA_startTransfer(xHOS_DMA_TransInfo_t* pxInfo)
+{
+	xHostDmaChannel_t* pxDma = &pxDmaArr[pxInfo->ucChannelNumber];
+
+	vCheck(pxDma->ucIsLocked, "DMA channel locked before transfer", pxInfo->ucChannelNumber);
+	vCheck(!pxDma->ucIsActive, "DMA transfer started while active", pxInfo->ucChannelNumber);
+	vCheck(!pxDma->ucTcFlag, "stale DMA TC flag on transfer start", pxInfo->ucChannelNumber);
+
+	pxDma->xInfo = *pxInfo;
+	pxDma->ucIsActive = 1;
+	pxDma->uiCount = 0;
+}
+
+void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber	)
+{
+	(void)ucUnitNumber;
+	pxDmaArr[ucChannelNumber].ucTcFlag = 0;
+}
+
+static uint8_t ucRunHardware(void);
+
+uint8_t ucHOS_DMA_blockUntilTransferComplete(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber,
+												TickType_t xTimeout	)
+{
+	(void)ucUnitNumber;
+
+	while (!pxDmaArr[ucChannelNumber].ucTcFlag)
+	{
+		if (xTimeout == 0 || !ucRunHardware())
+			return 0;
+	}
+
+	pxDmaArr[ucChannelNumber].ucTcFlag = 0;
+	return 1;
+}
+
+/*
+ * Counts a byte moved by a channel, and raises its half transfer (enabled on
+ * every channel by the DMA driver) and transfer complete interrupts.
+ */
+static void vDmaCount(xHostDmaChannel_t* pxDma)
+{
+	pxDma->uiCount++;
+
+	if (pxDma->uiCount == pxDma->xInfo.uiN / 2)
+		uiIsrCount++;
+
+	if (pxDma->uiCount == pxDma->xInfo.uiN)
+	{
+		pxDma->ucIsActive = 0;
+		pxDma->ucTcFlag = 1;
+		uiIsrCount++;
+	}
+}
+
+#endif	/*	portDMA_IS_AVAILABLE	*/
+
+/*
+ * Runs one step of the simulated hardware. Returns 1 if anything happened.
+ */
+static uint8_t ucRunHardware(void)
+{
+#if portDMA_IS_AVAILABLE
+	/*	Rx channel has the higher priority	*/
+	if (pxSpi->ucIsRxneConnectedToDma && pxRxDma->ucIsActive && pxSpi->ucIsRxBufferFull)
+	{
+		vCheck(	pxRxDma->xInfo.ucDirection == 0 &&
+				pxRxDma->xInfo.pvPeripheralStartingAdderss == (void*)&pxSpi->ucDr,
+				"Rx DMA reads DR", 0	);
+
+		((uint8_t*)pxRxDma->xInfo.pvMemoryStartingAdderss)[pxRxDma->uiCount] =
+			ucPort_SPI_readDataNoWait(0);
+
+		vDmaCount(pxRxDma);
+		return 1;
+	}
+
+	if (pxSpi->ucIsTxeConnectedToDma && pxTxDma->ucIsActive && !pxSpi->ucIsTxBufferFull)
+	{
+		uint8_t* pucMem = (uint8_t*)pxTxDma->xInfo.pvMemoryStartingAdderss;
+
+		vCheck(	pxTxDma->xInfo.ucDirection == 1 &&
+				pxTxDma->xInfo.pvPeripheralStartingAdderss == (void*)&pxSpi->ucDr,
+				"Tx DMA writes DR", 0	);
+
+		vPort_SPI_writeDataNoWait(
+			0, pucMem[pxTxDma->xInfo.ucMemoryIncrement ? pxTxDma->uiCount : 0]);
+
+		vDmaCount(pxTxDma);
+		return 1;
+	}
+#endif
+
+	if (pxSpi->ucIsTxeInterruptEnabled && !pxSpi->ucIsTxBufferFull)
+	{
+		uiIsrCount++;
+		pxSpi->pfTxeCallback(pxSpi->pvTxeCallbackParams);
+		return 1;
+	}
+
+	if (pxSpi->ucIsRxneInterruptEnabled && pxSpi->ucIsRxBufferFull)
+	{
+		uiIsrCount++;
+		pxSpi->pfRxneCallback(pxSpi->pvRxneCallbackParams);
+		return 1;
+	}
+
+	/*	Move Tx buffer to the shift register (raises TxE)	*/
+	if (!pxSpi->ucIsShifting && pxSpi->ucIsTxBufferFull)
+	{
+		pxSpi->ucShiftRegister = pxSpi->ucTxBuffer;
+		pxSpi->ucIsTxBufferFull = 0;
+		pxSpi->ucIsShifting = 1;
+		return 1;
+	}
+
+	/*	Shift the byte out, slave's reply is received (raises RxNE)	*/
+	if (pxSpi->ucIsShifting)
+	{
+		pxSpi->ucRxBuffer = ucSlaveReply(uiWireLen);
+		pxSpi->ucIsRxBufferFull = 1;
+		pucWireArr[uiWireLen++] = pxSpi->ucShiftRegister;
+		pxSpi->ucIsShifting = 0;
+		return 1;
+	}
+
+	return 0;
+}
+
+uint8_t ucHOST_TEST_STUB_onBlock(void)
+{
+	return ucRunHardware();
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+typedef enum{
+	xOP_SEND,
+	xOP_TRANSCEIVE,
+	xOP_RECEIVE,
+	xOP_SEND_MULTIPLE
+}xOp_t;
+
+static const char* const pcOpNameArr[] = {"send", "transceive", "receive", "send x4"};
+
+/*	Runs an operation (of "uiSize" bytes, 4 times "uiSize" for send multiple)	*/
+static void vRun(xOp_t xOp, int8_t* pcOutArr, int8_t* pcInArr, uint32_t uiSize)
+{
+	switch(xOp)
+	{
+	case xOP_SEND:
+		vHOS_SPI_send(0, pcOutArr, uiSize);
+		break;
+	case xOP_TRANSCEIVE:
+		vHOS_SPI_transceive(0, pcOutArr, pcInArr, uiSize);
+		break;
+	case xOP_RECEIVE:
+		vHOS_SPI_receive(0, pcInArr, uiSize);
+		break;
+	default:
+		vHOS_SPI_sendMultiple(0, pcOutArr, uiSize, 4);
+		break;
+	}
+}
+
+static void vTestOperations(uint8_t ucByteDir)
+{
+	static int8_t pcOutArr[uiMAX_TRANSFER_SIZE];
+	static int8_t pcInArr[uiMAX_TRANSFER_SIZE];
+	uint32_t uiSize, uiWireStart, uiRepeat, k;
+	uint8_t ucIsReversed = (ucByteDir == ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST);
+	xOp_t xOp;
+
+	vHOS_SPI_setByteDirection(0, ucByteDir);
+
+	for (uint32_t t = 0; t < uiNUMBER_OF_TRANSFERS; t++)
+	{
+		xOp = (xOp_t)(rand() % 4);
+		uiSize = 1 + rand() % uiMAX_TRANSFER_SIZE;
+		uiRepeat = (xOp == xOP_SEND_MULTIPLE) ? 4 : 1;
+
+		for (uint32_t i = 0; i < uiSize; i++)
+			pcOutArr[i] = rand();
+		memset(pcInArr, 0, uiSize);
+
+		uiWireLen = 0;
+		uiWireStart = 0;
+
+		vRun(xOp, pcOutArr, pcInArr, uiSize);
+
+		/*	Returned after last byte is on the bus	*/
+		vCheck(uiWireLen - uiWireStart == uiSize * uiRepeat, "all bytes on wire", t);
+		vCheck(!pxSpi->ucIsShifting && !pxSpi->ucIsTxBufferFull, "bus idle on return", t);
+		vCheck(ucHOS_SPI_blockUntilTransferComplete(0, 0), "transfer complete", t);
+
+		for (uint32_t i = 0; i < uiSize * uiRepeat; i++)
+		{
+			/*	Array index of the i-th byte on the wire	*/
+			k = i % uiSize;
+			if (ucIsReversed)
+				k = uiSize - 1 - k;
+
+			if (xOp == xOP_RECEIVE)
+				vCheck(pucWireArr[uiWireStart + i] == 0xFF, "receive sends 0xFF", t);
+			else
+				vCheck(pucWireArr[uiWireStart + i] == (uint8_t)pcOutArr[k], "bytes on wire", t);
+
+			if (xOp == xOP_TRANSCEIVE || xOp == xOP_RECEIVE)
+				vCheck((uint8_t)pcInArr[k] == ucSlaveReply(uiWireStart + i), "received bytes", t);
+		}
+
+		vCheck(uiHostPortSpiTxOverwriteCount == 0, "no write to full Tx buffer", t);
+
+#if portDMA_IS_AVAILABLE
+		vCheck(	!pxTxDma->ucIsLocked && !pxRxDma->ucIsLocked &&
+				!pxSpi->ucIsTxeConnectedToDma && !pxSpi->ucIsRxneConnectedToDma,
+				"DMA channels released and disconnected", t	);
+
+		/*	Leave TC flags given, as a previous user of the channels could	*/
+		pxTxDma->ucTcFlag = 1;
+		pxRxDma->ucTcFlag = 1;
+#endif
+
+		/*	Rx buffer may be left full by send operations	*/
+		vCheck(!ucRunHardware() || pxSpi->ucIsRxBufferFull, "hardware idle", t);
+	}
+}
+
+static void vBenchmark(uint8_t ucByteDir, xOp_t xOp, uint32_t uiSize)
+{
+	static int8_t pcOutArr[1024];
+	static int8_t pcInArr[1024];
+	uint32_t uiIsrStart, uiN = uiBENCHMARK_BYTES / uiSize;
+	clock_t xStart;
+	double dSec;
+
+	vHOS_SPI_setByteDirection(0, ucByteDir);
+	uiIsrStart = uiIsrCount;
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiN; i++)
+	{
+		uiWireLen = 0;
+		vRun(xOp, pcOutArr, pcInArr, uiSize);
+	}
+	dSec = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	printf(	"%-11s %6u %14.1f %12.1f %14.1f\n",
+			pcOpNameArr[xOp],
+			uiSize,
+			(double)(uiIsrCount - uiIsrStart) / uiN,
+			(double)(uiIsrCount - uiIsrStart) * 1024 / (uiN * uiSize),
+			uiN * uiSize * ((xOp == xOP_SEND_MULTIPLE) ? 4 : 1) / dSec / 1e6	);
+}
+
+static void vBenchmarkAll(uint8_t ucByteDir)
+{
+	static const uint32_t puiSizeArr[] = {1, 16, 256, 1024};
+
+	printf("operation     size   ISRs/transfer   ISRs/KiB   host MB/s\n");
+	for (uint32_t op = 0; op < 3; op++)
+		for (uint32_t s = 0; s < 4; s++)
+			vBenchmark(ucByteDir, (xOp_t)op, puiSizeArr[s]);
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vHOS_SPI_init();
+
+#if portDMA_IS_AVAILABLE
+	/*	DMA driver gives every channel's TC flag on init	*/
+	pxTxDma->ucTcFlag = 1;
+	pxRxDma->ucTcFlag = 1;
+#endif
+
+	vTestOperations(ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST);
+	vTestOperations(ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST);
+
+	printf(	"Variant: %s\n",
+			portDMA_IS_AVAILABLE ? "V2 (DMA)" : "V1 (TxE/RxNE ISRs)"	);
+
+	printf("LS byte first%s:\n", portDMA_IS_AVAILABLE ? " (DMA)" : "");
+	vBenchmarkAll(ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST);
+
+	printf("MS byte first%s:\n", portDMA_IS_AVAILABLE ? " (CPU, against DMA endianness)" : "");
+	vBenchmarkAll(ucHOS_SPI_BYTE_DIRECTION_MSBYTE_FIRST);
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_SPI_HOST_TEST	*/
@@ -323,9 +323,6 @@ void vHOS_SPI_transceive(	uint8_t ucUnitNumber,
 		/*	Block until there's free byte/s in unit's Tx buffer	*/
 		xSemaphoreTake(pxUnit->xTxeSemaphore, portMAX_DELAY);
 
-		/*	Block until there's new byte/s in unit's Rx buffer	*/
-		xSemaphoreTake(pxUnit->xRxneSemaphore, portMAX_DELAY);
-
 		/*	If there's an unread byte in the Rx buffer, read it	*/
 		if (xSemaphoreTake(pxUnit->xRxneSemaphore, 0))
 		{
@@ -344,7 +341,7 @@ void vHOS_SPI_transceive(	uint8_t ucUnitNumber,
 		 * Block until the Rx buffer is not empty (i.e: a byte has completely been
 		 * transmitted on the bus).
 		 */
-		xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
+		xSemaphoreTake(pxUnit->xRxneSemaphore, portMAX_DELAY);
 
 		pcInArr[iReader] = ucPort_SPI_readDataNoWait(ucUnitNumber);
 	}
@@ -91,6 +91,12 @@ typedef struct{
  */
 static xHOS_SPI_Unit_t pxUnitArr[portSPI_NUMBER_OF_UNITS];
 
+/*
+ * Byte sent by receive operations. DMA reads it repeatedly (memory increment
+ * disabled) while the received bytes are written to the user's array.
+ */
+static int8_t cDummyByte = (int8_t)0xFF;
+
 /*******************************************************************************
  * Helping functions/macros:
  ******************************************************************************/
@@ -165,6 +171,211 @@ static void vSendLoop(xHOS_SPI_Unit_t* pxUnit, int8_t* pcArr, uint32_t uiSize)
 	}
 }
 
+/*
+ * Transceives without DMA.
+ *
+ * (Used in case of byte direction configured in the SPI driver is different from
+ * that which the DMA uses).
+ *
+ * If "pcOutArr" is NULL, dummy bytes (0xFF) are sent.
+ */
+static void vTransceiveLoop(	xHOS_SPI_Unit_t* pxUnit,
+								int8_t* pcOutArr,
+								int8_t* pcInArr,
+								uint32_t uiSize	)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	/*	Configure loop counter based on the previously configured byte direction	*/
+	int32_t i, iIncrementer, iEnd;
+	vCONF_ITERATOR(pxUnit->ucByteDir, uiSize, i, iIncrementer, iEnd);
+
+	int32_t iReader = i;
+
+	for (; i != iEnd; i += iIncrementer)
+	{
+		/*	Write next byte to uint's data buffer (data register in most cases)	*/
+		if (pcOutArr != NULL)
+			vPort_SPI_writeDataNoWait(ucUnitNumber, pcOutArr[i]);
+		else
+			vPort_SPI_writeDataNoWait(ucUnitNumber, 0xFF);
+
+		/*	Enable TxE & RxNE interrupts (disabled in the ISR)	*/
+		vPORT_SPI_enableTxeInterrupt(ucUnitNumber);
+		vPORT_SPI_enableRxneInterrupt(ucUnitNumber);
+
+		/*	Block until there's free byte/s in unit's data buffer	*/
+		xSemaphoreTake(pxUnit->xTxeSemaphore, portMAX_DELAY);
+
+		/*	If there's an unread byte in the Rx buffer, read it	*/
+		if (xSemaphoreTake(pxUnit->xRxneSemaphore, 0))
+		{
+			pcInArr[iReader] = ucPort_SPI_readDataNoWait(ucUnitNumber);
+			iReader += iIncrementer;
+		}
+	}
+
+	/*	Empty the Rx buffer (Keep reading into "pcInArr[]").	*/
+	for (; iReader != iEnd; iReader += iIncrementer)
+	{
+		/*	Enable RxNE interrupt	*/
+		vPORT_SPI_enableRxneInterrupt(ucUnitNumber);
+
+		/*
+		 * Block until the Rx buffer is not empty (i.e: a byte has completely been
+		 * transmitted on the bus).
+		 */
+		xSemaphoreTake(pxUnit->xRxneSemaphore, portMAX_DELAY);
+
+		pcInArr[iReader] = ucPort_SPI_readDataNoWait(ucUnitNumber);
+	}
+}
+
+/*
+ * Locks the DMA channel which is going to serve one of the SPI unit's signals.
+ *
+ * "ppucMapping" is either "ppucPortSpiTxeDmaMapping" or "ppucPortSpiRxneDmaMapping",
+ * and is only used if the target has static SPI/DMA mapping.
+ */
+static void vLockDmaChannel(	xHOS_DMA_TransInfo_t* pxDmaInfo,
+								const uint8_t ppucMapping[][2],
+								uint8_t ucUnitNumber	)
+{
+	if (portSPI_IS_DMA_STATIC_CONNECTED)
+	{
+		pxDmaInfo->ucUnitNumber = ppucMapping[ucUnitNumber][0];
+		pxDmaInfo->ucChannelNumber = ppucMapping[ucUnitNumber][1];
+
+		ucHOS_DMA_lockChannel(	pxDmaInfo->ucUnitNumber,
+								pxDmaInfo->ucChannelNumber,
+								portMAX_DELAY	);
+	}
+	else
+	{
+		ucHOS_DMA_lockAnyChannel(	&pxDmaInfo->ucUnitNumber,
+									&pxDmaInfo->ucChannelNumber,
+									portMAX_DELAY	);
+	}
+}
+
+/*
+ * Transceives using a DMA RX + TX channel pair, as a single DMA transfer.
+ *
+ * Notes:
+ * 		-	If "ucOutIncrement" is 0, first byte of "pcOutArr" is sent "uiSize"
+ * 			times (used for receive operations).
+ *
+ * 		-	RxNE channel is started before the TxE one, and is given higher
+ * 			priority, so that no received byte is overrun.
+ *
+ * 		-	As the last received byte is only available after it has completely
+ * 			been shifted on the bus, end of the RxNE channel transfer is end of
+ * 			the whole transceive operation. Hence, no busy flag checking is needed.
+ *
+ * 		-	RxNE channel is always locked before the TxE channel, hence no
+ * 			dead-lock could happen with other transfers on the same unit or
+ * 			other units that share these channels.
+ */
+static void vTransceiveDma(	xHOS_SPI_Unit_t* pxUnit,
+							int8_t* pcOutArr,
+							int8_t* pcInArr,
+							uint32_t uiSize,
+							uint8_t ucOutIncrement	)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+
+	/*	Configure DMA transfers	*/
+	xHOS_DMA_TransInfo_t xRxDmaInfo = {
+		.pvMemoryStartingAdderss = (void*)pcInArr,
+
+		.pvPeripheralStartingAdderss = pvPort_SPI_getDrAddress(ucUnitNumber),
+
+		.uiN = uiSize,
+
+		.ucTriggerSource = 0,
+
+		/*
+		 * Rx channel is given higher priority than the Tx channel, so that a
+		 * received byte is always read before the next one is received.
+		 */
+		.ucPriLevel = 1,
+
+		.ucDirection = 0,
+
+		.ucMemoryIncrement = 1,
+
+		.ucPeripheralIncrement = 0
+	};
+
+	xHOS_DMA_TransInfo_t xTxDmaInfo = {
+		.pvMemoryStartingAdderss = (void*)pcOutArr,
+
+		.pvPeripheralStartingAdderss = pvPort_SPI_getDrAddress(ucUnitNumber),
+
+		.uiN = uiSize,
+
+		.ucTriggerSource = 0,
+
+		.ucPriLevel = 0,
+
+		.ucDirection = 1,
+
+		.ucMemoryIncrement = ucOutIncrement,
+
+		.ucPeripheralIncrement = 0
+	};
+
+	/*	Lock DMA channels	*/
+	vLockDmaChannel(&xRxDmaInfo, ppucPortSpiRxneDmaMapping, ucUnitNumber);
+	vLockDmaChannel(&xTxDmaInfo, ppucPortSpiTxeDmaMapping, ucUnitNumber);
+
+	/*	Clear RxNE flag to avoid parasitic effect from previous transceive operation	*/
+	vPORT_SPI_clearRxneFlag(ucUnitNumber);
+
+	/*
+	 * Clear TC flags of both channels, they may have been left given by a
+	 * previous user (or by channel's initialization).
+	 */
+	vHOS_DMA_clearTransferCompleteFlag(xRxDmaInfo.ucUnitNumber, xRxDmaInfo.ucChannelNumber);
+	vHOS_DMA_clearTransferCompleteFlag(xTxDmaInfo.ucUnitNumber, xTxDmaInfo.ucChannelNumber);
+
+	/*	Start Rx transfer, then connect SPI unit's RxNE to its channel	*/
+	vHOS_DMA_startTransfer(&xRxDmaInfo);
+
+	vPort_SPI_connectRxneToDma(	ucUnitNumber,
+								xRxDmaInfo.ucUnitNumber,
+								xRxDmaInfo.ucChannelNumber	);
+
+	/*	Start Tx transfer, then connect SPI unit's TxE to its channel	*/
+	vHOS_DMA_startTransfer(&xTxDmaInfo);
+
+	vPort_SPI_connectTxeToDma(	ucUnitNumber,
+								xTxDmaInfo.ucUnitNumber,
+								xTxDmaInfo.ucChannelNumber	);
+
+	/*	Block until end of both transfers	*/
+	ucHOS_DMA_blockUntilTransferComplete(	xTxDmaInfo.ucUnitNumber,
+											xTxDmaInfo.ucChannelNumber,
+											portMAX_DELAY	);
+
+	ucHOS_DMA_blockUntilTransferComplete(	xRxDmaInfo.ucUnitNumber,
+											xRxDmaInfo.ucChannelNumber,
+											portMAX_DELAY	);
+
+	/*	Disconnect SPI unit from the locked DMA channels	*/
+	vPort_SPI_disconnectTxeFromDma(ucUnitNumber);
+	vPort_SPI_disconnectRxneFromDma(ucUnitNumber);
+
+	/*	Release DMA channels	*/
+	ucHOS_DMA_releaseChannel(	xTxDmaInfo.ucUnitNumber,
+								xTxDmaInfo.ucChannelNumber,
+								portMAX_DELAY	);
+
+	ucHOS_DMA_releaseChannel(	xRxDmaInfo.ucUnitNumber,
+								xRxDmaInfo.ucChannelNumber,
+								portMAX_DELAY	);
+}
+
 /*******************************************************************************
  * ISR callback:
  ******************************************************************************/
@@ -320,27 +531,16 @@ void vHOS_SPI_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize)
 	};
 
 	/*	Lock DMA channel	*/
-	if (portSPI_IS_DMA_STATIC_CONNECTED)
-	{
-		xDmaInfo.ucUnitNumber = ppucPortSpiTxeDmaMapping[ucUnitNumber][0];
-		xDmaInfo.ucChannelNumber = ppucPortSpiTxeDmaMapping[ucUnitNumber][1];
-
-		ucHOS_DMA_lockChannel(	xDmaInfo.ucUnitNumber,
-								xDmaInfo.ucChannelNumber,
-								portMAX_DELAY	);
-	}
-	else
-	{
-		ucHOS_DMA_lockAnyChannel(	&xDmaInfo.ucUnitNumber,
-									&xDmaInfo.ucChannelNumber,
-									portMAX_DELAY	);
-	}
+	vLockDmaChannel(&xDmaInfo, ppucPortSpiTxeDmaMapping, ucUnitNumber);
 
 	/*	Connect SPI unit to the locked DMA channel	*/
 	vPort_SPI_connectTxeToDma(	ucUnitNumber,
 								xDmaInfo.ucUnitNumber,
 								xDmaInfo.ucChannelNumber	);
 
+	/*	Clear TC flag (may have been left given by a previous user)	*/
+	vHOS_DMA_clearTransferCompleteFlag(xDmaInfo.ucUnitNumber, xDmaInfo.ucChannelNumber);
+
 	/*	Start data transfer	*/
 	vHOS_DMA_startTransfer(&xDmaInfo);
 
@@ -386,54 +586,66 @@ void vHOS_SPI_transceive(	uint8_t ucUnitNumber,
 	/*	Assure Transfer complete semaphore is not available (force it)	*/
 	xSemaphoreTake(pxUnit->xTransferCompleteSemaphore, 0);
 
-	/*	Assure TxE semaphore is not available (force it)	*/
-	xSemaphoreTake(pxUnit->xTxeSemaphore, 0);
-
-	/*	Clear RxNE flag to avoid parasitic effect from previous transceive operation	*/
-	vPORT_SPI_clearRxneFlag(ucUnitNumber);
+	/*
+	 * If the configured byte direction is not same as DMA endianess, transceive
+	 * bytes using the CPU.
+	 */
+	if (!(portDMA_ENDIANESS ^ pxUnit->ucByteDir))
+	{
+		/*	Assure TxE semaphore is not available (force it)	*/
+		xSemaphoreTake(pxUnit->xTxeSemaphore, 0);
 
-	/*	Assure RxNE semaphore is not available (force it)	*/
-	xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
+		/*	Clear RxNE flag to avoid parasitic effect from previous transceive operation	*/
+		vPORT_SPI_clearRxneFlag(ucUnitNumber);
 
-	/*	Configure loop counter based on the previously configured byte direction	*/
-	int32_t i, iIncrementer, iEnd;
-	vCONF_ITERATOR(pxUnit->ucByteDir, uiSize, i, iIncrementer, iEnd);
+		/*	Assure RxNE semaphore is not available (force it)	*/
+		xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
 
-	int32_t iReader = i;
+		vTransceiveLoop(pxUnit, pcOutArr, pcInArr, uiSize);
+	}
 
-	for (; i != iEnd; i += iIncrementer)
+	else
 	{
-		/*	Write next byte to uint's data buffer (data register in most cases)	*/
-		vPort_SPI_writeDataNoWait(ucUnitNumber, pcOutArr[i]);
+		vTransceiveDma(pxUnit, pcOutArr, pcInArr, uiSize, 1);
+	}
 
-		/*	Enable TxE & RxNE interrupts (disabled in the ISR)	*/
-		vPORT_SPI_enableTxeInterrupt(ucUnitNumber);
-		vPORT_SPI_enableRxneInterrupt(ucUnitNumber);
+	/*	Acknowledge end of transfer	*/
+	xSemaphoreGive(pxUnit->xTransferCompleteSemaphore);
+}
 
-		/*	Block until there's free byte/s in unit's data buffer	*/
-		xSemaphoreTake(pxUnit->xTxeSemaphore, portMAX_DELAY);
+/*
+ * See header for info.
+ */
+void vHOS_SPI_receive(		uint8_t ucUnitNumber,
+							int8_t* pcInArr,
+							uint32_t uiSize	)
+{
+	xHOS_SPI_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
 
-		/*	If there's an unread byte in the Rx buffer, read it	*/
-		if (xSemaphoreTake(pxUnit->xRxneSemaphore, 0))
-		{
-			pcInArr[iReader] = ucPort_SPI_readDataNoWait(ucUnitNumber);
-			iReader += iIncrementer;
-		}
-	}
+	/*	Assure Transfer complete semaphore is not available (force it)	*/
+	xSemaphoreTake(pxUnit->xTransferCompleteSemaphore, 0);
 
-	/*	Empty the Rx buffer (Keep reading into "pcInArr[]").	*/
-	for (; iReader != iEnd; iReader += iIncrementer)
+	/*
+	 * If the configured byte direction is not same as DMA endianess, receive
+	 * bytes using the CPU.
+	 */
+	if (!(portDMA_ENDIANESS ^ pxUnit->ucByteDir))
 	{
-		/*	Enable RxNE interrupt	*/
-		vPORT_SPI_enableRxneInterrupt(pxUnit->ucUnitNumber);
+		/*	Assure TxE semaphore is not available (force it)	*/
+		xSemaphoreTake(pxUnit->xTxeSemaphore, 0);
 
-		/*
-		 * Block until the Rx buffer is not empty (i.e: a byte has completely been
-		 * transmitted on the bus).
-		 */
-		xSemaphoreTake(pxUnit->xRxneSemaphore, portMAX_DELAY);
+		/*	Clear RxNE flag to avoid parasitic effect from previous transceive operation	*/
+		vPORT_SPI_clearRxneFlag(ucUnitNumber);
 
-		pcInArr[iReader] = ucPort_SPI_readDataNoWait(ucUnitNumber);
+		/*	Assure RxNE semaphore is not available (force it)	*/
+		xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
+
+		vTransceiveLoop(pxUnit, NULL, pcInArr, uiSize);
+	}
+
+	else
+	{
+		vTransceiveDma(pxUnit, &cDummyByte, pcInArr, uiSize, 0);
 	}
 
 	/*	Acknowledge end of transfer	*/
@@ -499,21 +711,7 @@ void vHOS_SPI_sendMultiple(	uint8_t ucUnitNumber,
 	};
 
 	/*	Lock DMA channel	*/
-	if (portSPI_IS_DMA_STATIC_CONNECTED)
-	{
-		xDmaInfo.ucUnitNumber = ppucPortSpiTxeDmaMapping[ucUnitNumber][0];
-		xDmaInfo.ucChannelNumber = ppucPortSpiTxeDmaMapping[ucUnitNumber][1];
-
-		ucHOS_DMA_lockChannel(	xDmaInfo.ucUnitNumber,
-								xDmaInfo.ucChannelNumber,
-								portMAX_DELAY	);
-	}
-	else
-	{
-		ucHOS_DMA_lockAnyChannel(	&xDmaInfo.ucUnitNumber,
-									&xDmaInfo.ucChannelNumber,
-									portMAX_DELAY	);
-	}
+	vLockDmaChannel(&xDmaInfo, ppucPortSpiTxeDmaMapping, ucUnitNumber);
 
 	/*	Connect SPI unit to the locked DMA channel	*/
 	vPort_SPI_connectTxeToDma(	ucUnitNumber,
@@ -522,6 +720,9 @@ void vHOS_SPI_sendMultiple(	uint8_t ucUnitNumber,
 
 	while(uiN--)
 	{
+		/*	Clear TC flag (may have been left given by a previous user)	*/
+		vHOS_DMA_clearTransferCompleteFlag(xDmaInfo.ucUnitNumber, xDmaInfo.ucChannelNumber);
+
 		/*	Start data transfer	*/
 		vHOS_DMA_startTransfer(&xDmaInfo);
 
@@ -15,6 +15,8 @@
 
 /*	MCAL (Ported)	*/
 #include "MCAL_Port/Port_DIO.h"
+#include "MCAL_Port/Port_Timer.h"
+#include "MCAL_Port/Port_Interrupt.h"
 #include "MCAL_Port/Port_Print.h"
 #include "MCAL_Port/Port_Breakpoint.h"
 
@@ -33,6 +35,7 @@
 /*******************************************************************************
  * Static objects:
  ******************************************************************************/
+/*	Indexed by glyph index (see header)	*/
 static const uint8_t pucSegmentStateArr[] = {
 	0b00111111,	/*	0	*/
 	0b00000110,	/*	1	*/
@@ -43,9 +46,41 @@ static const uint8_t pucSegmentStateArr[] = {
 	0b01111101,	/*	6	*/
 	0b00000111,	/*	7	*/
 	0b01111111,	/*	8	*/
-	0b01101111	/*	9	*/
+	0b01101111,	/*	9	*/
+	0b01110111,	/*	A	*/
+	0b01111100,	/*	b	*/
+	0b00111001,	/*	C	*/
+	0b01011110,	/*	d	*/
+	0b01111001,	/*	E	*/
+	0b01110001,	/*	F	*/
+	0b00111101,	/*	G	*/
+	0b01110110,	/*	H	*/
+	0b00110000,	/*	I	*/
+	0b00011110,	/*	J	*/
+	0b01110101,	/*	K	*/
+	0b00111000,	/*	L	*/
+	0b00110111,	/*	M	*/
+	0b01010100,	/*	n	*/
+	0b01011100,	/*	o	*/
+	0b01110011,	/*	P	*/
+	0b01100111,	/*	q	*/
+	0b01010000,	/*	r	*/
+	0b01101101,	/*	S	*/
+	0b01111000,	/*	t	*/
+	0b00111110,	/*	U	*/
+	0b00011100,	/*	v	*/
+	0b00101010,	/*	W	*/
+	0b01110110,	/*	X	*/
+	0b01101110,	/*	Y	*/
+	0b01011011,	/*	Z	*/
+	0b00000000,	/*	blank	*/
+	0b01000000,	/*	-	*/
+	0b00001000,	/*	_	*/
+	0b01100011	/*	degree	*/
 };
 
+#define ucNUMBER_OF_GLYPHS	(sizeof(pucSegmentStateArr) / sizeof(pucSegmentStateArr[0]))
+
 /*******************************************************************************
  * Helping functions/macros.
  ******************************************************************************/
@@ -92,7 +127,7 @@ static inline void vWriteCurrentlyActiveDigit(xHOS_SevenSegmentMux_t* pxHandle)
 	uint8_t ucActiveLevel = pxHandle->ucSegmentActiveLevel;
 	uint8_t ucCurrent = pxHandle->ucCurrentActiveDigit;
 	uint8_t ucVal = pxHandle->pucDisplayBuffer[ucCurrent];
-	uint8_t ucStates = pucSegmentStateArr[ucVal];
+	uint8_t ucStates = (ucVal < ucNUMBER_OF_GLYPHS) ? pucSegmentStateArr[ucVal] : 0;
 	uint8_t ucPort, ucPin, ucState, ucLevel;
 	uint8_t i;
 
@@ -115,6 +150,180 @@ static inline void vWriteCurrentlyActiveDigit(xHOS_SevenSegmentMux_t* pxHandle)
 	vPORT_DIO_WRITE_PIN(ucPort, ucPin, ucLevel);
 }
 
+static inline uint8_t ucGetGlyphIndex(char cChar)
+{
+	if (cChar >= '0' && cChar <= '9')
+		return cChar - '0';
+	if (cChar >= 'A' && cChar <= 'Z')
+		return 10 + cChar - 'A';
+	if (cChar >= 'a' && cChar <= 'z')
+		return 10 + cChar - 'a';
+
+	switch (cChar)
+	{
+	case '-':	return ucHOS_SEVENSEGMENTMUX_GLYPH_MINUS;
+	case '_':	return ucHOS_SEVENSEGMENTMUX_GLYPH_UNDERSCORE;
+	case '*':	return ucHOS_SEVENSEGMENTMUX_GLYPH_DEGREE;
+	default:	return ucHOS_SEVENSEGMENTMUX_GLYPH_BLANK;
+	}
+}
+
+/*
+ * Writes number "uiNum" to display buffer in base "uiBase". Leading zeros are
+ * written as zeros.
+ */
+static void vWriteNumber(	xHOS_SevenSegmentMux_t* pxHandle,
+							uint32_t uiNum,
+							uint32_t uiBase	)
+{
+    uint8_t i;
+    uint8_t* pucDigArr = pxHandle->pucDisplayBuffer;
+    uint8_t ucNDigs = pxHandle->ucNumberOfDigits;
+
+    for (i = 0; i < ucNDigs; i++)
+    {
+    	pucDigArr[i] = uiNum % uiBase;
+    	uiNum = uiNum / uiBase;
+        if (uiNum == 0)
+            break;
+    }
+    for (i = i + 1; i < ucNDigs; i++)
+    {
+    	pucDigArr[i] = 0;
+    }
+}
+
+/*
+ * Returns index of "ucPort" in the object's used ports array, adding it if it is
+ * not already there.
+ */
+static uint8_t ucGetPortIndex(xHOS_SevenSegmentMux_t* pxHandle, uint8_t ucPort)
+{
+	uint8_t i;
+
+	for (i = 0; i < pxHandle->ucNumberOfPorts; i++)
+	{
+		if (pxHandle->pucPortNumberArr[i] == ucPort)
+			return i;
+	}
+
+	configASSERT(i < configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS);
+
+	pxHandle->pucPortNumberArr[i] = ucPort;
+	pxHandle->ucNumberOfPorts++;
+
+	return i;
+}
+
+/*	Adds writing "ucLevel" on a pin to the set/reset words "puiWordArr"	*/
+static inline void vAddPinToWords(	xHOS_SevenSegmentMux_t* pxHandle,
+									uint32_t* puiWordArr,
+									uint8_t ucPort,
+									uint8_t ucPin,
+									uint8_t ucLevel	)
+{
+	uint8_t ucIndex = ucGetPortIndex(pxHandle, ucPort);
+
+	if (ucLevel)
+		puiWordArr[ucIndex] |= 1ul << ucPin;
+	else
+		puiWordArr[ucIndex] |= 1ul << (ucPin + 16);
+}
+
+/*
+ * Calculates set/reset words of all digits into the inactive frame, then makes
+ * it the active one.
+ */
+static void vCalculateFrame(xHOS_SevenSegmentMux_t* pxHandle)
+{
+	uint8_t ucFrame = !pxHandle->ucActiveFrame;
+	uint32_t* puiWordArr;
+	uint8_t ucVal, ucStates, ucState;
+
+	for (uint8_t ucDigit = 0; ucDigit < pxHandle->ucNumberOfDigits; ucDigit++)
+	{
+		puiWordArr = pxHandle->puiFrameArr[ucFrame][ucDigit];
+
+		for (uint8_t i = 0; i < configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS; i++)
+			puiWordArr[i] = 0;
+
+		/*	Segments (and point)	*/
+		ucVal = pxHandle->pucDisplayBuffer[ucDigit];
+		ucStates = (ucVal < ucNUMBER_OF_GLYPHS) ? pucSegmentStateArr[ucVal] : 0;
+		if (pxHandle->ucPointIndex & (1 << ucDigit))
+			ucStates |= 1 << 7;
+
+		for (uint8_t i = 0; i < 8; i++)
+		{
+			ucState = ucGET_BIT(ucStates, i);
+			vAddPinToWords(	pxHandle,
+							puiWordArr,
+							pxHandle->pxSegmentPortNumberArr[i],
+							pxHandle->pxSegmentPinNumberArr[i],
+							ucGET_LEVEL(ucState, pxHandle->ucSegmentActiveLevel)	);
+		}
+
+		/*	Only this digit is enabled	*/
+		for (uint8_t i = 0; i < pxHandle->ucNumberOfDigits; i++)
+		{
+			vAddPinToWords(	pxHandle,
+							puiWordArr,
+							pxHandle->pxDigitEnablePortNumberArr[i],
+							pxHandle->pxDigitEnablePinNumberArr[i],
+							ucGET_LEVEL(i == ucDigit, pxHandle->ucEnableActiveLevel)	);
+		}
+	}
+
+	pxHandle->ucActiveFrame = ucFrame;
+}
+
+static inline void vWriteBlank(xHOS_SevenSegmentMux_t* pxHandle)
+{
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfPorts; i++)
+	{
+		vPORT_DIO_WRITE_PORT_SET_RESET(	pxHandle->pucPortNumberArr[i],
+										pxHandle->puiBlankWordArr[i]	);
+	}
+}
+
+/*	Compare value at which digits are turned off, for a brightness level	*/
+static inline uint32_t uiGetCompareValue(	xHOS_SevenSegmentMux_t* pxHandle,
+											uint8_t ucBrightness	)
+{
+	return ((pxHandle->uiCounterUpperLimit + 1) * ucBrightness) /
+				(ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS + 1);
+}
+
+/*******************************************************************************
+ * ISRs (timer drive mode):
+ ******************************************************************************/
+/*	Start of a digit's time slot	*/
+static void vTimerOvfCallback(void* pvParams)
+{
+	xHOS_SevenSegmentMux_t* pxHandle = (xHOS_SevenSegmentMux_t*)pvParams;
+
+	/*	Previous digit off, before its segments are changed	*/
+	vWriteBlank(pxHandle);
+
+	if (pxHandle->ucBrightness == 0)
+		return;
+
+	vINCREMENT_CURRENT_ACTIVE_COUNTER(pxHandle);
+
+	/*	Segments of the new digit, and its enable pin	*/
+	uint32_t* puiWordArr =
+		pxHandle->puiFrameArr[pxHandle->ucActiveFrame][pxHandle->ucCurrentActiveDigit];
+
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfPorts; i++)
+		vPORT_DIO_WRITE_PORT_SET_RESET(pxHandle->pucPortNumberArr[i], puiWordArr[i]);
+}
+
+/*	End of the "on" part of a digit's time slot (brightness control)	*/
+static void vTimerCcCallback(void* pvParams)
+{
+	vWriteBlank((xHOS_SevenSegmentMux_t*)pvParams);
+}
+
 /*******************************************************************************
  * RTOS Task code:
  ******************************************************************************/
@@ -142,6 +351,85 @@ static void vTask(void* pvParams)
 	}
 }
 
+/*******************************************************************************
+ * Timer drive mode init:
+ ******************************************************************************/
+static void vInitTimerDrive(xHOS_SevenSegmentMux_t* pxHandle)
+{
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	/*
+	 * Used ports. All of them are registered before any frame is calculated, so
+	 * that no port is added in the middle of a digit's words (after they were
+	 * cleared).
+	 */
+	pxHandle->ucNumberOfPorts = 0;
+	for (uint8_t i = 0; i < 8; i++)
+		ucGetPortIndex(pxHandle, pxHandle->pxSegmentPortNumberArr[i]);
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfDigits; i++)
+		ucGetPortIndex(pxHandle, pxHandle->pxDigitEnablePortNumberArr[i]);
+
+	/*	Blank words, all digits disabled	*/
+	for (uint8_t i = 0; i < configHOS_SEVEN_SEGMENT_MUX_MAX_NUMBER_OF_PORTS; i++)
+		pxHandle->puiBlankWordArr[i] = 0;
+
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfDigits; i++)
+	{
+		vAddPinToWords(	pxHandle,
+						pxHandle->puiBlankWordArr,
+						pxHandle->pxDigitEnablePortNumberArr[i],
+						pxHandle->pxDigitEnablePinNumberArr[i],
+						ucGET_LEVEL(0, pxHandle->ucEnableActiveLevel)	);
+	}
+
+	/*	Frames of the initial display buffer	*/
+	pxHandle->ucActiveFrame = 0;
+	vCalculateFrame(pxHandle);
+
+	pxHandle->ucBrightness = ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS;
+
+	/*	Init HW timer (OVF at every digit slot)	*/
+	vPORT_TIM_DISABLE_COUNTER(ucUnit);
+
+	vPORT_TIM_USE_INTERNAL_CLOCK_SOURCE(ucUnit);
+
+	VPORT_TIM_SET_PRESCALER(ucUnit, uiPORT_TIM_PRESCALER_FOR_1_MHZ);
+
+	vPORT_TIM_SET_COUNTING_DIR_UP(ucUnit);
+
+	pxHandle->uiCounterUpperLimit =
+		uiPORT_TIM_FREQ_ACTUAL_FOR_1_MHZ /
+		(pxHandle->uiRefreshRateHz * pxHandle->ucNumberOfDigits) - 1;
+
+	vPORT_TIM_SET_COUNTER_UPPER_LIMIT(ucUnit, pxHandle->uiCounterUpperLimit);
+
+	vPORT_TIM_WRITE_OC_REGISTER(
+		ucUnit,
+		uiGetCompareValue(pxHandle, ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS)	);
+
+	vPort_TIM_setOvfCallback(ucUnit, vTimerOvfCallback, (void*)pxHandle);
+	vPort_TIM_setCcCallback(ucUnit, vTimerCcCallback, (void*)pxHandle);
+
+	vPORT_TIM_CLEAR_OVF_FLAG(ucUnit);
+	vPORT_TIM_CLEAR_CC_FLAG(ucUnit);
+
+	/*	At maximum brightness, digits are never turned off within their slots	*/
+	vPORT_TIM_ENABLE_OVF_INTERRUPT(ucUnit);
+
+	/*	Init interrupt controller	*/
+	VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptTimerOvfIrqNumberArr[ucUnit],
+									configHOS_SEVEN_SEGMENT_MUX_TIMER_PRI	);
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerOvfIrqNumberArr[ucUnit]);
+
+	VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptTimerCcIrqNumberArr[ucUnit],
+									configHOS_SEVEN_SEGMENT_MUX_TIMER_PRI	);
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerCcIrqNumberArr[ucUnit]);
+
+	pxHandle->ucIsEnabled = 1;
+
+	vPORT_TIM_ENABLE_COUNTER(ucUnit);
+}
+
 /*******************************************************************************
  * API functions:
  ******************************************************************************/
@@ -157,6 +445,7 @@ void vHOS_SevenSegmentMux_init(xHOS_SevenSegmentMux_t* pxHandle)
 	char pcTaskName[configMAX_TASK_NAME_LEN];
 
 	pxHandle->ucIsEnabled = 0;
+	pxHandle->ucCurrentActiveDigit = 0;
 
 	/*	initialize segments pins as digital outputs, initially in-active	*/
 	ucLevel = ucGET_LEVEL(0, pxHandle->ucSegmentActiveLevel);
@@ -187,6 +476,12 @@ void vHOS_SevenSegmentMux_init(xHOS_SevenSegmentMux_t* pxHandle)
 	/*	Initially, point is disabled	*/
 	pxHandle->ucPointIndex = 0;
 
+	if (pxHandle->ucDriveMode == ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER)
+	{
+		vInitTimerDrive(pxHandle);
+		return;
+	}
+
 	/*	Create task	*/
 	sprintf(pcTaskName, "SSMux%d", ucCreatedObjectsCount++);
 
@@ -206,25 +501,99 @@ void vHOS_SevenSegmentMux_write(	xHOS_SevenSegmentMux_t* pxHandle,
 									uint32_t uiNum,
 									uint8_t ucPointIndex	)
 {
-    uint8_t i;
-    uint8_t ucDigVal;
-    uint8_t* pucDigArr = pxHandle->pucDisplayBuffer;
-    uint8_t ucNDigs = pxHandle->ucNumberOfDigits;
+	vWriteNumber(pxHandle, uiNum, 10);
 
-    for (i = 0; i < ucNDigs; i++)
-    {
-    	ucDigVal = uiNum % 10;
-    	pucDigArr[i] = ucDigVal;
-    	uiNum = uiNum / 10;
-        if (uiNum == 0)
-            break;
-    }
-    for (i = i + 1; i < ucNDigs; i++)
-    {
-    	pucDigArr[i] = 0;
-    }
+    pxHandle->ucPointIndex = ucPointIndex;
+
+    vHOS_SevenSegmentMux_update(pxHandle);
+}
+
+/*
+ * See header file for info.
+ */
+void vHOS_SevenSegmentMux_writeHex(	xHOS_SevenSegmentMux_t* pxHandle,
+									uint32_t uiNum,
+									uint8_t ucPointIndex	)
+{
+	vWriteNumber(pxHandle, uiNum, 16);
 
     pxHandle->ucPointIndex = ucPointIndex;
+
+    vHOS_SevenSegmentMux_update(pxHandle);
+}
+
+/*
+ * See header file for info.
+ */
+void vHOS_SevenSegmentMux_writeString(	xHOS_SevenSegmentMux_t* pxHandle,
+										const char* pcStr	)
+{
+	uint8_t* pucDigArr = pxHandle->pucDisplayBuffer;
+	uint8_t ucNDigs = pxHandle->ucNumberOfDigits;
+	uint8_t ucPointIndex = 0;
+	uint8_t ucDigit = ucNDigs;	/*	Digit of the next character, plus one	*/
+
+	for (; *pcStr != '\0'; pcStr++)
+	{
+		/*	Point of the preceding character	*/
+		if (*pcStr == '.' && ucDigit < ucNDigs)
+		{
+			ucPointIndex |= 1 << ucDigit;
+			continue;
+		}
+
+		if (ucDigit == 0)
+			break;
+
+		ucDigit--;
+		pucDigArr[ucDigit] = ucGetGlyphIndex(*pcStr);
+	}
+
+	while (ucDigit > 0)
+	{
+		ucDigit--;
+		pucDigArr[ucDigit] = ucHOS_SEVENSEGMENTMUX_GLYPH_BLANK;
+	}
+
+	pxHandle->ucPointIndex = ucPointIndex;
+
+	vHOS_SevenSegmentMux_update(pxHandle);
+}
+
+/*
+ * See header file for info.
+ */
+void vHOS_SevenSegmentMux_update(xHOS_SevenSegmentMux_t* pxHandle)
+{
+	if (pxHandle->ucDriveMode == ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER)
+		vCalculateFrame(pxHandle);
+}
+
+/*
+ * See header file for info.
+ */
+void vHOS_SevenSegmentMux_setBrightness(	xHOS_SevenSegmentMux_t* pxHandle,
+											uint8_t ucBrightness	)
+{
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	if (pxHandle->ucDriveMode != ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER)
+		return;
+
+	vPORT_TIM_WRITE_OC_REGISTER(ucUnit, uiGetCompareValue(pxHandle, ucBrightness));
+
+	pxHandle->ucBrightness = ucBrightness;
+
+	if (	ucBrightness == 0 ||
+			ucBrightness == ucHOS_SEVENSEGMENTMUX_MAX_BRIGHTNESS ||
+			!pxHandle->ucIsEnabled	)
+	{
+		vPORT_TIM_DISABLE_CC_INTERRUPT(ucUnit);
+	}
+	else
+	{
+		vPORT_TIM_ENABLE_CC_INTERRUPT(ucUnit);
+	}
 }
 
 /*
@@ -235,6 +604,13 @@ void vHOS_SevenSegmentMux_Enable(xHOS_SevenSegmentMux_t* pxHandle)
 {
 	pxHandle->ucIsEnabled = 1;
 
+	if (pxHandle->ucDriveMode == ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER)
+	{
+		vPORT_TIM_ENABLE_OVF_INTERRUPT(pxHandle->ucTimerUnitNumber);
+		vHOS_SevenSegmentMux_setBrightness(pxHandle, pxHandle->ucBrightness);
+		return;
+	}
+
 	vTaskResume(pxHandle->xTask);
 }
 
@@ -243,7 +619,15 @@ void vHOS_SevenSegmentMux_Enable(xHOS_SevenSegmentMux_t* pxHandle)
  */
 void vHOS_SevenSegmentMux_Disable(xHOS_SevenSegmentMux_t* pxHandle)
 {
-	vTaskSuspend(pxHandle->xTask);
+	if (pxHandle->ucDriveMode == ucHOS_SEVENSEGMENTMUX_DRIVE_TIMER)
+	{
+		vPORT_TIM_DISABLE_OVF_INTERRUPT(pxHandle->ucTimerUnitNumber);
+		vPORT_TIM_DISABLE_CC_INTERRUPT(pxHandle->ucTimerUnitNumber);
+	}
+	else
+	{
+		vTaskSuspend(pxHandle->xTask);
+	}
 
 	pxHandle->ucIsEnabled = 0;
 
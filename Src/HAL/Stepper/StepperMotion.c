@@ -0,0 +1,350 @@
+/*
+ * StepperMotion.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_DIO.h"
+#include "MCAL_Port/Port_Timer.h"
+#include "MCAL_Port/Port_Interrupt.h"
+#include "MCAL_Port/Port_BusyWait1us.h"
+
+/*	SELF	*/
+#include "HAL/Stepper/StepperMotion.h"
+
+#if (uiCONF_STEPPER_MOTION_QUEUE_LENGTH & (uiCONF_STEPPER_MOTION_QUEUE_LENGTH - 1)) != 0
+#error "uiCONF_STEPPER_MOTION_QUEUE_LENGTH must be a power of two"
+#endif
+
+#define uiQUEUE_MASK		(uiCONF_STEPPER_MOTION_QUEUE_LENGTH - 1)
+
+#define uiTIMER_FREQ		uiPORT_TIM_FREQ_ACTUAL_FOR_1_MHZ
+
+/*******************************************************************************
+ * Helping (private) functions:
+ ******************************************************************************/
+/*	Sets direction pins of all steppers for the segment to be executed	*/
+static inline void vSetDirs(	xHOS_StepperMotion_t* pxHandle,
+								const xHOS_StepperPlanner_segment_t* pxSeg	)
+{
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfSteppers; i++)
+	{
+		vHOS_Stepper_setDir(
+			&pxHandle->pxStepperArr[i],
+			(pxSeg->ucDirMask & (1u << i)) ?
+				ucHOS_STEPPER_DIR_BACKWARD : ucHOS_STEPPER_DIR_FORWARD	);
+	}
+}
+
+/*	Pulses step pins of the steppers in "uiMask", all at once	*/
+static inline void vStep(xHOS_StepperMotion_t* pxHandle, uint32_t uiMask)
+{
+	xHOS_Stepper_t* pxStepper;
+
+	if (uiMask == 0)
+		return;
+
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfSteppers; i++)
+	{
+		if (uiMask & (1u << i))
+		{
+			pxStepper = &pxHandle->pxStepperArr[i];
+			vPORT_DIO_WRITE_PIN(pxStepper->ucStepPort, pxStepper->ucStepPin, 1);
+		}
+	}
+
+	vPort_BusyWait1us();
+	vPort_BusyWait1us();
+
+	for (uint8_t i = 0; i < pxHandle->ucNumberOfSteppers; i++)
+	{
+		if (uiMask & (1u << i))
+		{
+			pxStepper = &pxHandle->pxStepperArr[i];
+			vPORT_DIO_WRITE_PIN(pxStepper->ucStepPort, pxStepper->ucStepPin, 0);
+			pxStepper->iCurrentPos += pxStepper->cPosIncrementer;
+		}
+	}
+}
+
+/*	Sets period of the timer (ticks until next OVF)	*/
+static inline void vSetPeriod(xHOS_StepperMotion_t* pxHandle, uint32_t uiPeriod)
+{
+	if (uiPeriod > pxHandle->uiMaxCounterValue)
+		uiPeriod = pxHandle->uiMaxCounterValue;
+	else if (uiPeriod < 2)
+		uiPeriod = 2;
+
+	vPORT_TIM_SET_COUNTER_UPPER_LIMIT(pxHandle->ucTimerUnitNumber, uiPeriod - 1);
+}
+
+/*
+ * Starts executing segment at "uiTail".
+ * Must be called while motion is stopped, from a critical section.
+ */
+static inline void vStart(xHOS_StepperMotion_t* pxHandle)
+{
+	xHOS_StepperPlanner_segment_t* pxSeg = &pxHandle->pxSegArr[pxHandle->uiTail & uiQUEUE_MASK];
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	/*	Assure idle semaphore is not available	*/
+	xSemaphoreTake(pxHandle->xIdleSemaphore, 0);
+
+	pxHandle->ucIsRunning = 1;
+
+	vSetDirs(pxHandle, pxSeg);
+
+	vPORT_TIM_WRITE_COUNTER(ucUnit, 0);
+	vSetPeriod(pxHandle, uiHOS_StepperPlanner_loadSegment(&pxHandle->xStepGen, pxSeg));
+	vPORT_TIM_CLEAR_OVF_FLAG(ucUnit);
+	vPORT_TIM_ENABLE_COUNTER(ucUnit);
+}
+
+/*
+ * Re-plans all segments that are not being executed, including the new one at
+ * "uiHead", and commits their profiles and the new segment at once.
+ *
+ * Profiles are calculated outside of the critical section. If the ISR moved to
+ * another segment meanwhile, planning is repeated with the new state.
+ */
+static void vReplanAndCommit(xHOS_StepperMotion_t* pxHandle)
+{
+	xHOS_StepperPlanner_segment_t* pxSegArr = pxHandle->pxSegArr;
+	uint32_t uiHead = pxHandle->uiHead;
+	uint32_t uiTail, uiFirst, uiCount;
+	uint8_t ucIsRunning;
+	uint64_t ulEntrySpeedSqr;
+
+	while(1)
+	{
+		taskENTER_CRITICAL();
+		{
+			uiTail = pxHandle->uiTail;
+			ucIsRunning = pxHandle->ucIsRunning;
+			ulEntrySpeedSqr = ucIsRunning ?
+				pxSegArr[uiTail & uiQUEUE_MASK].xProfile.ulExitSpeedSqr : 0;
+		}
+		taskEXIT_CRITICAL();
+
+		/*	Executed segment (if any) is not re-planned	*/
+		uiFirst = ucIsRunning ? uiTail + 1 : uiTail;
+		uiCount = uiHead + 1 - uiFirst;
+
+		vHOS_StepperPlanner_plan(	pxSegArr,
+									uiCONF_STEPPER_MOTION_QUEUE_LENGTH,
+									uiFirst,
+									uiCount,
+									ulEntrySpeedSqr	);
+
+		for (uint32_t k = 0; k < uiCount; k++)
+		{
+			vHOS_StepperPlanner_calculateProfile(	&pxSegArr[(uiFirst + k) & uiQUEUE_MASK],
+													uiTIMER_FREQ,
+													&pxHandle->pxProfileArr[k]	);
+		}
+
+		taskENTER_CRITICAL();
+		{
+			if (	uiTail == pxHandle->uiTail	&&
+					ucIsRunning == pxHandle->ucIsRunning	)
+			{
+				for (uint32_t k = 0; k < uiCount; k++)
+				{
+					pxSegArr[(uiFirst + k) & uiQUEUE_MASK].xProfile =
+						pxHandle->pxProfileArr[k];
+				}
+
+				pxHandle->uiHead = uiHead + 1;
+
+				if (!ucIsRunning)
+					vStart(pxHandle);
+
+				taskEXIT_CRITICAL();
+				return;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+
+/*******************************************************************************
+ * ISR callback:
+ ******************************************************************************/
+static void vCallback(void* pvParams)
+{
+	xHOS_StepperMotion_t* pxHandle = (xHOS_StepperMotion_t*)pvParams;
+	xHOS_StepperPlanner_segment_t* pxSeg = &pxHandle->pxSegArr[pxHandle->uiTail & uiQUEUE_MASK];
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+	uint32_t uiPeriod;
+	uint32_t uiMask;
+
+	uiMask = uiHOS_StepperPlanner_step(&pxHandle->xStepGen, pxSeg, &uiPeriod);
+	vStep(pxHandle, uiMask);
+
+	/*	If segment is done, move to the next one, or stop if queue is empty	*/
+	if (pxHandle->xStepGen.uiStepIndex == pxSeg->uiSteps)
+	{
+		pxHandle->uiTail++;
+		xSemaphoreGiveFromISR(pxHandle->xFreeSlotsSemaphore, &xHighPriorityTaskWoken);
+
+		if (pxHandle->uiTail != pxHandle->uiHead)
+		{
+			pxSeg = &pxHandle->pxSegArr[pxHandle->uiTail & uiQUEUE_MASK];
+			vSetDirs(pxHandle, pxSeg);
+			uiPeriod = uiHOS_StepperPlanner_loadSegment(&pxHandle->xStepGen, pxSeg);
+		}
+
+		else
+		{
+			vPORT_TIM_DISABLE_COUNTER(pxHandle->ucTimerUnitNumber);
+			pxHandle->ucIsRunning = 0;
+			xSemaphoreGiveFromISR(pxHandle->xIdleSemaphore, &xHighPriorityTaskWoken);
+			portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+			return;
+		}
+	}
+
+	vSetPeriod(pxHandle, uiPeriod);
+
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header file for info.
+ */
+void vHOS_StepperMotion_init(xHOS_StepperMotion_t* pxHandle)
+{
+	uint8_t ucUnit = pxHandle->ucTimerUnitNumber;
+
+	configASSERT(pxHandle->ucNumberOfSteppers <= uiCONF_STEPPER_MOTION_MAX_STEPPERS);
+
+	pxHandle->uiHead = 0;
+	pxHandle->uiTail = 0;
+	pxHandle->ucIsRunning = 0;
+
+	/*	Create semaphores	*/
+	pxHandle->xFreeSlotsSemaphore =
+		xSemaphoreCreateCountingStatic(	uiCONF_STEPPER_MOTION_QUEUE_LENGTH,
+										uiCONF_STEPPER_MOTION_QUEUE_LENGTH,
+										&pxHandle->xFreeSlotsStaticSemaphore	);
+	configASSERT(pxHandle->xFreeSlotsSemaphore != NULL);
+
+	pxHandle->xIdleSemaphore = xSemaphoreCreateBinaryStatic(&pxHandle->xIdleStaticSemaphore);
+	configASSERT(pxHandle->xIdleSemaphore != NULL);
+
+	pxHandle->xMutex = xSemaphoreCreateMutexStatic(&pxHandle->xStaticMutex);
+	configASSERT(pxHandle->xMutex != NULL);
+
+	/*	Init HW timer (1MHz, OVF interrupt, stopped)	*/
+	vPORT_TIM_DISABLE_COUNTER(ucUnit);
+
+	vPORT_TIM_USE_INTERNAL_CLOCK_SOURCE(ucUnit);
+
+	VPORT_TIM_SET_PRESCALER(ucUnit, uiPORT_TIM_PRESCALER_FOR_1_MHZ);
+
+	vPORT_TIM_CLEAR_OVF_FLAG(ucUnit);
+
+	vPort_TIM_setOvfCallback(ucUnit, vCallback, (void*)pxHandle);
+
+	vPORT_TIM_ENABLE_OVF_INTERRUPT(ucUnit);
+
+	vPORT_TIM_SET_COUNTING_DIR_UP(ucUnit);
+
+	pxHandle->uiMaxCounterValue = (1ul << pucPortTimerCounterSizeInBits[ucUnit]) - 1;
+	vPORT_TIM_SET_COUNTER_UPPER_LIMIT(ucUnit, pxHandle->uiMaxCounterValue);
+
+	/*	Init interrupt controller	*/
+	VPORT_INTERRUPT_SET_PRIORITY(
+		pxPortInterruptTimerOvfIrqNumberArr[ucUnit],
+		configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
+
+	vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptTimerOvfIrqNumberArr[ucUnit]);
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_StepperMotion_enqueue(	xHOS_StepperMotion_t* pxHandle,
+										const int32_t* piDeltaArr,
+										uint32_t uiSpeed,
+										TickType_t xTimeout	)
+{
+	xHOS_StepperPlanner_segment_t* pxSeg;
+	uint32_t uiHead;
+
+	if (!xSemaphoreTake(pxHandle->xMutex, xTimeout))
+		return 0;
+
+	if (!xSemaphoreTake(pxHandle->xFreeSlotsSemaphore, xTimeout))
+	{
+		xSemaphoreGive(pxHandle->xMutex);
+		return 0;
+	}
+
+	/*	Slot at "uiHead" is not seen by the ISR until committed	*/
+	uiHead = pxHandle->uiHead;
+	pxSeg = &pxHandle->pxSegArr[uiHead & uiQUEUE_MASK];
+
+	if (!ucHOS_StepperPlanner_initSegment(	pxSeg,
+											piDeltaArr,
+											pxHandle->ucNumberOfSteppers,
+											uiSpeed,
+											pxHandle->uiAccel	)	)
+	{
+		xSemaphoreGive(pxHandle->xFreeSlotsSemaphore);
+		xSemaphoreGive(pxHandle->xMutex);
+		return 1;
+	}
+
+	/*	Junction with the previous segment, if it is not done yet	*/
+	if (pxHandle->uiTail != uiHead)
+	{
+		vHOS_StepperPlanner_setJunction(	pxSeg,
+											&pxHandle->pxSegArr[(uiHead - 1) & uiQUEUE_MASK],
+											pxHandle->uiMaxJunctionJerk	);
+	}
+
+	vReplanAndCommit(pxHandle);
+
+	xSemaphoreGive(pxHandle->xMutex);
+
+	return 1;
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_StepperMotion_blockUntilIdle(	xHOS_StepperMotion_t* pxHandle,
+											TickType_t xTimeout	)
+{
+	if (!pxHandle->ucIsRunning)
+		return 1;
+
+	if (!xSemaphoreTake(pxHandle->xIdleSemaphore, xTimeout))
+		return 0;
+
+	/*	Keep it available for other waiting tasks (if any)	*/
+	xSemaphoreGive(pxHandle->xIdleSemaphore);
+
+	return 1;
+}
+
+/*
+ * See header file for info.
+ */
+uint8_t ucHOS_StepperMotion_isRunning(xHOS_StepperMotion_t* pxHandle)
+{
+	return pxHandle->ucIsRunning;
+}
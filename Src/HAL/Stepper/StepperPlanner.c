@@ -0,0 +1,369 @@
+/*
+ * StepperPlanner.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include "stdint.h"
+
+/*	SELF	*/
+#include "HAL/Stepper/StepperPlanner.h"
+
+/*******************************************************************************
+ * Helping functions / macros:
+ ******************************************************************************/
+#define ulMIN(ulA, ulB)		(((ulA) < (ulB)) ? (ulA) : (ulB))
+
+/*	Largest period (Q8), keeps "2 * period" from overflowing	*/
+#define uiMAX_PERIOD_Q8		(1ul << 30)
+
+/*
+ * Integer square root (floor). Bit by bit, 32 iterations.
+ */
+static uint32_t uiSqrt64(uint64_t ulX)
+{
+	uint64_t ulRes = 0;
+	uint64_t ulBit = 1ull << 62;
+
+	while (ulBit > ulX)
+		ulBit >>= 2;
+
+	while (ulBit != 0)
+	{
+		if (ulX >= ulRes + ulBit)
+		{
+			ulX -= ulRes + ulBit;
+			ulRes = (ulRes >> 1) + ulBit;
+		}
+		else
+		{
+			ulRes >>= 1;
+		}
+		ulBit >>= 2;
+	}
+
+	return (uint32_t)ulRes;
+}
+
+static inline uint32_t uiAbs(int32_t iX)
+{
+	return (iX < 0) ? -(uint32_t)iX : (uint32_t)iX;
+}
+
+/*	Converts a period to Q8, limited to "uiMAX_PERIOD_Q8"	*/
+static inline uint32_t uiPeriodQ8(uint64_t ulTimerFreq, uint64_t ulRate)
+{
+	uint64_t ulPeriod = (ulTimerFreq << 8) / ulRate;
+	return (uint32_t)ulMIN(ulPeriod, uiMAX_PERIOD_Q8);
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_StepperPlanner_initSegment(	xHOS_StepperPlanner_segment_t* pxSeg,
+											const int32_t* piDeltaArr,
+											uint8_t ucNumberOfSteppers,
+											uint32_t uiSpeed,
+											uint32_t uiAccel	)
+{
+	uint64_t ulLengthSqr = 0;
+	uint32_t uiMax = 0;
+	uint32_t uiAbsDelta;
+
+	pxSeg->ucNumberOfSteppers = ucNumberOfSteppers;
+	pxSeg->ucDirMask = 0;
+
+	for (uint8_t i = 0; i < ucNumberOfSteppers; i++)
+	{
+		pxSeg->piDeltaArr[i] = piDeltaArr[i];
+
+		uiAbsDelta = uiAbs(piDeltaArr[i]);
+		if (uiAbsDelta > uiMax)
+			uiMax = uiAbsDelta;
+
+		ulLengthSqr += (uint64_t)uiAbsDelta * uiAbsDelta;
+
+		if (piDeltaArr[i] < 0)
+			pxSeg->ucDirMask |= 1u << i;
+	}
+
+	if (uiMax == 0)
+		return 0;
+
+	pxSeg->uiSteps = uiMax;
+	pxSeg->uiLength = uiSqrt64(ulLengthSqr);
+	pxSeg->uiAccel = (uiAccel != 0) ? uiAccel : 1;
+	pxSeg->ulNominalSpeedSqr = (uint64_t)uiSpeed * uiSpeed;
+	pxSeg->ulMaxEntrySpeedSqr = 0;
+	pxSeg->ulEntrySpeedSqr = 0;
+	pxSeg->ulExitSpeedSqr = 0;
+
+	return 1;
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_StepperPlanner_setJunction(	xHOS_StepperPlanner_segment_t* pxSeg,
+										const xHOS_StepperPlanner_segment_t* pxPrev,
+										uint32_t uiMaxJunctionJerk	)
+{
+	int64_t lPrev, lCur, lDiff;
+	uint64_t ulMaxDiff = 0;
+	uint64_t ulSpeed, ulSpeedSqr;
+
+	/*
+	 * Speed of stepper 'i' is (speed * delta[i] / length). Find the largest
+	 * instant change of it per unit of junction speed. (Q16)
+	 */
+	for (uint8_t i = 0; i < pxSeg->ucNumberOfSteppers; i++)
+	{
+		lPrev = ((int64_t)pxPrev->piDeltaArr[i] * 65536) / pxPrev->uiLength;
+		lCur = ((int64_t)pxSeg->piDeltaArr[i] * 65536) / pxSeg->uiLength;
+		lDiff = (lPrev > lCur) ? (lPrev - lCur) : (lCur - lPrev);
+
+		if ((uint64_t)lDiff > ulMaxDiff)
+			ulMaxDiff = lDiff;
+	}
+
+	ulSpeedSqr = ulMIN(pxSeg->ulNominalSpeedSqr, pxPrev->ulNominalSpeedSqr);
+
+	if (ulMaxDiff != 0)
+	{
+		ulSpeed = ((uint64_t)uiMaxJunctionJerk << 16) / ulMaxDiff;
+		ulSpeedSqr = ulMIN(ulSpeedSqr, ulSpeed * ulSpeed);
+	}
+
+	pxSeg->ulMaxEntrySpeedSqr = ulSpeedSqr;
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_StepperPlanner_plan(	xHOS_StepperPlanner_segment_t* pxSegArr,
+								uint32_t uiQueueLength,
+								uint32_t uiFirst,
+								uint32_t uiCount,
+								uint64_t ulFirstEntrySpeedSqr	)
+{
+	xHOS_StepperPlanner_segment_t* pxSeg;
+	uint64_t ulSpeedSqr;
+	uint64_t ulReachableSqr;
+	uint32_t uiMask = uiQueueLength - 1;
+
+	if (uiCount == 0)
+		return;
+
+	/*
+	 * Backward pass: every segment must be able to decelerate to the entry
+	 * speed of the next one. (Last one to stand still)
+	 */
+	ulSpeedSqr = 0;
+	for (uint32_t k = uiCount; k-- > 0;)
+	{
+		pxSeg = &pxSegArr[(uiFirst + k) & uiMask];
+
+		pxSeg->ulExitSpeedSqr = ulSpeedSqr;
+
+		if (k == 0)
+		{
+			pxSeg->ulEntrySpeedSqr = ulFirstEntrySpeedSqr;
+		}
+		else
+		{
+			ulReachableSqr = ulSpeedSqr + 2 * (uint64_t)pxSeg->uiAccel * pxSeg->uiLength;
+			pxSeg->ulEntrySpeedSqr = ulMIN(pxSeg->ulMaxEntrySpeedSqr, ulReachableSqr);
+		}
+
+		ulSpeedSqr = pxSeg->ulEntrySpeedSqr;
+	}
+
+	/*
+	 * Forward pass: every segment must be able to accelerate from its entry
+	 * speed to its exit speed.
+	 */
+	ulSpeedSqr = ulFirstEntrySpeedSqr;
+	for (uint32_t k = 0; k < uiCount; k++)
+	{
+		pxSeg = &pxSegArr[(uiFirst + k) & uiMask];
+
+		pxSeg->ulEntrySpeedSqr = ulSpeedSqr;
+
+		ulReachableSqr = ulSpeedSqr + 2 * (uint64_t)pxSeg->uiAccel * pxSeg->uiLength;
+		pxSeg->ulExitSpeedSqr = ulMIN(pxSeg->ulExitSpeedSqr, ulReachableSqr);
+
+		ulSpeedSqr = pxSeg->ulExitSpeedSqr;
+	}
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_StepperPlanner_calculateProfile(	const xHOS_StepperPlanner_segment_t* pxSeg,
+											uint32_t uiTimerFreq,
+											xHOS_StepperPlanner_profile_t* pxProfile	)
+{
+	uint64_t ulN = pxSeg->uiSteps;
+	uint64_t ulL = pxSeg->uiLength;
+	uint64_t ulEntryRate, ulNominalRate, ulExitRate, ulAccel;
+	uint64_t ulEntryRateSqr, ulNominalRateSqr, ulExitRateSqr, ulPeakRateSqr;
+	uint64_t ulAccelSteps, ulDecelSteps;
+	int64_t lNum;
+
+	/*	Convert path speeds and acceleration to those of the major stepper	*/
+	ulEntryRate = uiSqrt64(pxSeg->ulEntrySpeedSqr) * ulN / ulL;
+	ulNominalRate = uiSqrt64(pxSeg->ulNominalSpeedSqr) * ulN / ulL;
+	ulExitRate = uiSqrt64(pxSeg->ulExitSpeedSqr) * ulN / ulL;
+	ulAccel = (uint64_t)pxSeg->uiAccel * ulN / ulL;
+
+	if (ulNominalRate == 0)		ulNominalRate = 1;
+	if (ulAccel == 0)			ulAccel = 1;
+	ulEntryRate = ulMIN(ulEntryRate, ulNominalRate);
+	ulExitRate = ulMIN(ulExitRate, ulNominalRate);
+
+	ulEntryRateSqr = ulEntryRate * ulEntryRate;
+	ulNominalRateSqr = ulNominalRate * ulNominalRate;
+	ulExitRateSqr = ulExitRate * ulExitRate;
+
+	/*	Steps needed to reach nominal rate, and to decelerate from it	*/
+	ulAccelSteps = (ulNominalRateSqr - ulEntryRateSqr) / (2 * ulAccel);
+	ulDecelSteps = (ulNominalRateSqr - ulExitRateSqr) / (2 * ulAccel);
+
+	if (ulAccelSteps + ulDecelSteps > ulN)
+	{
+		/*	Nominal rate is not reached, acceleration meets deceleration	*/
+		lNum = (int64_t)(2 * ulAccel * ulN + ulExitRateSqr) - (int64_t)ulEntryRateSqr;
+		if (lNum < 0)
+			lNum = 0;
+
+		ulAccelSteps = ulMIN((uint64_t)lNum / (4 * ulAccel), ulN);
+		ulDecelSteps = ulN - ulAccelSteps;
+		ulPeakRateSqr = ulEntryRateSqr + 2 * ulAccel * ulAccelSteps;
+	}
+	else
+	{
+		ulPeakRateSqr = ulNominalRateSqr;
+	}
+
+	pxProfile->uiAccelUntil = (uint32_t)ulAccelSteps;
+	pxProfile->uiDecelAfter = (uint32_t)(ulN - ulDecelSteps);
+
+	/*
+	 * Recurrence index. Rate of index 'n' is: sqrt(2 * a * (n + 0.5)), hence:
+	 * n = r^2 / (2 * a) - 0.5. (rounded)
+	 */
+	pxProfile->iEntryN = (int32_t)(ulEntryRateSqr / (2 * ulAccel));
+	pxProfile->iDecelN = -(int32_t)(ulPeakRateSqr / (2 * ulAccel));
+	if (pxProfile->iDecelN == 0)
+		pxProfile->iDecelN = -1;
+
+	/*
+	 * Entry period. From stand still (or below rate of n = 1), it is:
+	 * 0.676 * f * sqrt(2 / a), (0.676 * sqrt(2) * 256 ~= 245). Otherwise, entry
+	 * rate is rounded to that of "iEntryN", as the recurrence accumulates any
+	 * mismatch between them.
+	 */
+	if (pxProfile->iEntryN != 0)
+		pxProfile->uiEntryPeriodQ8 = uiPeriodQ8(
+			uiTimerFreq,
+			uiSqrt64(ulAccel * (2 * (uint64_t)pxProfile->iEntryN + 1))	);
+	else
+		pxProfile->uiEntryPeriodQ8 = (uint32_t)ulMIN(
+			(uint64_t)uiTimerFreq * 245 / uiSqrt64(ulAccel),
+			uiMAX_PERIOD_Q8	);
+
+	pxProfile->uiNominalPeriodQ8 = uiPeriodQ8(uiTimerFreq, ulNominalRate);
+
+	if (ulExitRate != 0)
+		pxProfile->uiExitPeriodQ8 = uiPeriodQ8(uiTimerFreq, ulExitRate);
+	else
+		pxProfile->uiExitPeriodQ8 = uiMAX_PERIOD_Q8;
+
+	pxProfile->ulExitSpeedSqr = pxSeg->ulExitSpeedSqr;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_StepperPlanner_loadSegment(	xHOS_StepperPlanner_stepGen_t* pxGen,
+											const xHOS_StepperPlanner_segment_t* pxSeg	)
+{
+	pxGen->uiStepIndex = 0;
+	pxGen->iN = pxSeg->xProfile.iEntryN;
+	pxGen->uiPeriodQ8 = pxSeg->xProfile.uiEntryPeriodQ8;
+	pxGen->ucIsDecelerating = 0;
+
+	for (uint8_t i = 0; i < pxSeg->ucNumberOfSteppers; i++)
+		pxGen->puiErrArr[i] = pxSeg->uiSteps >> 1;
+
+	return pxGen->uiPeriodQ8 >> 8;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_StepperPlanner_step(	xHOS_StepperPlanner_stepGen_t* pxGen,
+									const xHOS_StepperPlanner_segment_t* pxSeg,
+									uint32_t* puiPeriod	)
+{
+	const xHOS_StepperPlanner_profile_t* pxProfile = &pxSeg->xProfile;
+	uint32_t uiN = pxSeg->uiSteps;
+	uint32_t uiMask = 0;
+	uint32_t uiPeriod = pxGen->uiPeriodQ8;
+	int32_t iDen;
+
+	/*	Bresenham: stepper 'i' steps |delta[i]| times over the N steps	*/
+	for (uint8_t i = 0; i < pxSeg->ucNumberOfSteppers; i++)
+	{
+		pxGen->puiErrArr[i] += uiAbs(pxSeg->piDeltaArr[i]);
+		if (pxGen->puiErrArr[i] >= uiN)
+		{
+			pxGen->puiErrArr[i] -= uiN;
+			uiMask |= 1u << i;
+		}
+	}
+
+	pxGen->uiStepIndex++;
+
+	/*	Period until next step	*/
+	if (pxGen->uiStepIndex < pxProfile->uiAccelUntil)
+	{
+		pxGen->iN++;
+		uiPeriod -= (2 * uiPeriod) / (uint32_t)(4 * pxGen->iN + 1);
+		if (uiPeriod < pxProfile->uiNominalPeriodQ8)
+			uiPeriod = pxProfile->uiNominalPeriodQ8;
+	}
+
+	else if (pxGen->uiStepIndex >= pxProfile->uiDecelAfter)
+	{
+		if (!pxGen->ucIsDecelerating)
+		{
+			pxGen->ucIsDecelerating = 1;
+			pxGen->iN = pxProfile->iDecelN;
+		}
+
+		pxGen->iN++;
+		if (pxGen->iN < 0)
+		{
+			iDen = -(4 * pxGen->iN + 1);
+			uiPeriod += (2 * uiPeriod) / (uint32_t)iDen;
+		}
+
+		if (uiPeriod > pxProfile->uiExitPeriodQ8)
+			uiPeriod = pxProfile->uiExitPeriodQ8;
+	}
+
+	else
+	{
+		uiPeriod = pxProfile->uiNominalPeriodQ8;
+	}
+
+	pxGen->uiPeriodQ8 = uiPeriod;
+	*puiPeriod = uiPeriod >> 8;
+
+	return uiMask;
+}
@@ -0,0 +1,226 @@
+/*
+ * StepperPlanner_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the stepper motion planner and step generator.
+ * It feeds a path of segments to the planner the same way "StepperMotion"
+ * does (segments are added while others are executed, executing segment is
+ * never re-planned), runs the step generator over them, and checks the
+ * resultant step timeline.
+ *
+ * It does not depend on the RTOS nor on the target, and is built and run from
+ * repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_STEPPER_PLANNER_HOST_TEST -IInc \
+ * 			Src/HAL/Stepper/StepperPlanner.c \
+ * 			Src/HAL/Stepper/StepperPlanner_Test.c -lm -o sp_test
+ *
+ * 		./sp_test
+ *
+ * Checks:
+ * 		-	Every stepper made exactly the requested number of steps.
+ * 		-	Path speed never exceeded the nominal speed.
+ * 		-	Path acceleration between successive steps stayed within bound.
+ * 		-	Speed is continuous at junctions.
+ * 		-	Motion ended at (near) stand still.
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_STEPPER_PLANNER_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "HAL/Stepper/StepperPlanner.h"
+
+#define TIMER_FREQ			1000000
+#define QUEUE_LENGTH		16
+#define AHEAD				4
+#define NUMBER_OF_STEPPERS	3
+#define SPEED				8000
+#define ACCEL				40000
+#define JUNCTION_JERK		400
+#define ACCEL_WINDOW		0.01
+#define MAX_SPEED_ERR		1.02
+/*
+ * Within a segment, acceleration of the major stepper is rounded down, hence
+ * path acceleration never exceeds the nominal. Measured one however includes:
+ * 		-	Speed steps at junctions (within "MAX_JUNCTION_ERR"), when a window
+ * 			spans a junction.
+ * 		-	Periods truncated to whole timer ticks.
+ * Which are 2.7% at most for this path and 1MHz timer.
+ */
+#define MAX_ACCEL_ERR		1.05
+#define MAX_JUNCTION_ERR	0.15
+
+/*	Path (relative moves), ends with an empty segment	*/
+static const int32_t ppiPath[][NUMBER_OF_STEPPERS] = {
+	{ 4000,     0,    0},
+	{ 4000,   200,    0},		/*	Small turn, high junction speed	*/
+	{    0,  3000,    0},		/*	90 degrees, low junction speed	*/
+	{-2000, -2000,  500},
+	{-2000, -2000,  500},		/*	Collinear, full speed	*/
+	{   30,    10,    0},		/*	Short segment	*/
+	{   30,    10,    0},
+	{ 6000,  1000, -1000},
+	{-6000, -1000,    0},		/*	Reversal	*/
+	{  100,   100,  100},
+	{    0,     0,    0}
+};
+
+static xHOS_StepperPlanner_segment_t pxSegArr[QUEUE_LENGTH];
+static uint32_t uiHead = 0, uiTail = 0;
+
+/*	Enqueues a segment, the same way "StepperMotion" does	*/
+static void vEnqueue(const int32_t* piDelta, uint8_t ucIsRunning)
+{
+	xHOS_StepperPlanner_segment_t* pxSeg = &pxSegArr[uiHead & (QUEUE_LENGTH - 1)];
+	uint32_t uiFirst;
+	uint64_t ulEntrySqr;
+
+	if (!ucHOS_StepperPlanner_initSegment(pxSeg, piDelta, NUMBER_OF_STEPPERS, SPEED, ACCEL))
+		return;
+
+	if (uiHead != uiTail)
+		vHOS_StepperPlanner_setJunction(
+			pxSeg, &pxSegArr[(uiHead - 1) & (QUEUE_LENGTH - 1)], JUNCTION_JERK);
+
+	uiHead++;
+
+	uiFirst = ucIsRunning ? uiTail + 1 : uiTail;
+	ulEntrySqr = ucIsRunning ?
+		pxSegArr[uiTail & (QUEUE_LENGTH - 1)].xProfile.ulExitSpeedSqr : 0;
+
+	vHOS_StepperPlanner_plan(pxSegArr, QUEUE_LENGTH, uiFirst, uiHead - uiFirst, ulEntrySqr);
+
+	for (uint32_t i = uiFirst; i != uiHead; i++)
+	{
+		xHOS_StepperPlanner_segment_t* pxS = &pxSegArr[i & (QUEUE_LENGTH - 1)];
+		vHOS_StepperPlanner_calculateProfile(pxS, TIMER_FREQ, &pxS->xProfile);
+	}
+}
+
+int main(void)
+{
+	xHOS_StepperPlanner_stepGen_t xGen;
+	xHOS_StepperPlanner_segment_t* pxSeg;
+	uint32_t uiNumberOfSegments = sizeof(ppiPath) / sizeof(ppiPath[0]);
+	uint32_t uiNext = 0;
+	int64_t plPos[NUMBER_OF_STEPPERS] = {0};
+	int64_t plExpected[NUMBER_OF_STEPPERS] = {0};
+	uint32_t uiPeriod, uiMask;
+	double dSpeed, dPrevSpeed = 0.0, dPrevTime = 0.0, dAccel;
+	double dWindowStart = 0.0, dWindowDist = 0.0;
+	double dWindowSpeed, dPrevWindowSpeed = -1.0, dPrevWindowCenter = 0.0;
+	double dMaxSpeed = 0.0, dMaxAccel = 0.0, dMaxJunctionErr = 0.0;
+	double dTime = 0.0;
+	uint64_t ulSteps = 0;
+	uint8_t ucFailed = 0;
+
+	for (uint32_t i = 0; i < uiNumberOfSegments; i++)
+		for (uint8_t j = 0; j < NUMBER_OF_STEPPERS; j++)
+			plExpected[j] += ppiPath[i][j];
+
+	while (uiNext < uiNumberOfSegments && uiHead - uiTail < AHEAD)
+		vEnqueue(ppiPath[uiNext++], 0);
+
+	while (uiTail != uiHead)
+	{
+		pxSeg = &pxSegArr[uiTail & (QUEUE_LENGTH - 1)];
+		uiPeriod = uiHOS_StepperPlanner_loadSegment(&xGen, pxSeg);
+
+		/*	Speed at junction, from the last period of previous segment	*/
+		if (dPrevSpeed > 0.0)
+		{
+			dSpeed = (double)TIMER_FREQ / uiPeriod * pxSeg->uiLength / pxSeg->uiSteps;
+			double dErr = fabs(dSpeed - dPrevSpeed) / fmax(dPrevSpeed, dSpeed);
+			/*	Near stand still, steps are too coarse to compare	*/
+			if (fmin(dSpeed, dPrevSpeed) > 4 * sqrt(ACCEL) && dErr > dMaxJunctionErr)
+				dMaxJunctionErr = dErr;
+		}
+
+		while (xGen.uiStepIndex < pxSeg->uiSteps)
+		{
+			dTime += (double)uiPeriod / TIMER_FREQ;
+			uiMask = uiHOS_StepperPlanner_step(&xGen, pxSeg, &uiPeriod);
+			ulSteps++;
+
+			for (uint8_t j = 0; j < NUMBER_OF_STEPPERS; j++)
+				if (uiMask & (1u << j))
+					plPos[j] += (pxSeg->ucDirMask & (1u << j)) ? -1 : 1;
+
+			/*	Path speed of the period just ended	*/
+			dSpeed = pxSeg->uiLength / (double)pxSeg->uiSteps / (dTime - dPrevTime);
+			if (dSpeed > dMaxSpeed)
+				dMaxSpeed = dSpeed;
+
+			/*
+			 * Path acceleration, from average speeds of windows of
+			 * "ACCEL_WINDOW" seconds (periods are integer ticks, hence speed of
+			 * a single period is too coarse to be differentiated). A window
+			 * ends at the first step after "ACCEL_WINDOW", which at low speeds
+			 * is significantly later, hence speed difference is divided by
+			 * actual time between windows' centers.
+			 */
+			dWindowDist += pxSeg->uiLength / (double)pxSeg->uiSteps;
+			if (dTime - dWindowStart >= ACCEL_WINDOW)
+			{
+				dWindowSpeed = dWindowDist / (dTime - dWindowStart);
+				if (dPrevWindowSpeed >= 0.0)
+				{
+					dAccel = fabs(dWindowSpeed - dPrevWindowSpeed) /
+						((dWindowStart + dTime) / 2.0 - dPrevWindowCenter);
+					if (dAccel > dMaxAccel)
+						dMaxAccel = dAccel;
+				}
+				dPrevWindowSpeed = dWindowSpeed;
+				dPrevWindowCenter = (dWindowStart + dTime) / 2.0;
+				dWindowStart = dTime;
+				dWindowDist = 0.0;
+			}
+
+			dPrevSpeed = dSpeed;
+			dPrevTime = dTime;
+		}
+
+		/*	Segment is done, executor moves to the next one	*/
+		uiTail++;
+		while (uiNext < uiNumberOfSegments && uiHead - uiTail < AHEAD)
+			vEnqueue(ppiPath[uiNext++], uiTail != uiHead);
+	}
+
+	printf("Steps: %llu, time: %.3f s\n", (unsigned long long)ulSteps, dTime);
+	printf("Max path speed: %.1f (nominal: %d)\n", dMaxSpeed, SPEED);
+	printf("Max path accel: %.1f (nominal: %d)\n", dMaxAccel, ACCEL);
+	printf("Max junction speed jump: %.1f %%\n", dMaxJunctionErr * 100.0);
+	printf("Final speed: %.1f\n", dPrevSpeed);
+
+	for (uint8_t j = 0; j < NUMBER_OF_STEPPERS; j++)
+	{
+		if (plPos[j] != plExpected[j])
+		{
+			printf("Stepper %u: position %lld, expected %lld\n",
+				j, (long long)plPos[j], (long long)plExpected[j]);
+			ucFailed = 1;
+		}
+	}
+
+	if (	dMaxSpeed > SPEED * MAX_SPEED_ERR				||
+			dMaxAccel > ACCEL * MAX_ACCEL_ERR				||
+			dMaxJunctionErr > MAX_JUNCTION_ERR				||
+			dPrevSpeed > 2 * sqrt(2.0 * ACCEL)				||
+			ucFailed	)
+	{
+		printf("FAILED\n");
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_STEPPER_PLANNER_HOST_TEST	*/
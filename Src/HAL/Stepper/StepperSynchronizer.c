@@ -39,7 +39,7 @@ static inline uint32_t uiGetNorm(int32_t* piArr, int8_t ucN)
 
 	for (uint8_t i = 0; i < ucN; i++)
 	{
-		ulNormSquared += piArr[i] * piArr[i];
+		ulNormSquared += (int64_t)piArr[i] * piArr[i];
 	}
 
 	uint32_t uiNorm = sqrt(ulNormSquared);
@@ -61,9 +61,7 @@ void vHOS_StepperSynchronizer_move(	xHOS_StepperSynchronizer_t* pxHandle,
 	xHOS_Stepper_t* pxStepperArr = pxHandle->pxStepperArr;
 	uint32_t* puiStepsDoneArr = pxHandle->puiStepsDoneArr;
 
-	/*
-	 * Set directions of all steppers, and make 'piNArr' a magnitude array.
-	 * Also, reset the 'puiStepsDoneArr[]' array	*/
+	/*	Set directions of all steppers, and make 'piNArr' a magnitude array	*/
 	for (uint8_t i = 0; i < ucN; i++)
 	{
 		if (piNArr[i] >= 0)
@@ -73,13 +71,14 @@ void vHOS_StepperSynchronizer_move(	xHOS_StepperSynchronizer_t* pxHandle,
 			vHOS_Stepper_setDir(&pxHandle->pxStepperArr[i], ucHOS_STEPPER_DIR_BACKWARD);
 			piNArr[i] = -piNArr[i];
 		}
-
-		puiStepsDoneArr[i] = 0;
 	}
 
 	/*	Get necessary parameters	*/
 	uint8_t ucMaxIndex = ucGetMaxIndex(piNArr, ucN);
 
+	if (piNArr[ucMaxIndex] == 0)
+		return;
+
 	uint32_t uiNorm = uiGetNorm(piNArr, ucN);
 
 	uint32_t uiStepIntervalUs = ( (uint64_t)uiSpeedMagnitudeInverseUs *
@@ -92,31 +91,30 @@ void vHOS_StepperSynchronizer_move(	xHOS_StepperSynchronizer_t* pxHandle,
 	/*	Take 'HardwareDelay_t' unit mutex	*/
 	xSemaphoreTake(pxHandle->pxHardwareDelayHandle->xMutex, portMAX_DELAY);
 
-	/*	Move steppers synchronously	*/
-	uint32_t uiTheo;
-	while(puiStepsDoneArr[ucMaxIndex] < piNArr[ucMaxIndex])
-	{
-		/*	Step stepper[maxIndex]	*/
-		vHOS_Stepper_stepSingle(&pxStepperArr[ucMaxIndex]);
-		puiStepsDoneArr[ucMaxIndex]++;
+	/*
+	 * Move steppers synchronously. Steps of each stepper are distributed over
+	 * steps of stepper[maxIndex] using Bresenham's algorithm, where
+	 * 'puiStepsDoneArr[i]' is the error accumulator of stepper[i].
+	 */
+	uint32_t uiMaxN = piNArr[ucMaxIndex];
+	for (uint8_t i = 0; i < ucN; i++)
+		puiStepsDoneArr[i] = uiMaxN / 2;
 
-		/*	Loop on all other steppers	*/
+	for (uint32_t uiStep = 0; uiStep < uiMaxN; uiStep++)
+	{
 		for (uint8_t i = 0; i < ucN; i++)
 		{
-			if (i == ucMaxIndex)
-				continue;
-
 			/*	check if it's time to step	*/
-			uiTheo = ((uint64_t)puiStepsDoneArr[ucMaxIndex] * (uint64_t)piNArr[i]) / piNArr[ucMaxIndex];
-			if (puiStepsDoneArr[i] < uiTheo)
+			puiStepsDoneArr[i] += piNArr[i];
+			if (puiStepsDoneArr[i] >= uiMaxN)
 			{
+				puiStepsDoneArr[i] -= uiMaxN;
 				vHOS_Stepper_stepSingle(&pxStepperArr[i]);
-				puiStepsDoneArr[i]++;
 			}
 		}
 
 		/*	HW (RTOS handled) Delay until next step of stepper[maxIndex]	*/
-		vHOS_HardwareDelay_delayUs(pxHandle->pxHardwareDelayHandle, uiStepIntervalTicks);
+		vHOS_HardwareDelay_delayTicks(pxHandle->pxHardwareDelayHandle, uiStepIntervalTicks);
 	}
 
 	/*	Give 'HardwareDelay_t' unit mutex	*/
@@ -0,0 +1,33 @@
+/*
+ * Port_ASM.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the ASM port, used only by "TFT_Test.c". Same
+ * functions, in plain C.
+ */
+
+#ifndef COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_ASM_H_
+#define COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_ASM_H_
+
+#include <stdint.h>
+
+/*
+ * Reverses byte order in each 16-bit, of a given 32-bit value.
+ */
+static inline uint32_t uiPort_ASM_reverseEach16(uint32_t uiX)
+{
+	return ((uiX & 0x00FF00FF) << 8) | ((uiX >> 8) & 0x00FF00FF);
+}
+
+/*
+ * Reverses byte order of a given 16-bit value.
+ */
+static inline uint16_t uiPort_ASM_reverse16(uint16_t uiX)
+{
+	return (uint16_t)((uiX << 8) | (uiX >> 8));
+}
+
+
+
+#endif /* COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_ASM_H_ */
@@ -0,0 +1,29 @@
+/*
+ * Port_DIO.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the DIO port, used only by "TFT_Test.c". Output levels
+ * are kept in "ppucHostPortDioLevelArr[][]" (defined in the test), so that the
+ * test can tell commands from data by the A0 pin.
+ */
+
+#ifndef COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_DIO_H_
+#define COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_DIO_H_
+
+#include <stdint.h>
+
+extern uint8_t ppucHostPortDioLevelArr[4][16];
+
+static inline void vPort_DIO_initPinOutput(uint8_t ucPortNumber, uint8_t ucPinNumber)
+{
+	(void)ucPortNumber;
+	(void)ucPinNumber;
+}
+
+#define vPORT_DIO_WRITE_PIN(ucPortNumber, ucPinNumber, ucLevel)	\
+	(	ppucHostPortDioLevelArr[(ucPortNumber)][(ucPinNumber)] = (ucLevel)	)
+
+
+
+#endif /* COTS_OS_SRC_HAL_TFT_HOSTTESTPORT_PORT_DIO_H_ */
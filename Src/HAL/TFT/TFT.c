@@ -139,12 +139,54 @@ static void vHOS_TFT_writeDataArrMultiple(xHOS_TFT_t* pxTFT, int8_t* pcArr, uint
 #endif		/*	ucHOS_TFT_DATA_CONNECTION		*/
 }
 
+/*
+ * Sends "uiN" pixels of a single color.
+ *
+ * Notes:
+ * 		-	Color is expanded into the line buffer (only if it is not already
+ * 			filled with it), which is then sent once per "uiHOS_TFT_LINE_BUFFER_PIXELS"
+ * 			pixels, and once more for the remaining pixels (if any).
+ */
+static void vWriteSingleColor(xHOS_TFT_t* pxTFT, xLIB_Color16_t xColor, uint32_t uiN)
+{
+	/*	Expand color into the line buffer	*/
+	if (!pxTFT->ucIsLineBufferFilled || pxTFT->xLineBufferColor != xColor)
+	{
+		for (uint32_t i = 0; i < uiHOS_TFT_LINE_BUFFER_PIXELS; i++)
+			pxTFT->pxLineBuffer[i] = xColor;
+
+		pxTFT->xLineBufferColor = xColor;
+		pxTFT->ucIsLineBufferFilled = 1;
+	}
+
+	/*	Send full buffers	*/
+	uint32_t uiNumberOfBuffers = uiN / uiHOS_TFT_LINE_BUFFER_PIXELS;
+	if (uiNumberOfBuffers > 0)
+	{
+		vHOS_TFT_writeDataArrMultiple(	pxTFT,
+										(int8_t*)pxTFT->pxLineBuffer,
+										2 * uiHOS_TFT_LINE_BUFFER_PIXELS,
+										uiNumberOfBuffers	);
+	}
+
+	/*	Send remaining pixels	*/
+	uint32_t uiRemaining = uiN % uiHOS_TFT_LINE_BUFFER_PIXELS;
+	if (uiRemaining > 0)
+	{
+		vHOS_TFT_writeDataArr(	pxTFT,
+								(int8_t*)pxTFT->pxLineBuffer,
+								2 * uiRemaining	);
+	}
+}
+
 static void vReset(xHOS_TFT_t* pxTFT)
 {
+#if ucHOS_TFT_DATA_CONNECTION == ucHOS_TFT_DATA_CONNECTION_PARALLEL
 	/*	Flush shift register	*/
 	vPORT_DIO_WRITE_PORT(pxTFT->ucDataPort, (uint16_t)0xFFFF, 0);
 	vPORT_DIO_WRITE_PORT(pxTFT->ucDataPort, (uint16_t)0xFFFF, 0);
 	vPORT_DIO_WRITE_PORT(pxTFT->ucDataPort, (uint16_t)0xFFFF, 0);
+#endif		/*	ucHOS_TFT_DATA_CONNECTION		*/
 
 	/*	execute reset sequence	*/
 	vHOS_TFT_reset(pxTFT);
@@ -203,6 +245,9 @@ void vHOS_TFT_init(xHOS_TFT_t* pxTFT)
 
 	/*	Lock LCD	*/
 
+	/*	Line buffer is initially not filled with any color	*/
+	pxTFT->ucIsLineBufferFilled = 0;
+
 	/*	reset	*/
 	vReset(pxTFT);
 
@@ -297,7 +342,7 @@ void vHOS_TFT_fillRectangle(	xHOS_TFT_t* pxTFT,
 
 	/*	send color data	*/
 	uint32_t uiN = (usXEnd - usXStart + 1) * (usYEnd - usYStart + 1);
-	vHOS_TFT_writeDataArrMultiple(pxTFT, (int8_t*)&xColor, 2, uiN);
+	vWriteSingleColor(pxTFT, xColor, uiN);
 }
 
 /*
@@ -386,7 +431,7 @@ void inline vHOS_TFT_drawNextNPixFromSingleColor(	xHOS_TFT_t* pxTFT,
 											xLIB_Color16_t xColor,
 											uint32_t uiN	)
 {
-	vHOS_TFT_writeDataArrMultiple(pxTFT, (int8_t*)&xColor, 2, uiN);
+	vWriteSingleColor(pxTFT, xColor, uiN);
 }
 
 /*
@@ -399,38 +444,107 @@ void vHOS_TFT_drawText(	xHOS_TFT_t* pxTFT,
 						uint8_t ucSize,
 						char* pcTxt	)
 {
-	ucSize--;
+	uint8_t ucRow;
+	uint16_t usY;
+	uint16_t j, jEnd;
+
+	for (uint16_t i = 0; pcTxt[i] != '\0'; i++)
+	{
+		for (uint16_t k = 0; k < 8; k++)
+		{
+			usY = usYStart + (i * 8 + k) * ucSize;
+
+			/*	Draw each run of lit pixels in this glyph row as a single rectangle	*/
+			j = 0;
+			while(j < 8)
+			{
+				ucRow = pucFont8x8[(uint8_t)pcTxt[i] & 0x7F][7-j];
+
+				if (!(ucRow & (1 << k)))
+				{
+					j++;
+					continue;
+				}
+
+				for (jEnd = j + 1; jEnd < 8; jEnd++)
+				{
+					if (!(pucFont8x8[(uint8_t)pcTxt[i] & 0x7F][7-jEnd] & (1 << k)))
+						break;
+				}
+
+				vHOS_TFT_fillRectangle(	pxTFT,
+										usXStart + j * ucSize,
+										usXStart + jEnd * ucSize - 1,
+										usY,
+										usY + ucSize - 1,
+										xColor	);
+
+				j = jEnd;
+			}
+		}
+	}
+}
+
+/*
+ * See header file for info.
+ */
+void vHOS_TFT_drawTextWithBackground(	xHOS_TFT_t* pxTFT,
+										xLIB_Color16_t xColor,
+										xLIB_Color16_t xBackgroundColor,
+										uint16_t usXStart,
+										uint16_t usYStart,
+										uint8_t ucSize,
+										char* pcTxt	)
+{
+	uint32_t uiLen = 0;
+	uint32_t uiCount = 0;
+	const char* pcGlyph;
+
+	while(pcTxt[uiLen] != '\0')
+		uiLen++;
 
-	for (uint8_t i = 0; pcTxt[i] != '\0'; i++)
+	if (uiLen == 0)
+		return;
+
+	/*
+	 * Set a single address window for the whole text run. As glyphs are stacked
+	 * along y-axis, pixels are streamed glyph after glyph, row after row.
+	 */
+	vHOS_TFT_setXBoundaries(pxTFT, usXStart, usXStart + 8 * ucSize - 1);
+	vHOS_TFT_setYBoundaries(pxTFT, usYStart, usYStart + uiLen * 8 * ucSize - 1);
+
+	/*	Line buffer is going to be used as a scanline buffer	*/
+	pxTFT->ucIsLineBufferFilled = 0;
+
+	for (uint32_t i = 0; i < uiLen; i++)
 	{
-		for (uint16_t j = 0; j < 8; j++)
+		pcGlyph = pucFont8x8[(uint8_t)pcTxt[i] & 0x7F];
+
+		/*	Every glyph row is scaled to "ucSize" rows of "8 * ucSize" pixels	*/
+		for (uint16_t k = 0; k < 8 * ucSize; k++)
 		{
-			for (uint16_t k = 0; k < 8; k++)
+			for (uint16_t j = 0; j < 8 * ucSize; j++)
 			{
-				if (pucFont8x8[(uint8_t)pcTxt[i]][7-j] & (1 << (k)))
+				if (pcGlyph[7 - j / ucSize] & (1 << (k / ucSize)))
+					pxTFT->pxLineBuffer[uiCount] = xColor;
+				else
+					pxTFT->pxLineBuffer[uiCount] = xBackgroundColor;
+
+				/*	Flush line buffer when it gets full	*/
+				if (++uiCount == uiHOS_TFT_LINE_BUFFER_PIXELS)
 				{
-					if (ucSize == 0)
-					{
-						vHOS_TFT_setPix(pxTFT, usXStart+j, usYStart+k+i*8, xColor);
-					}
-					else
-					{
-						vHOS_TFT_fillRectangle(
-								pxTFT,
-
-								usXStart + j*ucSize,
-								usXStart + (j+1)*ucSize,
-
-								usYStart + i*ucSize*8 + k*ucSize,
-								usYStart + i*ucSize*8 + (k+1)*ucSize,
-
-								xColor
-							);
-					}
+					vHOS_TFT_writeDataArr(	pxTFT,
+											(int8_t*)pxTFT->pxLineBuffer,
+											2 * uiCount	);
+					uiCount = 0;
 				}
 			}
 		}
 	}
+
+	/*	Flush remaining pixels	*/
+	if (uiCount > 0)
+		vHOS_TFT_writeDataArr(pxTFT, (int8_t*)pxTFT->pxLineBuffer, 2 * uiCount);
 }
 
 
@@ -0,0 +1,323 @@
+/*
+ * TFT_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the TFT driver's single color fills, on the SPI
+ * connection, and a stand-in port ("HostTestPort" directory).
+ *
+ * SPI driver is stubbed. Data sent while A0 is high is appended to a "pixel
+ * stream" (which restarts on every memory write command). Every send, and
+ * every repetition of a send multiple, starts a DMA transfer (as "SPI_V2.c"
+ * does in the driver's byte direction), and the stubbed DMA start counts it.
+ *
+ * It checks that:
+ * 		-	A full-screen fill of a 128x160 panel takes a DMA start per line
+ * 			buffer length ("uiHOS_TFT_LINE_BUFFER_PIXELS") of pixels, and not a
+ * 			start per pixel.
+ *
+ * 		-	Random rectangles, and consecutive fills with the same or a
+ * 			different color, stream the right number of pixels, all of the fill
+ * 			color, with a start per line buffer and one for the remainder.
+ *
+ * 		-	A fill after a text with background (which uses the line buffer as a
+ * 			scanline buffer) does not stream the text's pixels.
+ *
+ * Then it prints DMA starts per full-screen fill for common panel sizes.
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_TFT_HOST_TEST -DucHOS_TFT_DATA_CONNECTION=0 \
+ * 			-ISrc/HAL/TFT/HostTestPort -ISrc/LIB/HostTestStubs -IInc \
+ * 			Src/HAL/TFT/TFT.c Src/LIB/Graphics.c/font8x8.c \
+ * 			Src/HAL/TFT/TFT_Test.c -o tft_test
+ *
+ * 		./tft_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_TFT_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*	FreeRTOS (stubs)	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (stand-in port)	*/
+#include "MCAL_Port/Port_DIO.h"
+
+/*	HAL	*/
+#include "HAL/TFT/TFT.h"
+
+#define ucTFT_CMD_MEM_WRITE			0x2C
+
+#define uiNUMBER_OF_RECTANGLES		5000
+
+#define ucA0_PORT					0
+#define ucA0_PIN					1
+
+/*******************************************************************************
+ * Stand-in port and stubbed SPI driver:
+ ******************************************************************************/
+uint8_t ppucHostPortDioLevelArr[4][16];
+
+static uint8_t ucByteDir;
+
+/*	Pixel stream since last memory write command	*/
+static uint32_t uiStreamPixelCount;
+static uint32_t uiStreamDmaStartCount;
+static uint32_t uiStreamMismatchCount;
+static uint8_t ucStreamOddByte;
+static uint8_t ucIsStreamOddByte;
+
+/*	Expected color of the stream (if checked)	*/
+static xLIB_Color16_t xExpectedColor;
+static uint8_t ucIsColorChecked;
+
+/*	Number of data bytes sent without DMA	*/
+static uint32_t uiCpuByteCount;
+
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiIndex)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, index: %u\n", pcName, uiIndex);
+		uiNumberOfFailures++;
+	}
+}
+
+static void vStartStream(void)
+{
+	uiStreamPixelCount = 0;
+	uiStreamDmaStartCount = 0;
+	uiStreamMismatchCount = 0;
+	ucIsStreamOddByte = 0;
+}
+
+/*
+ * Stubbed DMA start. Transfer is completed right away, appending bytes to the
+ * pixel stream.
+ */
+static void vStartDmaTransfer(int8_t* pcArr, uint32_t uiSize)
+{
+	uiStreamDmaStartCount++;
+
+	for (uint32_t i = 0; i < uiSize; i++)
+	{
+		if (!ucIsStreamOddByte)
+		{
+			ucStreamOddByte = (uint8_t)pcArr[i];
+			ucIsStreamOddByte = 1;
+			continue;
+		}
+
+		/*	Pixels are sent as they are in memory	*/
+		xLIB_Color16_t xPixel;
+		((uint8_t*)&xPixel)[0] = ucStreamOddByte;
+		((uint8_t*)&xPixel)[1] = (uint8_t)pcArr[i];
+		ucIsStreamOddByte = 0;
+
+		if (ucIsColorChecked && xPixel != xExpectedColor)
+			uiStreamMismatchCount++;
+
+		uiStreamPixelCount++;
+	}
+}
+
+void vHOS_SPI_setByteDirection(uint8_t ucUnitNumber, uint8_t ucByteDirection)
+{
+	(void)ucUnitNumber;
+	ucByteDir = ucByteDirection;
+}
+
+void vHOS_SPI_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize)
+{
+	(void)ucUnitNumber;
+
+	/*	Command	*/
+	if (ppucHostPortDioLevelArr[ucA0_PORT][ucA0_PIN] == 0)
+	{
+		if (uiSize == 1 && (uint8_t)pcArr[0] == ucTFT_CMD_MEM_WRITE)
+			vStartStream();
+		return;
+	}
+
+	/*	Data, by DMA only if in DMA's byte direction (little endian)	*/
+	if (ucByteDir == ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST)
+		vStartDmaTransfer(pcArr, uiSize);
+	else
+		uiCpuByteCount += uiSize;
+}
+
+void vHOS_SPI_sendMultiple(	uint8_t ucUnitNumber,
+							int8_t* pcArr,
+							uint32_t uiSize,
+							uint32_t uiN	)
+{
+	(void)ucUnitNumber;
+
+	vCheck(ppucHostPortDioLevelArr[ucA0_PORT][ucA0_PIN] == 1, "send multiple in data mode", 0);
+	vCheck(ucByteDir == ucHOS_SPI_BYTE_DIRECTION_LSBYTE_FIRST, "send multiple in DMA byte direction", 0);
+
+	/*	A DMA transfer per repetition	*/
+	while(uiN--)
+		vStartDmaTransfer(pcArr, uiSize);
+}
+
+uint8_t ucHOS_SPI_takeMutex(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	(void)ucUnitNumber;
+	(void)xTimeout;
+	return 1;
+}
+
+void vHOS_SPI_releaseMutex(uint8_t ucUnitNumber)
+{
+	(void)ucUnitNumber;
+}
+
+uint8_t ucHOS_SPI_blockUntilTransferComplete(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	(void)ucUnitNumber;
+	(void)xTimeout;
+	return 1;
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static xHOS_TFT_t xTFT = {
+	.ucSpiUnitNumber = 0,
+	.ucRstPort = 0,
+	.ucRstPin = 0,
+	.ucA0Port = ucA0_PORT,
+	.ucA0Pin = ucA0_PIN,
+	.uiWidth = 128,
+	.uiHeight = 160
+};
+
+static uint32_t uiExpectedStarts(uint32_t uiN)
+{
+	return (uiN + uiHOS_TFT_LINE_BUFFER_PIXELS - 1) / uiHOS_TFT_LINE_BUFFER_PIXELS;
+}
+
+/*	Fills a rectangle, and checks the pixel stream	*/
+static void vFillAndCheck(	uint16_t usWidth, uint16_t usHeight,
+							xLIB_Color16_t xColor, uint32_t uiIndex	)
+{
+	uint32_t uiN = (uint32_t)usWidth * usHeight;
+	uint16_t usX = rand() % 64;
+	uint16_t usY = rand() % 64;
+
+	xExpectedColor = xColor;
+	ucIsColorChecked = 1;
+
+	vHOS_TFT_fillRectangle(&xTFT, usX, usX + usWidth - 1, usY, usY + usHeight - 1, xColor);
+
+	vCheck(uiStreamPixelCount == uiN && !ucIsStreamOddByte, "number of pixels", uiIndex);
+	vCheck(uiStreamMismatchCount == 0, "pixels of fill color", uiIndex);
+	vCheck(uiStreamDmaStartCount == uiExpectedStarts(uiN), "DMA starts per fill", uiIndex);
+}
+
+static void vTestFullScreen(void)
+{
+	uint32_t uiN = xTFT.uiWidth * xTFT.uiHeight;
+
+	vFillAndCheck(xTFT.uiWidth, xTFT.uiHeight, xLIB_COLOR_WHITE, 0);
+
+	vCheck(uiStreamDmaStartCount == uiN / uiHOS_TFT_LINE_BUFFER_PIXELS, "full-screen fill DMA starts", 0);
+	vCheck(uiCpuByteCount == 0, "pixels sent by DMA", 0);
+
+	printf(	"%ux%u fill: %u DMA starts (a start per pixel would be %u)\n",
+			xTFT.uiWidth, xTFT.uiHeight, uiStreamDmaStartCount, uiN	);
+}
+
+static void vTestRandomRectangles(void)
+{
+	static const xLIB_Color16_t pxColorArr[] = {0x0000, 0xFFFF, 0x1234, 0xF800};
+
+	for (uint32_t i = 0; i < uiNUMBER_OF_RECTANGLES; i++)
+	{
+		/*	Same color repeats often (line buffer is not expanded again)	*/
+		vFillAndCheck(	1 + rand() % 64,
+						1 + rand() % 96,
+						pxColorArr[rand() % 4],
+						i	);
+	}
+
+	vCheck(uiCpuByteCount == 0, "pixels sent by DMA", 0);
+}
+
+static void vTestFillAfterText(void)
+{
+	uint32_t uiN;
+
+	vFillAndCheck(16, 16, xLIB_COLOR_BLACK, 0);
+
+	/*	Text uses the line buffer as a scanline buffer	*/
+	ucIsColorChecked = 0;
+	vHOS_TFT_drawTextWithBackground(&xTFT, xLIB_COLOR_WHITE, xLIB_COLOR_BLACK, 0, 0, 2, "Ab");
+	uiN = (8 * 2) * (2 * 8 * 2);
+	vCheck(uiStreamPixelCount == uiN, "text pixels", 0);
+	vCheck(uiStreamDmaStartCount == uiExpectedStarts(uiN), "text DMA starts", 0);
+
+	/*	Same color as before the text	*/
+	vFillAndCheck(16, 16, xLIB_COLOR_BLACK, 1);
+	vFillAndCheck(3, 50, xLIB_COLOR_BLACK, 2);
+}
+
+static void vPrintPanels(void)
+{
+	static const uint16_t pusSizeArr[][2] = {{128, 128}, {128, 160}, {240, 320}, {320, 480}};
+
+	printf("panel      pixels   DMA starts per fill\n");
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		vFillAndCheck(pusSizeArr[i][0], pusSizeArr[i][1], 0x5555, i);
+
+		printf(	"%3ux%-5u %7u %10u\n",
+				pusSizeArr[i][0], pusSizeArr[i][1],
+				pusSizeArr[i][0] * pusSizeArr[i][1],
+				uiStreamDmaStartCount	);
+	}
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vHOS_TFT_init(&xTFT);
+	vCheck(ucHOS_TFT_enableCommunication(&xTFT, portMAX_DELAY), "enable communication", 0);
+
+	/*	Init's single data byte is not a pixel	*/
+	uiCpuByteCount = 0;
+
+	vTestFullScreen();
+	vTestRandomRectangles();
+	vTestFillAfterText();
+	vPrintPanels();
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_TFT_HOST_TEST	*/
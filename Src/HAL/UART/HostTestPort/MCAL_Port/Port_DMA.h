@@ -0,0 +1,58 @@
+/*
+ * Port_DMA.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the DMA port, used only by "UART_HW_Test.c". The test
+ * itself implements the DMA driver functions, and performs transfers.
+ *
+ * "portDMA_IS_AVAILABLE" is given on the command line, to select which
+ * variant of the HW UART driver is tested.
+ */
+
+#ifndef COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_DMA_H_
+#define COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_DMA_H_
+
+#include <stdint.h>
+
+#ifndef portDMA_IS_AVAILABLE
+#define portDMA_IS_AVAILABLE					0
+#endif
+
+#if portDMA_IS_AVAILABLE
+
+#define portDMA_NUMBER_OF_UNITS					1
+#define portDMA_NUMBER_OF_CHANNELS_PER_UNIT		7
+
+typedef struct{
+	uint8_t ucUnitNumber;
+	uint8_t ucChannelNumber;
+
+	void* pvMemoryStartingAdderss;
+	void* pvPeripheralStartingAdderss;
+
+	uint32_t uiN;
+
+	uint8_t ucTriggerSource : 1;
+	uint8_t ucPriLevel : 2;
+	uint8_t ucDirection : 1;
+	uint8_t ucMemoryIncrement : 1;
+	uint8_t ucPeripheralIncrement : 1;
+	uint8_t ucDataSize : 1;
+	uint8_t ucCircularMode : 1;
+}xPort_DMA_TransInfo_t;
+
+extern uint8_t pucHostPortDmaTcInterruptEnabledArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+extern uint8_t pucHostPortDmaThcInterruptEnabledArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+
+#define vPORT_DMA_ENABLE_TRANSFER_COMPLETE_INTERRUPT(ucUnitNumber, ucChannelNumber)	\
+	(	pucHostPortDmaTcInterruptEnabledArr[(ucChannelNumber)] = 1	)
+
+#define vPORT_DMA_ENABLE_TRANSFER_HALF_COMPLETE_INTERRUPT(ucUnitNumber, ucChannelNumber)	\
+	(	pucHostPortDmaThcInterruptEnabledArr[(ucChannelNumber)] = 1	)
+
+#endif	/*	portDMA_IS_AVAILABLE	*/
+
+
+
+#endif /* COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_DMA_H_ */
@@ -0,0 +1,184 @@
+/*
+ * Port_UART.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the UART port, used only by "UART_HW_Test.c".
+ *
+ * A unit is a plain structure: interrupt enables, DMA request connection, the
+ * data register, and the registered callbacks. The test simulates the hardware
+ * by calling the callbacks while the matching interrupts are enabled, and
+ * defines "pxHostPortUartArr[]".
+ */
+
+#ifndef COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_UART_H_
+#define COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_UART_H_
+
+#include <stdint.h>
+
+typedef struct{
+	/*	Callbacks and their parameters	*/
+	void (*pfTxeCallback)(void*);
+	void* pvTxeCallbackParams;
+	void (*pfRxneCallback)(void*);
+	void* pvRxneCallbackParams;
+	void (*pfTcCallback)(void*);
+	void* pvTcCallbackParams;
+	void (*pfIdleCallback)(void*);
+	void* pvIdleCallbackParams;
+
+	/*	Interrupt enables	*/
+	uint8_t ucIsTxeInterruptEnabled;
+	uint8_t ucIsRxneInterruptEnabled;
+	uint8_t ucIsTcInterruptEnabled;
+	uint8_t ucIsIdleInterruptEnabled;
+
+	/*	Are TxE and RxNE connected to DMA requests	*/
+	uint8_t ucIsTxeConnectedToDma;
+	uint8_t ucIsRxneConnectedToDma;
+
+	uint8_t ucIsEnabled;
+
+	/*	Data register, and whether a byte was written to it and not yet sent	*/
+	uint8_t ucDr;
+	uint8_t ucIsDrWritten;
+}xHostPort_UART_t;
+
+/*	Number of units available in the stand-in target	*/
+#define portUART_NUMBER_OF_UNITS		1
+
+#define portUART_IS_DMA_STATIC_CONNECTED		1
+
+extern const uint8_t ppucPortUartTxeDmaMapping[portUART_NUMBER_OF_UNITS][2];
+extern const uint8_t ppucPortUartRxneDmaMapping[portUART_NUMBER_OF_UNITS][2];
+
+extern xHostPort_UART_t pxHostPortUartArr[portUART_NUMBER_OF_UNITS];
+
+static inline void vPort_UART_enable(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsEnabled = 1;
+}
+
+static inline void vPort_UART_sendByte(uint8_t ucUnitNumber, uint8_t ucByte)
+{
+	pxHostPortUartArr[ucUnitNumber].ucDr = ucByte;
+	pxHostPortUartArr[ucUnitNumber].ucIsDrWritten = 1;
+}
+
+static inline uint8_t ucPort_UART_readByte(uint8_t ucUnitNumber)
+{
+	return pxHostPortUartArr[ucUnitNumber].ucDr;
+}
+
+static inline void* pvPort_UART_getDrAddress(uint8_t ucUnitNumber)
+{
+	return (void*)&pxHostPortUartArr[ucUnitNumber].ucDr;
+}
+
+static inline void vPort_UART_connectTxeToDma(	uint8_t ucUartUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	(void)ucDmaUnitNumber;
+	(void)ucDmaChannelNumber;
+	pxHostPortUartArr[ucUartUnitNumber].ucIsTxeConnectedToDma = 1;
+}
+
+static inline void vPort_UART_disconnectTxeFromDma(uint8_t ucUartUnitNumber)
+{
+	pxHostPortUartArr[ucUartUnitNumber].ucIsTxeConnectedToDma = 0;
+}
+
+static inline void vPort_UART_connectRxneToDma(	uint8_t ucUartUnitNumber,
+												uint8_t ucDmaUnitNumber,
+												uint8_t ucDmaChannelNumber	)
+{
+	(void)ucDmaUnitNumber;
+	(void)ucDmaChannelNumber;
+	pxHostPortUartArr[ucUartUnitNumber].ucIsRxneConnectedToDma = 1;
+}
+
+static inline void vPort_UART_disconnectRxneFromDma(uint8_t ucUartUnitNumber)
+{
+	pxHostPortUartArr[ucUartUnitNumber].ucIsRxneConnectedToDma = 0;
+}
+
+static inline void vPort_UART_enableTxeInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsTxeInterruptEnabled = 1;
+}
+
+static inline void vPort_UART_disableTxeInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsTxeInterruptEnabled = 0;
+}
+
+static inline void vPort_UART_enableRxneInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsRxneInterruptEnabled = 1;
+}
+
+static inline void vPort_UART_disableRxneInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsRxneInterruptEnabled = 0;
+}
+
+static inline void vPort_UART_enableTcInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsTcInterruptEnabled = 1;
+}
+
+static inline void vPort_UART_disableTcInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsTcInterruptEnabled = 0;
+}
+
+static inline void vPort_UART_enableIdleInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsIdleInterruptEnabled = 1;
+}
+
+static inline void vPort_UART_disableIdleInterrupt(uint8_t ucUnitNumber)
+{
+	pxHostPortUartArr[ucUnitNumber].ucIsIdleInterruptEnabled = 0;
+}
+
+/*	Flags are not simulated, TC and IDLE flags are only "set" by the test	*/
+#define vPORT_UART_CLEAR_TC_FLAG(ucUnitNumber)		((void)(ucUnitNumber))
+#define vPORT_UART_CLEAR_IDLE_FLAG(ucUnitNumber)	((void)(ucUnitNumber))
+
+static inline void vPort_UART_setTxeCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortUartArr[ucUnitNumber].pfTxeCallback = pfCallback;
+	pxHostPortUartArr[ucUnitNumber].pvTxeCallbackParams = pvParams;
+}
+
+static inline void vPort_UART_setRxneCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortUartArr[ucUnitNumber].pfRxneCallback = pfCallback;
+	pxHostPortUartArr[ucUnitNumber].pvRxneCallbackParams = pvParams;
+}
+
+static inline void vPort_UART_setTcCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortUartArr[ucUnitNumber].pfTcCallback = pfCallback;
+	pxHostPortUartArr[ucUnitNumber].pvTcCallbackParams = pvParams;
+}
+
+static inline void vPort_UART_setIdleCallback(	uint8_t ucUnitNumber,
+												void(*pfCallback)(void*),
+												void* pvParams	)
+{
+	pxHostPortUartArr[ucUnitNumber].pfIdleCallback = pfCallback;
+	pxHostPortUartArr[ucUnitNumber].pvIdleCallbackParams = pvParams;
+}
+
+
+
+#endif /* COTS_OS_SRC_HAL_UART_HOSTTESTPORT_PORT_UART_H_ */
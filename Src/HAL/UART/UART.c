@@ -8,6 +8,7 @@
 
 /*	LIB	*/
 #include <stdint.h>
+#include <stddef.h>
 
 /*	FreeRTOS	*/
 #include "FreeRTOS.h"
@@ -29,6 +30,16 @@ extern void vHOS_UART_HW_init(void);
 
 extern void vHOS_UART_HW_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize);
 
+extern uint8_t ucHOS_UART_HW_enqueue(	uint8_t ucUnitNumber,
+										int8_t* pcArr,
+										uint32_t uiSize,
+										TickType_t xTimeout,
+										uint32_t* puiToken	);
+
+extern uint8_t ucHOS_UART_HW_blockUntilBufferSent(	uint8_t ucUnitNumber,
+													uint32_t uiToken,
+													TickType_t xTimeout	);
+
 extern uint8_t ucHOS_UART_HW_receive(		uint8_t ucUnitNumber,
 								int8_t* pcInArr,
 								uint32_t uiSize,
@@ -40,6 +51,23 @@ extern void vHOS_UART_HW_releaseMutex(uint8_t ucUnitNumber);
 
 extern uint8_t ucHOS_UART_HW_blockUntilTransmissionComplete(uint8_t ucUnitNumber, TickType_t xTimeout);
 
+extern void vHOS_UART_HW_enableContinuousReception(uint8_t ucUnitNumber);
+
+extern void vHOS_UART_HW_disableContinuousReception(uint8_t ucUnitNumber);
+
+extern void vHOS_UART_HW_setMatchCharacter(uint8_t ucUnitNumber, uint8_t ucChar, uint8_t ucEnable);
+
+extern uint32_t uiHOS_UART_HW_getAvailableSize(uint8_t ucUnitNumber);
+
+extern uint32_t uiHOS_UART_HW_readAvailable(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiMaxSize);
+
+extern uint32_t uiHOS_UART_HW_readFrame(	uint8_t ucUnitNumber,
+									int8_t* pcArr,
+									uint32_t uiMaxSize,
+									TickType_t xTimeout	);
+
+extern uint32_t uiHOS_UART_HW_getOverrunCount(uint8_t ucUnitNumber);
+
 
 /*******************************************************************************
  * Extern SW unit functions:
@@ -97,6 +125,42 @@ void vHOS_UART_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize)
 #endif
 }
 
+uint8_t ucHOS_UART_enqueue(	uint8_t ucUnitNumber,
+								int8_t* pcArr,
+								uint32_t uiSize,
+								TickType_t xTimeout,
+								uint32_t* puiToken	)
+{
+#if ucIS_SW_UART_USED
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return ucHOS_UART_HW_enqueue(ucUnitNumber, pcArr, uiSize, xTimeout, puiToken);
+	else
+	{
+		/*	SW units have no queue, buffer is sent before returning	*/
+		vHOS_UART_SW_send(ucCONVERT_TO_SW_UNIT_NUMBER(ucUnitNumber), pcArr, uiSize);
+		if (puiToken != NULL)
+			*puiToken = 0;
+		return 1;
+	}
+#else
+	return ucHOS_UART_HW_enqueue(ucUnitNumber, pcArr, uiSize, xTimeout, puiToken);
+#endif
+}
+
+uint8_t ucHOS_UART_blockUntilBufferSent(	uint8_t ucUnitNumber,
+											uint32_t uiToken,
+											TickType_t xTimeout	)
+{
+#if ucIS_SW_UART_USED
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return ucHOS_UART_HW_blockUntilBufferSent(ucUnitNumber, uiToken, xTimeout);
+	else
+		return 1;
+#else
+	return ucHOS_UART_HW_blockUntilBufferSent(ucUnitNumber, uiToken, xTimeout);
+#endif
+}
+
 uint8_t ucHOS_UART_receive(		uint8_t ucUnitNumber,
 								int8_t* pcInArr,
 								uint32_t uiSize,
@@ -148,25 +212,55 @@ uint8_t ucHOS_UART_blockUntilTransmissionComplete(uint8_t ucUnitNumber, TickType
 #endif
 }
 
+/*
+ * Continuous reception is available on HW units only. (SW unit calls are
+ * ignored, and read functions return 0)
+ */
+void vHOS_UART_enableContinuousReception(uint8_t ucUnitNumber)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		vHOS_UART_HW_enableContinuousReception(ucUnitNumber);
+}
 
+void vHOS_UART_disableContinuousReception(uint8_t ucUnitNumber)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		vHOS_UART_HW_disableContinuousReception(ucUnitNumber);
+}
 
+void vHOS_UART_setMatchCharacter(uint8_t ucUnitNumber, uint8_t ucChar, uint8_t ucEnable)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		vHOS_UART_HW_setMatchCharacter(ucUnitNumber, ucChar, ucEnable);
+}
 
+uint32_t uiHOS_UART_getAvailableSize(uint8_t ucUnitNumber)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return uiHOS_UART_HW_getAvailableSize(ucUnitNumber);
+	return 0;
+}
 
+uint32_t uiHOS_UART_readAvailable(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiMaxSize)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return uiHOS_UART_HW_readAvailable(ucUnitNumber, pcArr, uiMaxSize);
+	return 0;
+}
 
+uint32_t uiHOS_UART_readFrame(	uint8_t ucUnitNumber,
+								int8_t* pcArr,
+								uint32_t uiMaxSize,
+								TickType_t xTimeout	)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return uiHOS_UART_HW_readFrame(ucUnitNumber, pcArr, uiMaxSize, xTimeout);
+	return 0;
+}
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+uint32_t uiHOS_UART_getOverrunCount(uint8_t ucUnitNumber)
+{
+	if (ucUnitNumber < portUART_NUMBER_OF_UNITS)
+		return uiHOS_UART_HW_getOverrunCount(ucUnitNumber);
+	return 0;
+}
@@ -0,0 +1,663 @@
+/*
+ * UART_HW.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is the HW UART source code shared by all targets. Sending the Tx queue
+ * and filling the continuous reception ring are target dependent, and are
+ * implemented in "UART_HW_V1.c" (targets which do not have DMA) or
+ * "UART_HW_V2.c" (targets which have DMA).
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+#include <string.h>
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_UART.h"
+#include "MCAL_Port/Port_Interrupt.h"
+
+/*	SELF	*/
+#include "HAL/UART/UART_Config.h"
+#include "HAL/UART/UART_HW_Private.h"
+
+/*******************************************************************************
+ * Helping functions/macros:
+ ******************************************************************************/
+/*
+ * Returns ticks remaining of "xTimeout", that started at "xStartTime".
+ */
+static TickType_t xGetRemainingTime(TickType_t xStartTime, TickType_t xTimeout)
+{
+	TickType_t xElapsed;
+
+	if (xTimeout == portMAX_DELAY)
+		return portMAX_DELAY;
+
+	xElapsed = xTaskGetTickCount() - xStartTime;
+
+	return (xElapsed < xTimeout) ? (xTimeout - xElapsed) : 0;
+}
+
+/*
+ * Returns number of bytes available in ring.
+ *
+ * If circular DMA has overwritten bytes that were not read yet (counted as
+ * overrun by "vHOS_UART_HW_syncRxRingFromISR()"), they are skipped.
+ */
+static uint32_t uiRxRingGetAvailable(xHOS_UART_HW_RxRing_t* pxRing)
+{
+	uint32_t uiAvailable = pxRing->uiHead - pxRing->uiTail;
+
+	if (uiAvailable > uiCONF_UART_RX_RING_SIZE)
+	{
+		pxRing->uiTail += uiAvailable - uiCONF_UART_RX_RING_SIZE;
+		uiAvailable = uiCONF_UART_RX_RING_SIZE;
+	}
+
+	return uiAvailable;
+}
+
+/*
+ * Copies "uiSize" bytes (which must be available) from ring to "pcArr", and
+ * frees them.
+ */
+static void vRxRingRead(xHOS_UART_HW_RxRing_t* pxRing, int8_t* pcArr, uint32_t uiSize)
+{
+	uint32_t uiStart = pxRing->uiTail & uiUART_HW_RING_MASK;
+	uint32_t uiFirstPart = uiCONF_UART_RX_RING_SIZE - uiStart;
+
+	if (uiFirstPart > uiSize)
+		uiFirstPart = uiSize;
+
+	memcpy(pcArr, &pxRing->pucArr[uiStart], uiFirstPart);
+	memcpy(&pcArr[uiFirstPart], pxRing->pucArr, uiSize - uiFirstPart);
+
+	pxRing->uiTail += uiSize;
+}
+
+/*******************************************************************************
+ * Global and static variables:
+ ******************************************************************************/
+/*
+ * Array of units.
+ */
+static xHOS_UART_HW_Unit_t pxUnitArr[uiUART_HW_NUMBER_OF_UNITS];
+
+/*******************************************************************************
+ * ISR callback:
+ ******************************************************************************/
+static void vRxRingCallback(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+	uint8_t ucByte = ucPort_UART_readByte(pxUnit->ucUnitNumber);
+	uint32_t uiHead = pxRing->uiHead;
+	uint8_t ucWake = 0;
+
+	if (uiHead - pxRing->uiTail < uiCONF_UART_RX_RING_SIZE)
+	{
+		pxRing->pucArr[uiHead & uiUART_HW_RING_MASK] = ucByte;
+		pxRing->uiHead = ++uiHead;
+
+		if (pxRing->ucIsMatchEnabled && ucByte == pxRing->ucMatchChar)
+		{
+			pxRing->uiEventHead = uiHead;
+			ucWake = 1;
+		}
+	}
+	else
+	{
+		pxRing->uiOverrunCount++;
+	}
+
+	if (uiHead - pxRing->uiTail >= pxRing->uiWakeLevel)
+		ucWake = 1;
+
+	if (ucWake)
+	{
+		BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+		xSemaphoreGiveFromISR(	pxUnit->xRxneSemaphore,
+								&xHighPriorityTaskWoken	);
+
+		portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+	}
+}
+
+static void vRxneCallback(void* pvParams)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = (xHOS_UART_HW_Unit_t*)pvParams;
+
+	if (pxUnit->xRxRing.ucIsEnabled)
+	{
+		vRxRingCallback(pxUnit);
+		return;
+	}
+
+	pxUnit->xRxInfo.pcRxBuffer[pxUnit->xRxInfo.uiRxCurrentSize++] =
+		ucPort_UART_readByte(pxUnit->ucUnitNumber);
+
+	if (pxUnit->xRxInfo.uiRxCurrentSize == pxUnit->xRxInfo.uiRxTotalSize)
+	{
+		BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+		xSemaphoreGiveFromISR(	pxUnit->xRxneSemaphore,
+								&xHighPriorityTaskWoken	);
+
+		portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+	}
+}
+
+static void vIdleCallback(void* pvParams)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = (xHOS_UART_HW_Unit_t*)pvParams;
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+	/*	Frame gap, mark end of the frame	*/
+	vHOS_UART_HW_syncRxRingFromISR(pxUnit);
+	pxUnit->xRxRing.uiEventHead = pxUnit->xRxRing.uiHead;
+
+	xSemaphoreGiveFromISR(	pxUnit->xRxneSemaphore,
+							&xHighPriorityTaskWoken	);
+
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+static void vTcCallback(void* pvParams)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = (xHOS_UART_HW_Unit_t*)pvParams;
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+	vPort_UART_disableTcInterrupt(pxUnit->ucUnitNumber);
+
+	xSemaphoreGiveFromISR(	pxUnit->xTransferCompleteSemaphore,
+							&xHighPriorityTaskWoken	);
+
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+/*******************************************************************************
+ * Driver functions:
+ ******************************************************************************/
+/*
+ * See "UART_HW_Private.h" for info.
+ */
+uint8_t ucHOS_UART_HW_advanceTxQueueFromISR(	xHOS_UART_HW_Unit_t* pxUnit,
+												BaseType_t* pxHighPriorityTaskWoken	)
+{
+	xHOS_UART_HW_TxQueue_t* pxQueue = &pxUnit->xTxQueue;
+	uint8_t ucIsEmpty;
+
+	pxQueue->uiTail++;
+
+	/*	If queue is empty, mark it idle and wait for the last byte to be shifted out	*/
+	ucIsEmpty = (pxQueue->uiTail == pxQueue->uiHead);
+	if (ucIsEmpty)
+	{
+		pxQueue->ucIsBusy = 0;
+		vPort_UART_enableTcInterrupt(pxUnit->ucUnitNumber);
+	}
+
+	xSemaphoreGiveFromISR(	pxQueue->xFreeSlotsSemaphore,
+							pxHighPriorityTaskWoken	);
+
+	/*	Wake the blocked task only once the buffer it waits for is sent	*/
+	if (pxQueue->ucIsWaiting && (int32_t)(pxQueue->uiTail - pxQueue->uiWakeToken) >= 0)
+	{
+		pxQueue->ucIsWaiting = 0;
+
+		xSemaphoreGiveFromISR(	pxQueue->xBufferSentSemaphore,
+								pxHighPriorityTaskWoken	);
+	}
+
+	return ucIsEmpty;
+}
+
+/*
+ * Initializes all HW based UART units.
+ */
+void vHOS_UART_HW_init(void)
+{
+	xHOS_UART_HW_Unit_t* pxUnit;
+
+	for (uint8_t i = 0; i < uiUART_HW_NUMBER_OF_UNITS; i++)
+	{
+		pxUnit = &pxUnitArr[i];
+
+		/*	create unit's mutex	*/
+		pxUnit->xUnitMutex =
+			xSemaphoreCreateMutexStatic(&pxUnit->xUnitMutexStatic);
+		xSemaphoreGive(pxUnit->xUnitMutex);
+
+		/*	create transfer complete semaphore	*/
+		pxUnit->xTransferCompleteSemaphore =
+			xSemaphoreCreateBinaryStatic(&pxUnit->xTransferCompleteSemaphoreStatic);
+		xSemaphoreGive(pxUnit->xTransferCompleteSemaphore);
+
+		/*	create Tx queue semaphores	*/
+		pxUnit->xTxQueue.xFreeSlotsSemaphore =
+			xSemaphoreCreateCountingStatic(	uiCONF_UART_TX_QUEUE_LENGTH,
+											uiCONF_UART_TX_QUEUE_LENGTH,
+											&pxUnit->xTxQueue.xFreeSlotsSemaphoreStatic	);
+
+		pxUnit->xTxQueue.xBufferSentSemaphore =
+			xSemaphoreCreateBinaryStatic(&pxUnit->xTxQueue.xBufferSentSemaphoreStatic);
+		xSemaphoreTake(pxUnit->xTxQueue.xBufferSentSemaphore, 0);
+
+		pxUnit->xTxQueue.uiHead = 0;
+		pxUnit->xTxQueue.uiTail = 0;
+		pxUnit->xTxQueue.ucIsBusy = 0;
+		pxUnit->xTxQueue.ucIsWaiting = 0;
+
+		/*	create RxNE semaphore	*/
+		pxUnit->xRxneSemaphore =
+			xSemaphoreCreateBinaryStatic(&pxUnit->xRxneSemaphoreStatic);
+		xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
+
+		/*	Unit number	*/
+		pxUnit->ucUnitNumber = i;
+
+		/*	Initialize unit's Tx (TxE interrupt or DMA)	*/
+		vHOS_UART_HW_initTx(pxUnit);
+
+		/*	Initialize unit's RxNE interrupt	*/
+		VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptUartRxneIrqNumberArr[i],
+										configLIBRARY_LOWEST_INTERRUPT_PRIORITY	);
+
+		vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptUartRxneIrqNumberArr[i]);
+
+		vPort_UART_setRxneCallback(i, vRxneCallback, (void*)pxUnit);
+
+		vPort_UART_disableRxneInterrupt(i);
+
+		/*	Initialize unit's IDLE interrupt (shares RxNE's IRQ)	*/
+		vPort_UART_setIdleCallback(i, vIdleCallback, (void*)pxUnit);
+
+		vPort_UART_disableIdleInterrupt(i);
+
+		pxUnit->xRxRing.ucIsEnabled = 0;
+		pxUnit->xRxRing.ucIsMatchEnabled = 0;
+
+		/*	Initialize unit's continuous reception (DMA channel, if any)	*/
+		vHOS_UART_HW_initRxRing(pxUnit);
+
+		/*	Initialize unit's TC interrupt	*/
+		VPORT_INTERRUPT_SET_PRIORITY(	pxPortInterruptUartTcIrqNumberArr[i],
+										configLIBRARY_LOWEST_INTERRUPT_PRIORITY	);
+
+		vPORT_INTERRUPT_ENABLE_IRQ(pxPortInterruptUartTcIrqNumberArr[i]);
+
+		vPort_UART_setTcCallback(i, vTcCallback, (void*)pxUnit);
+
+		vPort_UART_disableTcInterrupt(i);
+
+		/*	Enable unit	*/
+		vPort_UART_enable(i);
+	}
+}
+
+/*
+ * Enqueues a buffer to be sent by a HW unit.
+ */
+uint8_t ucHOS_UART_HW_enqueue(	uint8_t ucUnitNumber,
+								int8_t* pcArr,
+								uint32_t uiSize,
+								TickType_t xTimeout,
+								uint32_t* puiToken	)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	xHOS_UART_HW_TxQueue_t* pxQueue = &pxUnit->xTxQueue;
+	xHOS_UART_HW_TxBuffer_t* pxBuffer;
+	uint32_t uiToken;
+
+	/*	Token of the last enqueued buffer	*/
+	if (uiSize == 0)
+	{
+		if (puiToken != NULL)
+			*puiToken = pxQueue->uiHead;
+		return 1;
+	}
+
+	/*	Wait for a free slot	*/
+	if (!xSemaphoreTake(pxQueue->xFreeSlotsSemaphore, xTimeout))
+		return 0;
+
+	taskENTER_CRITICAL();
+	{
+		pxBuffer = &pxQueue->pxBufferArr[pxQueue->uiHead & uiUART_HW_TX_QUEUE_MASK];
+		pxBuffer->pcArr = pcArr;
+		pxBuffer->uiSize = uiSize;
+		uiToken = ++pxQueue->uiHead;
+
+		/*
+		 * If queue is idle, start sending. Otherwise, the buffer is sent after
+		 * the ones before it.
+		 */
+		if (!pxQueue->ucIsBusy)
+		{
+			pxQueue->ucIsBusy = 1;
+			vPort_UART_disableTcInterrupt(ucUnitNumber);
+			xSemaphoreTake(pxUnit->xTransferCompleteSemaphore, 0);
+			vHOS_UART_HW_startTx(pxUnit);
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (puiToken != NULL)
+		*puiToken = uiToken;
+
+	return 1;
+}
+
+/*
+ * Blocks until an enqueued buffer is sent by a HW unit.
+ *
+ * A buffer's token is the value "uiTail" takes once it is sent. Tokens are free
+ * running, hence compared by their signed difference.
+ */
+uint8_t ucHOS_UART_HW_blockUntilBufferSent(	uint8_t ucUnitNumber,
+											uint32_t uiToken,
+											TickType_t xTimeout	)
+{
+	xHOS_UART_HW_TxQueue_t* pxQueue = &pxUnitArr[ucUnitNumber].xTxQueue;
+	TickType_t xStartTime = xTaskGetTickCount();
+	TickType_t xRemaining;
+
+	/*	Discard a wake up of a previous wait	*/
+	xSemaphoreTake(pxQueue->xBufferSentSemaphore, 0);
+
+	while(1)
+	{
+		/*	Wake token is set before checking, so no completion is missed	*/
+		pxQueue->uiWakeToken = uiToken;
+		pxQueue->ucIsWaiting = 1;
+
+		if ((int32_t)(pxQueue->uiTail - uiToken) >= 0)
+			break;
+
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			break;
+
+		xSemaphoreTake(pxQueue->xBufferSentSemaphore, xRemaining);
+	}
+
+	pxQueue->ucIsWaiting = 0;
+
+	return ((int32_t)(pxQueue->uiTail - uiToken) >= 0);
+}
+
+/*
+ * Sends data using a HW unit.
+ */
+void vHOS_UART_HW_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize)
+{
+	uint32_t uiToken;
+
+	if (uiSize == 0)
+	{
+		xSemaphoreGive(pxUnitArr[ucUnitNumber].xTransferCompleteSemaphore);
+		return;
+	}
+
+	/*	"pcArr" may be reused once this returns, wait until it's sent	*/
+	(void)ucHOS_UART_HW_enqueue(ucUnitNumber, pcArr, uiSize, portMAX_DELAY, &uiToken);
+
+	(void)ucHOS_UART_HW_blockUntilBufferSent(ucUnitNumber, uiToken, portMAX_DELAY);
+}
+
+/*
+ * Receives data using a HW unit.
+ */
+uint8_t ucHOS_UART_HW_receive(		uint8_t ucUnitNumber,
+								int8_t* pcInArr,
+								uint32_t uiSize,
+								TickType_t xTimeout	)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	uint8_t ucState = 0;
+
+	if (pxUnit->xRxRing.ucIsEnabled)
+	{
+		xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+		TickType_t xStartTime = xTaskGetTickCount();
+		TickType_t xRemaining;
+		uint32_t uiAvailable;
+
+		while(1)
+		{
+			/*	Wake level is set before checking, so no byte is missed	*/
+			pxRing->uiWakeLevel = uiSize;
+
+			uiAvailable = uiRxRingGetAvailable(pxRing);
+			if (uiAvailable > uiSize)
+				uiAvailable = uiSize;
+
+			vRxRingRead(pxRing, pcInArr, uiAvailable);
+			pcInArr += uiAvailable;
+			uiSize -= uiAvailable;
+
+			if (uiSize == 0)
+			{
+				ucState = 1;
+				break;
+			}
+
+			xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+			if (xRemaining == 0)
+				break;
+
+			xSemaphoreTake(pxUnit->xRxneSemaphore, xRemaining);
+		}
+
+		pxRing->uiWakeLevel = 0xFFFFFFFF;
+		return ucState;
+	}
+
+//	/*	Flush	*/
+//	(volatile void)ucPort_UART_readByte(ucUnitNumber);
+
+	/*	Configure Rx info	*/
+	pxUnit->xRxInfo.pcRxBuffer = pcInArr;
+	pxUnit->xRxInfo.uiRxCurrentSize = 0;
+	pxUnit->xRxInfo.uiRxTotalSize = uiSize;
+
+	/*	Enable RxNE interrupt	*/
+	vPort_UART_enableRxneInterrupt(ucUnitNumber);
+
+	/*	Wait until data is received or timeout passes	*/
+	if (xSemaphoreTake(pxUnit->xRxneSemaphore, xTimeout))
+		ucState = 1;
+
+	/*	Disable RxNE interrupt	*/
+	vPort_UART_disableRxneInterrupt(ucUnitNumber);
+
+	return ucState;
+}
+
+/*
+ * Disables continuous reception of a HW unit.
+ */
+void vHOS_UART_HW_disableContinuousReception(uint8_t ucUnitNumber)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+
+	vPort_UART_disableIdleInterrupt(ucUnitNumber);
+	vHOS_UART_HW_stopRxRing(pxUnit);
+
+	pxUnit->xRxRing.ucIsEnabled = 0;
+}
+
+/*
+ * Enables continuous reception of a HW unit.
+ */
+void vHOS_UART_HW_enableContinuousReception(uint8_t ucUnitNumber)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+
+	/*	Ring is filled from its beginning, stop filling it first	*/
+	if (pxRing->ucIsEnabled)
+		vHOS_UART_HW_disableContinuousReception(ucUnitNumber);
+
+	pxRing->uiHead = 0;
+	pxRing->uiTail = 0;
+	pxRing->uiEventHead = 0;
+	pxRing->uiWakeLevel = 0xFFFFFFFF;
+	pxRing->uiOverrunCount = 0;
+	pxRing->ucIsEnabled = 1;
+
+	xSemaphoreTake(pxUnit->xRxneSemaphore, 0);
+
+	/*	Discard any previous idle state, then start filling the ring	*/
+	vPORT_UART_CLEAR_IDLE_FLAG(ucUnitNumber);
+	vHOS_UART_HW_startRxRing(pxUnit);
+	vPort_UART_enableIdleInterrupt(ucUnitNumber);
+}
+
+/*
+ * Sets match character of a HW unit.
+ */
+void vHOS_UART_HW_setMatchCharacter(uint8_t ucUnitNumber, uint8_t ucChar, uint8_t ucEnable)
+{
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnitArr[ucUnitNumber].xRxRing;
+
+	pxRing->ucIsMatchEnabled = 0;
+	pxRing->ucMatchChar = ucChar;
+	pxRing->ucIsMatchEnabled = ucEnable;
+}
+
+/*
+ * Returns number of bytes available in the ring of a HW unit.
+ */
+uint32_t uiHOS_UART_HW_getAvailableSize(uint8_t ucUnitNumber)
+{
+	return uiRxRingGetAvailable(&pxUnitArr[ucUnitNumber].xRxRing);
+}
+
+/*
+ * Reads whatever is available in the ring of a HW unit.
+ */
+uint32_t uiHOS_UART_HW_readAvailable(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiMaxSize)
+{
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnitArr[ucUnitNumber].xRxRing;
+	uint32_t uiSize = uiRxRingGetAvailable(pxRing);
+
+	if (uiSize > uiMaxSize)
+		uiSize = uiMaxSize;
+
+	vRxRingRead(pxRing, pcArr, uiSize);
+
+	return uiSize;
+}
+
+/*
+ * Reads a frame from the ring of a HW unit.
+ */
+uint32_t uiHOS_UART_HW_readFrame(	uint8_t ucUnitNumber,
+									int8_t* pcArr,
+									uint32_t uiMaxSize,
+									TickType_t xTimeout	)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+	TickType_t xStartTime = xTaskGetTickCount();
+	TickType_t xRemaining;
+	uint32_t uiAvailable, uiEvent, uiLen, uiTail;
+	uint32_t uiScanned = 0;
+
+	if (uiMaxSize == 0)
+		return 0;
+
+	while(1)
+	{
+		/*	Wake level is set before checking, so no byte is missed	*/
+		pxRing->uiWakeLevel = uiMaxSize;
+
+		/*	Bytes overwritten by DMA are skipped, scan again from the tail	*/
+		uiTail = pxRing->uiTail;
+		uiAvailable = uiRxRingGetAvailable(pxRing);
+		if (pxRing->uiTail != uiTail)
+			uiScanned = 0;
+
+		uiEvent = pxRing->uiEventHead - pxRing->uiTail;
+		uiLen = 0;
+
+		/*	First match character ends the frame	*/
+		if (pxRing->ucIsMatchEnabled)
+		{
+			for (; uiScanned < uiAvailable && uiScanned < uiMaxSize; uiScanned++)
+			{
+				if (pxRing->pucArr[(pxRing->uiTail + uiScanned) & uiUART_HW_RING_MASK] ==
+					pxRing->ucMatchChar)
+				{
+					uiLen = uiScanned + 1;
+					break;
+				}
+			}
+		}
+
+		/*	Otherwise, a frame gap (idle line) that has not been read yet	*/
+		if (uiLen == 0 && uiEvent != 0 && uiEvent <= uiAvailable)
+			uiLen = uiEvent;
+
+		/*	Otherwise, a full buffer	*/
+		if (uiLen == 0 && uiAvailable >= uiMaxSize)
+			uiLen = uiMaxSize;
+
+		if (uiLen != 0)
+		{
+			if (uiLen > uiMaxSize)
+				uiLen = uiMaxSize;
+
+			vRxRingRead(pxRing, pcArr, uiLen);
+			break;
+		}
+
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			break;
+
+		xSemaphoreTake(pxUnit->xRxneSemaphore, xRemaining);
+	}
+
+	pxRing->uiWakeLevel = 0xFFFFFFFF;
+	return uiLen;
+}
+
+/*
+ * Returns number of bytes dropped by a HW unit as its ring was full.
+ */
+uint32_t uiHOS_UART_HW_getOverrunCount(uint8_t ucUnitNumber)
+{
+	return pxUnitArr[ucUnitNumber].xRxRing.uiOverrunCount;
+}
+
+/*
+ * Locks a HW unit.
+ */
+uint8_t ucHOS_UART_HW_takeMutex(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	return xSemaphoreTake(pxUnitArr[ucUnitNumber].xUnitMutex, xTimeout);
+}
+
+/*
+ * Unlocks a HW unit.
+ */
+void vHOS_UART_HW_releaseMutex(uint8_t ucUnitNumber)
+{
+	xSemaphoreGive(pxUnitArr[ucUnitNumber].xUnitMutex);
+}
+
+/*
+ * Blocks untill end of current transmission.
+ */
+uint8_t ucHOS_UART_HW_blockUntilTransmissionComplete(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	return xSemaphoreTake(pxUnitArr[ucUnitNumber].xTransferCompleteSemaphore, xTimeout);
+}
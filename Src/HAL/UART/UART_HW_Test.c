@@ -0,0 +1,715 @@
+/*
+ * UART_HW_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the HW UART driver, on a stand-in
+ * port ("HostTestPort" directory).
+ *
+ * The test simulates the hardware: bytes written to the data register (or moved
+ * by the simulated DMA) are appended to a "wire" array, received bytes are
+ * passed to the RxNE callback (or written to memory by the simulated circular
+ * DMA), and the driver's callbacks are called while their interrupts are
+ * enabled. Simulation runs
+ * whenever the driver blocks (see "ucHOST_TEST_STUB_onBlock()" in
+ * "Src/LIB/HostTestStubs").
+ *
+ * It checks that:
+ * 		-	Bytes on the wire are the enqueued buffers, in order.
+ *
+ * 		-	Waiting on a buffer's token returns only after its last byte is
+ * 			written to the unit, even if many buffers were sent without being
+ * 			waited for.
+ *
+ * 		-	Send returns only after its buffer is written to the unit (so the
+ * 			buffer can be reused), and a zero size send signals end of
+ * 			transmission.
+ *
+ * 		-	Enqueueing to a full queue with zero timeout fails, and zero size
+ * 			buffers are not enqueued.
+ *
+ * 		-	End of transmission is only signaled after the last buffer of the
+ * 			current transmission, not by a previous one.
+ *
+ * 		-	(DMA variant) The DMA channel's TC flag is never stale when a
+ * 			transmission starts.
+ *
+ * 		-	Continuous reception ring returns received bytes, frames ended by
+ * 			match character or idle line, and counts overruns (V1 drops the
+ * 			newest bytes, V2 overwrites the oldest ones).
+ *
+ * 		-	(DMA variant) Streamed frames are received intact across the ring's
+ * 			half and end.
+ *
+ * Then it prints, for different buffer sizes, the number of interrupts per
+ * KiB sent, the interrupt rate at 921600 baud (which is what loads the CPU on
+ * target), and host throughput of the driver's code path. The same is printed
+ * for continuous reception of different frame sizes.
+ *
+ * It is built for both variants, and run from repository's root directory
+ * as follows (portDMA_IS_AVAILABLE: 0 for "UART_HW_V1.c", 1 for "UART_HW_V2.c"):
+ *
+ * 		gcc -O2 -DHAL_UART_HW_HOST_TEST -DportDMA_IS_AVAILABLE=1 \
+ * 			-ISrc/HAL/UART/HostTestPort -ISrc/LIB/HostTestStubs -IInc \
+ * 			Src/HAL/UART/UART_HW.c Src/HAL/UART/UART_HW_V1.c \
+ * 			Src/HAL/UART/UART_HW_V2.c Src/HAL/UART/UART_HW_Test.c \
+ * 			-o uart_hw_test
+ *
+ * 		./uart_hw_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_UART_HW_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*	FreeRTOS (stubs)	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (stand-in port)	*/
+#include "MCAL_Port/Port_UART.h"
+#include "MCAL_Port/Port_DMA.h"
+
+/*	HAL	*/
+#include "HAL/DMA/DMA.h"
+#include "HAL/UART/UART_Config.h"
+#include "HAL/UART/UART_HW_Private.h"
+
+/*******************************************************************************
+ * Extern HW unit functions (see "UART.c"):
+ ******************************************************************************/
+extern void vHOS_UART_HW_init(void);
+
+extern void vHOS_UART_HW_send(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiSize);
+
+extern uint8_t ucHOS_UART_HW_enqueue(	uint8_t ucUnitNumber,
+										int8_t* pcArr,
+										uint32_t uiSize,
+										TickType_t xTimeout,
+										uint32_t* puiToken	);
+
+extern uint8_t ucHOS_UART_HW_blockUntilBufferSent(	uint8_t ucUnitNumber,
+													uint32_t uiToken,
+													TickType_t xTimeout	);
+
+extern uint8_t ucHOS_UART_HW_blockUntilTransmissionComplete(uint8_t ucUnitNumber, TickType_t xTimeout);
+
+extern void vHOS_UART_HW_enableContinuousReception(uint8_t ucUnitNumber);
+
+extern void vHOS_UART_HW_setMatchCharacter(uint8_t ucUnitNumber, uint8_t ucChar, uint8_t ucEnable);
+
+extern uint32_t uiHOS_UART_HW_getAvailableSize(uint8_t ucUnitNumber);
+
+extern uint32_t uiHOS_UART_HW_readAvailable(uint8_t ucUnitNumber, int8_t* pcArr, uint32_t uiMaxSize);
+
+extern uint32_t uiHOS_UART_HW_readFrame(	uint8_t ucUnitNumber,
+											int8_t* pcArr,
+											uint32_t uiMaxSize,
+											TickType_t xTimeout	);
+
+extern uint32_t uiHOS_UART_HW_getOverrunCount(uint8_t ucUnitNumber);
+
+#define uiWIRE_SIZE					(4 * 1024 * 1024)
+#define uiMAX_BUFFER_SIZE			300
+#define uiNUMBER_OF_BUFFERS			20000
+#define uiBENCHMARK_BYTES			(2 * 1024 * 1024)
+#define uiBAUD_BYTES_PER_SECOND		(921600 / 10)
+
+/*******************************************************************************
+ * Stand-in port and simulated hardware:
+ ******************************************************************************/
+xHostPort_UART_t pxHostPortUartArr[portUART_NUMBER_OF_UNITS];
+
+const uint8_t ppucPortUartTxeDmaMapping[portUART_NUMBER_OF_UNITS][2] = {
+	{0, 3}
+};
+
+const uint8_t ppucPortUartRxneDmaMapping[portUART_NUMBER_OF_UNITS][2] = {
+	{0, 4}
+};
+
+const uint8_t pxPortInterruptUartTxeIrqNumberArr[] = {0};
+const uint8_t pxPortInterruptUartRxneIrqNumberArr[] = {0};
+const uint8_t pxPortInterruptUartTcIrqNumberArr[] = {0};
+
+static xHostPort_UART_t* const pxUart = &pxHostPortUartArr[0];
+
+/*	Bytes shifted out by the unit	*/
+static uint8_t pucWireArr[uiWIRE_SIZE];
+static uint32_t uiWireLen;
+
+/*	Number of interrupts taken	*/
+static uint32_t uiIsrCount;
+
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiIndex)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, index: %u\n", pcName, uiIndex);
+		uiNumberOfFailures++;
+	}
+}
+
+#if portDMA_IS_AVAILABLE
+
+uint8_t pucHostPortDmaTcInterruptEnabledArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+uint8_t pucHostPortDmaThcInterruptEnabledArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+
+/*	Simulated DMA channels	*/
+typedef struct{
+	uint8_t ucIsLocked;
+	uint8_t ucIsActive;
+	uint8_t ucTcFlag;
+	xHOS_DMA_TransInfo_t xInfo;
+	void (*pfCallback)(void*);
+	void* pvParams;
+	void (*pfHalfCallback)(void*);
+	void* pvHalfParams;
+
+	/*	Number of bytes transferred in current (circular) cycle	*/
+	uint32_t uiCount;
+}xHostDmaChannel_t;
+
+static xHostDmaChannel_t pxDmaArr[portDMA_NUMBER_OF_CHANNELS_PER_UNIT];
+
+static xHostDmaChannel_t* const pxTxDma = &pxDmaArr[3];
+static xHostDmaChannel_t* const pxRxDma = &pxDmaArr[4];
+
+static uint8_t ucIsInIsr;
+
+uint8_t ucHOS_DMA_lockChannel(	uint8_t ucUnitNumber,
+								uint8_t ucChannelNumber,
+								TickType_t xTimeout	)
+{
+	(void)xTimeout;
+	vCheck(	ucUnitNumber == 0 &&
+			(	ucChannelNumber == ppucPortUartTxeDmaMapping[0][1] ||
+				ucChannelNumber == ppucPortUartRxneDmaMapping[0][1]	),
+			"locked channel is a mapped one", ucChannelNumber	);
+	vCheck(!pxDmaArr[ucChannelNumber].ucIsLocked, "channel locked once", ucChannelNumber);
+	pxDmaArr[ucChannelNumber].ucIsLocked = 1;
+	return 1;
+}
+
+uint8_t ucHOS_DMA_lockAnyChannel(	uint8_t* pucUnitNumber,
+									uint8_t* pucChannelNumber,
+									TickType_t xTimeout	)
+{
+	/*	Not used, as the stand-in port is static connected	*/
+	(void)pucUnitNumber;
+	(void)pucChannelNumber;
+	(void)xTimeout;
+	vCheck(0, "lock any channel", 0);
+	return 0;
+}
+
+void vHOS_DMA_startTransfer(xHOS_DMA_TransInfo_t* pxInfo)
+{
+	xHostDmaChannel_t* pxDma = &pxDmaArr[pxInfo->ucChannelNumber];
+
+	vCheck(pxDma->ucIsLocked, "DMA channel locked before transfer", pxInfo->ucChannelNumber);
+	vCheck(!pxDma->ucIsActive, "DMA transfer started while active", pxInfo->ucChannelNumber);
+
+	/*	A transmission started by a task must not see a previous TC flag	*/
+	if (!ucIsInIsr && pxDma == pxTxDma)
+		vCheck(!pxDma->ucTcFlag, "stale DMA TC flag on transmission start", uiWireLen);
+
+	pxDma->xInfo = *pxInfo;
+	pxDma->ucIsActive = 1;
+	pxDma->uiCount = 0;
+}
+
+void vHOS_DMA_stopTransfer(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+{
+	(void)ucUnitNumber;
+	pxDmaArr[ucChannelNumber].ucIsActive = 0;
+}
+
+uint32_t uiHOS_DMA_getRemainingCount(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+{
+	(void)ucUnitNumber;
+	return pxDmaArr[ucChannelNumber].xInfo.uiN - pxDmaArr[ucChannelNumber].uiCount;
+}
+
+void vHOS_DMA_clearTransferCompleteFlag(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber	)
+{
+	(void)ucUnitNumber;
+	pxDmaArr[ucChannelNumber].ucTcFlag = 0;
+}
+
+void vHOS_DMA_setTransferCompleteCallback(	uint8_t ucUnitNumber,
+											uint8_t ucChannelNumber,
+											void (*pfCallback)(void*),
+											void* pvParams	)
+{
+	(void)ucUnitNumber;
+	pxDmaArr[ucChannelNumber].pfCallback = pfCallback;
+	pxDmaArr[ucChannelNumber].pvParams = pvParams;
+}
+
+void vHOS_DMA_setTransferHalfCompleteCallback(	uint8_t ucUnitNumber,
+												uint8_t ucChannelNumber,
+												void (*pfCallback)(void*),
+												void* pvParams	)
+{
+	(void)ucUnitNumber;
+	pxDmaArr[ucChannelNumber].pfHalfCallback = pfCallback;
+	pxDmaArr[ucChannelNumber].pvHalfParams = pvParams;
+}
+
+#endif	/*	portDMA_IS_AVAILABLE	*/
+
+/*
+ * Runs one step of the simulated hardware. Returns 1 if anything happened.
+ */
+static uint8_t ucRunHardware(void)
+{
+	/*	Shift out the data register	*/
+	if (pxUart->ucIsDrWritten)
+	{
+		pucWireArr[uiWireLen++] = pxUart->ucDr;
+		pxUart->ucIsDrWritten = 0;
+		return 1;
+	}
+
+#if portDMA_IS_AVAILABLE
+	/*	Complete the DMA transfer (bytes go to the wire through DR)	*/
+	if (pxTxDma->ucIsActive && pxUart->ucIsTxeConnectedToDma)
+	{
+		vCheck(	pxTxDma->xInfo.pvPeripheralStartingAdderss == (void*)&pxUart->ucDr,
+				"DMA peripheral address", 0	);
+
+		memcpy(&pucWireArr[uiWireLen], pxTxDma->xInfo.pvMemoryStartingAdderss, pxTxDma->xInfo.uiN);
+		uiWireLen += pxTxDma->xInfo.uiN;
+		pxTxDma->ucIsActive = 0;
+
+		vCheck(	pucHostPortDmaTcInterruptEnabledArr[pxTxDma->xInfo.ucChannelNumber],
+				"DMA TC interrupt enabled", 0	);
+
+		/*	As the DMA driver's ISR does: give TC flag, then call the callback	*/
+		pxTxDma->ucTcFlag = 1;
+		ucIsInIsr = 1;
+		uiIsrCount++;
+		pxTxDma->pfCallback(pxTxDma->pvParams);
+		ucIsInIsr = 0;
+		return 1;
+	}
+#endif
+
+	if (pxUart->ucIsTxeInterruptEnabled)
+	{
+		uiIsrCount++;
+		pxUart->pfTxeCallback(pxUart->pvTxeCallbackParams);
+		return 1;
+	}
+
+	if (pxUart->ucIsTcInterruptEnabled)
+	{
+		uiIsrCount++;
+		pxUart->pfTcCallback(pxUart->pvTcCallbackParams);
+		return 1;
+	}
+
+	return 0;
+}
+
+uint8_t ucHOST_TEST_STUB_onBlock(void)
+{
+	return ucRunHardware();
+}
+
+/*	Receives a byte, as the unit would	*/
+static void vReceive(uint8_t ucByte)
+{
+	pxUart->ucDr = ucByte;
+
+#if portDMA_IS_AVAILABLE
+	/*	Circular DMA moves it to memory, with HT and TC interrupts	*/
+	if (pxUart->ucIsRxneConnectedToDma && pxRxDma->ucIsActive)
+	{
+		vCheck(	!pxUart->ucIsRxneInterruptEnabled,
+				"RxNE interrupt disabled while served by DMA", 0	);
+		vCheck(	pxRxDma->xInfo.ucCircularMode && pxRxDma->xInfo.ucDirection == 0,
+				"Rx DMA is circular, peripheral to memory", 0	);
+
+		((uint8_t*)pxRxDma->xInfo.pvMemoryStartingAdderss)[pxRxDma->uiCount++] =
+			*(uint8_t*)pxRxDma->xInfo.pvPeripheralStartingAdderss;
+
+		if (pxRxDma->uiCount == pxRxDma->xInfo.uiN / 2)
+		{
+			vCheck(	pucHostPortDmaThcInterruptEnabledArr[pxRxDma->xInfo.ucChannelNumber],
+					"Rx DMA HT interrupt enabled", 0	);
+			uiIsrCount++;
+			pxRxDma->pfHalfCallback(pxRxDma->pvHalfParams);
+		}
+		else if (pxRxDma->uiCount == pxRxDma->xInfo.uiN)
+		{
+			vCheck(	pucHostPortDmaTcInterruptEnabledArr[pxRxDma->xInfo.ucChannelNumber],
+					"Rx DMA TC interrupt enabled", 0	);
+			pxRxDma->uiCount = 0;
+			uiIsrCount++;
+			pxRxDma->pfCallback(pxRxDma->pvParams);
+		}
+		return;
+	}
+#endif
+
+	if (pxUart->ucIsRxneInterruptEnabled)
+	{
+		uiIsrCount++;
+		pxUart->pfRxneCallback(pxUart->pvRxneCallbackParams);
+	}
+}
+
+/*	Idle line after received bytes, as the unit would signal it	*/
+static void vIdleLine(void)
+{
+	if (pxUart->ucIsIdleInterruptEnabled)
+	{
+		uiIsrCount++;
+		pxUart->pfIdleCallback(pxUart->pvIdleCallbackParams);
+	}
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static void vTestQueue(void)
+{
+	static uint8_t pucDataArr[uiNUMBER_OF_BUFFERS * uiMAX_BUFFER_SIZE / 2 + uiMAX_BUFFER_SIZE];
+	static uint32_t puiEndArr[uiNUMBER_OF_BUFFERS];
+	static uint32_t puiTokenArr[uiNUMBER_OF_BUFFERS];
+	uint32_t uiPos = 0, uiOldest = 0, uiCount = 0, uiWireStart;
+
+	/*	Make sure previous transmission is complete	*/
+	ucHOS_UART_HW_blockUntilTransmissionComplete(0, portMAX_DELAY);
+	uiWireLen = 0;
+	uiWireStart = uiWireLen;
+
+	for (uint32_t i = 0; i < uiNUMBER_OF_BUFFERS; i++)
+	{
+		uint32_t uiSize = 1 + rand() % uiMAX_BUFFER_SIZE;
+		if (uiPos + uiSize > sizeof(pucDataArr))
+			break;
+
+		for (uint32_t j = 0; j < uiSize; j++)
+			pucDataArr[uiPos + j] = rand();
+
+		/*
+		 * Queue is full, wait for the oldest buffer, or (sometimes) for a later
+		 * one, which implies the ones before it.
+		 */
+		if (i - uiOldest == uiCONF_UART_TX_QUEUE_LENGTH)
+		{
+			if (rand() % 4 == 0)
+				uiOldest += rand() % uiCONF_UART_TX_QUEUE_LENGTH;
+
+			vCheck(	ucHOS_UART_HW_blockUntilBufferSent(0, puiTokenArr[uiOldest], portMAX_DELAY),
+					"buffer sent", uiOldest	);
+			/*	Last byte is either on the wire, or in the data register	*/
+			vCheck(	uiWireLen + pxUart->ucIsDrWritten - uiWireStart >= puiEndArr[uiOldest],
+					"sent before signaled", uiOldest	);
+			uiOldest++;
+		}
+
+		vCheck(	ucHOS_UART_HW_enqueue(0, (int8_t*)&pucDataArr[uiPos], uiSize, portMAX_DELAY, &puiTokenArr[i]),
+				"enqueue", i	);
+
+		uiPos += uiSize;
+		puiEndArr[i] = uiPos;
+		uiCount++;
+
+		/*	A buffer not yet sent (hardware has not run since) is not signaled	*/
+		if (uiSize > 1)
+			vCheck(!ucHOS_UART_HW_blockUntilBufferSent(0, puiTokenArr[i], 0), "not sent yet", i);
+
+		/*	Sometimes, let the hardware run a while	*/
+		for (uint32_t j = rand() % 64; j > 0; j--)
+			ucRunHardware();
+
+		if (rand() % 1000 == 0)
+		{
+			/*	Let it get idle	*/
+			while(ucRunHardware());
+		}
+	}
+
+	/*	Every buffer's token is signaled, including ones already sent	*/
+	for (uint32_t i = 0; i < uiCount; i++)
+	{
+		vCheck(	ucHOS_UART_HW_blockUntilBufferSent(0, puiTokenArr[i], portMAX_DELAY),
+				"buffer sent", i	);
+	}
+
+	vCheck(ucHOS_UART_HW_blockUntilTransmissionComplete(0, portMAX_DELAY), "transmission complete", 0);
+
+	vCheck(uiWireLen - uiWireStart == uiPos, "number of bytes on wire", uiWireLen);
+	vCheck(	memcmp(&pucWireArr[uiWireStart], pucDataArr, uiPos) == 0,
+			"bytes on wire", 0	);
+
+	vCheck(!ucRunHardware(), "hardware idle", 0);
+}
+
+static void vTestSend(void)
+{
+	int8_t pcArr[64];
+	uint32_t uiWireStart;
+
+	while(ucRunHardware());
+	uiWireLen = 0;
+	uiWireStart = uiWireLen;
+
+	/*	Same (stack) buffer is reused right after each send	*/
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		memset(pcArr, i, sizeof(pcArr));
+		vHOS_UART_HW_send(0, pcArr, sizeof(pcArr));
+		memset(pcArr, 0xEE, sizeof(pcArr));
+	}
+
+	vCheck(ucHOS_UART_HW_blockUntilTransmissionComplete(0, portMAX_DELAY), "send TC", 0);
+	vCheck(uiWireLen - uiWireStart == 100 * sizeof(pcArr), "send bytes on wire", 0);
+	for (uint32_t i = 0; i < uiWireLen - uiWireStart; i++)
+		vCheck(pucWireArr[uiWireStart + i] == i / sizeof(pcArr), "send data", i);
+
+	/*	Zero size send signals end of transmission	*/
+	vCheck(!ucHOS_UART_HW_blockUntilTransmissionComplete(0, 0), "TC taken", 0);
+	vHOS_UART_HW_send(0, pcArr, 0);
+	vCheck(!ucRunHardware(), "zero size send does not start", 0);
+	vCheck(ucHOS_UART_HW_blockUntilTransmissionComplete(0, 0), "zero size send TC", 0);
+}
+
+static void vTestFullQueueAndTc(void)
+{
+	static int8_t pcArr[uiCONF_UART_TX_QUEUE_LENGTH + 1][4];
+	uint32_t puiTokenArr[uiCONF_UART_TX_QUEUE_LENGTH];
+	uint32_t uiWireStart, uiToken;
+
+	/*	Previous transmission is complete, and its TC is left given	*/
+	while(ucRunHardware());
+	uiWireLen = 0;
+	uiWireStart = uiWireLen;
+
+	/*	Zero size is not enqueued, its token is the last enqueued one's	*/
+	vCheck(ucHOS_UART_HW_enqueue(0, pcArr[0], 0, 0, &uiToken), "zero size enqueue", 0);
+	vCheck(!ucRunHardware(), "zero size does not start", 0);
+	vCheck(ucHOS_UART_HW_blockUntilBufferSent(0, uiToken, 0), "zero size token sent", 0);
+
+	/*	Fill the queue, without letting hardware run	*/
+	for (uint32_t i = 0; i < uiCONF_UART_TX_QUEUE_LENGTH; i++)
+	{
+		memset(pcArr[i], i, 4);
+		vCheck(ucHOS_UART_HW_enqueue(0, pcArr[i], 4, 0, &puiTokenArr[i]), "enqueue to non-full", i);
+	}
+
+	vCheck(!ucHOS_UART_HW_enqueue(0, pcArr[uiCONF_UART_TX_QUEUE_LENGTH], 4, 0, &uiToken), "enqueue to full", 0);
+
+	/*	Previous transmission's TC must not be taken as end of this one	*/
+	vCheck(!ucHOS_UART_HW_blockUntilTransmissionComplete(0, 0), "stale TC", 0);
+
+	vCheck(ucHOS_UART_HW_blockUntilTransmissionComplete(0, portMAX_DELAY), "TC", 0);
+	vCheck(uiWireLen - uiWireStart == 4 * uiCONF_UART_TX_QUEUE_LENGTH, "full queue sent", 0);
+
+	for (uint32_t i = 0; i < uiCONF_UART_TX_QUEUE_LENGTH; i++)
+		vCheck(ucHOS_UART_HW_blockUntilBufferSent(0, puiTokenArr[i], 0), "full queue buffers sent", i);
+}
+
+static void vTestRxRing(void)
+{
+	int8_t pcArr[uiCONF_UART_RX_RING_SIZE];
+	uint32_t uiLen, uiFrameLen, puiFrameLenArr[20];
+
+	vHOS_UART_HW_enableContinuousReception(0);
+
+	/*	Plain bytes (with DMA, available on idle line)	*/
+	for (uint32_t i = 0; i < 100; i++)
+		vReceive(i);
+	vIdleLine();
+
+	vCheck(uiHOS_UART_HW_getAvailableSize(0) == 100, "available size", 0);
+	uiLen = uiHOS_UART_HW_readAvailable(0, pcArr, 60);
+	vCheck(uiLen == 60, "read available length", 0);
+	for (uint32_t i = 0; i < 60; i++)
+		vCheck(pcArr[i] == (int8_t)i, "read available data", i);
+	uiLen = uiHOS_UART_HW_readAvailable(0, pcArr, 100);
+	vCheck(uiLen == 40 && pcArr[0] == 60, "read rest", 0);
+
+	/*	Frames ended by match character, across ring's end, read after a burst	*/
+	vHOS_UART_HW_setMatchCharacter(0, '\n', 1);
+	for (uint32_t f = 0; f < 20; f++)
+	{
+		uiFrameLen = 1 + rand() % 10;
+		for (uint32_t i = 0; i < uiFrameLen - 1; i++)
+			vReceive('a' + i % 26);
+		vReceive('\n');
+		puiFrameLenArr[f] = uiFrameLen;
+	}
+	vIdleLine();
+
+	for (uint32_t f = 0; f < 20; f++)
+	{
+		uiLen = uiHOS_UART_HW_readFrame(0, pcArr, sizeof(pcArr), 0);
+		vCheck(uiLen == puiFrameLenArr[f] && pcArr[uiLen - 1] == '\n', "match frame", f);
+	}
+	vCheck(uiHOS_UART_HW_getAvailableSize(0) == 0, "match frames all read", 0);
+	vHOS_UART_HW_setMatchCharacter(0, '\n', 0);
+
+	/*	Frame ended by idle line	*/
+	for (uint32_t i = 0; i < 10; i++)
+		vReceive(i);
+	vCheck(uiHOS_UART_HW_readFrame(0, pcArr, sizeof(pcArr), 0) == 0, "no frame before idle", 0);
+	vIdleLine();
+	vCheck(uiHOS_UART_HW_readFrame(0, pcArr, sizeof(pcArr), 0) == 10, "idle frame", 0);
+
+	/*	Overrun (V1 drops the newest bytes, V2 overwrites the oldest ones)	*/
+	for (uint32_t i = 0; i < uiCONF_UART_RX_RING_SIZE + 5; i++)
+		vReceive(i);
+	vIdleLine();
+	vCheck(uiHOS_UART_HW_getOverrunCount(0) == 5, "overrun count", 0);
+	uiLen = uiHOS_UART_HW_readAvailable(0, pcArr, sizeof(pcArr));
+	vCheck(	uiLen == uiCONF_UART_RX_RING_SIZE &&
+			pcArr[0] == (portDMA_IS_AVAILABLE ? 5 : 0),
+			"full ring", 0	);
+	for (uint32_t i = 1; i < uiLen; i++)
+		vCheck(pcArr[i] == (int8_t)(pcArr[0] + i), "full ring data", i);
+}
+
+static void vBenchmarkRx(uint32_t uiFrameSize)
+{
+	static int8_t pcArr[uiCONF_UART_RX_RING_SIZE];
+	uint32_t uiIsrStart, uiN = uiBENCHMARK_BYTES / uiFrameSize;
+	uint32_t uiLen, uiReceived = 0, uiRead = 0, uiOverrunStart;
+	clock_t xStart;
+	double dSec, dIsrPerByte;
+
+	vHOS_UART_HW_enableContinuousReception(0);
+	uiOverrunStart = uiHOS_UART_HW_getOverrunCount(0);
+	uiIsrStart = uiIsrCount;
+
+	/*	Frames separated by idle lines, each read when its idle line is seen	*/
+	xStart = clock();
+	for (uint32_t i = 0; i < uiN; i++)
+	{
+		for (uint32_t j = 0; j < uiFrameSize; j++)
+			vReceive(uiReceived++);
+		vIdleLine();
+
+		while((uiLen = uiHOS_UART_HW_readFrame(0, pcArr, sizeof(pcArr), 0)) != 0)
+		{
+			for (uint32_t j = 0; j < uiLen; j++)
+				vCheck(pcArr[j] == (int8_t)(uiRead + j), "streamed data", uiRead + j);
+			uiRead += uiLen;
+		}
+	}
+	dSec = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	vCheck(uiRead == uiReceived, "streamed bytes all read", uiRead);
+	vCheck(uiHOS_UART_HW_getOverrunCount(0) == uiOverrunStart, "no streamed overrun", 0);
+
+	dIsrPerByte = (double)(uiIsrCount - uiIsrStart) / uiReceived;
+
+	printf(	"%6u %14.1f %18.0f %12.1f\n",
+			uiFrameSize,
+			dIsrPerByte * 1024,
+			dIsrPerByte * uiBAUD_BYTES_PER_SECOND,
+			uiReceived / dSec / 1e6	);
+}
+
+static void vBenchmark(uint32_t uiBufferSize)
+{
+	static int8_t pcArr[uiCONF_UART_TX_QUEUE_LENGTH][1024];
+	uint32_t puiTokenArr[uiCONF_UART_TX_QUEUE_LENGTH];
+	uint32_t uiIsrStart, uiN = uiBENCHMARK_BYTES / uiBufferSize;
+	clock_t xStart;
+	double dSec, dIsrPerByte;
+
+	while(ucRunHardware());
+	uiWireLen = 0;
+	uiIsrStart = uiIsrCount;
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiN; i++)
+	{
+		/*	Reuse the slot's array once its previous buffer is sent	*/
+		if (i >= uiCONF_UART_TX_QUEUE_LENGTH)
+		{
+			ucHOS_UART_HW_blockUntilBufferSent(	0,
+												puiTokenArr[i & uiUART_HW_TX_QUEUE_MASK],
+												portMAX_DELAY	);
+		}
+
+		ucHOS_UART_HW_enqueue(	0,
+								pcArr[i & uiUART_HW_TX_QUEUE_MASK],
+								uiBufferSize,
+								portMAX_DELAY,
+								&puiTokenArr[i & uiUART_HW_TX_QUEUE_MASK]	);
+	}
+	ucHOS_UART_HW_blockUntilTransmissionComplete(0, portMAX_DELAY);
+	dSec = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	dIsrPerByte = (double)(uiIsrCount - uiIsrStart) / (uiN * uiBufferSize);
+
+	printf(	"%6u %14.1f %18.0f %12.1f\n",
+			uiBufferSize,
+			dIsrPerByte * 1024,
+			dIsrPerByte * uiBAUD_BYTES_PER_SECOND,
+			uiN * uiBufferSize / dSec / 1e6	);
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vHOS_UART_HW_init();
+	vCheck(pxUart->ucIsEnabled, "unit enabled", 0);
+
+	for (uint32_t t = 0; t < 5; t++)
+	{
+		vTestQueue();
+		vTestSend();
+		vTestFullQueueAndTc();
+	}
+
+	vTestRxRing();
+
+	printf(	"Tx variant: %s\n",
+			portDMA_IS_AVAILABLE ? "V2 (DMA, chained from TC ISR)" : "V1 (TxE ISR)"	);
+	printf("  size   ISRs per KiB   ISRs/s @921600   host MB/s\n");
+	vBenchmark(1);
+	vBenchmark(16);
+	vBenchmark(256);
+	vBenchmark(1024);
+
+	printf(	"Rx variant: %s\n",
+			portDMA_IS_AVAILABLE ? "V2 (circular DMA, HT/TC/IDLE ISRs)" : "V1 (RxNE ISR)"	);
+	printf(" frame   ISRs per KiB   ISRs/s @921600   host MB/s\n");
+	vBenchmarkRx(16);
+	vBenchmarkRx(64);
+	vBenchmarkRx(200);
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_UART_HW_HOST_TEST	*/
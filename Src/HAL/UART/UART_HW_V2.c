@@ -0,0 +1,299 @@
+/*
+ * UART_HW_V2.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is the HW UART Tx and continuous reception source code used for targets
+ * which have DMA. (Rest of the driver is in "UART_HW.c")
+ *
+ * In continuous reception, a circular DMA transfer writes received bytes into
+ * the ring, and "uiHead" is advanced to DMA's position on the idle line, half
+ * transfer and transfer complete events, instead of an ISR per byte. As the
+ * ring is read on these events, a match character is found by the reading
+ * task when it wakes, not when the character is received. A ring that is not
+ * read in time gets its oldest bytes overwritten (and counted as overrun),
+ * rather than dropping the newest ones.
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_UART.h"
+#include "MCAL_Port/Port_DMA.h"
+
+/*	HAL (OS)	*/
+#include "HAL/DMA/DMA.h"
+
+/*	SELF	*/
+#include "HAL/UART/UART_Config.h"
+#include "HAL/UART/UART_HW_Private.h"
+
+#if portDMA_IS_AVAILABLE == 1
+
+/*******************************************************************************
+ * Helping functions/macros:
+ ******************************************************************************/
+/*
+ * Starts DMA transfer of the buffer at the tail.
+ */
+static void vStartTailBuffer(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_UART_HW_TxQueue_t* pxQueue = &pxUnit->xTxQueue;
+	xHOS_UART_HW_TxBuffer_t* pxBuffer =
+		&pxQueue->pxBufferArr[pxQueue->uiTail & uiUART_HW_TX_QUEUE_MASK];
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxQueue->xDmaInfo;
+
+	pxDmaInfo->pvMemoryStartingAdderss = (void*)pxBuffer->pcArr;
+	pxDmaInfo->uiN = pxBuffer->uiSize;
+
+	/*	Start transfer, then connect unit's TxE to its channel	*/
+	vHOS_DMA_startTransfer(pxDmaInfo);
+
+	vPort_UART_connectTxeToDma(	pxUnit->ucUnitNumber,
+								pxDmaInfo->ucUnitNumber,
+								pxDmaInfo->ucChannelNumber	);
+}
+
+/*******************************************************************************
+ * ISR callback:
+ ******************************************************************************/
+/*
+ * DMA transfer complete callback. Chains the next queued buffer, if any.
+ */
+static void vDmaTcCallback(void* pvParams)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = (xHOS_UART_HW_Unit_t*)pvParams;
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+	vPort_UART_disconnectTxeFromDma(pxUnit->ucUnitNumber);
+
+	if (!ucHOS_UART_HW_advanceTxQueueFromISR(pxUnit, &xHighPriorityTaskWoken))
+		vStartTailBuffer(pxUnit);
+
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+/*
+ * Rx DMA half transfer and transfer complete callback. DMA has written half of
+ * the ring since the previous one, advance "uiHead" and wake the reading task
+ * if its wake level is reached.
+ */
+static void vDmaRxCallback(void* pvParams)
+{
+	xHOS_UART_HW_Unit_t* pxUnit = (xHOS_UART_HW_Unit_t*)pvParams;
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+	BaseType_t xHighPriorityTaskWoken = pdFALSE;
+
+	vHOS_UART_HW_syncRxRingFromISR(pxUnit);
+
+	if (pxRing->uiHead - pxRing->uiTail >= pxRing->uiWakeLevel)
+	{
+		xSemaphoreGiveFromISR(	pxUnit->xRxneSemaphore,
+								&xHighPriorityTaskWoken	);
+	}
+
+	portYIELD_FROM_ISR(xHighPriorityTaskWoken);
+}
+
+/*******************************************************************************
+ * Driver functions:
+ ******************************************************************************/
+/*
+ * See "UART_HW_Private.h" for info.
+ *
+ * The unit's DMA channel is locked here and held by the unit, so that buffers
+ * are chained from the DMA ISR, with no task in the Tx path.
+ */
+void vHOS_UART_HW_initTx(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxUnit->xTxQueue.xDmaInfo;
+	uint8_t ucIsLocked;
+
+	/*	TxE is served by DMA	*/
+	vPort_UART_disableTxeInterrupt(ucUnitNumber);
+
+	if (portUART_IS_DMA_STATIC_CONNECTED)
+	{
+		pxDmaInfo->ucUnitNumber = ppucPortUartTxeDmaMapping[ucUnitNumber][0];
+		pxDmaInfo->ucChannelNumber = ppucPortUartTxeDmaMapping[ucUnitNumber][1];
+
+		ucIsLocked = ucHOS_DMA_lockChannel(	pxDmaInfo->ucUnitNumber,
+											pxDmaInfo->ucChannelNumber,
+											0	);
+	}
+	else
+	{
+		ucIsLocked = ucHOS_DMA_lockAnyChannel(	&pxDmaInfo->ucUnitNumber,
+												&pxDmaInfo->ucChannelNumber,
+												0	);
+	}
+
+	configASSERT(ucIsLocked);
+
+	pxDmaInfo->pvPeripheralStartingAdderss = pvPort_UART_getDrAddress(ucUnitNumber);
+	pxDmaInfo->ucTriggerSource = 0;
+	pxDmaInfo->ucPriLevel = 0;
+	pxDmaInfo->ucDirection = 1;
+	pxDmaInfo->ucMemoryIncrement = 1;
+	pxDmaInfo->ucPeripheralIncrement = 0;
+	pxDmaInfo->ucDataSize = 0;
+	pxDmaInfo->ucCircularMode = 0;
+
+	vHOS_DMA_setTransferCompleteCallback(	pxDmaInfo->ucUnitNumber,
+											pxDmaInfo->ucChannelNumber,
+											vDmaTcCallback,
+											(void*)pxUnit	);
+
+	vPORT_DMA_ENABLE_TRANSFER_COMPLETE_INTERRUPT(	pxDmaInfo->ucUnitNumber,
+													pxDmaInfo->ucChannelNumber	);
+}
+
+/*
+ * See "UART_HW_Private.h" for info.
+ */
+void vHOS_UART_HW_startTx(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxUnit->xTxQueue.xDmaInfo;
+
+	/*
+	 * Channel's TC flag (semaphore) is given on every transfer, and nothing
+	 * takes it here. Drain it, so that it only reflects transfers of this
+	 * transmission.
+	 */
+	vHOS_DMA_clearTransferCompleteFlag(	pxDmaInfo->ucUnitNumber,
+										pxDmaInfo->ucChannelNumber	);
+
+	/*	TC flag is not cleared by DMA writes, clear it before sending	*/
+	vPORT_UART_CLEAR_TC_FLAG(pxUnit->ucUnitNumber);
+
+	vStartTailBuffer(pxUnit);
+}
+
+/*
+ * See "UART_HW_Private.h" for info.
+ *
+ * The unit's Rx DMA channel is locked here and held by the unit, as the Tx
+ * one is.
+ */
+void vHOS_UART_HW_initRxRing(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	uint8_t ucUnitNumber = pxUnit->ucUnitNumber;
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxUnit->xRxRing.xDmaInfo;
+	uint8_t ucIsLocked;
+
+	if (portUART_IS_DMA_STATIC_CONNECTED)
+	{
+		pxDmaInfo->ucUnitNumber = ppucPortUartRxneDmaMapping[ucUnitNumber][0];
+		pxDmaInfo->ucChannelNumber = ppucPortUartRxneDmaMapping[ucUnitNumber][1];
+
+		ucIsLocked = ucHOS_DMA_lockChannel(	pxDmaInfo->ucUnitNumber,
+											pxDmaInfo->ucChannelNumber,
+											0	);
+	}
+	else
+	{
+		ucIsLocked = ucHOS_DMA_lockAnyChannel(	&pxDmaInfo->ucUnitNumber,
+												&pxDmaInfo->ucChannelNumber,
+												0	);
+	}
+
+	configASSERT(ucIsLocked);
+
+	pxDmaInfo->pvPeripheralStartingAdderss = pvPort_UART_getDrAddress(ucUnitNumber);
+	pxDmaInfo->pvMemoryStartingAdderss = (void*)pxUnit->xRxRing.pucArr;
+	pxDmaInfo->uiN = uiCONF_UART_RX_RING_SIZE;
+	pxDmaInfo->ucTriggerSource = 0;
+	pxDmaInfo->ucPriLevel = 0;
+	pxDmaInfo->ucDirection = 0;
+	pxDmaInfo->ucMemoryIncrement = 1;
+	pxDmaInfo->ucPeripheralIncrement = 0;
+	pxDmaInfo->ucDataSize = 0;
+	pxDmaInfo->ucCircularMode = 1;
+
+	vHOS_DMA_setTransferHalfCompleteCallback(	pxDmaInfo->ucUnitNumber,
+												pxDmaInfo->ucChannelNumber,
+												vDmaRxCallback,
+												(void*)pxUnit	);
+
+	vHOS_DMA_setTransferCompleteCallback(	pxDmaInfo->ucUnitNumber,
+											pxDmaInfo->ucChannelNumber,
+											vDmaRxCallback,
+											(void*)pxUnit	);
+
+	vPORT_DMA_ENABLE_TRANSFER_HALF_COMPLETE_INTERRUPT(	pxDmaInfo->ucUnitNumber,
+														pxDmaInfo->ucChannelNumber	);
+
+	vPORT_DMA_ENABLE_TRANSFER_COMPLETE_INTERRUPT(	pxDmaInfo->ucUnitNumber,
+													pxDmaInfo->ucChannelNumber	);
+}
+
+/*
+ * See "UART_HW_Private.h" for info.
+ */
+void vHOS_UART_HW_startRxRing(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxUnit->xRxRing.xDmaInfo;
+
+	/*	Ring is emptied (counters are zero), DMA starts at its beginning	*/
+	vHOS_DMA_startTransfer(pxDmaInfo);
+
+	vPort_UART_connectRxneToDma(	pxUnit->ucUnitNumber,
+									pxDmaInfo->ucUnitNumber,
+									pxDmaInfo->ucChannelNumber	);
+}
+
+/*
+ * See "UART_HW_Private.h" for info.
+ */
+void vHOS_UART_HW_stopRxRing(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxUnit->xRxRing.xDmaInfo;
+
+	vPort_UART_disconnectRxneFromDma(pxUnit->ucUnitNumber);
+
+	vHOS_DMA_stopTransfer(pxDmaInfo->ucUnitNumber, pxDmaInfo->ucChannelNumber);
+}
+
+/*
+ * See "UART_HW_Private.h" for info.
+ *
+ * DMA position is wrapped into the ring, so a whole ring written between two
+ * calls would not be seen. Half transfer and transfer complete interrupts
+ * make sure a call happens at least every half ring.
+ */
+void vHOS_UART_HW_syncRxRingFromISR(xHOS_UART_HW_Unit_t* pxUnit)
+{
+	xHOS_UART_HW_RxRing_t* pxRing = &pxUnit->xRxRing;
+	xHOS_DMA_TransInfo_t* pxDmaInfo = &pxRing->xDmaInfo;
+	uint32_t uiPos, uiHead, uiFill, uiPrevFill;
+
+	/*	Position in "pucArr" DMA is going to write next	*/
+	uiPos = uiCONF_UART_RX_RING_SIZE -
+		uiHOS_DMA_getRemainingCount(	pxDmaInfo->ucUnitNumber,
+										pxDmaInfo->ucChannelNumber	);
+
+	uiHead = pxRing->uiHead + ((uiPos - pxRing->uiHead) & uiUART_HW_RING_MASK);
+
+	/*	Count bytes overwritten before being read (not counted before)	*/
+	uiFill = uiHead - pxRing->uiTail;
+	if (uiFill > uiCONF_UART_RX_RING_SIZE)
+	{
+		uiPrevFill = pxRing->uiHead - pxRing->uiTail;
+		if (uiPrevFill < uiCONF_UART_RX_RING_SIZE)
+			uiPrevFill = uiCONF_UART_RX_RING_SIZE;
+
+		pxRing->uiOverrunCount += uiFill - uiPrevFill;
+	}
+
+	pxRing->uiHead = uiHead;
+}
+
+
+#endif		/*		portDMA_IS_AVAILABLE == 1		*/
@@ -0,0 +1,20 @@
+/*
+ * Port_USB.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host (PC) stand-in of the USB port, used only by "UsbCdc_Test.c". USB device
+ * is simulated by the TinyUSB stand-in ("Src/LIB/HostTestStubs/tusb.h").
+ */
+
+#ifndef COTS_OS_SRC_HAL_USBCDC_HOSTTESTPORT_PORT_USB_H_
+#define COTS_OS_SRC_HAL_USBCDC_HOSTTESTPORT_PORT_USB_H_
+
+static inline void vPort_USB_initHardware(void)
+{
+
+}
+
+
+
+#endif /* COTS_OS_SRC_HAL_USBCDC_HOSTTESTPORT_PORT_USB_H_ */
@@ -0,0 +1,526 @@
+/*
+ * UsbCdc.c
+ *
+ *  Created on: Sep 11, 2023
+ *      Author: Ali Emad
+ */
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*	FreeRTOS	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	MCAL (Ported)	*/
+#include "MCAL_Port/Port_USB.h"
+
+/*	Third-party dependencies	*/
+#include "tusb.h"
+#include "device/usbd_pvt.h"
+
+/*	COTS_OS	*/
+#include "RTOS_PRI_Config.h"
+
+/*	SELF	*/
+#include "HAL/UsbCdc/UsbCdc_Config.h"
+#include "HAL/UsbCdc/UsbCdc.h"
+
+
+
+/*******************************************************************************
+ * Helping macros:
+ ******************************************************************************/
+#define uiTASK_STACK_SIZE		(configMINIMAL_STACK_SIZE)
+
+#if (uiCONF_USB_CDC_RX_BUFFER_SIZE & (uiCONF_USB_CDC_RX_BUFFER_SIZE - 1)) != 0
+#error "uiCONF_USB_CDC_RX_BUFFER_SIZE must be a power of two"
+#endif
+#define uiRX_MASK				(uiCONF_USB_CDC_RX_BUFFER_SIZE - 1)
+
+
+/*******************************************************************************
+ * Helping structures:
+ ******************************************************************************/
+/*	USB CDC unit	*/
+typedef struct{
+	SemaphoreHandle_t xTransmissionMutex;
+	StaticSemaphore_t xTransmissionMutexStatic;
+
+	SemaphoreHandle_t xReceptionMutex;
+	StaticSemaphore_t xReceptionMutexStatic;
+
+	/*
+	 * Rx ring. Written by the USB device task only, read by the receiving task.
+	 * "uiRxHead" and "uiRxTail" are free running counters.
+	 */
+	uint8_t pucRxArr[uiCONF_USB_CDC_RX_BUFFER_SIZE];
+	volatile uint32_t uiRxHead;
+	volatile uint32_t uiRxTail;
+
+	/*
+	 * Set by the USB device task when the ring got full while TinyUSB still has
+	 * received data. Receiving task then re-schedules moving of this data after
+	 * it frees space in the ring.
+	 */
+	volatile uint8_t ucIsRxStalled;
+
+	/*	Given by the USB device task whenever new data is written to the ring	*/
+	SemaphoreHandle_t xRxSemaphore;
+	StaticSemaphore_t xRxSemaphoreStatic;
+
+	/*	Given by the USB device task when a Tx packet is sent to host	*/
+	SemaphoreHandle_t xTxCompleteSemaphore;
+	StaticSemaphore_t xTxCompleteSemaphoreStatic;
+
+	/*	Number of written bytes that were not yet flushed	*/
+	volatile uint32_t uiTxPendingCount;
+}xUsbCdc_t;
+
+/*******************************************************************************
+ * Driver's static variables:
+ ******************************************************************************/
+static xUsbCdc_t pxUnitArr[ucCONF_USB_CDC_NUMBER_OF_UNITS];
+
+/*
+ * Flush task (flushes pending Tx data on timeout).
+ */
+static StackType_t puxFlushTaskStack[uiTASK_STACK_SIZE];
+static StaticTask_t xFlushTaskStatic;
+static TaskHandle_t xFlushTask;
+
+/*	Given by senders when they leave pending data	*/
+static SemaphoreHandle_t xFlushRequestSemaphore;
+static StaticSemaphore_t xFlushRequestSemaphoreStatic;
+
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+/*
+ * Returns ticks remaining of "xTimeout", that started at "xStartTime".
+ */
+static TickType_t xGetRemainingTime(TickType_t xStartTime, TickType_t xTimeout)
+{
+	TickType_t xElapsed;
+
+	if (xTimeout == portMAX_DELAY)
+		return portMAX_DELAY;
+
+	xElapsed = xTaskGetTickCount() - xStartTime;
+
+	return (xElapsed < xTimeout) ? (xTimeout - xElapsed) : 0;
+}
+
+/*
+ * Moves received data from TinyUSB's FIFO to unit's Rx ring.
+ *
+ * Notes:
+ * 		-	Must only be called from the USB device task (single writer of the
+ * 			ring).
+ *
+ * 		-	Data is read directly into the ring, in at most two contiguous
+ * 			segments.
+ */
+static void vMoveRxData(uint8_t ucUnitNumber)
+{
+	xUsbCdc_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	uint32_t uiHead, uiFree, uiSegment, uiRead;
+	uint8_t ucIsMoved = 0;
+
+	while(1)
+	{
+		uiHead = pxUnit->uiRxHead;
+		uiFree = uiCONF_USB_CDC_RX_BUFFER_SIZE - (uiHead - pxUnit->uiRxTail);
+
+		if (uiFree == 0)
+		{
+			if (tud_cdc_n_available(ucUnitNumber) == 0)
+				break;
+
+			/*
+			 * Mark stalled, then re-check free space, in case receiving task has
+			 * freed space before seeing the flag.
+			 */
+			pxUnit->ucIsRxStalled = 1;
+			if (pxUnit->uiRxHead - pxUnit->uiRxTail < uiCONF_USB_CDC_RX_BUFFER_SIZE)
+			{
+				pxUnit->ucIsRxStalled = 0;
+				continue;
+			}
+			break;
+		}
+
+		/*	Free contiguous segment starting at head	*/
+		uiSegment = uiCONF_USB_CDC_RX_BUFFER_SIZE - (uiHead & uiRX_MASK);
+		if (uiSegment > uiFree)
+			uiSegment = uiFree;
+
+		uiRead = tud_cdc_n_read(ucUnitNumber, &pxUnit->pucRxArr[uiHead & uiRX_MASK], uiSegment);
+		if (uiRead == 0)
+			break;
+
+		pxUnit->uiRxHead = uiHead + uiRead;
+		ucIsMoved = 1;
+	}
+
+	if (ucIsMoved)
+		xSemaphoreGive(pxUnit->xRxSemaphore);
+}
+
+/*
+ * Deferred (executed in USB device task) version of "vMoveRxData()".
+ */
+static void vMoveRxDataDeferred(void* pvParams)
+{
+	vMoveRxData((uint8_t)(uintptr_t)pvParams);
+}
+
+/*
+ * Blocks until there is data in unit's Rx ring, or "xTimeout" passes.
+ *
+ * Returns number of available bytes.
+ */
+static uint32_t uiWaitRxData(xUsbCdc_t* pxUnit, TickType_t xTimeout)
+{
+	TickType_t xStartTime = xTaskGetTickCount();
+	TickType_t xRemaining;
+	uint32_t uiAvailable;
+
+	while(1)
+	{
+		uiAvailable = pxUnit->uiRxHead - pxUnit->uiRxTail;
+		if (uiAvailable != 0)
+			return uiAvailable;
+
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			return 0;
+
+		xSemaphoreTake(pxUnit->xRxSemaphore, xRemaining);
+	}
+}
+
+/*
+ * Flush task.
+ *
+ * Once a sender leaves pending data, task waits for the flush timeout, then
+ * flushes whatever is still pending on all units.
+ */
+static void vFlushTask(void* pvParams)
+{
+	(void)pvParams;
+
+	while(1)
+	{
+		xSemaphoreTake(xFlushRequestSemaphore, portMAX_DELAY);
+
+		vTaskDelay(pdMS_TO_TICKS(uiCONF_USB_CDC_TX_FLUSH_TIMEOUT_MS));
+
+		for (uint8_t i = 0; i < ucCONF_USB_CDC_NUMBER_OF_UNITS; i++)
+		{
+			if (pxUnitArr[i].uiTxPendingCount != 0)
+				vHOS_UsbCdc_flush(i);
+		}
+	}
+}
+
+
+/*******************************************************************************
+ * Callbacks:
+ ******************************************************************************/
+/*
+ * TinyUSB callbacks. (Executed in USB device task)
+ */
+void tud_cdc_rx_cb(uint8_t itf)
+{
+	if (itf < ucCONF_USB_CDC_NUMBER_OF_UNITS)
+		vMoveRxData(itf);
+}
+
+void tud_cdc_tx_complete_cb(uint8_t itf)
+{
+	if (itf < ucCONF_USB_CDC_NUMBER_OF_UNITS)
+		xSemaphoreGive(pxUnitArr[itf].xTxCompleteSemaphore);
+}
+
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_init(void)
+{
+	xUsbCdc_t* pxUnit;
+
+	for (uint8_t i = 0; i < ucCONF_USB_CDC_NUMBER_OF_UNITS; i++)
+	{
+		pxUnit = &pxUnitArr[i];
+
+		/*	Initialize USB transmission mutex	*/
+		pxUnit->xTransmissionMutex = xSemaphoreCreateMutexStatic(
+			&pxUnit->xTransmissionMutexStatic	);
+
+		xSemaphoreGive(pxUnit->xTransmissionMutex);
+
+		/*	Initialize USB reception mutex	*/
+		pxUnit->xReceptionMutex = xSemaphoreCreateMutexStatic(
+			&pxUnit->xReceptionMutexStatic	);
+
+		xSemaphoreGive(pxUnit->xReceptionMutex);
+
+		/*	Initialize Rx ring	*/
+		pxUnit->uiRxHead = 0;
+		pxUnit->uiRxTail = 0;
+		pxUnit->ucIsRxStalled = 0;
+
+		pxUnit->xRxSemaphore = xSemaphoreCreateBinaryStatic(
+			&pxUnit->xRxSemaphoreStatic	);
+
+		/*	Initialize Tx	*/
+		pxUnit->uiTxPendingCount = 0;
+
+		pxUnit->xTxCompleteSemaphore = xSemaphoreCreateBinaryStatic(
+			&pxUnit->xTxCompleteSemaphoreStatic	);
+	}
+
+	/*	Create flush task	*/
+	xFlushRequestSemaphore = xSemaphoreCreateBinaryStatic(
+		&xFlushRequestSemaphoreStatic	);
+
+	xFlushTask = xTaskCreateStatic(	vFlushTask,
+									"UsbCdcFlush",
+									uiTASK_STACK_SIZE,
+									NULL,
+									configHOS_SOFT_REAL_TIME_TASK_PRI,
+									puxFlushTaskStack,
+									&xFlushTaskStatic	);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_UsbCdc_lockTransmission(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	xUsbCdc_t* pxHandle = &pxUnitArr[ucUnitNumber];
+
+	return xSemaphoreTake(pxHandle->xTransmissionMutex, xTimeout);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_releaseTransmission(uint8_t ucUnitNumber)
+{
+	xUsbCdc_t* pxHandle = &pxUnitArr[ucUnitNumber];
+
+	xSemaphoreGive(pxHandle->xTransmissionMutex);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_UsbCdc_lockReception(uint8_t ucUnitNumber, TickType_t xTimeout)
+{
+	xUsbCdc_t* pxHandle = &pxUnitArr[ucUnitNumber];
+
+	return xSemaphoreTake(pxHandle->xReceptionMutex, xTimeout);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_releaseReception(uint8_t ucUnitNumber)
+{
+	xUsbCdc_t* pxHandle = &pxUnitArr[ucUnitNumber];
+
+	xSemaphoreGive(pxHandle->xReceptionMutex);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_send(uint8_t ucUnitNumber, uint8_t* pucBuffer, uint16_t usLen)
+{
+	xUsbCdc_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	uint32_t uiWritten;
+
+	while(usLen > 0)
+	{
+		uiWritten = tud_cdc_n_write(ucUnitNumber, (void*)pucBuffer, usLen);
+
+		pucBuffer += uiWritten;
+		usLen -= uiWritten;
+		pxUnit->uiTxPendingCount += uiWritten;
+
+		if (pxUnit->uiTxPendingCount >= uiCONF_USB_CDC_TX_FLUSH_THRESHOLD)
+			vHOS_UsbCdc_flush(ucUnitNumber);
+
+		/*	If Tx FIFO is full, wait for a packet to be sent to host	*/
+		if (usLen > 0)
+		{
+			/*	Data can't be sent if host is not connected	*/
+			if (!tud_cdc_n_connected(ucUnitNumber))
+				break;
+
+			xSemaphoreTake(pxUnit->xTxCompleteSemaphore, 0);
+			vHOS_UsbCdc_flush(ucUnitNumber);
+			if (tud_cdc_n_write_available(ucUnitNumber) == 0)
+				xSemaphoreTake(pxUnit->xTxCompleteSemaphore, pdMS_TO_TICKS(1));
+		}
+	}
+
+	/*	If data is left pending, request a flush on timeout	*/
+	if (pxUnit->uiTxPendingCount != 0)
+		xSemaphoreGive(xFlushRequestSemaphore);
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_flush(uint8_t ucUnitNumber)
+{
+	pxUnitArr[ucUnitNumber].uiTxPendingCount = 0;
+	tud_cdc_n_write_flush(ucUnitNumber);
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_UsbCdc_read(	uint8_t ucUnitNumber,
+							uint8_t* pucBuffer,
+							uint32_t uiMaxLen,
+							TickType_t xTimeout	)
+{
+	uint32_t uiLen = 0;
+	uint32_t uiSegment;
+	uint8_t* pucSegment;
+
+	if (uiMaxLen == 0)
+		return 0;
+
+	/*	Copy in at most two contiguous segments	*/
+	for (uint8_t i = 0; i < 2 && uiLen < uiMaxLen; i++)
+	{
+		uiSegment = uiHOS_UsbCdc_getRxSegment(	ucUnitNumber,
+												&pucSegment,
+												(i == 0) ? xTimeout : 0	);
+		if (uiSegment == 0)
+			break;
+
+		if (uiSegment > uiMaxLen - uiLen)
+			uiSegment = uiMaxLen - uiLen;
+
+		memcpy(&pucBuffer[uiLen], pucSegment, uiSegment);
+		vHOS_UsbCdc_consumeRx(ucUnitNumber, uiSegment);
+		uiLen += uiSegment;
+	}
+
+	return uiLen;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_UsbCdc_readRxBuffer(	uint8_t ucUnitNumber,
+									uint8_t* pucBuffer,
+									uint32_t* puiLen,
+									TickType_t xTimeout	)
+{
+	*puiLen = uiHOS_UsbCdc_read(	ucUnitNumber,
+									pucBuffer,
+									uiCONF_USB_CDC_RX_BUFFER_SIZE,
+									xTimeout	);
+
+	return (*puiLen != 0);
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_UsbCdc_receive(	uint8_t ucUnitNumber,
+								uint8_t* pucBuffer,
+								uint32_t uiLen,
+								TickType_t xTimeout	)
+{
+	TickType_t xStartTime = xTaskGetTickCount();
+	TickType_t xRemaining;
+	uint32_t uiCount = 0;
+
+	while(uiCount < uiLen)
+	{
+		xRemaining = xGetRemainingTime(xStartTime, xTimeout);
+		if (xRemaining == 0)
+			return 0;
+
+		uiCount += uiHOS_UsbCdc_read(	ucUnitNumber,
+										&pucBuffer[uiCount],
+										uiLen - uiCount,
+										xRemaining	);
+	}
+
+	return 1;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiHOS_UsbCdc_getRxSegment(	uint8_t ucUnitNumber,
+									uint8_t** ppucSegment,
+									TickType_t xTimeout	)
+{
+	xUsbCdc_t* pxUnit = &pxUnitArr[ucUnitNumber];
+	uint32_t uiAvailable = uiWaitRxData(pxUnit, xTimeout);
+	uint32_t uiStart = pxUnit->uiRxTail & uiRX_MASK;
+	uint32_t uiSegment = uiCONF_USB_CDC_RX_BUFFER_SIZE - uiStart;
+
+	if (uiSegment > uiAvailable)
+		uiSegment = uiAvailable;
+
+	*ppucSegment = &pxUnit->pucRxArr[uiStart];
+
+	return uiSegment;
+}
+
+/*
+ * See header for info.
+ */
+void vHOS_UsbCdc_consumeRx(uint8_t ucUnitNumber, uint32_t uiLen)
+{
+	xUsbCdc_t* pxUnit = &pxUnitArr[ucUnitNumber];
+
+	pxUnit->uiRxTail += uiLen;
+
+	/*	If USB device task has data it couldn't move, re-schedule moving it	*/
+	if (pxUnit->ucIsRxStalled)
+	{
+		pxUnit->ucIsRxStalled = 0;
+		usbd_defer_func(vMoveRxDataDeferred, (void*)(uintptr_t)ucUnitNumber, false);
+	}
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucHOS_UsbCdc_isConnected(uint8_t ucUnitNumber)
+{
+	return tud_cdc_n_connected(ucUnitNumber);
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,294 @@
+/*
+ * UsbCdc_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the USB CDC driver, on the TinyUSB stand-in
+ * ("Src/LIB/HostTestStubs/tusb.h"), whose host echoes every packet sent to it.
+ * USB device task and host run whenever the test blocks (i.e.: on a full Tx
+ * FIFO, or waiting for received data).
+ *
+ * It checks that:
+ * 		-	Data sent in random sized chunks is received back in order, using all
+ * 			read functions (read, receive, read Rx buffer, and zero-copy segments),
+ * 			including when the Rx ring gets full, and moving received data is
+ * 			deferred until it's consumed.
+ *
+ * 		-	Single byte sends are coalesced into full packets.
+ *
+ * Then it prints loopback throughput (MB/s) and bytes per packet, for several
+ * send sizes. Throughput is that of the driver and the stand-in on the host
+ * machine, bus time is not simulated. Bytes per packet give the full-speed bus
+ * limit (19 bulk packets per 1ms frame).
+ *
+ * Flush on timeout is done by the driver's flush task, which host tests don't
+ * run, hence the test flushes after each burst of sends.
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DHAL_USB_CDC_HOST_TEST -ISrc/HAL/UsbCdc/HostTestPort \
+ * 			-ISrc/LIB/HostTestStubs -IInc Src/HAL/UsbCdc/UsbCdc.c \
+ * 			Src/LIB/HostTestStubs/TinyUsbLoopback.c \
+ * 			Src/HAL/UsbCdc/UsbCdc_Test.c -o usb_cdc_test
+ *
+ * 		./usb_cdc_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef HAL_USB_CDC_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*	FreeRTOS (stubs)	*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*	Third-party dependencies (stubs)	*/
+#include "tusb.h"
+
+/*	HAL	*/
+#include "HAL/UsbCdc/UsbCdc_Config.h"
+#include "HAL/UsbCdc/UsbCdc.h"
+
+#define uiINTEGRITY_BYTES				(2 * 1024 * 1024)
+#define uiCOALESCING_BYTES				(16 * 1024)
+#define uiBENCHMARK_BYTES				(16 * 1024 * 1024)
+
+/*	Largest burst sent before reading it back (host buffers echoed data)	*/
+#define uiMAX_BURST						(8 * 1024)
+
+#define uiFS_PACKETS_PER_FRAME			19
+
+static uint32_t uiNumberOfFailures = 0;
+
+/*	Stream position of the next sent and received bytes	*/
+static uint32_t uiTxPos = 0;
+static uint32_t uiRxPos = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiIndex)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, index: %u\n", pcName, uiIndex);
+		uiNumberOfFailures++;
+	}
+}
+
+static uint8_t ucStreamByte(uint32_t uiPos)
+{
+	return (uint8_t)(uiPos * 7 + (uiPos >> 8));
+}
+
+/*
+ * Blocking runs the USB device task and the host. If there is nothing for them
+ * to do, the test would block forever.
+ */
+uint8_t ucHOST_TEST_STUB_onBlock(void)
+{
+	if (!ucHOST_TEST_STUB_runUsb())
+	{
+		printf("FAILED: blocked with nothing to wait for\n");
+		exit(1);
+	}
+
+	return 1;
+}
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+/*	Sends "uiLen" bytes of the stream in chunks of up to "usChunk" bytes	*/
+static void vSendStream(uint32_t uiLen, uint16_t usChunk, uint8_t ucIsRandomChunk)
+{
+	static uint8_t pucArr[65535];
+	uint16_t usLen;
+
+	while(uiLen > 0)
+	{
+		usLen = ucIsRandomChunk ? (1 + rand() % usChunk) : usChunk;
+		if (usLen > uiLen)
+			usLen = uiLen;
+
+		for (uint16_t i = 0; i < usLen; i++)
+			pucArr[i] = ucStreamByte(uiTxPos + i);
+
+		vHOS_UsbCdc_send(0, pucArr, usLen);
+
+		uiTxPos += usLen;
+		uiLen -= usLen;
+	}
+
+	vHOS_UsbCdc_flush(0);
+}
+
+static void vCheckReceived(uint8_t* pucArr, uint32_t uiLen)
+{
+	for (uint32_t i = 0; i < uiLen; i++, uiRxPos++)
+		vCheck(pucArr[i] == ucStreamByte(uiRxPos), "received data", uiRxPos);
+}
+
+/*	Receives everything sent so far, using a random read function each time	*/
+static void vReceiveStream(void)
+{
+	static uint8_t pucArr[uiCONF_USB_CDC_RX_BUFFER_SIZE];
+	uint8_t* pucSegment;
+	uint32_t uiLen;
+
+	while(uiRxPos < uiTxPos)
+	{
+		/*
+		 * Sometimes, let the device task and the host run as long as they can
+		 * before reading (as if receiving task was busy), filling the Rx ring.
+		 */
+		if (rand() % 4 == 0)
+			while(ucHOST_TEST_STUB_runUsb());
+
+		switch(rand() % 4)
+		{
+		case 0:
+			uiLen = uiHOS_UsbCdc_read(	0,
+										pucArr,
+										1 + rand() % uiCONF_USB_CDC_RX_BUFFER_SIZE,
+										portMAX_DELAY	);
+			vCheck(uiLen != 0, "read", uiRxPos);
+			break;
+
+		case 1:
+			uiLen = 1 + rand() % uiCONF_USB_CDC_RX_BUFFER_SIZE;
+			if (uiLen > uiTxPos - uiRxPos)
+				uiLen = uiTxPos - uiRxPos;
+			vCheck(ucHOS_UsbCdc_receive(0, pucArr, uiLen, portMAX_DELAY), "receive", uiRxPos);
+			break;
+
+		case 2:
+			vCheck(ucHOS_UsbCdc_readRxBuffer(0, pucArr, &uiLen, portMAX_DELAY), "read Rx buffer", uiRxPos);
+			break;
+
+		default:
+			/*	Zero-copy, consuming part of the segment	*/
+			uiLen = uiHOS_UsbCdc_getRxSegment(0, &pucSegment, portMAX_DELAY);
+			vCheck(uiLen != 0, "get Rx segment", uiRxPos);
+			uiLen = 1 + rand() % uiLen;
+			memcpy(pucArr, pucSegment, uiLen);
+			vHOS_UsbCdc_consumeRx(0, uiLen);
+			break;
+		}
+
+		vCheck(uiLen <= uiTxPos - uiRxPos, "received more than sent", uiRxPos);
+		vCheckReceived(pucArr, uiLen);
+	}
+
+	/*	Nothing more is received	*/
+	while(ucHOST_TEST_STUB_runUsb());
+	vCheck(uiHOS_UsbCdc_read(0, pucArr, 1, 0) == 0, "no extra data", uiRxPos);
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static void vTestIntegrity(void)
+{
+	while(uiTxPos < uiINTEGRITY_BYTES)
+	{
+		vSendStream(1 + rand() % uiMAX_BURST, 600, 1);
+		vReceiveStream();
+	}
+
+	/*	Ring got full, and data was moved once consumed	*/
+	vCheck(xHOST_TEST_STUB_usbStats.uiDeferredCallCount != 0, "deferred moving of Rx data", 0);
+}
+
+static void vTestCoalescing(void)
+{
+	uint32_t uiPackets = xHOST_TEST_STUB_usbStats.uiInPacketCount;
+
+	vSendStream(uiCOALESCING_BYTES, 1, 0);
+	vReceiveStream();
+
+	uiPackets = xHOST_TEST_STUB_usbStats.uiInPacketCount - uiPackets;
+
+	vCheck(	uiPackets == uiCOALESCING_BYTES / CFG_TUD_CDC_EP_BUFSIZE,
+			"single byte sends coalesced into full packets",
+			uiPackets	);
+}
+
+static void vBenchmark(void)
+{
+	static const uint16_t pusChunkArr[] = {1, 8, 64, 512, 4096};
+	static uint8_t pucArr[uiCONF_USB_CDC_RX_BUFFER_SIZE];
+	uint32_t uiPackets, uiBytes, uiLen;
+	double dSeconds, dBytesPerPacket;
+	clock_t xStart;
+
+	printf("send size   MB/s   bytes/packet   FS bus limit (MB/s)\n");
+
+	for (uint32_t i = 0; i < sizeof(pusChunkArr) / sizeof(pusChunkArr[0]); i++)
+	{
+		uiPackets = xHOST_TEST_STUB_usbStats.uiInPacketCount;
+		uiBytes = xHOST_TEST_STUB_usbStats.uiInByteCount;
+		xStart = clock();
+
+		for (uint32_t j = 0; j < uiBENCHMARK_BYTES / uiMAX_BURST; j++)
+		{
+			vSendStream(uiMAX_BURST, pusChunkArr[i], 0);
+
+			while(uiRxPos < uiTxPos)
+			{
+				uiLen = uiHOS_UsbCdc_read(0, pucArr, sizeof(pucArr), portMAX_DELAY);
+				uiRxPos += uiLen;
+			}
+		}
+
+		dSeconds = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+		uiPackets = xHOST_TEST_STUB_usbStats.uiInPacketCount - uiPackets;
+		uiBytes = xHOST_TEST_STUB_usbStats.uiInByteCount - uiBytes;
+		dBytesPerPacket = (double)uiBytes / uiPackets;
+
+		vCheck(uiBytes == uiBENCHMARK_BYTES, "benchmark bytes", i);
+
+		printf(	"%9u %6.1f %14.1f %21.3f\n",
+				pusChunkArr[i],
+				uiBENCHMARK_BYTES / 1e6 / dSeconds,
+				dBytesPerPacket,
+				uiFS_PACKETS_PER_FRAME * dBytesPerPacket * 1000 / 1e6	);
+	}
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vHOS_UsbCdc_init();
+	vCheck(ucHOS_UsbCdc_lockTransmission(0, 0), "lock transmission", 0);
+	vCheck(ucHOS_UsbCdc_lockReception(0, 0), "lock reception", 0);
+	vCheck(ucHOS_UsbCdc_isConnected(0), "connected", 0);
+
+	vTestIntegrity();
+	vTestCoalescing();
+	vBenchmark();
+
+	vHOS_UsbCdc_releaseReception(0);
+	vHOS_UsbCdc_releaseTransmission(0);
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	HAL_USB_CDC_HOST_TEST	*/
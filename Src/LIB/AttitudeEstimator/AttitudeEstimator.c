@@ -0,0 +1,283 @@
+/*
+ * AttitudeEstimator.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include "stdint.h"
+
+/*	SELF	*/
+#include "LIB/AttitudeEstimator/AttitudeEstimator.h"
+
+/*******************************************************************************
+ * Helping functions / macros:
+ ******************************************************************************/
+#define iONE		iLIB_ATTITUDE_ESTIMATOR_ONE
+
+/*	Multiplication of two Q30 numbers	*/
+#define iMUL_Q30(iA, iB)	((int32_t)(((int64_t)(iA) * (int64_t)(iB)) >> 30))
+
+/*	Arc tangent polynomial coefficients, in Q30	*/
+#define iATAN_A1	((int32_t)( 0.9998660 * (double)iONE))
+#define iATAN_A3	((int32_t)(-0.3302995 * (double)iONE))
+#define iATAN_A5	((int32_t)( 0.1801410 * (double)iONE))
+#define iATAN_A7	((int32_t)(-0.0851330 * (double)iONE))
+#define iATAN_A9	((int32_t)( 0.0208351 * (double)iONE))
+
+/*	(180 / pi) * 10^6, converts radians to micro-degrees	*/
+#define lRAD_TO_UDEG	(57295780ll)
+
+/*
+ * Integer square root (floor). Bit by bit, 16 iterations.
+ */
+static uint32_t uiSqrt(uint32_t uiX)
+{
+	uint32_t uiRes = 0;
+	uint32_t uiBit = 1ul << 30;
+
+	while (uiBit > uiX)
+		uiBit >>= 2;
+
+	while (uiBit != 0)
+	{
+		if (uiX >= uiRes + uiBit)
+		{
+			uiX -= uiRes + uiBit;
+			uiRes = (uiRes >> 1) + uiBit;
+		}
+		else
+		{
+			uiRes >>= 1;
+		}
+		uiBit >>= 2;
+	}
+
+	return uiRes;
+}
+
+/*
+ * Returns 1000000 * atan2(iY, iX) * 180 / pi. (Angle in micro-degrees)
+ *
+ * "iY" and "iX" are in the same (any) Q format.
+ */
+static int32_t iAtan2(int32_t iY, int32_t iX)
+{
+	uint32_t uiAbsY = (iY < 0) ? -(uint32_t)iY : (uint32_t)iY;
+	uint32_t uiAbsX = (iX < 0) ? -(uint32_t)iX : (uint32_t)iX;
+	uint32_t uiMin, uiMax;
+	int32_t iR, iR2, iAtan;
+	int32_t iAngle;
+
+	if (uiAbsX == 0 && uiAbsY == 0)
+		return 0;
+
+	/*	Reduce to the first octant: atan(r), where 0 <= r <= 1	*/
+	if (uiAbsY > uiAbsX)	{	uiMin = uiAbsX;	uiMax = uiAbsY;	}
+	else					{	uiMin = uiAbsY;	uiMax = uiAbsX;	}
+
+	iR = (int32_t)(((uint64_t)uiMin << 30) / uiMax);
+	iR2 = iMUL_Q30(iR, iR);
+
+	iAtan = iATAN_A9;
+	iAtan = iMUL_Q30(iAtan, iR2) + iATAN_A7;
+	iAtan = iMUL_Q30(iAtan, iR2) + iATAN_A5;
+	iAtan = iMUL_Q30(iAtan, iR2) + iATAN_A3;
+	iAtan = iMUL_Q30(iAtan, iR2) + iATAN_A1;
+	iAtan = iMUL_Q30(iAtan, iR);
+
+	iAngle = (int32_t)(((int64_t)iAtan * lRAD_TO_UDEG) >> 30);
+
+	/*	Back to the original octant	*/
+	if (uiAbsY > uiAbsX)
+		iAngle = 90000000 - iAngle;
+
+	if (iX < 0)
+		iAngle = 180000000 - iAngle;
+
+	if (iY < 0)
+		iAngle = -iAngle;
+
+	return iAngle;
+}
+
+/*
+ * Processes one sample.
+ */
+static inline void vUpdateSample(	xLIB_AttitudeEstimator_t* pxHandle,
+									const xLIB_AttitudeEstimator_sample_t* pxSample	)
+{
+	xLIB_AttitudeEstimator_quaternion_t* pxQ = &pxHandle->xQ;
+	int32_t iW = pxQ->iW, iX = pxQ->iX, iY = pxQ->iY, iZ = pxQ->iZ;
+	int32_t iAx = pxSample->piAccel[0];
+	int32_t iAy = pxSample->piAccel[1];
+	int32_t iAz = pxSample->piAccel[2];
+	int32_t piHalfAngle[3];
+	int32_t iVx, iVy, iVz;
+	int32_t piErr[3];
+	uint32_t uiNorm, uiInvNorm;
+	int64_t lW, lX, lY, lZ;
+	int32_t iN;
+
+	/*	Gyro sample, as a rotation of half the angle of one sample period (Q30)	*/
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		piHalfAngle[i] = (int32_t)(
+			((int64_t)(pxSample->piGyro[i] - pxHandle->piGyroBias[i]) *
+			pxHandle->iGyroGain) >> 16	);
+	}
+
+	/*	Accel correction (skipped if accel is zero)	*/
+	uiNorm = uiSqrt(	(uint32_t)(iAx * iAx) +
+						(uint32_t)(iAy * iAy) +
+						(uint32_t)(iAz * iAz)	);
+	if (uiNorm != 0)
+	{
+		/*	Normalize accel to Q30. (|component| <= norm, result fits)	*/
+		uiInvNorm = (1ul << 30) / uiNorm;
+		iAx *= (int32_t)uiInvNorm;
+		iAy *= (int32_t)uiInvNorm;
+		iAz *= (int32_t)uiInvNorm;
+
+		/*	Estimated gravity direction (third row of the rotation matrix)	*/
+		iVx = (int32_t)(((int64_t)iX * iZ - (int64_t)iW * iY) >> 29);
+		iVy = (int32_t)(((int64_t)iW * iX + (int64_t)iY * iZ) >> 29);
+		iVz = (int32_t)(	(	(int64_t)iW * iW - (int64_t)iX * iX -
+								(int64_t)iY * iY + (int64_t)iZ * iZ	) >> 30	);
+
+		/*	Error is the cross product of measured and estimated directions	*/
+		piErr[0] = (int32_t)(((int64_t)iAy * iVz - (int64_t)iAz * iVy) >> 30);
+		piErr[1] = (int32_t)(((int64_t)iAz * iVx - (int64_t)iAx * iVz) >> 30);
+		piErr[2] = (int32_t)(((int64_t)iAx * iVy - (int64_t)iAy * iVx) >> 30);
+
+		/*	Feed back proportional and integral terms	*/
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			pxHandle->plIntegral[i] +=
+				((int64_t)piErr[i] * pxHandle->iKiGain) >> 30;
+
+			piHalfAngle[i] +=
+				iMUL_Q30(piErr[i], pxHandle->iKpGain) +
+				(int32_t)(pxHandle->plIntegral[i] >> 16);
+		}
+	}
+
+	/*	Rotate: q += q * (0, half angle)	*/
+	lW = (int64_t)iW * iONE - (int64_t)iX * piHalfAngle[0] - (int64_t)iY * piHalfAngle[1] - (int64_t)iZ * piHalfAngle[2];
+	lX = (int64_t)iX * iONE + (int64_t)iW * piHalfAngle[0] + (int64_t)iY * piHalfAngle[2] - (int64_t)iZ * piHalfAngle[1];
+	lY = (int64_t)iY * iONE + (int64_t)iW * piHalfAngle[1] - (int64_t)iX * piHalfAngle[2] + (int64_t)iZ * piHalfAngle[0];
+	lZ = (int64_t)iZ * iONE + (int64_t)iW * piHalfAngle[2] + (int64_t)iX * piHalfAngle[1] - (int64_t)iY * piHalfAngle[0];
+
+	iW = (int32_t)(lW >> 30);
+	iX = (int32_t)(lX >> 30);
+	iY = (int32_t)(lY >> 30);
+	iZ = (int32_t)(lZ >> 30);
+
+	/*
+	 * Re-normalize. Norm is very close to 1 after a single sample, hence one
+	 * Newton iteration of the inverse square root is enough:
+	 * 		1 / sqrt(n) ~= (3 - n) / 2
+	 */
+	iN = (int32_t)((	(int64_t)iW * iW + (int64_t)iX * iX +
+						(int64_t)iY * iY + (int64_t)iZ * iZ	) >> 30);
+	iN = iONE + ((iONE - iN) >> 1);
+
+	pxQ->iW = iMUL_Q30(iW, iN);
+	pxQ->iX = iMUL_Q30(iX, iN);
+	pxQ->iY = iMUL_Q30(iY, iN);
+	pxQ->iZ = iMUL_Q30(iZ, iN);
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+void vLIB_AttitudeEstimator_init(	xLIB_AttitudeEstimator_t* pxHandle,
+									float fSamplePeriod,
+									float fGyroScale,
+									float fKp,
+									float fKi	)
+{
+	pxHandle->iGyroGain =
+		(int32_t)(0.5f * fSamplePeriod * fGyroScale * (float)(1ull << 46));
+
+	pxHandle->iKpGain =
+		(int32_t)(0.5f * fSamplePeriod * fKp * (float)(1ull << 30));
+
+	pxHandle->iKiGain =
+		(int32_t)(0.5f * fSamplePeriod * fSamplePeriod * fKi * (float)(1ull << 46));
+
+	pxHandle->piGyroBias[0] = 0;
+	pxHandle->piGyroBias[1] = 0;
+	pxHandle->piGyroBias[2] = 0;
+
+	vLIB_AttitudeEstimator_reset(pxHandle);
+}
+
+/*
+ * See header for info.
+ */
+void vLIB_AttitudeEstimator_reset(xLIB_AttitudeEstimator_t* pxHandle)
+{
+	pxHandle->xQ.iW = iONE;
+	pxHandle->xQ.iX = 0;
+	pxHandle->xQ.iY = 0;
+	pxHandle->xQ.iZ = 0;
+
+	pxHandle->plIntegral[0] = 0;
+	pxHandle->plIntegral[1] = 0;
+	pxHandle->plIntegral[2] = 0;
+}
+
+/*
+ * See header for info.
+ */
+void vLIB_AttitudeEstimator_update(	xLIB_AttitudeEstimator_t* pxHandle,
+									const xLIB_AttitudeEstimator_sample_t* pxSampleArr,
+									uint32_t uiNumberOfSamples	)
+{
+	for (uint32_t i = 0; i < uiNumberOfSamples; i++)
+		vUpdateSample(pxHandle, &pxSampleArr[i]);
+}
+
+/*
+ * See header for info.
+ */
+void vLIB_AttitudeEstimator_getQuaternion(	xLIB_AttitudeEstimator_t* pxHandle,
+											xLIB_AttitudeEstimator_quaternion_t* pxQ	)
+{
+	*pxQ = pxHandle->xQ;
+}
+
+/*
+ * See header for info.
+ */
+void vLIB_AttitudeEstimator_getEuler(	xLIB_AttitudeEstimator_t* pxHandle,
+										xLIB_AttitudeEstimator_euler_t* pxEuler	)
+{
+	int32_t iW = pxHandle->xQ.iW;
+	int32_t iX = pxHandle->xQ.iX;
+	int32_t iY = pxHandle->xQ.iY;
+	int32_t iZ = pxHandle->xQ.iZ;
+	int32_t iSinPitch, iCosPitch;
+
+	/*	Roll: atan2(2(wx + yz), 1 - 2(x^2 + y^2)). (Arguments in Q29)	*/
+	pxEuler->iRoll = iAtan2(
+		(int32_t)(((int64_t)iW * iX + (int64_t)iY * iZ) >> 30),
+		(int32_t)((((int64_t)iONE << 29) - (int64_t)iX * iX - (int64_t)iY * iY) >> 30)	);
+
+	/*	Pitch: asin(2(wy - zx)) = atan2(s, sqrt(1 - s^2))	*/
+	iSinPitch = (int32_t)(((int64_t)iW * iY - (int64_t)iZ * iX) >> 29);
+	if (iSinPitch > iONE)		iSinPitch = iONE;
+	if (iSinPitch < -iONE)		iSinPitch = -iONE;
+
+	iCosPitch = (int32_t)uiSqrt((uint32_t)(iONE - iMUL_Q30(iSinPitch, iSinPitch))) << 15;
+	pxEuler->iPitch = iAtan2(iSinPitch, iCosPitch);
+
+	/*	Yaw: atan2(2(wz + xy), 1 - 2(y^2 + z^2)). (Arguments in Q29)	*/
+	pxEuler->iYaw = iAtan2(
+		(int32_t)(((int64_t)iW * iZ + (int64_t)iX * iY) >> 30),
+		(int32_t)((((int64_t)iONE << 29) - (int64_t)iY * iY - (int64_t)iZ * iZ) >> 30)	);
+}
@@ -0,0 +1,331 @@
+/*
+ * AttitudeEstimator_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the fixed point attitude estimator. It replays
+ * a sensor trace through the estimator and through a double precision
+ * reference of the same filter, and compares their outputs.
+ *
+ * It does not depend on the RTOS nor on the target, and is built and run from
+ * repository's root directory as follows:
+ *
+ * 		gcc -O2 -DLIB_ATTITUDE_ESTIMATOR_HOST_TEST -IInc \
+ * 			Src/LIB/AttitudeEstimator/AttitudeEstimator.c \
+ * 			Src/LIB/AttitudeEstimator/AttitudeEstimator_Test.c -lm -o ae_test
+ *
+ * 		./ae_test [trace_file sample_period gyro_scale]
+ *
+ * Trace file is a text file of one sample per line: "gx gy gz ax ay az" (i.e.:
+ * logged raw MPU6050 registers). Sample period is in seconds, and gyro scale in
+ * rad/s per gyro unit. If no trace file is given, a synthetic trace of a known
+ * motion is generated (raw MPU6050 units, +-2000dps, +-2g, with noise and gyro
+ * bias) and the estimate is also compared to the true orientation.
+ *
+ * It exits with 0 if fixed point output stayed within "MAX_ERR_DEG" from the
+ * reference.
+ */
+
+#ifdef LIB_ATTITUDE_ESTIMATOR_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "LIB/AttitudeEstimator/AttitudeEstimator.h"
+
+#define KP					1.0
+#define KI					0.01
+#define MAX_ERR_DEG			0.1
+#define SYNTH_PERIOD		0.001
+#define SYNTH_SAMPLES		60000
+#define SYNTH_GYRO_SCALE	((2000.0 * M_PI / 180.0) / 32768.0)
+#define SYNTH_ACCEL_ONE_G	16384.0
+#define BATCH_SIZE			16
+
+/*******************************************************************************
+ * Double precision reference:
+ ******************************************************************************/
+typedef struct{
+	double pdQ[4];
+	double pdIntegral[3];
+	double dDt;
+	double dGyroScale;
+}xRef_t;
+
+static void vRefInit(xRef_t* pxRef, double dDt, double dGyroScale)
+{
+	pxRef->pdQ[0] = 1;	pxRef->pdQ[1] = 0;	pxRef->pdQ[2] = 0;	pxRef->pdQ[3] = 0;
+	pxRef->pdIntegral[0] = 0;	pxRef->pdIntegral[1] = 0;	pxRef->pdIntegral[2] = 0;
+	pxRef->dDt = dDt;
+	pxRef->dGyroScale = dGyroScale;
+}
+
+static void vRefUpdate(xRef_t* pxRef, const xLIB_AttitudeEstimator_sample_t* pxSample)
+{
+	double* q = pxRef->pdQ;
+	double g[3], a[3], v[3], e[3], n;
+
+	for (int i = 0; i < 3; i++)
+	{
+		g[i] = pxSample->piGyro[i] * pxRef->dGyroScale;
+		a[i] = pxSample->piAccel[i];
+	}
+
+	n = sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+	if (n > 0)
+	{
+		a[0] /= n;	a[1] /= n;	a[2] /= n;
+
+		v[0] = 2 * (q[1]*q[3] - q[0]*q[2]);
+		v[1] = 2 * (q[0]*q[1] + q[2]*q[3]);
+		v[2] = q[0]*q[0] - q[1]*q[1] - q[2]*q[2] + q[3]*q[3];
+
+		e[0] = a[1]*v[2] - a[2]*v[1];
+		e[1] = a[2]*v[0] - a[0]*v[2];
+		e[2] = a[0]*v[1] - a[1]*v[0];
+
+		for (int i = 0; i < 3; i++)
+		{
+			pxRef->pdIntegral[i] += KI * e[i] * pxRef->dDt;
+			g[i] += KP * e[i] + pxRef->pdIntegral[i];
+		}
+	}
+
+	double h[3] = {0.5 * g[0] * pxRef->dDt, 0.5 * g[1] * pxRef->dDt, 0.5 * g[2] * pxRef->dDt};
+	double w = q[0] - q[1]*h[0] - q[2]*h[1] - q[3]*h[2];
+	double x = q[1] + q[0]*h[0] + q[2]*h[2] - q[3]*h[1];
+	double y = q[2] + q[0]*h[1] - q[1]*h[2] + q[3]*h[0];
+	double z = q[3] + q[0]*h[2] + q[1]*h[1] - q[2]*h[0];
+
+	n = sqrt(w*w + x*x + y*y + z*z);
+	q[0] = w / n;	q[1] = x / n;	q[2] = y / n;	q[3] = z / n;
+}
+
+static void vQuatToEulerDeg(const double* q, double* pdEuler)
+{
+	double s = 2 * (q[0]*q[2] - q[3]*q[1]);
+	if (s > 1)	s = 1;
+	if (s < -1)	s = -1;
+
+	pdEuler[0] = atan2(2 * (q[0]*q[1] + q[2]*q[3]), 1 - 2 * (q[1]*q[1] + q[2]*q[2])) * 180.0 / M_PI;
+	pdEuler[1] = asin(s) * 180.0 / M_PI;
+	pdEuler[2] = atan2(2 * (q[0]*q[3] + q[1]*q[2]), 1 - 2 * (q[2]*q[2] + q[3]*q[3])) * 180.0 / M_PI;
+}
+
+/*	Angle (in degrees) between two orientations	*/
+static double dQuatAngleDeg(const double* q1, const double* q2)
+{
+	double d = fabs(q1[0]*q2[0] + q1[1]*q2[1] + q1[2]*q2[2] + q1[3]*q2[3]);
+	if (d > 1)	d = 1;
+	return 2 * acos(d) * 180.0 / M_PI;
+}
+
+/*******************************************************************************
+ * Trace:
+ ******************************************************************************/
+static xLIB_AttitudeEstimator_sample_t* pxTrace;
+static double (*ppdTruth)[4];
+static uint32_t uiTraceLen;
+
+static uint32_t uiLoadTrace(const char* pcPath)
+{
+	FILE* pxFile = fopen(pcPath, "r");
+	uint32_t uiCapacity = 1024;
+	int32_t p[6];
+
+	if (pxFile == NULL)
+		return 0;
+
+	pxTrace = malloc(uiCapacity * sizeof(*pxTrace));
+	uiTraceLen = 0;
+
+	while (fscanf(pxFile, "%d %d %d %d %d %d", &p[0], &p[1], &p[2], &p[3], &p[4], &p[5]) == 6)
+	{
+		if (uiTraceLen == uiCapacity)
+		{
+			uiCapacity *= 2;
+			pxTrace = realloc(pxTrace, uiCapacity * sizeof(*pxTrace));
+		}
+
+		for (int i = 0; i < 3; i++)
+		{
+			pxTrace[uiTraceLen].piGyro[i] = p[i];
+			pxTrace[uiTraceLen].piAccel[i] = p[3 + i];
+		}
+		uiTraceLen++;
+	}
+
+	fclose(pxFile);
+	return uiTraceLen;
+}
+
+static double dNoise(double dAmplitude)
+{
+	return dAmplitude * ((double)rand() / RAND_MAX * 2.0 - 1.0);
+}
+
+static int32_t iQuantize(double dVal)
+{
+	dVal = round(dVal);
+	if (dVal > 32767)	dVal = 32767;
+	if (dVal < -32768)	dVal = -32768;
+	return (int32_t)dVal;
+}
+
+/*
+ * Generates a motion of sinusoidal body rates, starting from a known tilt, and
+ * the raw samples an MPU6050 would give for it.
+ */
+static void vSynthesizeTrace(void)
+{
+	double q[4] = {cos(0.2), sin(0.2), 0, 0};	/*	Initial roll of ~23 degrees	*/
+	const double pdBias[3] = {12, -7, 4};		/*	Gyro bias, in raw units		*/
+
+	uiTraceLen = SYNTH_SAMPLES;
+	pxTrace = malloc(uiTraceLen * sizeof(*pxTrace));
+	ppdTruth = malloc(uiTraceLen * sizeof(*ppdTruth));
+
+	for (uint32_t k = 0; k < uiTraceLen; k++)
+	{
+		double t = k * SYNTH_PERIOD;
+		double w[3] = {	1.5 * sin(2 * M_PI * 0.3 * t),
+						1.0 * sin(2 * M_PI * 0.17 * t + 1),
+						0.8 * sin(2 * M_PI * 0.11 * t + 2)	};
+
+		/*	Gravity in body frame (accel measures the reaction, +1g upwards)	*/
+		double v[3] = {	2 * (q[1]*q[3] - q[0]*q[2]),
+						2 * (q[0]*q[1] + q[2]*q[3]),
+						q[0]*q[0] - q[1]*q[1] - q[2]*q[2] + q[3]*q[3]	};
+
+		for (int i = 0; i < 3; i++)
+		{
+			pxTrace[k].piGyro[i] = iQuantize(w[i] / SYNTH_GYRO_SCALE + pdBias[i] + dNoise(8));
+			pxTrace[k].piAccel[i] = iQuantize(v[i] * SYNTH_ACCEL_ONE_G + dNoise(150));
+		}
+
+		for (int i = 0; i < 4; i++)
+			ppdTruth[k][i] = q[i];
+
+		/*	Propagate true orientation (exact rotation over one period)	*/
+		double dNorm = sqrt(w[0]*w[0] + w[1]*w[1] + w[2]*w[2]);
+		double dHalf = 0.5 * dNorm * SYNTH_PERIOD;
+		double c = cos(dHalf), s = (dNorm > 0) ? sin(dHalf) / dNorm : 0;
+		double r[4] = {c, w[0] * s, w[1] * s, w[2] * s};
+		double n[4] = {	q[0]*r[0] - q[1]*r[1] - q[2]*r[2] - q[3]*r[3],
+						q[0]*r[1] + q[1]*r[0] + q[2]*r[3] - q[3]*r[2],
+						q[0]*r[2] - q[1]*r[3] + q[2]*r[0] + q[3]*r[1],
+						q[0]*r[3] + q[1]*r[2] - q[2]*r[1] + q[3]*r[0]	};
+		for (int i = 0; i < 4; i++)
+			q[i] = n[i];
+	}
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+	static xLIB_AttitudeEstimator_t xEst;
+	xLIB_AttitudeEstimator_quaternion_t xQ;
+	xLIB_AttitudeEstimator_euler_t xEuler;
+	xRef_t xRef;
+	double dDt = SYNTH_PERIOD, dGyroScale = SYNTH_GYRO_SCALE;
+	double pdQ[4], pdRefEuler[3], dErr;
+	double dMaxQuatErr = 0, dMaxEulerErr = 0, dMaxTruthErr = 0;
+
+	if (argc >= 4)
+	{
+		if (uiLoadTrace(argv[1]) == 0)
+		{
+			printf("Could not load trace: %s\n", argv[1]);
+			return 1;
+		}
+		dDt = atof(argv[2]);
+		dGyroScale = atof(argv[3]);
+	}
+	else
+	{
+		vSynthesizeTrace();
+	}
+
+	vLIB_AttitudeEstimator_init(&xEst, dDt, dGyroScale, KP, KI);
+	vRefInit(&xRef, dDt, dGyroScale);
+
+	/*	Replay in batches, comparing after every batch	*/
+	for (uint32_t k = 0; k < uiTraceLen; k += BATCH_SIZE)
+	{
+		uint32_t uiN = (uiTraceLen - k < BATCH_SIZE) ? uiTraceLen - k : BATCH_SIZE;
+
+		vLIB_AttitudeEstimator_update(&xEst, &pxTrace[k], uiN);
+		for (uint32_t i = 0; i < uiN; i++)
+			vRefUpdate(&xRef, &pxTrace[k + i]);
+
+		vLIB_AttitudeEstimator_getQuaternion(&xEst, &xQ);
+		pdQ[0] = xQ.iW / (double)iLIB_ATTITUDE_ESTIMATOR_ONE;
+		pdQ[1] = xQ.iX / (double)iLIB_ATTITUDE_ESTIMATOR_ONE;
+		pdQ[2] = xQ.iY / (double)iLIB_ATTITUDE_ESTIMATOR_ONE;
+		pdQ[3] = xQ.iZ / (double)iLIB_ATTITUDE_ESTIMATOR_ONE;
+
+		dErr = dQuatAngleDeg(pdQ, xRef.pdQ);
+		if (dErr > dMaxQuatErr)		dMaxQuatErr = dErr;
+
+		/*	Euler output (away from gimbal lock, where roll and yaw are undefined)	*/
+		vLIB_AttitudeEstimator_getEuler(&xEst, &xEuler);
+		vQuatToEulerDeg(xRef.pdQ, pdRefEuler);
+		if (fabs(pdRefEuler[1]) < 80)
+		{
+			double pdFix[3] = {xEuler.iRoll / 1e6, xEuler.iPitch / 1e6, xEuler.iYaw / 1e6};
+			for (int i = 0; i < 3; i++)
+			{
+				dErr = fabs(pdFix[i] - pdRefEuler[i]);
+				if (dErr > 180)		dErr = 360 - dErr;
+				if (dErr > dMaxEulerErr)	dMaxEulerErr = dErr;
+			}
+		}
+
+		/*	Tilt error against true orientation (after convergence)	*/
+		if (ppdTruth != NULL && k * dDt > 5.0)
+		{
+			double* t = ppdTruth[k + uiN];
+			if (k + uiN < uiTraceLen)
+			{
+				double pdTruthEuler[3], pdEstEuler[3];
+				vQuatToEulerDeg(t, pdTruthEuler);
+				vQuatToEulerDeg(pdQ, pdEstEuler);
+				for (int i = 0; i < 2; i++)
+				{
+					dErr = fabs(pdTruthEuler[i] - pdEstEuler[i]);
+					if (dErr > 180)		dErr = 360 - dErr;
+					if (dErr > dMaxTruthErr)	dMaxTruthErr = dErr;
+				}
+			}
+		}
+	}
+
+	printf("Samples: %u\n", uiTraceLen);
+	printf("Max quaternion error vs reference: %.5f deg\n", dMaxQuatErr);
+	printf("Max Euler error vs reference: %.5f deg\n", dMaxEulerErr);
+	if (ppdTruth != NULL)
+		printf("Max roll / pitch error vs truth: %.3f deg\n", dMaxTruthErr);
+
+	/*	Benchmark (host time, for relative comparisons only)	*/
+	clock_t xStart = clock();
+	for (int r = 0; r < 20; r++)
+		vLIB_AttitudeEstimator_update(&xEst, pxTrace, uiTraceLen);
+	double dNs = (double)(clock() - xStart) / CLOCKS_PER_SEC * 1e9 / (20.0 * uiTraceLen);
+	printf("Update: %.1f ns per sample (host)\n", dNs);
+
+	if (dMaxQuatErr > MAX_ERR_DEG || dMaxEulerErr > MAX_ERR_DEG)
+	{
+		printf("FAILED\n");
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	LIB_ATTITUDE_ESTIMATOR_HOST_TEST	*/
@@ -0,0 +1,66 @@
+/*
+ * BinaryFilterVertical.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*	LIB	*/
+#include "stdint.h"
+
+/*	SELF	*/
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+/*
+ * See header file for info.
+ */
+void vLIB_BinaryFilterVertical_init(	xLIB_BinaryFilterVertical_t* pxHandle,
+										uint8_t ucCounterBits,
+										uint32_t uiInitialLevels	)
+{
+	if (ucCounterBits < 1)
+		ucCounterBits = 1;
+	else if (ucCounterBits > ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS)
+		ucCounterBits = ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS;
+
+	pxHandle->ucCounterBits = ucCounterBits;
+
+	for (uint8_t k = 0; k < ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS; k++)
+		pxHandle->puiCountArr[k] = 0;
+
+	pxHandle->uiLevelsFiltered = uiInitialLevels;
+	pxHandle->uiPrevLevelsFiltered = uiInitialLevels;
+}
+
+/*
+ * See header file for info.
+ */
+uint32_t uiLIB_BinaryFilterVertical_updateFilter(	xLIB_BinaryFilterVertical_t* pxHandle,
+													uint32_t uiNewLevels	)
+{
+	uint32_t uiCount;
+
+	/*	Update "prevFiltered" value	*/
+	pxHandle->uiPrevLevelsFiltered = pxHandle->uiLevelsFiltered;
+
+	/*	Inputs whose new level differs from the filtered one	*/
+	uint32_t uiDiff = uiNewLevels ^ pxHandle->uiLevelsFiltered;
+
+	/*
+	 * Increment counters of differing inputs, and clear counters of the others
+	 * (noise occurred, or level is stable). Carry out of the last counter bit
+	 * is set for inputs which have just completed N differing samples in row,
+	 * their counters wrap back to zero.
+	 */
+	uint32_t uiCarry = uiDiff;
+	for (uint8_t k = 0; k < pxHandle->ucCounterBits; k++)
+	{
+		uiCount = pxHandle->puiCountArr[k];
+		pxHandle->puiCountArr[k] = (uiCount ^ uiCarry) & uiDiff;
+		uiCarry &= uiCount;
+	}
+
+	/*	Filtered levels of these inputs are now stable and could be used	*/
+	pxHandle->uiLevelsFiltered ^= uiCarry;
+
+	return uiCarry;
+}
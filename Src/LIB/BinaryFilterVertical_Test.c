@@ -0,0 +1,214 @@
+/*
+ * BinaryFilterVertical_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test of the vertical (bit-parallel) binary filter.
+ *
+ * It feeds synthetic button traces of 32 inputs, each of random presses and
+ * releases with contact bounce around every edge, through the filter, and
+ * checks that:
+ * 		-	Every input matches a scalar (one counter per input) reference of
+ * 			the same filter, sample by sample.
+ *
+ * 		-	Every press and every release produces exactly one filtered change,
+ * 			no more than "uiMAX_BOUNCE + N" samples after the edge.
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DLIB_BINARY_FILTER_VERTICAL_HOST_TEST -IInc \
+ * 			Src/LIB/BinaryFilterVertical.c Src/LIB/BinaryFilterVertical_Test.c \
+ * 			-o bfv_test
+ *
+ * 		./bfv_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef LIB_BINARY_FILTER_VERTICAL_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "LIB/BinaryFilter/BinaryFilterVertical.h"
+
+#define uiNUMBER_OF_INPUTS		32
+#define uiNUMBER_OF_SAMPLES		200000
+/*
+ * Samples of bouncing after an edge. Bounce yields at most 3 random samples, so
+ * that it can't make a false change even at the smallest N (2 samples), which
+ * would need 2 samples of the new level then 2 samples of the old one.
+ */
+#define uiMAX_BOUNCE			4
+#define uiMIN_STABLE			24		/*	Samples of stable level between edges	*/
+#define uiMAX_STABLE			400
+
+/*******************************************************************************
+ * Synthetic input:
+ ******************************************************************************/
+typedef struct{
+	uint8_t ucTrueLevel;
+	uint32_t uiSamplesTillEdge;
+	uint32_t uiBounceLeft;
+	uint32_t uiEdgeTime;
+	uint8_t ucEdgePending;		/*	Edge not yet seen at filter's output	*/
+}xInput_t;
+
+static uint32_t uiRand(uint32_t uiMin, uint32_t uiMax)
+{
+	return uiMin + (uint32_t)rand() % (uiMax - uiMin + 1);
+}
+
+/*	Returns sampled level of the input, advancing it by one sample	*/
+static uint8_t ucInputSample(xInput_t* pxInput, uint32_t uiTime)
+{
+	if (pxInput->uiSamplesTillEdge == 0)
+	{
+		pxInput->ucTrueLevel ^= 1;
+		pxInput->uiBounceLeft = uiRand(0, uiMAX_BOUNCE);
+		pxInput->uiSamplesTillEdge = uiRand(uiMIN_STABLE, uiMAX_STABLE);
+		pxInput->uiEdgeTime = uiTime;
+		pxInput->ucEdgePending = 1;
+	}
+	pxInput->uiSamplesTillEdge--;
+
+	/*	Contact bounce: random level, ending at the true level	*/
+	if (pxInput->uiBounceLeft > 0)
+	{
+		pxInput->uiBounceLeft--;
+		if (pxInput->uiBounceLeft > 0)
+			return (uint8_t)(rand() & 1);
+	}
+
+	return pxInput->ucTrueLevel;
+}
+
+/*******************************************************************************
+ * Scalar reference:
+ ******************************************************************************/
+typedef struct{
+	uint8_t ucLevel;
+	uint32_t uiCount;
+}xRef_t;
+
+static uint8_t ucRefUpdate(xRef_t* pxRef, uint8_t ucNewLevel, uint32_t uiN)
+{
+	if (ucNewLevel == pxRef->ucLevel)
+	{
+		pxRef->uiCount = 0;
+		return 0;
+	}
+
+	pxRef->uiCount++;
+	if (pxRef->uiCount == uiN)
+	{
+		pxRef->ucLevel = ucNewLevel;
+		pxRef->uiCount = 0;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*******************************************************************************
+ * Test:
+ ******************************************************************************/
+static int iRunTest(uint8_t ucCounterBits)
+{
+	static xInput_t pxInputArr[uiNUMBER_OF_INPUTS];
+	static xRef_t pxRefArr[uiNUMBER_OF_INPUTS];
+	xLIB_BinaryFilterVertical_t xFilter;
+
+	uint32_t uiN = 1ul << ucCounterBits;
+	uint32_t uiMaxLatency = 0;
+	uint32_t uiNumberOfEdges = 0;
+	uint32_t uiErrors = 0;
+
+	for (uint32_t i = 0; i < uiNUMBER_OF_INPUTS; i++)
+	{
+		pxInputArr[i].ucTrueLevel = 0;
+		pxInputArr[i].uiSamplesTillEdge = uiRand(1, uiMAX_STABLE);
+		pxInputArr[i].uiBounceLeft = 0;
+		pxInputArr[i].ucEdgePending = 0;
+		pxRefArr[i].ucLevel = 0;
+		pxRefArr[i].uiCount = 0;
+	}
+
+	vLIB_BinaryFilterVertical_init(&xFilter, ucCounterBits, 0);
+
+	for (uint32_t t = 0; t < uiNUMBER_OF_SAMPLES; t++)
+	{
+		uint32_t uiSample = 0;
+		for (uint32_t i = 0; i < uiNUMBER_OF_INPUTS; i++)
+			uiSample |= (uint32_t)ucInputSample(&pxInputArr[i], t) << i;
+
+		uint32_t uiChanged = uiLIB_BinaryFilterVertical_updateFilter(&xFilter, uiSample);
+
+		if ((xFilter.uiLevelsFiltered ^ xFilter.uiPrevLevelsFiltered) != uiChanged)
+			uiErrors++;
+
+		for (uint32_t i = 0; i < uiNUMBER_OF_INPUTS; i++)
+		{
+			xInput_t* pxInput = &pxInputArr[i];
+			uint8_t ucChanged = (uiChanged >> i) & 1;
+			uint8_t ucLevel = (xFilter.uiLevelsFiltered >> i) & 1;
+
+			/*	Compare to reference	*/
+			uint8_t ucRefChanged = ucRefUpdate(&pxRefArr[i], (uiSample >> i) & 1, uiN);
+			if (ucChanged != ucRefChanged || ucLevel != pxRefArr[i].ucLevel)
+				uiErrors++;
+
+			/*	Compare to true level	*/
+			if (ucChanged)
+			{
+				if (!pxInput->ucEdgePending || ucLevel != pxInput->ucTrueLevel)
+				{
+					uiErrors++;
+					continue;
+				}
+
+				pxInput->ucEdgePending = 0;
+				uiNumberOfEdges++;
+				uint32_t uiLatency = t - pxInput->uiEdgeTime + 1;
+				if (uiLatency > uiMaxLatency)
+					uiMaxLatency = uiLatency;
+			}
+
+			else if (	pxInput->ucEdgePending &&
+						t - pxInput->uiEdgeTime + 1 > uiMAX_BOUNCE + uiN	)
+			{
+				/*	Edge was missed	*/
+				pxInput->ucEdgePending = 0;
+				uiErrors++;
+			}
+		}
+	}
+
+	printf(	"N = %2u: %u filtered edges, max latency: %u samples, errors: %u\n",
+			uiN, uiNumberOfEdges, uiMaxLatency, uiErrors	);
+
+	return (uiErrors == 0 && uiNumberOfEdges > 0) ? 0 : 1;
+}
+
+int main(void)
+{
+	int iFailed = 0;
+
+	srand(1);
+
+	/*	Stable time is longer than bounce + N, for N up to 16 samples	*/
+	for (uint8_t ucBits = 1; ucBits <= ucLIB_BINARY_FILTER_VERTICAL_MAX_COUNTER_BITS; ucBits++)
+		iFailed |= iRunTest(ucBits);
+
+	if (iFailed)
+	{
+		printf("FAILED\n");
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	LIB_BINARY_FILTER_VERTICAL_HOST_TEST	*/
@@ -9,9 +9,14 @@
 #include "stdint.h"
 
 /*	SELF	*/
+#include "LIB/CRC/CRC_Config.h"
 #include "LIB/CRC/CRC_Table.h"
 #include "LIB/CRC/CRC.h"
 
+#if uiCONF_CRC_SLICE_SIZE != 1 && uiCONF_CRC_SLICE_SIZE != 4 && uiCONF_CRC_SLICE_SIZE != 8
+#error uiCONF_CRC_SLICE_SIZE must be 1, 4 or 8.
+#endif
+
 /*
  * Check this:
  * http://www.rjhcoding.com/avrc-sd-interface-2.php
@@ -43,16 +48,99 @@
 /*
  * See header for info.
  */
-uint8_t ucLIB_CRC_getCrc7(uint8_t* pucArr, uint32_t uiLen)
+uint8_t ucLIB_CRC_initCrc7(void)
 {
-	uint8_t ucC = pucCrc7Table[0];
+	return pucCrc7Table[0];
+}
 
+/*
+ * See header for info.
+ */
+uint8_t ucLIB_CRC_updateCrc7(uint8_t ucCrc, const uint8_t* pucArr, uint32_t uiLen)
+{
 	for (int32_t i = (int32_t)uiLen - 1; i >= 0; i--)
 	{
-		ucC = pucCrc7Table[(ucC << 1) ^ pucArr[i]];
+		ucCrc = pucCrc7Table[(ucCrc << 1) ^ pucArr[i]];
 	}
 
-	return ucC;
+	return ucCrc;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucLIB_CRC_finalCrc7(uint8_t ucCrc)
+{
+	return ucCrc;
+}
+
+/*
+ * See header for info.
+ */
+uint8_t ucLIB_CRC_getCrc7(uint8_t* pucArr, uint32_t uiLen)
+{
+	uint8_t ucC = ucLIB_CRC_initCrc7();
+
+	ucC = ucLIB_CRC_updateCrc7(ucC, pucArr, uiLen);
+
+	return ucLIB_CRC_finalCrc7(ucC);
+}
+
+/*
+ * See header for info.
+ */
+uint16_t usLIB_CRC_initCrc16(void)
+{
+	return pusCrc16Table[0];
+}
+
+/*
+ * See header for info.
+ */
+uint16_t usLIB_CRC_updateCrc16(uint16_t usCrc, const uint8_t* pucArr, uint32_t uiLen)
+{
+#if uiCONF_CRC_SLICE_SIZE > 1
+	const uint16_t (*ppusT)[256] = ppusCrc16SliceTable;
+
+	while (uiLen >= uiCONF_CRC_SLICE_SIZE)
+	{
+		usCrc ^= ((uint16_t)pucArr[0] << 8) | pucArr[1];
+
+#if uiCONF_CRC_SLICE_SIZE == 8
+		usCrc =	ppusT[6][usCrc >> 8]		^
+				ppusT[5][usCrc & 0xFF]		^
+				ppusT[4][pucArr[2]]			^
+				ppusT[3][pucArr[3]]			^
+				ppusT[2][pucArr[4]]			^
+				ppusT[1][pucArr[5]]			^
+				ppusT[0][pucArr[6]]			^
+				pusCrc16Table[pucArr[7]];
+#else
+		usCrc =	ppusT[2][usCrc >> 8]		^
+				ppusT[1][usCrc & 0xFF]		^
+				ppusT[0][pucArr[2]]			^
+				pusCrc16Table[pucArr[3]];
+#endif
+
+		pucArr += uiCONF_CRC_SLICE_SIZE;
+		uiLen -= uiCONF_CRC_SLICE_SIZE;
+	}
+#endif
+
+	for (uint32_t i = 0; i < uiLen; i++)
+	{
+		usCrc = (usCrc<<8) ^ pusCrc16Table[(uint8_t)(usCrc>>8) ^ pucArr[i]];
+	}
+
+	return usCrc;
+}
+
+/*
+ * See header for info.
+ */
+uint16_t usLIB_CRC_finalCrc16(uint16_t usCrc)
+{
+	return usCrc;
 }
 
 /*
@@ -60,12 +148,82 @@ uint8_t ucLIB_CRC_getCrc7(uint8_t* pucArr, uint32_t uiLen)
  */
 uint16_t usLIB_CRC_getCrc16(uint8_t* pucArr, uint32_t uiLen)
 {
-	uint16_t usC = pusCrc16Table[0];
+	uint16_t usC = usLIB_CRC_initCrc16();
+
+	usC = usLIB_CRC_updateCrc16(usC, pucArr, uiLen);
+
+	return usLIB_CRC_finalCrc16(usC);
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiLIB_CRC_initCrc32(void)
+{
+	return 0xFFFFFFFF;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiLIB_CRC_updateCrc32(uint32_t uiCrc, const uint8_t* pucArr, uint32_t uiLen)
+{
+#if uiCONF_CRC_SLICE_SIZE > 1
+	const uint32_t (*ppuiT)[256] = ppuiCrc32SliceTable;
+
+	while (uiLen >= uiCONF_CRC_SLICE_SIZE)
+	{
+		/*	CRC-32 is reflected, so the first byte is the least significant	*/
+		uiCrc ^=	(uint32_t)pucArr[0]			|
+					((uint32_t)pucArr[1] << 8)	|
+					((uint32_t)pucArr[2] << 16)	|
+					((uint32_t)pucArr[3] << 24);
+
+#if uiCONF_CRC_SLICE_SIZE == 8
+		uiCrc =	ppuiT[6][uiCrc & 0xFF]			^
+				ppuiT[5][(uiCrc >> 8) & 0xFF]	^
+				ppuiT[4][(uiCrc >> 16) & 0xFF]	^
+				ppuiT[3][uiCrc >> 24]			^
+				ppuiT[2][pucArr[4]]				^
+				ppuiT[1][pucArr[5]]				^
+				ppuiT[0][pucArr[6]]				^
+				puiCrc32Table[pucArr[7]];
+#else
+		uiCrc =	ppuiT[2][uiCrc & 0xFF]			^
+				ppuiT[1][(uiCrc >> 8) & 0xFF]	^
+				ppuiT[0][(uiCrc >> 16) & 0xFF]	^
+				puiCrc32Table[uiCrc >> 24];
+#endif
+
+		pucArr += uiCONF_CRC_SLICE_SIZE;
+		uiLen -= uiCONF_CRC_SLICE_SIZE;
+	}
+#endif
 
 	for (uint32_t i = 0; i < uiLen; i++)
 	{
-		usC = (usC<<8) ^ pusCrc16Table[(uint8_t)(usC>>8) ^ pucArr[i]];
+		uiCrc = (uiCrc >> 8) ^ puiCrc32Table[(uint8_t)uiCrc ^ pucArr[i]];
 	}
 
-	return usC;
+	return uiCrc;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiLIB_CRC_finalCrc32(uint32_t uiCrc)
+{
+	return uiCrc ^ 0xFFFFFFFF;
+}
+
+/*
+ * See header for info.
+ */
+uint32_t uiLIB_CRC_getCrc32(uint8_t* pucArr, uint32_t uiLen)
+{
+	uint32_t uiC = uiLIB_CRC_initCrc32();
+
+	uiC = uiLIB_CRC_updateCrc32(uiC, pucArr, uiLen);
+
+	return uiLIB_CRC_finalCrc32(uiC);
 }
@@ -0,0 +1,230 @@
+/*
+ * CRC_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the CRC functions.
+ *
+ * It checks that:
+ * 		-	CRC-16 (XMODEM) and CRC-32 (IEEE 802.3) of "123456789" equal their
+ * 			standard check values (0x31C3, 0xCBF43926).
+ *
+ * 		-	CRC-16 and CRC-32 of random arrays of random lengths equal those of a
+ * 			bit-wise reference implementation.
+ *
+ * 		-	Incremental calls, over random splits of an array into chunks, equal
+ * 			the single-call functions. (CRC-7 chunks are passed in reverse order,
+ * 			see "CRC.h")
+ *
+ * Then it prints throughput of the single-call functions, against the bit-wise
+ * reference.
+ *
+ * It is built and run from repository's root directory as follows (slice size
+ * could be 1, 4 or 8):
+ *
+ * 		gcc -O2 -DLIB_CRC_HOST_TEST -DuiCONF_CRC_SLICE_SIZE=8 -IInc \
+ * 			Src/LIB/CRC/CRC.c Src/LIB/CRC/CRC_Table.c Src/LIB/CRC/CRC_Test.c \
+ * 			-o crc_test
+ *
+ * 		./crc_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef LIB_CRC_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "LIB/CRC/CRC_Config.h"
+#include "LIB/CRC/CRC.h"
+
+#define uiMAX_LEN					1024
+#define uiNUMBER_OF_RANDOM_TESTS	20000
+#define uiBENCHMARK_LEN				512
+#define uiBENCHMARK_ITERATIONS		20000
+
+/*******************************************************************************
+ * Bit-wise reference implementations:
+ ******************************************************************************/
+static uint16_t usRefCrc16(const uint8_t* pucArr, uint32_t uiLen)
+{
+	uint16_t usCrc = 0;
+
+	for (uint32_t i = 0; i < uiLen; i++)
+	{
+		usCrc ^= (uint16_t)pucArr[i] << 8;
+		for (uint8_t j = 0; j < 8; j++)
+			usCrc = (usCrc & 0x8000) ? ((usCrc << 1) ^ 0x1021) : (usCrc << 1);
+	}
+
+	return usCrc;
+}
+
+static uint32_t uiRefCrc32(const uint8_t* pucArr, uint32_t uiLen)
+{
+	uint32_t uiCrc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i < uiLen; i++)
+	{
+		uiCrc ^= pucArr[i];
+		for (uint8_t j = 0; j < 8; j++)
+			uiCrc = (uiCrc & 1) ? ((uiCrc >> 1) ^ 0xEDB88320) : (uiCrc >> 1);
+	}
+
+	return uiCrc ^ 0xFFFFFFFF;
+}
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiLen)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, length: %u\n", pcName, uiLen);
+		uiNumberOfFailures++;
+	}
+}
+
+/*
+ * Splits [0, uiLen) into random chunks. Writes chunk boundaries to "puiBoundArr"
+ * (first is 0, last is "uiLen"), and returns number of chunks.
+ */
+static uint32_t uiSplit(uint32_t uiLen, uint32_t* puiBoundArr)
+{
+	uint32_t uiN = 0;
+	uint32_t uiPos = 0;
+
+	puiBoundArr[0] = 0;
+	while (uiPos < uiLen)
+	{
+		uiPos += 1 + rand() % 37;
+		if (uiPos > uiLen)
+			uiPos = uiLen;
+		puiBoundArr[++uiN] = uiPos;
+	}
+
+	return uiN;
+}
+
+static double dGetMBps(clock_t xStart, clock_t xEnd)
+{
+	double dSec = (double)(xEnd - xStart) / CLOCKS_PER_SEC;
+	return (double)uiBENCHMARK_LEN * uiBENCHMARK_ITERATIONS / dSec / 1e6;
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	static uint8_t pucArr[uiMAX_LEN];
+	static uint32_t puiBoundArr[uiMAX_LEN + 1];
+	uint8_t pucCheck[] = "123456789";
+
+	srand(1);
+
+	/*	Standard check values	*/
+	vCheck(usLIB_CRC_getCrc16(pucCheck, 9) == 0x31C3, "CRC-16 check value", 9);
+	vCheck(uiLIB_CRC_getCrc32(pucCheck, 9) == 0xCBF43926, "CRC-32 check value", 9);
+
+	/*	Random arrays	*/
+	for (uint32_t t = 0; t < uiNUMBER_OF_RANDOM_TESTS; t++)
+	{
+		uint32_t uiLen = rand() % (uiMAX_LEN + 1);
+		for (uint32_t i = 0; i < uiLen; i++)
+			pucArr[i] = rand();
+
+		uint16_t usCrc16 = usLIB_CRC_getCrc16(pucArr, uiLen);
+		uint32_t uiCrc32 = uiLIB_CRC_getCrc32(pucArr, uiLen);
+		uint8_t ucCrc7 = ucLIB_CRC_getCrc7(pucArr, uiLen);
+
+		vCheck(usCrc16 == usRefCrc16(pucArr, uiLen), "CRC-16 vs reference", uiLen);
+		vCheck(uiCrc32 == uiRefCrc32(pucArr, uiLen), "CRC-32 vs reference", uiLen);
+
+		/*	Incremental, over random chunks	*/
+		uint32_t uiN = uiSplit(uiLen, puiBoundArr);
+
+		uint16_t usC16 = usLIB_CRC_initCrc16();
+		uint32_t uiC32 = uiLIB_CRC_initCrc32();
+		for (uint32_t i = 0; i < uiN; i++)
+		{
+			uint32_t uiChunkLen = puiBoundArr[i + 1] - puiBoundArr[i];
+			usC16 = usLIB_CRC_updateCrc16(usC16, &pucArr[puiBoundArr[i]], uiChunkLen);
+			uiC32 = uiLIB_CRC_updateCrc32(uiC32, &pucArr[puiBoundArr[i]], uiChunkLen);
+		}
+
+		uint8_t ucC7 = ucLIB_CRC_initCrc7();
+		for (int32_t i = (int32_t)uiN - 1; i >= 0; i--)
+		{
+			uint32_t uiChunkLen = puiBoundArr[i + 1] - puiBoundArr[i];
+			ucC7 = ucLIB_CRC_updateCrc7(ucC7, &pucArr[puiBoundArr[i]], uiChunkLen);
+		}
+
+		vCheck(usLIB_CRC_finalCrc16(usC16) == usCrc16, "CRC-16 incremental", uiLen);
+		vCheck(uiLIB_CRC_finalCrc32(uiC32) == uiCrc32, "CRC-32 incremental", uiLen);
+		vCheck(ucLIB_CRC_finalCrc7(ucC7) == ucCrc7, "CRC-7 incremental", uiLen);
+	}
+
+	/*	Benchmark	*/
+	volatile uint32_t uiSink = 0;
+	clock_t xStart;
+	double dCrc16, dCrc32, dRef16, dRef32;
+
+	for (uint32_t i = 0; i < uiBENCHMARK_LEN; i++)
+		pucArr[i] = rand();
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+	{
+		pucArr[0] = i;
+		uiSink += usLIB_CRC_getCrc16(pucArr, uiBENCHMARK_LEN);
+	}
+	dCrc16 = dGetMBps(xStart, clock());
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+	{
+		pucArr[0] = i;
+		uiSink += usRefCrc16(pucArr, uiBENCHMARK_LEN);
+	}
+	dRef16 = dGetMBps(xStart, clock());
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+	{
+		pucArr[0] = i;
+		uiSink += uiLIB_CRC_getCrc32(pucArr, uiBENCHMARK_LEN);
+	}
+	dCrc32 = dGetMBps(xStart, clock());
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+	{
+		pucArr[0] = i;
+		uiSink += uiRefCrc32(pucArr, uiBENCHMARK_LEN);
+	}
+	dRef32 = dGetMBps(xStart, clock());
+
+	printf("Slice size: %d, %u-byte blocks\n", uiCONF_CRC_SLICE_SIZE, uiBENCHMARK_LEN);
+	printf("CRC-16: %8.1f MB/s (bit-wise reference: %8.1f MB/s)\n", dCrc16, dRef16);
+	printf("CRC-32: %8.1f MB/s (bit-wise reference: %8.1f MB/s)\n", dCrc32, dRef32);
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	LIB_CRC_HOST_TEST	*/
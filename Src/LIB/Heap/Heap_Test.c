@@ -14,6 +14,15 @@
  * This is very useful to test the "Heap" driver every time its implementation is updated.
  *
  * This test code uses "int32_t" as a "xCONF_VECTOR_ELEM_TYPE".
+ *
+ * The second part of this file is a host (PC) test and benchmark of the typed
+ * heap ("TypedHeap.h"). It does not depend on the RTOS nor on the target, and
+ * is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DLIB_HEAP_HOST_TEST -IInc Src/LIB/Heap/Heap_Test.c -o heap_test
+ * 		./heap_test
+ *
+ * It exits with 0 if all tests passed.
  */
 
 #if 0
@@ -259,3 +268,260 @@ int main(void)
 }
 
 #endif
+
+
+
+#ifdef LIB_HEAP_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "LIB/Heap/TypedHeap.h"
+
+#define MAX_SIZE			4096
+#define NUMBER_OF_TESTS		200
+#define BENCH_SIZE			1024
+#define BENCH_ROUNDS		2000
+
+/*******************************************************************************
+ * Heap instantiations:
+ ******************************************************************************/
+/*	Min-heaps of "int32_t"	*/
+static inline uint8_t ucCompareMin(const int32_t* pi1, const int32_t* pi2)
+{
+	return *pi1 <= *pi2;
+}
+
+vLIB_TYPED_HEAP_DEFINE(Bin, int32_t, ucCompareMin, 2)
+vLIB_TYPED_HEAP_DEFINE(Quad, int32_t, ucCompareMin, 4)
+
+/*	Max-heap of a structure type (co-exists with the ones above)	*/
+typedef struct{
+	uint32_t uiKey;
+	uint32_t uiId;
+}xPair_t;
+
+static inline uint8_t ucComparePairMax(const xPair_t* px1, const xPair_t* px2)
+{
+	return px1->uiKey >= px2->uiKey;
+}
+
+vLIB_TYPED_HEAP_DEFINE(Pair, xPair_t, ucComparePairMax, 2)
+
+/*******************************************************************************
+ * Global variables:
+ ******************************************************************************/
+static int32_t piStorage[MAX_SIZE];
+static int32_t piElemArr[MAX_SIZE];
+static uint32_t uiFailCount = 0;
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+#define vCHECK(exp)															\
+{																			\
+	if (!(exp))																\
+	{																		\
+		printf("Check failed: %s (line %d)\n", #exp, __LINE__);				\
+		uiFailCount++;														\
+	}																		\
+}
+
+static int iCompareInt(const void* pv1, const void* pv2)
+{
+	int32_t i1 = *(const int32_t*)pv1;
+	int32_t i2 = *(const int32_t*)pv2;
+	return (i1 > i2) - (i1 < i2);
+}
+
+static uint8_t ucIsHeap(const int32_t* piArr, uint32_t uiSize, uint32_t uiArity)
+{
+	for (uint32_t i = 1; i < uiSize; i++)
+	{
+		if (piArr[(i - 1) / uiArity] > piArr[i])
+			return 0;
+	}
+	return 1;
+}
+
+static void vFillRandom(int32_t* piArr, uint32_t uiSize)
+{
+	for (uint32_t i = 0; i < uiSize; i++)
+		piArr[i] = rand() % 1000 - 500;
+}
+
+/*
+ * Pops all elements of the heap and checks that they are equal to the sorted
+ * "piElemArr".
+ */
+#define vCHECK_POP_ALL(Name, pxHeap, uiSize)								\
+{																			\
+	int32_t iTop = 0;													\
+	qsort(piElemArr, (uiSize), sizeof(int32_t), iCompareInt);				\
+	for (uint32_t i = 0; i < (uiSize); i++)									\
+	{																		\
+		vCHECK(ucLIB_Heap_##Name##_pop((pxHeap), &iTop));					\
+		vCHECK(iTop == piElemArr[i]);										\
+	}																		\
+	vCHECK(ucLIB_Heap_##Name##_pop((pxHeap), &iTop) == 0);					\
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+#define vTEST_HEAP(Name, uiArity)											\
+static void vTest##Name(void)												\
+{																			\
+	xLIB_Heap_##Name##_t xHeap;												\
+	uint32_t uiSize;														\
+	int32_t iNew;															\
+																			\
+	for (uint32_t t = 0; t < NUMBER_OF_TESTS; t++)							\
+	{																		\
+		uiSize = rand() % MAX_SIZE;											\
+		vFillRandom(piElemArr, uiSize);										\
+																			\
+		/*	Push one by one	*/												\
+		vLIB_Heap_##Name##_init(&xHeap, piStorage, uiSize);					\
+		for (uint32_t i = 0; i < uiSize; i++)								\
+			vCHECK(ucLIB_Heap_##Name##_push(&xHeap, &piElemArr[i]));		\
+		vCHECK(ucLIB_Heap_##Name##_push(&xHeap, &piElemArr[0]) == 0);		\
+		vCHECK(uiLIB_Heap_##Name##_getSize(&xHeap) == uiSize);				\
+		vCHECK(ucIsHeap(piStorage, uiSize, uiArity));						\
+																			\
+		/*	Replace top	*/													\
+		for (uint32_t i = 0; i < uiSize / 2; i++)							\
+		{																	\
+			iNew = rand() % 1000 - 500;										\
+			for (uint32_t j = 0; j < uiSize; j++)							\
+			{																\
+				if (piElemArr[j] == *pxLIB_Heap_##Name##_getTopPtr(&xHeap))	\
+				{															\
+					piElemArr[j] = iNew;									\
+					break;													\
+				}															\
+			}																\
+			vLIB_Heap_##Name##_replaceTop(&xHeap, &iNew);					\
+		}																	\
+		vCHECK(ucIsHeap(piStorage, uiSize, uiArity));						\
+		vCHECK_POP_ALL(Name, &xHeap, uiSize);								\
+																			\
+		/*	Bulk build	*/													\
+		vFillRandom(piElemArr, uiSize);										\
+		memcpy(piStorage, piElemArr, uiSize * sizeof(int32_t));				\
+		vLIB_Heap_##Name##_build(&xHeap, uiSize);							\
+		vCHECK(ucIsHeap(piStorage, uiSize, uiArity));						\
+		vCHECK_POP_ALL(Name, &xHeap, uiSize);								\
+	}																		\
+}
+
+vTEST_HEAP(Bin, 2)
+vTEST_HEAP(Quad, 4)
+
+static void vTestPair(void)
+{
+	xPair_t pxArr[8];
+	xPair_t xPair;
+	xLIB_Heap_Pair_t xHeap;
+
+	vLIB_Heap_Pair_init(&xHeap, pxArr, 8);
+	vCHECK(pxLIB_Heap_Pair_getTopPtr(&xHeap) == NULL);
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		xPair.uiKey = (i * 5) % 8;
+		xPair.uiId = i;
+		vCHECK(ucLIB_Heap_Pair_push(&xHeap, &xPair));
+	}
+
+	for (int32_t i = 7; i >= 0; i--)
+	{
+		vCHECK(ucLIB_Heap_Pair_pop(&xHeap, &xPair));
+		vCHECK(xPair.uiKey == (uint32_t)i);
+		vCHECK((xPair.uiId * 5) % 8 == (uint32_t)i);
+	}
+}
+
+/*******************************************************************************
+ * Benchmark:
+ ******************************************************************************/
+#define vBENCH_HEAP(Name)													\
+static void vBench##Name(void)												\
+{																			\
+	xLIB_Heap_##Name##_t xHeap;												\
+	volatile int32_t iSink = 0;												\
+	int32_t iTop = 0;													\
+	clock_t xStart;															\
+	double dPushPop, dReplace, dBuild;										\
+																			\
+	vFillRandom(piElemArr, BENCH_SIZE);										\
+	vLIB_Heap_##Name##_init(&xHeap, piStorage, BENCH_SIZE);					\
+																			\
+	/*	Push all then pop all	*/											\
+	xStart = clock();														\
+	for (uint32_t r = 0; r < BENCH_ROUNDS; r++)								\
+	{																		\
+		for (uint32_t i = 0; i < BENCH_SIZE; i++)							\
+			ucLIB_Heap_##Name##_push(&xHeap, &piElemArr[i]);				\
+		while (ucLIB_Heap_##Name##_pop(&xHeap, &iTop))						\
+			iSink += iTop;													\
+	}																		\
+	dPushPop = (double)(clock() - xStart) / CLOCKS_PER_SEC;					\
+																			\
+	/*	Replace top of a full heap	*/										\
+	for (uint32_t i = 0; i < BENCH_SIZE; i++)								\
+		ucLIB_Heap_##Name##_push(&xHeap, &piElemArr[i]);					\
+	xStart = clock();														\
+	for (uint32_t r = 0; r < BENCH_ROUNDS; r++)								\
+	{																		\
+		for (uint32_t i = 0; i < BENCH_SIZE; i++)							\
+			vLIB_Heap_##Name##_replaceTop(&xHeap, &piElemArr[i]);			\
+	}																		\
+	dReplace = (double)(clock() - xStart) / CLOCKS_PER_SEC;					\
+																			\
+	/*	Bulk build	*/														\
+	xStart = clock();														\
+	for (uint32_t r = 0; r < BENCH_ROUNDS; r++)								\
+	{																		\
+		memcpy(piStorage, piElemArr, sizeof(int32_t) * BENCH_SIZE);			\
+		vLIB_Heap_##Name##_build(&xHeap, BENCH_SIZE);						\
+		iSink += piStorage[0];												\
+	}																		\
+	dBuild = (double)(clock() - xStart) / CLOCKS_PER_SEC;					\
+																			\
+	printf(	"%-5s n=%d x%d: push+pop %.3fs, replaceTop %.3fs, build %.3fs\n",\
+			#Name, BENCH_SIZE, BENCH_ROUNDS, dPushPop, dReplace, dBuild);	\
+	(void)iSink;															\
+}
+
+vBENCH_HEAP(Bin)
+vBENCH_HEAP(Quad)
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(100);
+
+	vTestBin();
+	vTestQuad();
+	vTestPair();
+
+	if (uiFailCount)
+	{
+		printf("FAILED: %u checks\n", uiFailCount);
+		return 1;
+	}
+	printf("All heap tests passed.\n");
+
+	vBenchBin();
+	vBenchQuad();
+
+	return 0;
+}
+
+#endif	/*	LIB_HEAP_HOST_TEST	*/
@@ -0,0 +1,54 @@
+/*
+ * FreeRTOS.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Minimal stand-in of "FreeRTOS.h", used only by host (PC) tests of modules
+ * which use RTOS objects (i.e.: semaphores), but whose logic does not depend on
+ * the scheduler.
+ *
+ * Host tests add this directory to the include path (-ISrc/LIB/HostTestStubs).
+ * It must never be in the include path of a target build.
+ */
+
+#ifndef COTS_OS_SRC_LIB_HOSTTESTSTUBS_FREERTOS_H_
+#define COTS_OS_SRC_LIB_HOSTTESTSTUBS_FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef long UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define portMAX_DELAY		((TickType_t)0xFFFFFFFF)
+
+/*	One tick per ms	*/
+#define pdMS_TO_TICKS(xTimeInMs)	((TickType_t)(xTimeInMs))
+
+#define pdFALSE				((BaseType_t)0)
+#define pdTRUE				((BaseType_t)1)
+
+#define configASSERT(x)		assert(x)
+
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY		15
+
+#define configMAX_PRIORITIES		7
+#define configMINIMAL_STACK_SIZE	128
+
+/*	Host tests run ISR callbacks synchronously, there's nothing to yield to	*/
+#define portYIELD_FROM_ISR(x)		((void)(x))
+
+/*
+ * Called by the stubs when the test "blocks" (i.e.: takes an unavailable
+ * semaphore with a non-zero timeout). A test which simulates hardware defines
+ * it to run the simulation, and returns 0 if nothing more is going to happen.
+ * Otherwise, blocking fails immediately.
+ */
+uint8_t ucHOST_TEST_STUB_onBlock(void) __attribute__((weak));
+
+
+
+#endif /* COTS_OS_SRC_LIB_HOSTTESTSTUBS_FREERTOS_H_ */
@@ -0,0 +1,215 @@
+/*
+ * TinyUsbLoopback.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * CDC device of the TinyUSB stand-in (see "tusb.h" in this directory), with an
+ * echoing host.
+ *
+ * Like TinyUSB:
+ * 		-	Written data waits in the Tx FIFO until it's flushed. Flushing moves up
+ * 			to an endpoint buffer of it to the IN packet, unless a packet is
+ * 			already in flight. Once the packet is completed, remaining data in the
+ * 			FIFO is flushed by the device task itself.
+ *
+ * 		-	Host sends an OUT packet only if the Rx FIFO has room for a full one.
+ *
+ * Echoed data waits in the host while the Rx FIFO is full. Host's buffer is
+ * large, but not unlimited, a test must read back what it sends.
+ *
+ * Like the host tests, it is compiled to nothing unless the test using it is
+ * built.
+ */
+
+#ifdef HAL_USB_CDC_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <string.h>
+
+/*	SELF	*/
+#include "tusb.h"
+#include "device/usbd_pvt.h"
+
+#define uiHOST_BUFFER_SIZE		(64 * 1024)
+#define uiDEFER_QUEUE_SIZE		8
+
+/*
+ * Byte FIFO. Head and tail are free running counters.
+ */
+typedef struct{
+	uint8_t* pucArr;
+	uint32_t uiSize;
+	uint32_t uiHead;
+	uint32_t uiTail;
+}xFifo_t;
+
+static uint8_t pucTxFifoArr[CFG_TUD_CDC_TX_BUFSIZE];
+static uint8_t pucRxFifoArr[CFG_TUD_CDC_RX_BUFSIZE];
+static uint8_t pucHostArr[uiHOST_BUFFER_SIZE];
+
+static xFifo_t xTxFifo = {pucTxFifoArr, CFG_TUD_CDC_TX_BUFSIZE, 0, 0};
+static xFifo_t xRxFifo = {pucRxFifoArr, CFG_TUD_CDC_RX_BUFSIZE, 0, 0};
+static xFifo_t xHostFifo = {pucHostArr, uiHOST_BUFFER_SIZE, 0, 0};
+
+/*	IN packet in flight	*/
+static uint8_t pucInPacketArr[CFG_TUD_CDC_EP_BUFSIZE];
+static uint32_t uiInPacketLen = 0;
+
+/*	Deferred function calls	*/
+static osal_task_func_t pfDeferredArr[uiDEFER_QUEUE_SIZE];
+static void* ppvDeferredParamsArr[uiDEFER_QUEUE_SIZE];
+static uint32_t uiDeferredHead = 0;
+static uint32_t uiDeferredTail = 0;
+
+xHOST_TEST_STUB_UsbStats_t xHOST_TEST_STUB_usbStats;
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+static uint32_t uiFifoCount(xFifo_t* pxFifo)
+{
+	return pxFifo->uiHead - pxFifo->uiTail;
+}
+
+static uint32_t uiFifoWrite(xFifo_t* pxFifo, const uint8_t* pucArr, uint32_t uiLen)
+{
+	uint32_t uiFree = pxFifo->uiSize - uiFifoCount(pxFifo);
+
+	if (uiLen > uiFree)
+		uiLen = uiFree;
+
+	for (uint32_t i = 0; i < uiLen; i++)
+		pxFifo->pucArr[(pxFifo->uiHead + i) % pxFifo->uiSize] = pucArr[i];
+
+	pxFifo->uiHead += uiLen;
+
+	return uiLen;
+}
+
+static uint32_t uiFifoRead(xFifo_t* pxFifo, uint8_t* pucArr, uint32_t uiLen)
+{
+	uint32_t uiCount = uiFifoCount(pxFifo);
+
+	if (uiLen > uiCount)
+		uiLen = uiCount;
+
+	for (uint32_t i = 0; i < uiLen; i++)
+		pucArr[i] = pxFifo->pucArr[(pxFifo->uiTail + i) % pxFifo->uiSize];
+
+	pxFifo->uiTail += uiLen;
+
+	return uiLen;
+}
+
+/*******************************************************************************
+ * TinyUSB stand-in functions:
+ ******************************************************************************/
+uint32_t tud_cdc_n_available(uint8_t itf)
+{
+	(void)itf;
+	return uiFifoCount(&xRxFifo);
+}
+
+uint32_t tud_cdc_n_read(uint8_t itf, void* buffer, uint32_t bufsize)
+{
+	(void)itf;
+	return uiFifoRead(&xRxFifo, buffer, bufsize);
+}
+
+uint32_t tud_cdc_n_write(uint8_t itf, void const* buffer, uint32_t bufsize)
+{
+	(void)itf;
+	return uiFifoWrite(&xTxFifo, buffer, bufsize);
+}
+
+uint32_t tud_cdc_n_write_flush(uint8_t itf)
+{
+	(void)itf;
+
+	/*	Endpoint is busy	*/
+	if (uiInPacketLen != 0)
+		return 0;
+
+	uiInPacketLen = uiFifoRead(&xTxFifo, pucInPacketArr, CFG_TUD_CDC_EP_BUFSIZE);
+
+	return uiInPacketLen;
+}
+
+uint32_t tud_cdc_n_write_available(uint8_t itf)
+{
+	(void)itf;
+	return xTxFifo.uiSize - uiFifoCount(&xTxFifo);
+}
+
+bool tud_cdc_n_connected(uint8_t itf)
+{
+	(void)itf;
+	return true;
+}
+
+void usbd_defer_func(osal_task_func_t func, void* param, bool in_isr)
+{
+	(void)in_isr;
+
+	if (uiDeferredHead - uiDeferredTail == uiDEFER_QUEUE_SIZE)
+		return;
+
+	pfDeferredArr[uiDeferredHead % uiDEFER_QUEUE_SIZE] = func;
+	ppvDeferredParamsArr[uiDeferredHead % uiDEFER_QUEUE_SIZE] = param;
+	uiDeferredHead++;
+}
+
+/*******************************************************************************
+ * Simulation:
+ ******************************************************************************/
+/*
+ * See header for info.
+ */
+uint8_t ucHOST_TEST_STUB_runUsb(void)
+{
+	uint8_t pucPacketArr[CFG_TUD_CDC_EP_BUFSIZE];
+	uint32_t uiLen;
+
+	/*	Deferred call	*/
+	if (uiDeferredHead != uiDeferredTail)
+	{
+		uint32_t uiIndex = uiDeferredTail % uiDEFER_QUEUE_SIZE;
+		uiDeferredTail++;
+		xHOST_TEST_STUB_usbStats.uiDeferredCallCount++;
+		pfDeferredArr[uiIndex](ppvDeferredParamsArr[uiIndex]);
+		return 1;
+	}
+
+	/*	IN packet completion, if host has room for it	*/
+	if (	uiInPacketLen != 0													&&
+			uiHOST_BUFFER_SIZE - uiFifoCount(&xHostFifo) >= uiInPacketLen		)
+	{
+		uiFifoWrite(&xHostFifo, pucInPacketArr, uiInPacketLen);
+		xHOST_TEST_STUB_usbStats.uiInPacketCount++;
+		xHOST_TEST_STUB_usbStats.uiInByteCount += uiInPacketLen;
+		uiInPacketLen = 0;
+
+		tud_cdc_tx_complete_cb(0);
+
+		/*	Device task flushes what's left in the FIFO	*/
+		tud_cdc_n_write_flush(0);
+		return 1;
+	}
+
+	/*	OUT packet	*/
+	if (	uiFifoCount(&xHostFifo) != 0										&&
+			xRxFifo.uiSize - uiFifoCount(&xRxFifo) >= CFG_TUD_CDC_EP_BUFSIZE	)
+	{
+		uiLen = uiFifoRead(&xHostFifo, pucPacketArr, CFG_TUD_CDC_EP_BUFSIZE);
+		uiFifoWrite(&xRxFifo, pucPacketArr, uiLen);
+		xHOST_TEST_STUB_usbStats.uiOutPacketCount++;
+
+		tud_cdc_rx_cb(0);
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif	/*	HAL_USB_CDC_HOST_TEST	*/
@@ -0,0 +1,22 @@
+/*
+ * usbd_pvt.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Minimal stand-in of TinyUSB's "device/usbd_pvt.h" for host (PC) tests (see
+ * "tusb.h" in the parent directory). Deferred calls are executed by
+ * "ucHOST_TEST_STUB_runUsb()".
+ */
+
+#ifndef COTS_OS_SRC_LIB_HOSTTESTSTUBS_DEVICE_USBD_PVT_H_
+#define COTS_OS_SRC_LIB_HOSTTESTSTUBS_DEVICE_USBD_PVT_H_
+
+#include "tusb.h"
+
+typedef void (*osal_task_func_t)(void* param);
+
+void usbd_defer_func(osal_task_func_t func, void* param, bool in_isr);
+
+
+
+#endif /* COTS_OS_SRC_LIB_HOSTTESTSTUBS_DEVICE_USBD_PVT_H_ */
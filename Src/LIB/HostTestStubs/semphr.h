@@ -0,0 +1,77 @@
+/*
+ * semphr.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Minimal stand-in of "semphr.h" for host (PC) tests (see "FreeRTOS.h" in this
+ * directory). Semaphores are counters. Taking an unavailable one with a
+ * non-zero timeout calls "ucHOST_TEST_STUB_onBlock()" until it's available, or
+ * until nothing more is going to happen.
+ */
+
+#ifndef COTS_OS_SRC_LIB_HOSTTESTSTUBS_SEMPHR_H_
+#define COTS_OS_SRC_LIB_HOSTTESTSTUBS_SEMPHR_H_
+
+#include "FreeRTOS.h"
+
+typedef struct{
+	uint32_t uiCount;
+	uint32_t uiMaxCount;
+}StaticSemaphore_t;
+
+typedef StaticSemaphore_t* SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateCountingStatic(	uint32_t uiMaxCount,
+																uint32_t uiInitialCount,
+																StaticSemaphore_t* pxStatic	)
+{
+	pxStatic->uiCount = uiInitialCount;
+	pxStatic->uiMaxCount = uiMaxCount;
+	return pxStatic;
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* pxStatic)
+{
+	return xSemaphoreCreateCountingStatic(1, 0, pxStatic);
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* pxStatic)
+{
+	return xSemaphoreCreateCountingStatic(1, 1, pxStatic);
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t xSem)
+{
+	if (xSem->uiCount == xSem->uiMaxCount)
+		return pdFALSE;
+
+	xSem->uiCount++;
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGiveFromISR(	SemaphoreHandle_t xSem,
+												BaseType_t* pxHighPriorityTaskWoken	)
+{
+	*pxHighPriorityTaskWoken = pdTRUE;
+	return xSemaphoreGive(xSem);
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t xSem, TickType_t xTimeout)
+{
+	while (xSem->uiCount == 0)
+	{
+		if (	xTimeout == 0								||
+				ucHOST_TEST_STUB_onBlock == NULL			||
+				!ucHOST_TEST_STUB_onBlock()						)
+		{
+			return pdFALSE;
+		}
+	}
+
+	xSem->uiCount--;
+	return pdTRUE;
+}
+
+
+
+#endif /* COTS_OS_SRC_LIB_HOSTTESTSTUBS_SEMPHR_H_ */
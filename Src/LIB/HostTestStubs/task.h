@@ -0,0 +1,69 @@
+/*
+ * task.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Minimal stand-in of "task.h" for host (PC) tests (see "FreeRTOS.h" in this
+ * directory). Host tests are single threaded, and run ISR callbacks from the
+ * test itself, so critical sections are empty and time does not pass.
+ */
+
+#ifndef COTS_OS_SRC_LIB_HOSTTESTSTUBS_TASK_H_
+#define COTS_OS_SRC_LIB_HOSTTESTSTUBS_TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct{
+	TaskFunction_t pfTask;
+	void* pvParams;
+}StaticTask_t;
+
+typedef StaticTask_t* TaskHandle_t;
+
+/*
+ * Tasks are never run (there's no scheduler). Work that a module does in its
+ * own task is not covered by host tests.
+ */
+static inline TaskHandle_t xTaskCreateStatic(	TaskFunction_t pfTask,
+												const char* pcName,
+												uint32_t uiStackDepth,
+												void* pvParams,
+												UBaseType_t uxPriority,
+												StackType_t* puxStack,
+												StaticTask_t* pxStatic	)
+{
+	(void)pcName;
+	(void)uiStackDepth;
+	(void)uxPriority;
+	(void)puxStack;
+	pxStatic->pfTask = pfTask;
+	pxStatic->pvParams = pvParams;
+	return pxStatic;
+}
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+static inline TickType_t xTaskGetTickCount(void)
+{
+	return 0;
+}
+
+/*	Time does not pass	*/
+static inline void vTaskDelay(TickType_t xTicksToDelay)
+{
+	(void)xTicksToDelay;
+}
+
+/*	Yielding lets the simulated hardware (if any) run	*/
+static inline void taskYIELD(void)
+{
+	if (ucHOST_TEST_STUB_onBlock != NULL)
+		ucHOST_TEST_STUB_onBlock();
+}
+
+
+
+#endif /* COTS_OS_SRC_LIB_HOSTTESTSTUBS_TASK_H_ */
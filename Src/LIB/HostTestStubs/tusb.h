@@ -0,0 +1,64 @@
+/*
+ * tusb.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Minimal stand-in of TinyUSB's "tusb.h" for host (PC) tests of modules which
+ * use the CDC device class (see "FreeRTOS.h" in this directory).
+ *
+ * "TinyUsbLoopback.c" implements the functions declared here as a CDC device,
+ * whose host echoes every received (IN) packet back to the device (OUT). FIFO
+ * and endpoint sizes are those of the targets' full-speed configuration
+ * ("User_Port/tusb_config.h").
+ */
+
+#ifndef COTS_OS_SRC_LIB_HOSTTESTSTUBS_TUSB_H_
+#define COTS_OS_SRC_LIB_HOSTTESTSTUBS_TUSB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CFG_TUD_CDC_RX_BUFSIZE		64
+#define CFG_TUD_CDC_TX_BUFSIZE		64
+#define CFG_TUD_CDC_EP_BUFSIZE		64
+
+uint32_t tud_cdc_n_available(uint8_t itf);
+uint32_t tud_cdc_n_read(uint8_t itf, void* buffer, uint32_t bufsize);
+uint32_t tud_cdc_n_write(uint8_t itf, void const* buffer, uint32_t bufsize);
+uint32_t tud_cdc_n_write_flush(uint8_t itf);
+uint32_t tud_cdc_n_write_available(uint8_t itf);
+bool tud_cdc_n_connected(uint8_t itf);
+
+/*	Defined by the tested module	*/
+void tud_cdc_rx_cb(uint8_t itf);
+void tud_cdc_tx_complete_cb(uint8_t itf);
+
+/*
+ * Loopback statistics.
+ */
+typedef struct{
+	uint32_t uiInPacketCount;
+	uint32_t uiInByteCount;
+	uint32_t uiOutPacketCount;
+	uint32_t uiDeferredCallCount;
+}xHOST_TEST_STUB_UsbStats_t;
+
+extern xHOST_TEST_STUB_UsbStats_t xHOST_TEST_STUB_usbStats;
+
+/*
+ * Runs a single step of the USB device task and the echoing host, in this
+ * order of priority:
+ * 		-	Executes a deferred function call.
+ * 		-	Completes the IN packet in flight (host receives it), calls
+ * 			"tud_cdc_tx_complete_cb()", and starts the next packet, if any data
+ * 			is in the Tx FIFO.
+ * 		-	Sends a packet of echoed data (OUT) if the Rx FIFO has room for a full
+ * 			packet, and calls "tud_cdc_rx_cb()".
+ *
+ * Returns 0 if there was nothing to do.
+ */
+uint8_t ucHOST_TEST_STUB_runUsb(void);
+
+
+
+#endif /* COTS_OS_SRC_LIB_HOSTTESTSTUBS_TUSB_H_ */
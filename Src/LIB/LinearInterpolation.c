@@ -12,6 +12,93 @@
 #define GET_Y(X1, X2, Y1, Y2, X)	\
 	((((X)-(X1)) * ((Y1)-(Y2))) / ((X1)-(X2)) + Y1)
 
+/*******************************************************************************
+ * Helping functions/macros:
+ ******************************************************************************/
+/*
+ * Returns index of the segment to be used for interpolating at "iX". That is,
+ * the largest 'i' such that: piXArr[i] <= iX, clamped to [0, uiLen-2].
+ */
+static inline uint32_t uiFindSegment(	const int32_t* piXArr,
+										uint32_t uiLen,
+										int32_t iX	)
+{
+	uint32_t uiLow = 0;
+	uint32_t uiHigh = uiLen - 2;
+	uint32_t uiMid;
+
+	/*	Out of range values use first or last segment	*/
+	if (iX < piXArr[1])
+		return 0;
+
+	if (iX >= piXArr[uiHigh])
+		return uiHigh;
+
+	/*	Now: piXArr[uiLow] <= iX < piXArr[uiHigh]	*/
+	while (uiHigh - uiLow > 1)
+	{
+		uiMid = (uiLow + uiHigh) / 2;
+		if (piXArr[uiMid] <= iX)
+			uiLow = uiMid;
+		else
+			uiHigh = uiMid;
+	}
+
+	return uiLow;
+}
+
+/*
+ * Returns interpolated value of 'y' in Q16, as a 64-bit value.
+ */
+static inline int64_t lGetQ16(xLIB_LinearInterpolation_t* pxHandle, int32_t iX)
+{
+	const int32_t* piXArr = pxHandle->piXArr;
+	uint32_t uiSeg;
+	int64_t lDx;
+
+	/*
+	 * At and beyond the last point, extrapolate from the last point itself, so
+	 * that it is returned exactly (slopes are truncated to Q16).
+	 */
+	if (iX >= piXArr[pxHandle->uiLen - 1])
+	{
+		lDx = (int64_t)iX - piXArr[pxHandle->uiLen - 1];
+
+		return	(int64_t)pxHandle->piYArr[pxHandle->uiLen - 1] * 65536 +
+				lDx * pxHandle->piSlopeArr[pxHandle->uiLen - 2];
+	}
+
+	if (pxHandle->ucIsUniform)
+	{
+		if (iX <= piXArr[0])
+			uiSeg = 0;
+		else
+		{
+			lDx = (int64_t)iX - piXArr[0];
+			uiSeg = (uint32_t)(((uint64_t)lDx * pxHandle->uiInvStep) >> 32);
+
+			/*	"uiInvStep" is rounded down, result may be one segment less	*/
+			if (uiSeg < pxHandle->uiLen - 1 && iX >= piXArr[uiSeg + 1])
+				uiSeg++;
+
+			if (uiSeg > pxHandle->uiLen - 2)
+				uiSeg = pxHandle->uiLen - 2;
+		}
+	}
+	else
+	{
+		uiSeg = uiFindSegment(piXArr, pxHandle->uiLen, iX);
+	}
+
+	lDx = (int64_t)iX - piXArr[uiSeg];
+
+	return	(int64_t)pxHandle->piYArr[uiSeg] * 65536 +
+			lDx * pxHandle->piSlopeArr[uiSeg];
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
 int32_t iLIB_LinearInterpolation_interpolate(
 		int32_t* piXArr,
 		int32_t* piYArr,
@@ -21,41 +108,80 @@ int32_t iLIB_LinearInterpolation_interpolate(
 {
 	int32_t iY;
 	int32_t iX1, iX2, iY1, iY2;
+	uint32_t i;
 
-	/*	If "iX" is less than 1st value of "piXArr[]"	*/
-	if (iX < piXArr[0])
-	{
-		iX1 = piXArr[0];
-		iX2 = piXArr[1];
-		iY1 = piYArr[0];
-		iY2 = piYArr[1];
-	}
+	i = uiFindSegment(piXArr, uiLen, iX);
+
+	iX1 = piXArr[i];
+	iX2 = piXArr[i+1];
+	iY1 = piYArr[i];
+	iY2 = piYArr[i+1];
+
+	iY = GET_Y(iX1, iX2, iY1, iY2, iX);
+
+	return iY;
+}
 
-	/*	If "iX" is larger than last value of "piXArr[]"	*/
-	else if (iX >= piXArr[uiLen-1])
+uint8_t ucLIB_LinearInterpolation_init(
+		xLIB_LinearInterpolation_t* pxHandle,
+		const int32_t* piXArr,
+		const int32_t* piYArr,
+		uint32_t uiLen,
+		int32_t* piSlopeArr
+	)
+{
+	int64_t lDx, lDy, lSlope;
+
+	if (uiLen < 2)
+		return 0;
+
+	pxHandle->piXArr = piXArr;
+	pxHandle->piYArr = piYArr;
+	pxHandle->uiLen = uiLen;
+	pxHandle->piSlopeArr = piSlopeArr;
+
+	/*	Calculate slopes, and check uniformity of 'x' values	*/
+	pxHandle->ucIsUniform = 1;
+	for (uint32_t i = 0; i < uiLen - 1; i++)
 	{
-		iX1 = piXArr[uiLen-2];
-		iX2 = piXArr[uiLen-1];
-		iY1 = piYArr[uiLen-2];
-		iY2 = piYArr[uiLen-1];
+		lDx = (int64_t)piXArr[i+1] - piXArr[i];
+		lDy = (int64_t)piYArr[i+1] - piYArr[i];
+
+		if (lDx <= 0)
+			return 0;
+
+		lSlope = (lDy * 65536) / lDx;
+		if (lSlope > INT32_MAX || lSlope < INT32_MIN)
+			return 0;
+
+		piSlopeArr[i] = (int32_t)lSlope;
+
+		if (lDx != (int64_t)piXArr[1] - piXArr[0])
+			pxHandle->ucIsUniform = 0;
 	}
 
-	/*	Otherwise, if "iX" is within the range of "piXArr[]"	*/
-	else
+	/*	Step reciprocal in Q32 (rounded down)	*/
+	if (pxHandle->ucIsUniform)
 	{
-		for (uint32_t i = 0; i < uiLen; i++)
-		{
-			if (iX >= piXArr[i])
-			{
-				iX1 = piXArr[i];
-				iX2 = piXArr[i+1];
-				iY1 = piYArr[i];
-				iY2 = piYArr[i+1];
-			}
-		}
+		lDx = (int64_t)piXArr[1] - piXArr[0];
+		pxHandle->uiInvStep = (uint32_t)(0xFFFFFFFFull / (uint64_t)lDx);
 	}
 
-	iY = GET_Y(iX1, iX2, iY1, iY2, iX);
+	return 1;
+}
 
-	return iY;
+int32_t iLIB_LinearInterpolation_get(
+		xLIB_LinearInterpolation_t* pxHandle,
+		int32_t iX
+	)
+{
+	return (int32_t)((lGetQ16(pxHandle, iX) + 0x8000) >> 16);
+}
+
+int32_t iLIB_LinearInterpolation_getQ16(
+		xLIB_LinearInterpolation_t* pxHandle,
+		int32_t iX
+	)
+{
+	return (int32_t)lGetQ16(pxHandle, iX);
 }
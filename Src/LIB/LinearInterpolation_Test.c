@@ -0,0 +1,365 @@
+/*
+ * LinearInterpolation_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the linear interpolation functions.
+ *
+ * It builds random tables (uniform and non-uniform spacing, small and large
+ * steps, positive and negative slopes), and checks against a double precision
+ * reference that:
+ * 		-	"iLIB_LinearInterpolation_getQ16()" is within (|x - x[i]| + 1) LSBs
+ * 			of the exact value, where 'i' is the segment used. (Slopes are
+ * 			rounded towards zero to Q16, so the error grows by less than one LSB
+ * 			per unit of 'x')
+ *
+ * 		-	"iLIB_LinearInterpolation_get()" equals the exact value rounded to
+ * 			the nearest integer, within the above error.
+ *
+ * 		-	Both are exact at every table point, and at the first and last
+ * 			points specifically.
+ *
+ * 		-	Out of range inputs, including INT32_MIN and INT32_MAX, extrapolate
+ * 			the first or last segment.
+ *
+ * 		-	"iLIB_LinearInterpolation_interpolate()" is within one of the exact
+ * 			value (it truncates).
+ *
+ * 		-	"ucLIB_LinearInterpolation_init()" rejects short tables, 'x' values
+ * 			that are not strictly ascending, and slopes out of range of Q16.
+ *
+ * Then it prints throughput of the prepared and the unprepared functions.
+ *
+ * It is built and run from repository's root directory as follows:
+ *
+ * 		gcc -O2 -DLIB_LINEAR_INTERPOLATION_HOST_TEST -IInc \
+ * 			Src/LIB/LinearInterpolation.c Src/LIB/LinearInterpolation_Test.c \
+ * 			-o linear_interpolation_test -lm
+ *
+ * 		./linear_interpolation_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef LIB_LINEAR_INTERPOLATION_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "LIB/LinearInterpolation/LinearInterpolation.h"
+
+#define uiMAX_LEN					200
+#define uiNUMBER_OF_TABLES			2000
+#define uiPOINTS_PER_TABLE			2000
+#define uiBENCHMARK_ITERATIONS		20000000
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, int32_t iX)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, x: %d\n", pcName, iX);
+		uiNumberOfFailures++;
+	}
+}
+
+static int32_t iRand(int32_t iMin, int32_t iMax)
+{
+	uint64_t ulRange = (uint64_t)((int64_t)iMax - iMin) + 1;
+	uint64_t ulR = ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+	return (int32_t)(iMin + (int64_t)(ulR % ulRange));
+}
+
+/*
+ * Reference: exact 'y' at "iX", extrapolating the first or last segment out of
+ * range. Also writes the segment used to "puiSeg".
+ */
+static double dRefY(	const int32_t* piXArr, const int32_t* piYArr, uint32_t uiLen,
+						int32_t iX, uint32_t* puiSeg	)
+{
+	uint32_t i = 0;
+
+	while (i < uiLen - 2 && iX >= piXArr[i + 1])
+		i++;
+
+	*puiSeg = i;
+
+	return	(double)piYArr[i] +
+			((double)iX - piXArr[i]) * ((double)piYArr[i + 1] - piYArr[i]) /
+			((double)piXArr[i + 1] - piXArr[i]);
+}
+
+/*
+ * Generates a table of "uiLen" points, with 'x' starting at "iX0" and steps in
+ * [1, "iMaxStep"] (or exactly "iMaxStep" if uniform), and 'y' steps bounded
+ * such that slopes fit in Q16 and 'y' never leaves [-2^30, 2^30].
+ */
+static void vGenerate(	int32_t* piXArr, int32_t* piYArr, uint32_t uiLen,
+						int32_t iX0, int32_t iMaxStep, uint8_t ucIsUniform	)
+{
+	int64_t lMaxDy;
+
+	piXArr[0] = iX0;
+	piYArr[0] = iRand(-1000000, 1000000);
+
+	for (uint32_t i = 1; i < uiLen; i++)
+	{
+		int32_t iStep = ucIsUniform ? iMaxStep : iRand(1, iMaxStep);
+		piXArr[i] = piXArr[i - 1] + iStep;
+
+		lMaxDy = (int64_t)iStep * (rand() % 2 ? 100 : 30000);
+		if (lMaxDy > (1 << 30) / uiMAX_LEN)
+			lMaxDy = (1 << 30) / uiMAX_LEN;
+		piYArr[i] = piYArr[i - 1] + iRand(-(int32_t)lMaxDy, (int32_t)lMaxDy);
+	}
+}
+
+/*	Checks prepared functions at "iX" against reference	*/
+static void vCheckPoint(	xLIB_LinearInterpolation_t* pxHandle,
+							const int32_t* piXArr, const int32_t* piYArr,
+							uint32_t uiLen, int32_t iX	)
+{
+	uint32_t uiSeg;
+	double dRef = dRefY(piXArr, piYArr, uiLen, iX, &uiSeg);
+	double dErrQ16 = fabs((double)iX - piXArr[uiSeg]) + 1;
+
+	/*	Skip extrapolations which are out of range of the output	*/
+	if (fabs(dRef) * 65536 >= 4e18)
+		return;
+
+	double dQ16 = (double)iLIB_LinearInterpolation_getQ16(pxHandle, iX);
+
+	if (fabs(dRef) < 32768.0 - dErrQ16 / 65536)
+		vCheck(fabs(dQ16 - dRef * 65536.0) <= dErrQ16, "Q16 value", iX);
+
+	if (fabs(dRef) < 2147483647.0 - dErrQ16 / 65536 - 1)
+	{
+		int32_t iY = iLIB_LinearInterpolation_get(pxHandle, iX);
+		vCheck(	fabs((double)iY - dRef) <= 0.5 + dErrQ16 / 65536,
+				"rounded value", iX	);
+	}
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static void vTestRandomTables(void)
+{
+	static int32_t piXArr[uiMAX_LEN];
+	static int32_t piYArr[uiMAX_LEN];
+	static int32_t piSlopeArr[uiMAX_LEN - 1];
+	xLIB_LinearInterpolation_t xHandle;
+
+	for (uint32_t t = 0; t < uiNUMBER_OF_TABLES; t++)
+	{
+		uint32_t uiLen = 2 + rand() % (uiMAX_LEN - 1);
+		uint8_t ucIsUniform = rand() % 2;
+		int32_t iMaxStep = (rand() % 2) ? iRand(1, 100) : iRand(1, 1000000);
+		int32_t iX0 = iRand(-1000000000, 1000000000 - (int32_t)uiLen * iMaxStep);
+
+		vGenerate(piXArr, piYArr, uiLen, iX0, iMaxStep, ucIsUniform);
+
+		vCheck(	ucLIB_LinearInterpolation_init(&xHandle, piXArr, piYArr, uiLen, piSlopeArr),
+				"init", 0	);
+
+		if (ucIsUniform)
+			vCheck(xHandle.ucIsUniform, "uniformity detection", 0);
+
+		/*	Table points, exactly	*/
+		for (uint32_t i = 0; i < uiLen; i++)
+		{
+			vCheck(	iLIB_LinearInterpolation_get(&xHandle, piXArr[i]) == piYArr[i],
+					"value at table point", piXArr[i]	);
+			if (piYArr[i] < 32768 && piYArr[i] >= -32768)
+				vCheck(	iLIB_LinearInterpolation_getQ16(&xHandle, piXArr[i]) ==
+						piYArr[i] * 65536,
+						"Q16 value at table point", piXArr[i]	);
+		}
+
+		/*	Neighbours of table points (segment boundaries)	*/
+		for (uint32_t i = 0; i < uiLen; i++)
+		{
+			vCheckPoint(&xHandle, piXArr, piYArr, uiLen, piXArr[i] - 1);
+			vCheckPoint(&xHandle, piXArr, piYArr, uiLen, piXArr[i] + 1);
+		}
+
+		/*	Random points in range	*/
+		for (uint32_t i = 0; i < uiPOINTS_PER_TABLE; i++)
+		{
+			vCheckPoint(	&xHandle, piXArr, piYArr, uiLen,
+							iRand(piXArr[0], piXArr[uiLen - 1])	);
+		}
+
+		/*	Out of range, near and far	*/
+		for (uint32_t i = 0; i < 100; i++)
+		{
+			vCheckPoint(	&xHandle, piXArr, piYArr, uiLen,
+							piXArr[0] - iRand(1, 2 * iMaxStep)	);
+			vCheckPoint(	&xHandle, piXArr, piYArr, uiLen,
+							piXArr[uiLen - 1] + iRand(1, 2 * iMaxStep)	);
+			vCheckPoint(	&xHandle, piXArr, piYArr, uiLen,
+							iRand(INT32_MIN, piXArr[0])	);
+			vCheckPoint(	&xHandle, piXArr, piYArr, uiLen,
+							iRand(piXArr[uiLen - 1], INT32_MAX)	);
+		}
+		vCheckPoint(&xHandle, piXArr, piYArr, uiLen, INT32_MIN);
+		vCheckPoint(&xHandle, piXArr, piYArr, uiLen, INT32_MAX);
+	}
+}
+
+static void vTestUnprepared(void)
+{
+	static int32_t piXArr[uiMAX_LEN];
+	static int32_t piYArr[uiMAX_LEN];
+	uint32_t uiSeg;
+
+	/*
+	 * The unprepared function multiplies in 32-bits, so tables are kept small
+	 * enough for (x - x1) * (y1 - y2) to fit.
+	 */
+	for (uint32_t t = 0; t < uiNUMBER_OF_TABLES; t++)
+	{
+		uint32_t uiLen = 2 + rand() % 30;
+		vGenerate(piXArr, piYArr, uiLen, iRand(-10000, 10000), iRand(1, 100), rand() % 2);
+		for (uint32_t i = 1; i < uiLen; i++)
+			piYArr[i] = piYArr[0] + iRand(-10000, 10000);
+
+		for (uint32_t i = 0; i < 200; i++)
+		{
+			int32_t iX = iRand(piXArr[0] - 100, piXArr[uiLen - 1] + 100);
+			double dRef = dRefY(piXArr, piYArr, uiLen, iX, &uiSeg);
+			int32_t iY = iLIB_LinearInterpolation_interpolate(piXArr, piYArr, uiLen, iX);
+			vCheck(fabs((double)iY - dRef) < 1.0, "unprepared value", iX);
+		}
+
+		vCheck(	iLIB_LinearInterpolation_interpolate(piXArr, piYArr, uiLen, piXArr[0]) ==
+				piYArr[0], "unprepared first point", piXArr[0]	);
+		vCheck(	iLIB_LinearInterpolation_interpolate(
+					piXArr, piYArr, uiLen, piXArr[uiLen - 1]) == piYArr[uiLen - 1],
+				"unprepared last point", piXArr[uiLen - 1]	);
+	}
+}
+
+static void vTestInitErrors(void)
+{
+	xLIB_LinearInterpolation_t xHandle;
+	int32_t piSlopeArr[3];
+
+	const int32_t piX1[] = {0};
+	const int32_t piY1[] = {0};
+	vCheck(	!ucLIB_LinearInterpolation_init(&xHandle, piX1, piY1, 1, piSlopeArr),
+			"init rejects single point", 0	);
+
+	const int32_t piXEqual[] = {0, 10, 10, 20};
+	const int32_t piY4[] = {0, 1, 2, 3};
+	vCheck(	!ucLIB_LinearInterpolation_init(&xHandle, piXEqual, piY4, 4, piSlopeArr),
+			"init rejects repeated x", 0	);
+
+	const int32_t piXDesc[] = {0, 10, 5, 20};
+	vCheck(	!ucLIB_LinearInterpolation_init(&xHandle, piXDesc, piY4, 4, piSlopeArr),
+			"init rejects descending x", 0	);
+
+	const int32_t piXSteep[] = {0, 1};
+	const int32_t piYSteep[] = {0, 32768};
+	vCheck(	!ucLIB_LinearInterpolation_init(&xHandle, piXSteep, piYSteep, 2, piSlopeArr),
+			"init rejects slope out of Q16", 0	);
+
+	const int32_t piYSteepest[] = {0, 32767};
+	vCheck(	ucLIB_LinearInterpolation_init(&xHandle, piXSteep, piYSteepest, 2, piSlopeArr),
+			"init accepts largest slope", 0	);
+
+	/*	Widest possible uniform table	*/
+	const int32_t piXWide[] = {INT32_MIN, 0, INT32_MAX};
+	const int32_t piYWide[] = {-1000, 0, 1000};
+	vCheck(	ucLIB_LinearInterpolation_init(&xHandle, piXWide, piYWide, 3, piSlopeArr),
+			"init of full range table", 0	);
+	vCheck(!xHandle.ucIsUniform, "full range table is not uniform", 0);
+	vCheckPoint(&xHandle, piXWide, piYWide, 3, INT32_MIN);
+	vCheckPoint(&xHandle, piXWide, piYWide, 3, -1);
+	vCheckPoint(&xHandle, piXWide, piYWide, 3, 0);
+	vCheckPoint(&xHandle, piXWide, piYWide, 3, 1);
+	vCheckPoint(&xHandle, piXWide, piYWide, 3, INT32_MAX);
+
+	const int32_t piXWideUniform[] = {-2147483646, 0, 2147483646};
+	vCheck(	ucLIB_LinearInterpolation_init(
+				&xHandle, piXWideUniform, piYWide, 3, piSlopeArr),
+			"init of full range uniform table", 0	);
+	vCheck(xHandle.ucIsUniform, "full range uniform table is uniform", 0);
+	for (int32_t i = -3; i <= 3; i++)
+	{
+		vCheckPoint(&xHandle, piXWideUniform, piYWide, 3, i);
+		vCheckPoint(&xHandle, piXWideUniform, piYWide, 3, INT32_MIN + 3 + i);
+		vCheckPoint(&xHandle, piXWideUniform, piYWide, 3, INT32_MAX - 3 + i);
+	}
+}
+
+static void vBenchmark(void)
+{
+	static int32_t piXArr[64];
+	static int32_t piYArr[64];
+	static int32_t piSlopeArr[63];
+	xLIB_LinearInterpolation_t xUniform, xNonUniform;
+	volatile uint32_t uiSink = 0;
+	clock_t xStart;
+	double dUniform, dNonUniform, dUnprepared;
+
+	vGenerate(piXArr, piYArr, 64, 0, 64, 1);
+	ucLIB_LinearInterpolation_init(&xUniform, piXArr, piYArr, 64, piSlopeArr);
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+		uiSink += (uint32_t)iLIB_LinearInterpolation_get(&xUniform, i & 4095);
+	dUniform = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+		uiSink += (uint32_t)iLIB_LinearInterpolation_interpolate(piXArr, piYArr, 64, i & 4095);
+	dUnprepared = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	piXArr[1] += 1;
+	ucLIB_LinearInterpolation_init(&xNonUniform, piXArr, piYArr, 64, piSlopeArr);
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_ITERATIONS; i++)
+		uiSink += (uint32_t)iLIB_LinearInterpolation_get(&xNonUniform, i & 4095);
+	dNonUniform = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	printf("64-point table, Mlookups/s:\n");
+	printf("Prepared, uniform:     %8.1f\n", uiBENCHMARK_ITERATIONS / dUniform / 1e6);
+	printf("Prepared, non-uniform: %8.1f\n", uiBENCHMARK_ITERATIONS / dNonUniform / 1e6);
+	printf("Unprepared:            %8.1f\n", uiBENCHMARK_ITERATIONS / dUnprepared / 1e6);
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	vTestRandomTables();
+	vTestUnprepared();
+	vTestInitErrors();
+
+	vBenchmark();
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	LIB_LINEAR_INTERPOLATION_HOST_TEST	*/
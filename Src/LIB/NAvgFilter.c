@@ -10,13 +10,40 @@
 
 /*	RTOS	*/
 #include "FreeRTOS.h"
-#include "queue.h"
 #include "semphr.h"
 
 /*	SELF	*/
 #include "LIB/NAvgFilter/NAvgFilter.h"
 
+/*******************************************************************************
+ * Helping functions/macros:
+ ******************************************************************************/
+static inline void vPushSample(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal)
+{
+	uint32_t uiIndex = pxHandle->uiIndex;
+
+	/*	Replace oldest sample in the sum and in the ring with the new one	*/
+	pxHandle->iSum += iNewVal - pxHandle->piDataArr[uiIndex];
+	pxHandle->piDataArr[uiIndex] = iNewVal;
+
+	/*	Advance ring index (without modulo)	*/
+	uiIndex++;
+	if (uiIndex == pxHandle->uiN)
+		uiIndex = 0;
+	pxHandle->uiIndex = uiIndex;
+}
+
+static inline void vUpdateAvg(xLIB_NAvgFilter_t* pxHandle)
+{
+	if (pxHandle->ucIsNPowerOfTwo)
+		pxHandle->iAvg = pxHandle->iSum >> pxHandle->ucLog2N;
+	else
+		pxHandle->iAvg = pxHandle->iSum / (int32_t)pxHandle->uiN;
+}
 
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
 /*
  * See header file for info.
  */
@@ -24,19 +51,15 @@ void vLIB_NAvgFilter_init(	xLIB_NAvgFilter_t* pxHandle,
 							int32_t* piDataArr,
 							uint32_t uiN	)
 {
-	/*	Create queue handle	*/
-	pxHandle->xQueue = xQueueCreateStatic(	uiN,
-	                                 	 	sizeof(int32_t),
-											(uint8_t*)piDataArr,
-											&pxHandle->xQueueStatic	);
-
-	/*	Fill the queue with "uiN" zero samples	*/
-	int32_t iZero = 0;
+	/*	Fill the ring with "uiN" zero samples	*/
 	for (uint32_t i = 0; i < uiN; i++)
 	{
-		xQueueSend(pxHandle->xQueue, (void*)&iZero, 0);
+		piDataArr[i] = 0;
 	}
 
+	pxHandle->piDataArr = piDataArr;
+	pxHandle->uiIndex = 0;
+
 	/*	Sum of samples so far is zero, and hence avg is also zero	*/
 	pxHandle->iSum = 0;
 	pxHandle->iAvg = 0;
@@ -44,6 +67,14 @@ void vLIB_NAvgFilter_init(	xLIB_NAvgFilter_t* pxHandle,
 	/*	Copy "uiN" to the handle	*/
 	pxHandle->uiN = uiN;
 
+	/*	Check if "uiN" is a power of two	*/
+	pxHandle->ucIsNPowerOfTwo = ((uiN & (uiN - 1)) == 0);
+	pxHandle->ucLog2N = 0;
+	while ((1ul << pxHandle->ucLog2N) < uiN)
+	{
+		pxHandle->ucLog2N++;
+	}
+
 	/*	Initialize mutex	*/
 	pxHandle->xMutex = xSemaphoreCreateMutexStatic(&pxHandle->xMutexStatic);
 	xSemaphoreGive(pxHandle->xMutex);
@@ -54,19 +85,8 @@ void vLIB_NAvgFilter_init(	xLIB_NAvgFilter_t* pxHandle,
  */
 void vLIB_NAvgFilter_update(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal)
 {
-	/*	Read then remove front of the queue	*/
-	int32_t iFront;
-	xQueueReceive(pxHandle->xQueue, (void*)&iFront, 0);
-
-	/*	Subtract front of the queue from the sum	*/
-	pxHandle->iSum -= iFront;
-
-	/*	Add new value to the sum and update the avg	*/
-	pxHandle->iSum += iNewVal;
-	pxHandle->iAvg = pxHandle->iSum / pxHandle->uiN;
-
-	/*	Add new value to back of the queue	*/
-	xQueueSend(pxHandle->xQueue, (void*)&iNewVal, 0);
+	vPushSample(pxHandle, iNewVal);
+	vUpdateAvg(pxHandle);
 }
 
 /*
@@ -74,19 +94,45 @@ void vLIB_NAvgFilter_update(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal)
  */
 void vLIB_NAvgFilter_updateFromISR(xLIB_NAvgFilter_t* pxHandle, int32_t iNewVal)
 {
-	/*	Read then remove front of the queue	*/
-	int32_t iFront;
-	xQueueReceiveFromISR(pxHandle->xQueue, (void*)&iFront, NULL);
+	vPushSample(pxHandle, iNewVal);
+	vUpdateAvg(pxHandle);
+}
+
+/*
+ * See header file for info.
+ */
+void vLIB_NAvgFilter_updateBatch(	xLIB_NAvgFilter_t* pxHandle,
+									const int32_t* piArr,
+									uint32_t uiCount	)
+{
+	uint32_t uiN = pxHandle->uiN;
 
-	/*	Subtract front of the queue from the sum	*/
-	pxHandle->iSum -= iFront;
+	if (uiCount >= uiN)
+	{
+		/*
+		 * Whole window is replaced. Copy last "uiN" values to the ring, and
+		 * recalculate the sum.
+		 */
+		piArr += uiCount - uiN;
+		int32_t iSum = 0;
+		for (uint32_t i = 0; i < uiN; i++)
+		{
+			pxHandle->piDataArr[i] = piArr[i];
+			iSum += piArr[i];
+		}
+		pxHandle->iSum = iSum;
+		pxHandle->uiIndex = 0;
+	}
 
-	/*	Add new value to the sum and update the avg	*/
-	pxHandle->iSum += iNewVal;
-	pxHandle->iAvg = pxHandle->iSum / pxHandle->uiN;
+	else
+	{
+		for (uint32_t i = 0; i < uiCount; i++)
+		{
+			vPushSample(pxHandle, piArr[i]);
+		}
+	}
 
-	/*	Add new value to back of the queue	*/
-	xQueueSendFromISR(pxHandle->xQueue, (void*)&iNewVal, NULL);
+	vUpdateAvg(pxHandle);
 }
 
 
@@ -11,39 +11,189 @@
 
 /*	RTOS	*/
 #include "FreeRTOS.h"
-#include "queue.h"
+#include "task.h"
 #include "semphr.h"
 
 /*	SELF	*/
 #include "LIB/RMS/RMS.h"
 
+/*******************************************************************************
+ * Helping functions/macros:
+ ******************************************************************************/
+static inline uint32_t uiGetSquare(xLIB_RMS_t* pxHandle, int16_t sVal)
+{
+	/*
+	 * |iDiff| <= 65535, so its square fits in 32-bits unsigned (but not signed,
+	 * hence the unsigned multiplication, which is exact for two's complement).
+	 */
+	int32_t iDiff = (int32_t)sVal - (int32_t)pxHandle->sOffset;
+	return (uint32_t)iDiff * (uint32_t)iDiff;
+}
 
 /*
- * See header file for info.
+ * Integer square root (bit by bit method).
  */
-void vLIB_RMS_init(	xLIB_RMS_t* pxHandle,
-					float* piDataArr,
-					uint32_t uiN	)
+static uint16_t usSqrt(uint32_t uiX)
+{
+	uint32_t uiRes = 0;
+	uint32_t uiBit = 1ul << 30;
+
+	while (uiBit > uiX)
+		uiBit >>= 2;
+
+	while (uiBit != 0)
+	{
+		if (uiX >= uiRes + uiBit)
+		{
+			uiX -= uiRes + uiBit;
+			uiRes = (uiRes >> 1) + uiBit;
+		}
+		else
+		{
+			uiRes >>= 1;
+		}
+		uiBit >>= 2;
+	}
+
+	return (uint16_t)uiRes;
+}
+
+/*
+ * Adds "uiCount" samples to the sliding window.
+ */
+static void vUpdateSliding(	xLIB_RMS_t* pxHandle,
+							const int16_t* psArr,
+							uint32_t uiCount,
+							uint32_t uiStride	)
+{
+	uint32_t uiN = pxHandle->uiN;
+	uint32_t* puiSquareArr = pxHandle->puiSquareArr;
+	uint32_t uiIndex = pxHandle->uiIndex;
+	uint64_t ulSum = pxHandle->ulSum;
+	uint32_t uiSquare;
+
+	/*
+	 * If the block is longer than the window, older samples would be pushed
+	 * out of it anyway.
+	 */
+	if (uiCount > uiN)
+	{
+		psArr += (uiCount - uiN) * uiStride;
+		uiCount = uiN;
+	}
+
+	for (uint32_t i = 0; i < uiCount; i++)
+	{
+		uiSquare = uiGetSquare(pxHandle, *psArr);
+		psArr += uiStride;
+
+		ulSum += uiSquare;
+		ulSum -= puiSquareArr[uiIndex];
+		puiSquareArr[uiIndex] = uiSquare;
+
+		uiIndex++;
+		if (uiIndex == uiN)
+			uiIndex = 0;
+	}
+
+	pxHandle->uiIndex = uiIndex;
+	pxHandle->ulSum = ulSum;
+}
+
+/*
+ * Adds "uiCount" samples to the tumbling window.
+ */
+static void vUpdateTumbling(	xLIB_RMS_t* pxHandle,
+								const int16_t* psArr,
+								uint32_t uiCount,
+								uint32_t uiStride	)
 {
-	/*	Create queue handle	*/
-	pxHandle->xQueue = xQueueCreateStatic(	uiN - 2,
-	                                 	 	sizeof(float),
-											(uint8_t*)piDataArr,
-											&pxHandle->xQueueStatic	);
-
-	/*	Fill the queue with "uiN" - 2 zero samples	*/
-	float fZero = 0;
-	for (uint32_t i = 0; i < uiN-2; i++)
+	uint32_t uiRemaining, uiChunk;
+	uint64_t ulSum;
+
+	while (uiCount > 0)
 	{
-		xQueueSend(pxHandle->xQueue, (void*)&fZero, 0);
+		/*	Process samples up to the end of the current window	*/
+		uiRemaining = pxHandle->uiN - pxHandle->uiIndex;
+		uiChunk = (uiCount < uiRemaining) ? uiCount : uiRemaining;
+
+		ulSum = pxHandle->ulSum;
+		for (uint32_t i = 0; i < uiChunk; i++)
+		{
+			ulSum += uiGetSquare(pxHandle, *psArr);
+			psArr += uiStride;
+		}
+
+		pxHandle->uiIndex += uiChunk;
+		uiCount -= uiChunk;
+
+		/*	If window is completed, latch its sum and start a new one	*/
+		if (pxHandle->uiIndex == pxHandle->uiN)
+		{
+			pxHandle->ulLastSum = ulSum;
+			pxHandle->ulSum = 0;
+			pxHandle->uiIndex = 0;
+			pxHandle->uiNumberOfWindows++;
+		}
+		else
+		{
+			pxHandle->ulSum = ulSum;
+		}
 	}
+}
+
+/*
+ * Returns sum of squares of the window.
+ *
+ * Sum is 64-bit, which is read in two halves. If the handle is updated from an
+ * ISR, it could be written between reading them, hence the critical section.
+ */
+static inline uint64_t ulGetWindowSum(xLIB_RMS_t* pxHandle)
+{
+	uint64_t ulSum;
 
-	pxHandle->fX0 = 0;
-	pxHandle->fXN_1 = 0;
-	pxHandle->fSum = 0;
+	taskENTER_CRITICAL();
+	{
+		if (pxHandle->xWindow == xLIB_RMS_Window_Sliding)
+			ulSum = pxHandle->ulSum;
+		else
+			ulSum = pxHandle->ulLastSum;
+	}
+	taskEXIT_CRITICAL();
 
-	/*	Copy "uiN" to the handle	*/
+	return ulSum;
+}
+
+/*******************************************************************************
+ * API functions:
+ ******************************************************************************/
+/*
+ * See header file for info.
+ */
+void vLIB_RMS_init(	xLIB_RMS_t* pxHandle,
+					xLIB_RMS_Window_t xWindow,
+					uint32_t uiN,
+					uint32_t* puiSquareArr,
+					int16_t sOffset	)
+{
+	pxHandle->xWindow = xWindow;
 	pxHandle->uiN = uiN;
+	pxHandle->sOffset = sOffset;
+
+	/*	Window is initially filled with zero samples	*/
+	pxHandle->puiSquareArr = puiSquareArr;
+	if (xWindow == xLIB_RMS_Window_Sliding)
+	{
+		for (uint32_t i = 0; i < uiN; i++)
+		{
+			puiSquareArr[i] = 0;
+		}
+	}
+
+	pxHandle->uiIndex = 0;
+	pxHandle->ulSum = 0;
+	pxHandle->ulLastSum = 0;
+	pxHandle->uiNumberOfWindows = 0;
 
 	/*	Initialize mutex	*/
 	pxHandle->xMutex = xSemaphoreCreateMutexStatic(&pxHandle->xMutexStatic);
@@ -69,40 +219,45 @@ void vLIB_RMS_unlock(xLIB_RMS_t* pxHandle)
 /*
  * See header file for info.
  */
-void vLIB_RMS_update(xLIB_RMS_t* pxHandle, float fNewVal)
+void vLIB_RMS_update(xLIB_RMS_t* pxHandle, int16_t sNewVal)
 {
-	/*	Read then remove front of the queue (current before last sample)	*/
-	float fFront;
-	xQueueReceive(pxHandle->xQueue, (void*)&fFront, 0);
-
-	/*	Subtract front of the queue from the sum	*/
-	pxHandle->fSum -= fFront;
-
-	/*	update current last sample with the current before last sample	*/
-	pxHandle->fXN_1 = fFront;
-
-	/*	Add current first sample to the sum	*/
-	pxHandle->fSum += pxHandle->fX0;
+	vLIB_RMS_updateBlock(pxHandle, &sNewVal, 1, 1);
+}
 
-	/*	Add current first sample to back of the queue	*/
-	xQueueSend(pxHandle->xQueue, (void*)&(pxHandle->fX0), 0);
+/*
+ * See header file for info.
+ */
+void vLIB_RMS_updateFromISR(xLIB_RMS_t* pxHandle, int16_t sNewVal)
+{
+	vLIB_RMS_updateBlock(pxHandle, &sNewVal, 1, 1);
+}
 
-	/*	Write new value to current first sample	*/
-	pxHandle->fX0 = fNewVal * fNewVal;
+/*
+ * See header file for info.
+ */
+void vLIB_RMS_updateBlock(	xLIB_RMS_t* pxHandle,
+							const int16_t* psArr,
+							uint32_t uiCount,
+							uint32_t uiStride	)
+{
+	if (pxHandle->xWindow == xLIB_RMS_Window_Sliding)
+		vUpdateSliding(pxHandle, psArr, uiCount, uiStride);
+	else
+		vUpdateTumbling(pxHandle, psArr, uiCount, uiStride);
 }
 
+/*
+ * See header file for info.
+ */
 float fLIB_RMS_getValue(xLIB_RMS_t* pxHandle)
 {
-	return sqrt(
-			(pxHandle->fX0 + pxHandle->fXN_1 + pxHandle->fSum) /
-			(float)pxHandle->uiN
-		);
+	return sqrtf((float)ulGetWindowSum(pxHandle) / (float)pxHandle->uiN);
 }
 
-
-
-
-
-
-
-
+/*
+ * See header file for info.
+ */
+uint16_t usLIB_RMS_getValueInt(xLIB_RMS_t* pxHandle)
+{
+	return usSqrt((uint32_t)(ulGetWindowSum(pxHandle) / pxHandle->uiN));
+}
@@ -0,0 +1,235 @@
+/*
+ * RMS_Test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * This is a host (PC) test and benchmark of the RMS engine.
+ *
+ * It feeds random signals (sines with noise, and full-scale extremes) through
+ * sliding and tumbling handles, and checks that:
+ * 		-	Sum of squares of the window equals that of a 64-bit reference
+ * 			exactly, including differences of magnitude 65535 (offset -32768,
+ * 			sample 32767).
+ *
+ * 		-	"fLIB_RMS_getValue()" is within a relative error of 1e-6 of a double
+ * 			precision reference, and "usLIB_RMS_getValueInt()" equals the floor
+ * 			of it.
+ *
+ * 		-	Block updates, of random lengths and strides, equal per-sample
+ * 			updates.
+ *
+ * Then it prints throughput of "vLIB_RMS_updateBlock()".
+ *
+ * RTOS objects used by the handle (mutex) are stubbed by the headers in
+ * "Src/LIB/HostTestStubs". It is built and run from repository's root
+ * directory as follows:
+ *
+ * 		gcc -O2 -DLIB_RMS_HOST_TEST -IInc -ISrc/LIB/HostTestStubs \
+ * 			Src/LIB/RMS.c Src/LIB/RMS_Test.c -o rms_test -lm
+ *
+ * 		./rms_test
+ *
+ * It exits with 0 if all checks passed.
+ */
+
+#ifdef LIB_RMS_HOST_TEST
+
+/*	LIB	*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "LIB/RMS/RMS.h"
+
+#define uiMAX_N						1000
+#define uiNUMBER_OF_SAMPLES			200000
+#define uiBENCHMARK_SAMPLES			20000000
+
+/*******************************************************************************
+ * Helping functions:
+ ******************************************************************************/
+static uint32_t uiNumberOfFailures = 0;
+
+static void vCheck(uint8_t ucCondition, const char* pcName, uint32_t uiSample)
+{
+	if (!ucCondition)
+	{
+		if (uiNumberOfFailures < 10)
+			printf("FAILED: %s, sample: %u\n", pcName, uiSample);
+		uiNumberOfFailures++;
+	}
+}
+
+/*	Generates a signal of "uiCount" samples into "psArr"	*/
+static void vGenerate(int16_t* psArr, uint32_t uiCount, uint8_t ucType)
+{
+	double dAmp = 1000 + rand() % 31000;
+	double dPeriod = 20 + rand() % 200;
+
+	for (uint32_t i = 0; i < uiCount; i++)
+	{
+		if (ucType == 0)
+		{
+			/*	Sine with noise	*/
+			double dVal = dAmp * sin(2 * M_PI * i / dPeriod) + (rand() % 201 - 100);
+			if (dVal > 32767)
+				dVal = 32767;
+			if (dVal < -32768)
+				dVal = -32768;
+			psArr[i] = (int16_t)dVal;
+		}
+		else
+		{
+			/*	Full-scale extremes	*/
+			psArr[i] = (rand() & 1) ? 32767 : -32768;
+		}
+	}
+}
+
+/*
+ * Checks sum, float value and integer value of a handle against a reference sum
+ * of squares of a window of "uiN" samples.
+ */
+static void vCheckValue(xLIB_RMS_t* pxHandle, uint64_t ulRefSum, uint32_t uiSample)
+{
+	double dRef = sqrt((double)ulRefSum / pxHandle->uiN);
+	double dVal = fLIB_RMS_getValue(pxHandle);
+
+	uint64_t ulSum = (pxHandle->xWindow == xLIB_RMS_Window_Sliding) ?
+		pxHandle->ulSum : pxHandle->ulLastSum;
+
+	vCheck(ulSum == ulRefSum, "sum of squares", uiSample);
+
+	vCheck(fabs(dVal - dRef) <= 1e-6 * dRef + 1e-3, "float value", uiSample);
+
+	vCheck(usLIB_RMS_getValueInt(pxHandle) == (uint16_t)floor(dRef), "integer value", uiSample);
+}
+
+/*******************************************************************************
+ * Tests:
+ ******************************************************************************/
+static void vTestWindows(int16_t sOffset, uint8_t ucSignalType)
+{
+	static int16_t psArr[uiNUMBER_OF_SAMPLES];
+	static uint32_t puiSquareArr[uiMAX_N];
+	static uint32_t puiSquareArr2[uiMAX_N];
+	static int16_t psInterleavedArr[4 * 97];
+
+	xLIB_RMS_t xSliding, xTumbling, xSlidingBlock, xTumblingBlock;
+	uint32_t uiN = 1 + rand() % uiMAX_N;
+	uint64_t ulRefSum, ulRefTumblingSum = 0;
+	int64_t lDiff;
+
+	vGenerate(psArr, uiNUMBER_OF_SAMPLES, ucSignalType);
+
+	vLIB_RMS_init(&xSliding, xLIB_RMS_Window_Sliding, uiN, puiSquareArr, sOffset);
+	vLIB_RMS_init(&xTumbling, xLIB_RMS_Window_Tumbling, uiN, NULL, sOffset);
+	vLIB_RMS_init(&xSlidingBlock, xLIB_RMS_Window_Sliding, uiN, puiSquareArr2, sOffset);
+	vLIB_RMS_init(&xTumblingBlock, xLIB_RMS_Window_Tumbling, uiN, NULL, sOffset);
+
+	/*	Per-sample updates, against the reference	*/
+	for (uint32_t i = 0; i < uiNUMBER_OF_SAMPLES; i++)
+	{
+		vLIB_RMS_update(&xSliding, psArr[i]);
+		vLIB_RMS_update(&xTumbling, psArr[i]);
+
+		lDiff = (int64_t)psArr[i] - sOffset;
+		ulRefTumblingSum += (uint64_t)(lDiff * lDiff);
+
+		/*	Check every 97 samples (reference sum is O(N))	*/
+		if (i % 97 == 0)
+		{
+			ulRefSum = 0;
+			for (uint32_t j = (i + 1 >= uiN) ? (i + 1 - uiN) : 0; j <= i; j++)
+			{
+				lDiff = (int64_t)psArr[j] - sOffset;
+				ulRefSum += (uint64_t)(lDiff * lDiff);
+			}
+			vCheckValue(&xSliding, ulRefSum, i);
+		}
+
+		if ((i + 1) % uiN == 0)
+		{
+			vCheckValue(&xTumbling, ulRefTumblingSum, i);
+			ulRefTumblingSum = 0;
+		}
+	}
+
+	vCheck(xTumbling.uiNumberOfWindows == uiNUMBER_OF_SAMPLES / uiN, "number of windows", 0);
+
+	/*	Block updates of random lengths and strides, against per-sample ones	*/
+	uint32_t uiPos = 0;
+	while (uiPos < uiNUMBER_OF_SAMPLES)
+	{
+		uint32_t uiCount = 1 + rand() % 97;
+		uint32_t uiStride = 1 + rand() % 4;
+		if (uiCount > uiNUMBER_OF_SAMPLES - uiPos)
+			uiCount = uiNUMBER_OF_SAMPLES - uiPos;
+
+		/*	Interleave with garbage channels	*/
+		for (uint32_t i = 0; i < uiCount * uiStride; i++)
+			psInterleavedArr[i] = (i % uiStride == 0) ? psArr[uiPos + i / uiStride] : rand();
+
+		vLIB_RMS_updateBlock(&xSlidingBlock, psInterleavedArr, uiCount, uiStride);
+		vLIB_RMS_updateBlock(&xTumblingBlock, psInterleavedArr, uiCount, uiStride);
+
+		uiPos += uiCount;
+	}
+
+	vCheck(xSlidingBlock.ulSum == xSliding.ulSum, "sliding block sum", 0);
+	vCheck(xTumblingBlock.ulLastSum == xTumbling.ulLastSum, "tumbling block sum", 0);
+	vCheck(	xTumblingBlock.uiNumberOfWindows == xTumbling.uiNumberOfWindows,
+			"tumbling block windows", 0	);
+}
+
+static void vBenchmark(xLIB_RMS_Window_t xWindow, const char* pcName)
+{
+	static int16_t psArr[1024];
+	static uint32_t puiSquareArr[500];
+	xLIB_RMS_t xHandle;
+	clock_t xStart;
+	double dSec;
+
+	vGenerate(psArr, 1024, 0);
+	vLIB_RMS_init(&xHandle, xWindow, 500, puiSquareArr, 0);
+
+	xStart = clock();
+	for (uint32_t i = 0; i < uiBENCHMARK_SAMPLES / 1024; i++)
+		vLIB_RMS_updateBlock(&xHandle, psArr, 1024, 1);
+	dSec = (double)(clock() - xStart) / CLOCKS_PER_SEC;
+
+	printf(	"%s: %.1f Msamples/s (RMS: %u)\n",
+			pcName, uiBENCHMARK_SAMPLES / dSec / 1e6, usLIB_RMS_getValueInt(&xHandle)	);
+}
+
+/*******************************************************************************
+ * Main:
+ ******************************************************************************/
+int main(void)
+{
+	srand(1);
+
+	for (uint32_t t = 0; t < 10; t++)
+	{
+		vTestWindows(0, 0);
+		vTestWindows(2048, 0);
+		vTestWindows(-32768, 1);
+		vTestWindows(32767, 1);
+	}
+
+	vBenchmark(xLIB_RMS_Window_Sliding, "Sliding ");
+	vBenchmark(xLIB_RMS_Window_Tumbling, "Tumbling");
+
+	if (uiNumberOfFailures)
+	{
+		printf("%u checks FAILED\n", uiNumberOfFailures);
+		return 1;
+	}
+
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif	/*	LIB_RMS_HOST_TEST	*/
@@ -61,6 +61,20 @@ const uint8_t pucPortADCDoesUnitSupportDMA[] = {
 		0
 };
 
+/*	ADC1: DMA1 channel 1. (ADC2 has no DMA request)	*/
+const uint8_t ppucPortADCDmaMapping[][2] = {
+		{0, 0},
+		{0, 0}
+};
+
+/*	Regular sequence ranks, in order	*/
+static const uint32_t puiRankArr[ucPORT_ADC_MAX_SEQUENCE_LENGTH] = {
+		LL_ADC_REG_RANK_1,	LL_ADC_REG_RANK_2,	LL_ADC_REG_RANK_3,	LL_ADC_REG_RANK_4,
+		LL_ADC_REG_RANK_5,	LL_ADC_REG_RANK_6,	LL_ADC_REG_RANK_7,	LL_ADC_REG_RANK_8,
+		LL_ADC_REG_RANK_9,	LL_ADC_REG_RANK_10,	LL_ADC_REG_RANK_11,	LL_ADC_REG_RANK_12,
+		LL_ADC_REG_RANK_13,	LL_ADC_REG_RANK_14,	LL_ADC_REG_RANK_15,	LL_ADC_REG_RANK_16
+};
+
 #ifdef ucPORT_INTERRUPT_IRQ_DEF_ADC
 	void (*ppfPortAdcIsrCallback[2])(void*);
 	void* ppvPortAdcIsrParams[2];
@@ -174,6 +188,37 @@ void vPort_ADC_setConversionMode(uint8_t ucUnitNumber, uint8_t ucMode)
 		LL_ADC_REG_SetContinuousMode(pxPortADCArr[ucUnitNumber], LL_ADC_REG_CONV_SINGLE);
 }
 
+/*
+ * See header for info.
+ */
+void vPort_ADC_setScanSequence(	uint8_t ucUnitNumber,
+								const uint8_t* pucChannelArr,
+								uint8_t ucLength	)
+{
+	ADC_TypeDef* pxAdc = pxPortADCArr[ucUnitNumber];
+
+	vLib_ASSERT(ucLength > 0 && ucLength <= ucPORT_ADC_MAX_SEQUENCE_LENGTH, 0);
+
+	for (uint8_t i = 0; i < ucLength; i++)
+		LL_ADC_REG_SetSequencerRanks(pxAdc, puiRankArr[i], pxPortADCChannelsArr[pucChannelArr[i]]);
+
+	LL_ADC_REG_SetSequencerLength(pxAdc, (uint32_t)(ucLength - 1) << ADC_SQR1_L_Pos);
+
+	LL_ADC_SetSequencersScanMode(pxAdc, LL_ADC_SEQ_SCAN_ENABLE);
+}
+
+/*
+ * See header for info.
+ */
+void vPort_ADC_clearScanSequence(uint8_t ucUnitNumber)
+{
+	ADC_TypeDef* pxAdc = pxPortADCArr[ucUnitNumber];
+
+	LL_ADC_SetSequencersScanMode(pxAdc, LL_ADC_SEQ_SCAN_DISABLE);
+
+	LL_ADC_REG_SetSequencerLength(pxAdc, LL_ADC_REG_SEQ_SCAN_DISABLE);
+}
+
 
 /*******************************************************************************
  * ISRs:
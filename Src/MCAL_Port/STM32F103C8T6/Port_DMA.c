@@ -87,11 +87,25 @@ void vPort_DMA_startTransfer(xPort_DMA_TransInfo_t* pxInfo)
 
 	LL_DMA_SetMemoryIncMode(pxUnitHandle, uiChannelNumber, uiConf);
 
-	/*	Write peripheral data unit size to 1 byte	*/
-	LL_DMA_SetPeriphSize(pxUnitHandle, uiChannelNumber, LL_DMA_PDATAALIGN_BYTE);
+	/*	Write peripheral and memory data unit sizes	*/
+	if (pxInfo->ucDataSize == 0)
+	{
+		LL_DMA_SetPeriphSize(pxUnitHandle, uiChannelNumber, LL_DMA_PDATAALIGN_BYTE);
+		LL_DMA_SetMemorySize(pxUnitHandle, uiChannelNumber, LL_DMA_MDATAALIGN_BYTE);
+	}
+	else
+	{
+		LL_DMA_SetPeriphSize(pxUnitHandle, uiChannelNumber, LL_DMA_PDATAALIGN_HALFWORD);
+		LL_DMA_SetMemorySize(pxUnitHandle, uiChannelNumber, LL_DMA_MDATAALIGN_HALFWORD);
+	}
+
+	/*	Write mode (normal or circular)	*/
+	if (pxInfo->ucCircularMode == 0)
+		uiConf = LL_DMA_MODE_NORMAL;
+	else
+		uiConf = LL_DMA_MODE_CIRCULAR;
 
-	/*	Write memory data unit size	*/
-	LL_DMA_SetMemorySize(pxUnitHandle, uiChannelNumber, LL_DMA_PDATAALIGN_BYTE);
+	LL_DMA_SetMode(pxUnitHandle, uiChannelNumber, uiConf);
 
 	/*	Write priority setting	*/
 	uiConf = pxInfo->ucPriLevel << DMA_CCR_PL_Pos;
@@ -147,95 +161,114 @@ void vPort_DMA_setTransferHalfCompleteCallback(	uint8_t ucUnitNumber,
 
 void DMA1_Channel1_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 0))
+	{
+		ppfPortDmaTHCCallbackArr[0][0](ppvPortDmaTHCCallbackParamsArr[0][0]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 0);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 0))
 	{
 		ppfPortDmaTCCallbackArr[0][0](ppvPortDmaTCCallbackParamsArr[0][0]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 0);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 0))
-	{
-		ppfPortDmaTHCCallbackArr[0][0](ppvPortDmaTCCallbackParamsArr[0][0]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 0);
-	}
 }
 
 void DMA1_Channel2_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 1))
+	{
+		ppfPortDmaTHCCallbackArr[0][1](ppvPortDmaTHCCallbackParamsArr[0][1]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 1);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 1))
 	{
 		ppfPortDmaTCCallbackArr[0][1](ppvPortDmaTCCallbackParamsArr[0][1]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 1);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 1))
-	{
-		ppfPortDmaTHCCallbackArr[0][1](ppvPortDmaTCCallbackParamsArr[0][1]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 1);
-	}
 }
+
 void DMA1_Channel3_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 2))
+	{
+		ppfPortDmaTHCCallbackArr[0][2](ppvPortDmaTHCCallbackParamsArr[0][2]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 2);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 2))
 	{
 		ppfPortDmaTCCallbackArr[0][2](ppvPortDmaTCCallbackParamsArr[0][2]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 2);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 2))
-	{
-		ppfPortDmaTHCCallbackArr[0][2](ppvPortDmaTCCallbackParamsArr[0][2]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 2);
-	}
 }
+
 void DMA1_Channel4_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 3))
+	{
+		ppfPortDmaTHCCallbackArr[0][3](ppvPortDmaTHCCallbackParamsArr[0][3]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 3);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 3))
 	{
 		ppfPortDmaTCCallbackArr[0][3](ppvPortDmaTCCallbackParamsArr[0][3]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 3);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 3))
-	{
-		ppfPortDmaTHCCallbackArr[0][3](ppvPortDmaTCCallbackParamsArr[0][3]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 3);
-	}
 }
+
 void DMA1_Channel5_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 4))
+	{
+		ppfPortDmaTHCCallbackArr[0][4](ppvPortDmaTHCCallbackParamsArr[0][4]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 4);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 4))
 	{
 		ppfPortDmaTCCallbackArr[0][4](ppvPortDmaTCCallbackParamsArr[0][4]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 4);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 4))
-	{
-		ppfPortDmaTHCCallbackArr[0][4](ppvPortDmaTCCallbackParamsArr[0][4]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 4);
-	}
 }
+
 void DMA1_Channel6_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 5))
+	{
+		ppfPortDmaTHCCallbackArr[0][5](ppvPortDmaTHCCallbackParamsArr[0][5]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 5);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 5))
 	{
 		ppfPortDmaTCCallbackArr[0][5](ppvPortDmaTCCallbackParamsArr[0][5]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 5);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 5))
-	{
-		ppfPortDmaTHCCallbackArr[0][5](ppvPortDmaTCCallbackParamsArr[0][5]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 5);
-	}
 }
+
 void DMA1_Channel7_IRQHandler(void)
 {
+	/*	Half transfer is handled first, as it happens first in a cycle	*/
+	if (ucPort_DMA_GET_THC_FLAG(0, 6))
+	{
+		ppfPortDmaTHCCallbackArr[0][6](ppvPortDmaTHCCallbackParamsArr[0][6]);
+		vPort_DMA_CLEAR_THC_FLAG(0, 6);
+	}
+
 	if (ucPort_DMA_GET_TC_FLAG(0, 6))
 	{
 		ppfPortDmaTCCallbackArr[0][6](ppvPortDmaTCCallbackParamsArr[0][6]);
 		vPort_DMA_CLEAR_TC_FLAG(0, 6);
 	}
-	else if (ucPort_DMA_GET_THC_FLAG(0, 6))
-	{
-		ppfPortDmaTHCCallbackArr[0][6](ppvPortDmaTCCallbackParamsArr[0][6]);
-		vPort_DMA_CLEAR_THC_FLAG(0, 6);
-	}
 }
 
 #endif
@@ -14,9 +14,44 @@
 #include "stm32f1xx_hal.h"
 
 #include "MCAL_Port/Port_I2C.h"
+#include "MCAL_Port/Port_Interrupt.h"
 
 I2C_TypeDef* const pxPortI2cArr[] = {I2C1, I2C2};
 
+/*******************************************************************************
+ * Callbacks.
+ ******************************************************************************/
+#ifdef ucPORT_INTERRUPT_IRQ_DEF_I2C
+
+void (*ppfPortI2cEventCallbackArr[portI2C_NUMBER_OF_UNITS])(void*);
+void* ppvPortI2cEventCallbackParamsArr[portI2C_NUMBER_OF_UNITS];
+
+void (*ppfPortI2cErrorCallbackArr[portI2C_NUMBER_OF_UNITS])(void*);
+void* ppvPortI2cErrorCallbackParamsArr[portI2C_NUMBER_OF_UNITS];
+
+void I2C1_EV_IRQHandler(void)
+{
+	ppfPortI2cEventCallbackArr[0](ppvPortI2cEventCallbackParamsArr[0]);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	ppfPortI2cErrorCallbackArr[0](ppvPortI2cErrorCallbackParamsArr[0]);
+}
+
+void I2C2_EV_IRQHandler(void)
+{
+	ppfPortI2cEventCallbackArr[1](ppvPortI2cEventCallbackParamsArr[1]);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+	ppfPortI2cErrorCallbackArr[1](ppvPortI2cErrorCallbackParamsArr[1]);
+}
+
+#endif	/*	ucPORT_INTERRUPT_IRQ_DEF_I2C	*/
+
+
 
 void vPort_I2C_initHardware(uint8_t ucUnitNumber, xPort_I2C_HW_Conf_t* pxConf)
 {
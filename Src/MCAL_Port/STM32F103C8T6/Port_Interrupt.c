@@ -46,6 +46,10 @@ const IRQn_Type xPortInterruptPwrPvdIrqNumber = PVD_IRQn;
 
 const IRQn_Type pxPortInterruptAdcEocIrqNumberArr[] = {ADC1_2_IRQn, ADC1_2_IRQn};
 
+const IRQn_Type pxPortInterruptI2cEventIrqNumberArr[] = {I2C1_EV_IRQn, I2C2_EV_IRQn};
+
+const IRQn_Type pxPortInterruptI2cErrorIrqNumberArr[] = {I2C1_ER_IRQn, I2C2_ER_IRQn};
+
 
 
 
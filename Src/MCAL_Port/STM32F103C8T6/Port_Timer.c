@@ -240,6 +240,42 @@ void vPort_TIM_enableTriggerOutput(uint8_t ucUnitNumber)
 	LL_TIM_SetTriggerOutput(pxPortTimArr[ucUnitNumber], LL_TIM_TRGO_UPDATE);
 }
 
+void vPort_TIM_initPwmInput(uint8_t ucUnitNumber, uint32_t uiPrescaler)
+{
+	TIM_TypeDef* pxTim = pxPortTimArr[ucUnitNumber];
+
+	LL_TIM_DisableCounter(pxTim);
+
+	LL_TIM_SetClockSource(pxTim, LL_TIM_CLOCKSOURCE_INTERNAL);
+	LL_TIM_SetPrescaler(pxTim, uiPrescaler - 1);
+	LL_TIM_SetCounterMode(pxTim, LL_TIM_COUNTERMODE_UP);
+	LL_TIM_SetAutoReload(pxTim, (1ul << pucPortTimerCounterSizeInBits[ucUnitNumber]) - 1);
+
+	/*	IC1: TI1 rising edge (period), IC2: TI1 falling edge (active time)	*/
+	LL_TIM_IC_Config(	pxTim,
+						LL_TIM_CHANNEL_CH1,
+						LL_TIM_ACTIVEINPUT_DIRECTTI | LL_TIM_ICPSC_DIV1 |
+						LL_TIM_IC_FILTER_FDIV1 | LL_TIM_IC_POLARITY_RISING	);
+
+	LL_TIM_IC_Config(	pxTim,
+						LL_TIM_CHANNEL_CH2,
+						LL_TIM_ACTIVEINPUT_INDIRECTTI | LL_TIM_ICPSC_DIV1 |
+						LL_TIM_IC_FILTER_FDIV1 | LL_TIM_IC_POLARITY_FALLING	);
+
+	/*	Reset counter on every rising edge	*/
+	LL_TIM_SetTriggerInput(pxTim, LL_TIM_TS_TI1FP1);
+	LL_TIM_SetSlaveMode(pxTim, LL_TIM_SLAVEMODE_RESET);
+
+	/*	Update event only on overflow, not on slave mode reset	*/
+	LL_TIM_SetUpdateSource(pxTim, LL_TIM_UPDATESOURCE_COUNTER);
+
+	LL_TIM_CC_EnableChannel(pxTim, LL_TIM_CHANNEL_CH1 | LL_TIM_CHANNEL_CH2);
+
+	LL_TIM_SetCounter(pxTim, 0);
+	LL_TIM_ClearFlag_UPDATE(pxTim);
+	LL_TIM_ClearFlag_CC1(pxTim);
+}
+
 
 /*******************************************************************************
  * ISRs:
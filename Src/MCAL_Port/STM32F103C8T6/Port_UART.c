@@ -28,6 +28,33 @@ uint32_t puiPortUartPeriphClockArr[] = {uiPORT_CLOCK_MAIN_HZ, uiPORT_CLOCK_MAIN_
  ******************************************************************************/
 #include "MCAL_Port/Port_UART.h"
 
+/*******************************************************************************
+ * DMA mapping.
+ *
+ * Notes:
+ * 		-	The following arrays define mapping of i-th UART unit's TxE and RxNE
+ * 			signals, with DMA channels such that:
+ * 			ppucPortUartTxeDmaMapping[i] = {DmaUnitNumber, DmaChannelNumber}
+ * 			ppucPortUartRxneDmaMapping[i] = {DmaUnitNumber, DmaChannelNumber}
+ *
+ * 		-	If the used target has Static UART/DMA connection, define these
+ * 			connections in the following array.
+ *
+ * 		-	Otherwise, if UART/DMA connections are dynamic, or there's no DMA in
+ * 			the used target, leave this array empty.
+ ******************************************************************************/
+const uint8_t ppucPortUartTxeDmaMapping[portUART_NUMBER_OF_UNITS][2] = {
+	{0, 3},
+	{0, 6},
+	{0, 1}
+};
+
+const uint8_t ppucPortUartRxneDmaMapping[portUART_NUMBER_OF_UNITS][2] = {
+	{0, 4},
+	{0, 5},
+	{0, 2}
+};
+
 
 #ifdef ucPORT_INTERRUPT_IRQ_DEF_UART
 
@@ -40,6 +67,9 @@ void* ppvPortUartRxneCallbackParamsArr[portUART_NUMBER_OF_UNITS];
 void (*ppfPortUartTcCallbackArr[portUART_NUMBER_OF_UNITS])(void*);
 void* ppvPortUartTcCallbackParamsArr[portUART_NUMBER_OF_UNITS];
 
+void (*ppfPortUartIdleCallbackArr[portUART_NUMBER_OF_UNITS])(void*);
+void* ppvPortUartIdleCallbackParamsArr[portUART_NUMBER_OF_UNITS];
+
 void USART1_IRQHandler(void)
 {
 #define ucUNIT_NUMBER		0
@@ -55,6 +85,13 @@ void USART1_IRQHandler(void)
 		vPORT_UART_CLEAR_RXNE_FLAG(ucUNIT_NUMBER);
 	}
 
+	/*	Checked after RxNE, as clearing IDLE flag reads the data register	*/
+	else if (ucPORT_UART_GET_IDLE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_IDLE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
+	{
+		vPORT_UART_CLEAR_IDLE_FLAG(ucUNIT_NUMBER);
+		ppfPortUartIdleCallbackArr[ucUNIT_NUMBER](ppvPortUartIdleCallbackParamsArr[ucUNIT_NUMBER]);
+	}
+
 	else if (ucPORT_UART_GET_TXE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_TXE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
 	{
 		ppfPortUartTxeCallbackArr[ucUNIT_NUMBER](ppvPortUartTxeCallbackParamsArr[ucUNIT_NUMBER]);
@@ -87,6 +124,13 @@ void USART2_IRQHandler(void)
 		vPORT_UART_CLEAR_RXNE_FLAG(ucUNIT_NUMBER);
 	}
 
+	/*	Checked after RxNE, as clearing IDLE flag reads the data register	*/
+	else if (ucPORT_UART_GET_IDLE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_IDLE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
+	{
+		vPORT_UART_CLEAR_IDLE_FLAG(ucUNIT_NUMBER);
+		ppfPortUartIdleCallbackArr[ucUNIT_NUMBER](ppvPortUartIdleCallbackParamsArr[ucUNIT_NUMBER]);
+	}
+
 	else if (ucPORT_UART_GET_TXE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_TXE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
 	{
 		ppfPortUartTxeCallbackArr[ucUNIT_NUMBER](ppvPortUartTxeCallbackParamsArr[ucUNIT_NUMBER]);
@@ -119,6 +163,13 @@ void USART3_IRQHandler(void)
 		vPORT_UART_CLEAR_RXNE_FLAG(ucUNIT_NUMBER);
 	}
 
+	/*	Checked after RxNE, as clearing IDLE flag reads the data register	*/
+	else if (ucPORT_UART_GET_IDLE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_IDLE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
+	{
+		vPORT_UART_CLEAR_IDLE_FLAG(ucUNIT_NUMBER);
+		ppfPortUartIdleCallbackArr[ucUNIT_NUMBER](ppvPortUartIdleCallbackParamsArr[ucUNIT_NUMBER]);
+	}
+
 	else if (ucPORT_UART_GET_TXE_FLAG(ucUNIT_NUMBER) && ucPORT_UART_IS_TXE_INTERRUPT_ENABLED(ucUNIT_NUMBER))
 	{
 		ppfPortUartTxeCallbackArr[ucUNIT_NUMBER](ppvPortUartTxeCallbackParamsArr[ucUNIT_NUMBER]);
@@ -52,6 +52,31 @@ const uint32_t pxPortADCChannelsArr[] = {
 		LL_ADC_CHANNEL_18
 };
 
+const uint8_t pucPortADCTriggeringTimerUnitNumber[] = {
+		2
+};
+
+const uint8_t pucPortADCDoesUnitSupportDMA[] = {
+		1
+};
+
+/*
+ * ADC1 is on DMA2 stream 0 (channel 0) of this target. The DMA port still has
+ * the STM32F1 layout (and "portDMA_IS_AVAILABLE" is 0), so it mirrors the
+ * STM32F103C8T6 mapping until the DMA port is written for this target.
+ */
+const uint8_t ppucPortADCDmaMapping[][2] = {
+		{0, 0}
+};
+
+/*	Regular sequence ranks, in order	*/
+static const uint32_t puiRankArr[ucPORT_ADC_MAX_SEQUENCE_LENGTH] = {
+		LL_ADC_REG_RANK_1,	LL_ADC_REG_RANK_2,	LL_ADC_REG_RANK_3,	LL_ADC_REG_RANK_4,
+		LL_ADC_REG_RANK_5,	LL_ADC_REG_RANK_6,	LL_ADC_REG_RANK_7,	LL_ADC_REG_RANK_8,
+		LL_ADC_REG_RANK_9,	LL_ADC_REG_RANK_10,	LL_ADC_REG_RANK_11,	LL_ADC_REG_RANK_12,
+		LL_ADC_REG_RANK_13,	LL_ADC_REG_RANK_14,	LL_ADC_REG_RANK_15,	LL_ADC_REG_RANK_16
+};
+
 #ifdef ucPORT_INTERRUPT_IRQ_DEF_ADC
 	void (*ppfPortAdcIsrCallback[1])(void*);
 	void* ppvPortAdcIsrParams[1];
@@ -65,7 +90,11 @@ const uint32_t pxPortADCChannelsArr[] = {
 /*******************************************************************************
  * Static (private) functions:
  ******************************************************************************/
-void vADC_selectChannel(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+/*
+ * Connects internal channels' paths, and returns LL channel of a channel
+ * number (temperature sensor shares ADC1_IN18 with backup battery).
+ */
+static uint32_t uiGetChannel(uint8_t ucChannelNumber)
 {
 	if (ucChannelNumber == ucPORT_ADC_BKP_BAT_CH_NUMBER)
 	{
@@ -83,10 +112,15 @@ void vADC_selectChannel(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
 		ucChannelNumber = 18;
 	}
 
+	return pxPortADCChannelsArr[ucChannelNumber];
+}
+
+void vADC_selectChannel(uint8_t ucUnitNumber, uint8_t ucChannelNumber)
+{
 	LL_ADC_REG_SetSequencerRanks(
 			pxPortADCArr[(ucUnitNumber)],
 			LL_ADC_REG_RANK_1,
-			pxPortADCChannelsArr[(ucChannelNumber)]	);
+			uiGetChannel(ucChannelNumber)	);
 }
 
 /*******************************************************************************
@@ -164,6 +198,20 @@ void vPort_ADC_setInterruptCallback(	uint8_t ucUnitNumber,
 	ppvPortAdcIsrParams[ucUnitNumber] = pvParams;
 }
 
+void vPort_ADC_setTriggerSource(uint8_t ucUnitNumber, uint8_t ucSrc)
+{
+	if (ucSrc == 0)
+	{
+		LL_ADC_REG_SetTriggerSource(pxPortADCArr[ucUnitNumber], LL_ADC_REG_TRIG_SOFTWARE);
+		LL_ADC_REG_StartConversionSWStart(pxPortADCArr[ucUnitNumber]);
+	}
+	else
+	{
+		LL_ADC_REG_SetTriggerSource(pxPortADCArr[ucUnitNumber], LL_ADC_REG_TRIG_EXT_TIM3_TRGO);
+		LL_ADC_REG_StartConversionExtTrig(pxPortADCArr[ucUnitNumber], LL_ADC_REG_TRIG_EXT_RISING);
+	}
+}
+
 void vPort_ADC_setConversionMode(uint8_t ucUnitNumber, uint8_t ucMode)
 {
 	if (ucMode == 0)
@@ -172,6 +220,37 @@ void vPort_ADC_setConversionMode(uint8_t ucUnitNumber, uint8_t ucMode)
 		LL_ADC_REG_SetContinuousMode(pxPortADCArr[ucUnitNumber], LL_ADC_REG_CONV_SINGLE);
 }
 
+/*
+ * See header for info.
+ */
+void vPort_ADC_setScanSequence(	uint8_t ucUnitNumber,
+								const uint8_t* pucChannelArr,
+								uint8_t ucLength	)
+{
+	ADC_TypeDef* pxAdc = pxPortADCArr[ucUnitNumber];
+
+	vLib_ASSERT(ucLength > 0 && ucLength <= ucPORT_ADC_MAX_SEQUENCE_LENGTH, 0);
+
+	for (uint8_t i = 0; i < ucLength; i++)
+		LL_ADC_REG_SetSequencerRanks(pxAdc, puiRankArr[i], uiGetChannel(pucChannelArr[i]));
+
+	LL_ADC_REG_SetSequencerLength(pxAdc, (uint32_t)(ucLength - 1) << ADC_SQR1_L_Pos);
+
+	LL_ADC_SetSequencersScanMode(pxAdc, LL_ADC_SEQ_SCAN_ENABLE);
+}
+
+/*
+ * See header for info.
+ */
+void vPort_ADC_clearScanSequence(uint8_t ucUnitNumber)
+{
+	ADC_TypeDef* pxAdc = pxPortADCArr[ucUnitNumber];
+
+	LL_ADC_SetSequencersScanMode(pxAdc, LL_ADC_SEQ_SCAN_DISABLE);
+
+	LL_ADC_REG_SetSequencerLength(pxAdc, LL_ADC_REG_SEQ_SCAN_DISABLE);
+}
+
 
 /*******************************************************************************
  * ISRs:
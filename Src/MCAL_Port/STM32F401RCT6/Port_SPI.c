@@ -34,9 +34,9 @@ void* ppvPortSpiRxneCallbackParamsArr[portSPI_NUMBER_OF_UNITS];
  * DMA mapping.
  *
  * Notes:
- * 		-	The following array defines mapping of i-th SPI unit's transfer
- * 			complete signal, with a DMA channel such that:
- * 			pxPortSpiDmaMapping[i] = {DmaUnitNumber, DmaChannelNumber}
+ * 		-	The following arrays define mapping of i-th SPI unit's TxE and
+ * 			RxNE signals, with a DMA channel such that:
+ * 			ppucPortSpiXxxDmaMapping[i] = {DmaUnitNumber, DmaChannelNumber}
  *
  * 		-	If the used target has Static SPI/DMA connection, define these
  * 			connections in the following array.
@@ -49,6 +49,11 @@ const uint8_t ppucPortSpiTxeDmaMapping[portSPI_NUMBER_OF_UNITS][2] = {
 	{0, 4}
 };
 
+const uint8_t ppucPortSpiRxneDmaMapping[portSPI_NUMBER_OF_UNITS][2] = {
+	{0, 1},
+	{0, 3}
+};
+
 /*******************************************************************************
  * ISRs:
  *
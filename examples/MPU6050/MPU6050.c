@@ -116,6 +116,9 @@ void tasks_init(void)
  ******************************************************************************/
 void obj_init(void)
 {
+	/*	I2C driver (before any I2C device)	*/
+	vHOS_I2C_init();
+
 	/*	MPU	*/
 	xMPU.ucI2CUnitNumber = 0;
 	xMPU.ucAdd0State = 0;